@@ -60,8 +60,12 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     // Flag to postprocess old gnss records (older than 2009) and avoid wrong week rollover
     pvt_output_parameters.pre_2009_file = configuration->property("GNSS-SDR.pre_2009_file", false);
 
+    // interval of the observable epochs received from the Observables block
+    const int32_t observable_interval_ms = configuration->property("GNSS-SDR.observable_interval_ms", pvt_output_parameters.observable_interval_ms);
+    pvt_output_parameters.observable_interval_ms = bc::lcm(observable_interval_ms, configuration->property("GNSS-SDR.pvt_observable_interval_ms", observable_interval_ms));
+
     // output rate
-    pvt_output_parameters.output_rate_ms = bc::lcm(20, configuration->property(role + ".output_rate_ms", 500));
+    pvt_output_parameters.output_rate_ms = bc::lcm(pvt_output_parameters.observable_interval_ms, configuration->property(role + ".output_rate_ms", 500));
 
     // display rate
     pvt_output_parameters.display_rate_ms = bc::lcm(pvt_output_parameters.output_rate_ms, configuration->property(role + ".display_rate_ms", 500));
@@ -103,6 +107,21 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
         {
             pvt_output_parameters.rinex_name = FLAGS_RINEX_name;
         }
+    // Start new RINEX files every hour or every day of UTC time, instead of a single file per run
+    const std::string default_rinex_rotation("none");
+    const std::string rinex_rotation = configuration->property(role + ".rinex_rotation", default_rinex_rotation);
+    if (rinex_rotation == "hourly")
+        {
+            pvt_output_parameters.rinex_rotation_s = 3600;
+        }
+    else if (rinex_rotation == "daily")
+        {
+            pvt_output_parameters.rinex_rotation_s = 86400;
+        }
+    else if (rinex_rotation != "none")
+        {
+            LOG(WARNING) << "Unknown " << role << ".rinex_rotation " << rinex_rotation << ", using none";
+        }
 
     // RTCM Printer settings
     pvt_output_parameters.flag_rtcm_tty_port = configuration->property(role + ".flag_rtcm_tty_port", false);
@@ -140,6 +159,23 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.geojson_rate_ms = bc::lcm(configuration->property(role + ".geojson_rate_ms", pvt_output_parameters.geojson_rate_ms), pvt_output_parameters.output_rate_ms);
     pvt_output_parameters.nmea_rate_ms = bc::lcm(configuration->property(role + ".nmea_rate_ms", pvt_output_parameters.nmea_rate_ms), pvt_output_parameters.output_rate_ms);
 
+    // Output stage of the position printers: queue depth (0 to print in the PVT thread), policy when full and worker threads
+    pvt_output_parameters.output_queue_depth = configuration->property(role + ".output_queue_depth", pvt_output_parameters.output_queue_depth);
+    const std::string default_output_queue_policy("block");
+    const std::string output_queue_policy = configuration->property(role + ".output_queue_policy", default_output_queue_policy);
+    if (output_queue_policy == "drop")
+        {
+            pvt_output_parameters.output_queue_drop_when_full = true;
+        }
+    else if (output_queue_policy != "block")
+        {
+            LOG(WARNING) << "Unknown " << role << ".output_queue_policy " << output_queue_policy << ", using block";
+        }
+    pvt_output_parameters.output_workers = configuration->property(role + ".output_workers", pvt_output_parameters.output_workers);
+
+    // Queue of epochs of the user solver, when it is not the one steering the receiver clock (0 to solve in the PVT thread)
+    pvt_output_parameters.user_solver_queue_depth = configuration->property(role + ".user_solver_queue_depth", pvt_output_parameters.user_solver_queue_depth);
+
     // Infer the type of receiver
     /*
      *   TYPE  |  RECEIVER
@@ -33,6 +33,7 @@
 #include "glonass_gnav_almanac.h"
 #include "glonass_gnav_ephemeris.h"
 #include "glonass_gnav_utc_model.h"
+#include "gnss_assistance_store.h"
 #include "gnss_frequencies.h"
 #include "gnss_sdr_create_directory.h"
 #include "gnss_sdr_make_unique.h"
@@ -49,6 +50,7 @@
 #include "monitor_pvt_udp_sink.h"
 #include "nmea_printer.h"
 #include "pvt_conf.h"
+#include "pvt_output_stage.h"
 #include "rinex_printer.h"
 #include "rtcm_printer.h"
 #include "rtklib_solver.h"
@@ -74,6 +76,7 @@
 #include <stdexcept>                    // for length_error
 #include <sys/ipc.h>                    // for IPC_CREAT
 #include <sys/msg.h>                    // for msgctl
+#include <typeinfo>                     // for typeid
 #include <utility>                      // for pair
 
 #if HAS_GENERIC_LAMBDA
@@ -141,9 +144,13 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
 
     d_initial_carrier_phase_offset_estimation_rads = std::vector<double>(nchannels, 0.0);
     d_channel_initialized = std::vector<bool>(nchannels, false);
+    d_gnss_observables.reset(nchannels);
+    d_gnss_observables_t0.reset(nchannels);
+    d_gnss_observables_t1.reset(nchannels);
 
     d_max_obs_block_rx_clock_offset_ms = conf_.max_obs_block_rx_clock_offset_ms;
 
+    d_observable_interval_ms = conf_.observable_interval_ms;
     d_output_rate_ms = conf_.output_rate_ms;
     d_display_rate_ms = conf_.display_rate_ms;
     d_report_rate_ms = 1000;  // report every second PVT to gnss_synchro
@@ -188,7 +195,11 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
 
     d_type_of_rx = conf_.type_of_receiver;
 
-    // GPS Ephemeris data message port in
+    // Telemetry data message port in, dispatched on the type of the received object
+    register_gps_telemetry_handlers();
+    register_galileo_telemetry_handlers();
+    register_glonass_telemetry_handlers();
+    register_beidou_telemetry_handlers();
     this->message_port_register_in(pmt::mp("telemetry"));
     this->set_msg_handler(pmt::mp("telemetry"),
 #if HAS_GENERIC_LAMBDA
@@ -363,6 +374,8 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_rp = nullptr;
         }
     d_rinexobs_rate_ms = conf_.rinexobs_rate_ms;
+    d_rinex_rotation_s = conf_.rinex_rotation_s;
+    d_rinex_period = 0;
 
     // XML printer
     d_xml_storage = conf_.xml_output_enabled;
@@ -399,6 +412,14 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
                 }
 
             d_xml_base_path = d_xml_base_path + fs::path::preferred_separator;
+
+            // the navigation data is also written as it arrives to a binary store, read at the next start
+            d_assistance_store = std::make_unique<Gnss_Assistance_Store>(d_xml_base_path + "gnss_assistance.dat");
+            if (!d_assistance_store->open())
+                {
+                    std::cout << "The GNSS assistance store " << d_assistance_store->filename() << " cannot be written." << std::endl;
+                    d_assistance_store = nullptr;
+                }
         }
 
     d_rx_time = 0.0;
@@ -420,6 +441,12 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_udp_sink_ptr = nullptr;
         }
 
+    // Position printers run in the output stage, if enabled
+    if (conf_.output_queue_depth > 0 and (d_kml_output_enabled or d_gpx_output_enabled or d_geojson_output_enabled or d_nmea_output_file_enabled))
+        {
+            d_output_stage = std::make_unique<Pvt_Output_Stage>(conf_.output_queue_depth, conf_.output_queue_drop_when_full, conf_.output_workers);
+        }
+
     // Create Sys V message queue
     d_first_fix = true;
     d_sysv_msg_key = 1101;
@@ -495,6 +522,23 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_user_pvt_solver = d_internal_pvt_solver;
         }
 
+    // With two solvers, the user solver runs in its own stage, if enabled. The
+    // epochs are handed over in a ring with room for those waiting in the
+    // queue, the one being solved and the one being filled by work().
+    uint32_t user_epochs = 1;
+    if (d_enable_rx_clock_correction == true and conf_.user_solver_queue_depth > 0)
+        {
+            d_user_solver_stage = std::make_unique<Pvt_Output_Stage>(conf_.user_solver_queue_depth, false);
+            user_epochs = conf_.user_solver_queue_depth + 2;
+        }
+    d_user_epochs = std::vector<User_Pvt_Epoch>(user_epochs);
+    for (auto& user_epoch : d_user_epochs)
+        {
+            user_epoch.valid_pseudoranges.reset(nchannels);
+            user_epoch.observables.reset(nchannels);
+        }
+    d_user_epoch_index = 0;
+
     d_start = std::chrono::system_clock::now();
 }
 
@@ -502,6 +546,9 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
 rtklib_pvt_gs::~rtklib_pvt_gs()
 {
     DLOG(INFO) << "PVT block destructor called.";
+    // run the pending epochs of the user solver, and then the output tasks they posted, before the printers are destroyed
+    d_user_solver_stage.reset();
+    d_output_stage.reset();
     if (d_sysv_msqid != -1)
         {
             msgctl(d_sysv_msqid, IPC_RMID, nullptr);
@@ -1054,586 +1101,732 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
 {
     try
         {
-            // ************* GPS telemetry *****************
-            if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Gps_Ephemeris>))
+            const auto handler = d_telemetry_handlers.find(std::type_index(pmt::any_ref(msg).type()));
+            if (handler != d_telemetry_handlers.cend())
                 {
-                    // ### GPS EPHEMERIS ###
-                    std::shared_ptr<Gps_Ephemeris> gps_eph;
-                    gps_eph = boost::any_cast<std::shared_ptr<Gps_Ephemeris>>(pmt::any_ref(msg));
-                    DLOG(INFO) << "Ephemeris record has arrived from SAT ID "
-                               << gps_eph->i_satellite_PRN << " (Block "
-                               << gps_eph->satelliteBlock[gps_eph->i_satellite_PRN] << ")"
-                               << "inserted with Toe=" << gps_eph->d_Toe << " and GPS Week="
-                               << gps_eph->i_GPS_week;
-                    // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
-                        {
-                            bool new_annotation = false;
-                            if (d_internal_pvt_solver->gps_ephemeris_map.find(gps_eph->i_satellite_PRN) == d_internal_pvt_solver->gps_ephemeris_map.cend())
-                                {
-                                    new_annotation = true;
-                                }
-                            else
-                                {
-                                    if (d_internal_pvt_solver->gps_ephemeris_map[gps_eph->i_satellite_PRN].d_Toe != gps_eph->d_Toe)
-                                        {
-                                            new_annotation = true;
-                                        }
-                                }
-                            if (new_annotation == true)
-                                {
-                                    // New record!
-                                    std::map<int32_t, Gps_Ephemeris> new_eph;
-                                    std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
-                                    std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
-                                    new_eph[gps_eph->i_satellite_PRN] = *gps_eph;
-                                    switch (d_type_of_rx)
-                                        {
-                                        case 1:  // GPS L1 C/A only
-                                            d_rp->log_rinex_nav(d_rp->navFile, new_eph);
-                                            break;
-                                        case 8:  // L1+L5
-                                            d_rp->log_rinex_nav(d_rp->navFile, new_eph);
-                                            break;
-                                        case 9:  // GPS L1 C/A + Galileo E1B
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 10:  // GPS L1 C/A + Galileo E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 11:  // GPS L1 C/A + Galileo E5b
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 26:  // GPS L1 C/A + GLONASS L1 C/A
-                                            if (d_rinex_version == 3)
-                                                {
-                                                    d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_glo_eph);
-                                                }
-                                            if (d_rinex_version == 2)
-                                                {
-                                                    d_rp->log_rinex_nav(d_rp->navFile, new_glo_eph);
-                                                }
-                                            break;
-                                        case 29:  // GPS L1 C/A + GLONASS L2 C/A
-                                            if (d_rinex_version == 3)
-                                                {
-                                                    d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_glo_eph);
-                                                }
-                                            if (d_rinex_version == 2)
-                                                {
-                                                    d_rp->log_rinex_nav(d_rp->navFile, new_eph);
-                                                }
-                                            break;
-                                        case 32:  // L1+E1+L5+E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 33:  // L1+E1+E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 1000:  // L1+L2+L5
-                                            d_rp->log_rinex_nav(d_rp->navFile, new_eph);
-                                            break;
-                                        case 1001:  // L1+E1+L2+L5+E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        default:
-                                            break;
-                                        }
-                                }
-                        }
-                    d_internal_pvt_solver->gps_ephemeris_map[gps_eph->i_satellite_PRN] = *gps_eph;
-                    if (d_enable_rx_clock_correction == true)
-                        {
-                            d_user_pvt_solver->gps_ephemeris_map[gps_eph->i_satellite_PRN] = *gps_eph;
-                        }
+                    handler->second(msg);
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Gps_Iono>))
+            else
                 {
-                    // ### GPS IONO ###
-                    std::shared_ptr<Gps_Iono> gps_iono;
-                    gps_iono = boost::any_cast<std::shared_ptr<Gps_Iono>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->gps_iono = *gps_iono;
-                    if (d_enable_rx_clock_correction == true)
-                        {
-                            d_user_pvt_solver->gps_iono = *gps_iono;
-                        }
-                    DLOG(INFO) << "New IONO record has arrived ";
+                    LOG(WARNING) << "msg_handler_telemetry unknown object type!";
+                }
+        }
+    catch (boost::bad_any_cast& e)
+        {
+            LOG(WARNING) << "msg_handler_telemetry Bad any cast!";
+        }
+}
+
+
+template <typename T>
+void rtklib_pvt_gs::add_telemetry_handler(void (rtklib_pvt_gs::*handler)(const T&))
+{
+    d_telemetry_handlers[std::type_index(typeid(std::shared_ptr<T>))] = [this, handler](const pmt::pmt_t& msg) {
+        (this->*handler)(*boost::any_cast<const std::shared_ptr<T>&>(pmt::any_ref(msg)));
+    };
+}
+
+
+void rtklib_pvt_gs::register_gps_telemetry_handlers()
+{
+    add_telemetry_handler(&rtklib_pvt_gs::handle_gps_ephemeris);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_gps_iono);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_gps_utc_model);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_gps_cnav_ephemeris);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_gps_cnav_iono);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_gps_cnav_utc_model);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_gps_almanac);
+}
+
+
+void rtklib_pvt_gs::register_galileo_telemetry_handlers()
+{
+    add_telemetry_handler(&rtklib_pvt_gs::handle_galileo_ephemeris);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_galileo_iono);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_galileo_utc_model);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_galileo_almanac_helper);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_galileo_almanac);
+}
+
+
+void rtklib_pvt_gs::register_glonass_telemetry_handlers()
+{
+    add_telemetry_handler(&rtklib_pvt_gs::handle_glonass_gnav_ephemeris);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_glonass_gnav_utc_model);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_glonass_gnav_almanac);
+}
+
+
+void rtklib_pvt_gs::register_beidou_telemetry_handlers()
+{
+    add_telemetry_handler(&rtklib_pvt_gs::handle_beidou_dnav_ephemeris);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_beidou_dnav_iono);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_beidou_dnav_utc_model);
+    add_telemetry_handler(&rtklib_pvt_gs::handle_beidou_dnav_almanac);
+}
+
+
+template <typename T>
+void rtklib_pvt_gs::save_assistance(const T& record, uint32_t key)
+{
+    if (d_assistance_store)
+        {
+            d_assistance_store->save(record, key);
+        }
+}
+
+
+void rtklib_pvt_gs::handle_gps_ephemeris(const Gps_Ephemeris& gps_eph)
+{
+    const auto sat_block = gps_eph.satelliteBlock.find(gps_eph.i_satellite_PRN);
+    DLOG(INFO) << "Ephemeris record has arrived from SAT ID "
+               << gps_eph.i_satellite_PRN << " (Block "
+               << (sat_block != gps_eph.satelliteBlock.cend() ? sat_block->second : std::string()) << ")"
+               << "inserted with Toe=" << gps_eph.d_Toe << " and GPS Week="
+               << gps_eph.i_GPS_week;
+    // logged and passed to the user solver in its stage, in order with the observation epochs
+    run_in_user_solver_stage([this, gps_eph]() { update_user_solver(gps_eph); });
+    // update/insert new ephemeris record to the global ephemeris map
+    d_internal_pvt_solver->gps_ephemeris_map[gps_eph.i_satellite_PRN] = gps_eph;
+    save_assistance(gps_eph, gps_eph.i_satellite_PRN);
+}
+
+
+void rtklib_pvt_gs::update_user_solver(const Gps_Ephemeris& gps_eph)
+{
+    // runs before the ephemeris maps are updated, to tell new records from repeated ones
+    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
+        {
+            bool new_annotation = false;
+            if (d_user_pvt_solver->gps_ephemeris_map.find(gps_eph.i_satellite_PRN) == d_user_pvt_solver->gps_ephemeris_map.cend())
+                {
+                    new_annotation = true;
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Gps_Utc_Model>))
+            else
                 {
-                    // ### GPS UTC MODEL ###
-                    std::shared_ptr<Gps_Utc_Model> gps_utc_model;
-                    gps_utc_model = boost::any_cast<std::shared_ptr<Gps_Utc_Model>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->gps_utc_model = *gps_utc_model;
-                    if (d_enable_rx_clock_correction == true)
+                    if (d_user_pvt_solver->gps_ephemeris_map[gps_eph.i_satellite_PRN].d_Toe != gps_eph.d_Toe)
                         {
-                            d_user_pvt_solver->gps_utc_model = *gps_utc_model;
+                            new_annotation = true;
                         }
-                    DLOG(INFO) << "New UTC record has arrived ";
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Gps_CNAV_Ephemeris>))
+            if (new_annotation == true)
                 {
-                    // ### GPS CNAV message ###
-                    std::shared_ptr<Gps_CNAV_Ephemeris> gps_cnav_ephemeris;
-                    gps_cnav_ephemeris = boost::any_cast<std::shared_ptr<Gps_CNAV_Ephemeris>>(pmt::any_ref(msg));
-                    // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
+                    // New record!
+                    std::map<int32_t, Gps_Ephemeris> new_eph;
+                    std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
+                    std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
+                    new_eph[gps_eph.i_satellite_PRN] = gps_eph;
+                    switch (d_type_of_rx)
                         {
-                            bool new_annotation = false;
-                            if (d_internal_pvt_solver->gps_cnav_ephemeris_map.find(gps_cnav_ephemeris->i_satellite_PRN) == d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
+                        case 1:  // GPS L1 C/A only
+                            d_rp->log_rinex_nav(d_rp->navFile, new_eph);
+                            break;
+                        case 8:  // L1+L5
+                            d_rp->log_rinex_nav(d_rp->navFile, new_eph);
+                            break;
+                        case 9:  // GPS L1 C/A + Galileo E1B
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 10:  // GPS L1 C/A + Galileo E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 11:  // GPS L1 C/A + Galileo E5b
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 26:  // GPS L1 C/A + GLONASS L1 C/A
+                            if (d_rinex_version == 3)
                                 {
-                                    new_annotation = true;
+                                    d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_glo_eph);
                                 }
-                            else
+                            if (d_rinex_version == 2)
                                 {
-                                    if (d_internal_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->i_satellite_PRN].d_Toe1 != gps_cnav_ephemeris->d_Toe1)
-                                        {
-                                            new_annotation = true;
-                                        }
+                                    d_rp->log_rinex_nav(d_rp->navFile, new_glo_eph);
                                 }
-                            if (new_annotation == true)
+                            break;
+                        case 29:  // GPS L1 C/A + GLONASS L2 C/A
+                            if (d_rinex_version == 3)
                                 {
-                                    // New record!
-                                    std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
-                                    std::map<int32_t, Gps_CNAV_Ephemeris> new_cnav_eph;
-                                    std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
-                                    new_cnav_eph[gps_cnav_ephemeris->i_satellite_PRN] = *gps_cnav_ephemeris;
-                                    switch (d_type_of_rx)
-                                        {
-                                        case 2:  // GPS L2C only
-                                            d_rp->log_rinex_nav(d_rp->navFile, new_cnav_eph);
-                                            break;
-                                        case 3:  // GPS L5 only
-                                            d_rp->log_rinex_nav(d_rp->navFile, new_cnav_eph);
-                                            break;
-                                        case 7:  // GPS L1 C/A + GPS L2C
-                                            d_rp->log_rinex_nav(d_rp->navFile, new_cnav_eph);
-                                            break;
-                                        case 13:  // L5+E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_gal_eph);
-                                            break;
-                                        case 28:  // GPS L2C + GLONASS L1 C/A
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_glo_eph);
-                                            break;
-                                        case 31:  // GPS L2C + GLONASS L2 C/A
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_glo_eph);
-                                            break;
-                                        default:
-                                            break;
-                                        }
+                                    d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_glo_eph);
                                 }
+                            if (d_rinex_version == 2)
+                                {
+                                    d_rp->log_rinex_nav(d_rp->navFile, new_eph);
+                                }
+                            break;
+                        case 32:  // L1+E1+L5+E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 33:  // L1+E1+E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 1000:  // L1+L2+L5
+                            d_rp->log_rinex_nav(d_rp->navFile, new_eph);
+                            break;
+                        case 1001:  // L1+E1+L2+L5+E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        default:
+                            break;
                         }
-                    d_internal_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->i_satellite_PRN] = *gps_cnav_ephemeris;
-                    if (d_enable_rx_clock_correction == true)
-                        {
-                            d_user_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->i_satellite_PRN] = *gps_cnav_ephemeris;
-                        }
-                    DLOG(INFO) << "New GPS CNAV ephemeris record has arrived ";
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Gps_CNAV_Iono>))
+        }
+    if (d_enable_rx_clock_correction == true)
+        {
+            d_user_pvt_solver->gps_ephemeris_map[gps_eph.i_satellite_PRN] = gps_eph;
+        }
+}
+
+
+void rtklib_pvt_gs::handle_gps_iono(const Gps_Iono& gps_iono)
+{
+    d_internal_pvt_solver->gps_iono = gps_iono;
+    save_assistance(gps_iono);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, gps_iono]() { d_user_pvt_solver->gps_iono = gps_iono; });
+        }
+    DLOG(INFO) << "New IONO record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_gps_utc_model(const Gps_Utc_Model& gps_utc_model)
+{
+    d_internal_pvt_solver->gps_utc_model = gps_utc_model;
+    save_assistance(gps_utc_model);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, gps_utc_model]() { d_user_pvt_solver->gps_utc_model = gps_utc_model; });
+        }
+    DLOG(INFO) << "New UTC record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_gps_cnav_ephemeris(const Gps_CNAV_Ephemeris& gps_cnav_ephemeris)
+{
+    // logged and passed to the user solver in its stage, in order with the observation epochs
+    run_in_user_solver_stage([this, gps_cnav_ephemeris]() { update_user_solver(gps_cnav_ephemeris); });
+    // update/insert new ephemeris record to the global ephemeris map
+    d_internal_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris.i_satellite_PRN] = gps_cnav_ephemeris;
+    save_assistance(gps_cnav_ephemeris, gps_cnav_ephemeris.i_satellite_PRN);
+    DLOG(INFO) << "New GPS CNAV ephemeris record has arrived ";
+}
+
+
+void rtklib_pvt_gs::update_user_solver(const Gps_CNAV_Ephemeris& gps_cnav_ephemeris)
+{
+    // runs before the ephemeris maps are updated, to tell new records from repeated ones
+    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
+        {
+            bool new_annotation = false;
+            if (d_user_pvt_solver->gps_cnav_ephemeris_map.find(gps_cnav_ephemeris.i_satellite_PRN) == d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
+                {
+                    new_annotation = true;
+                }
+            else
                 {
-                    // ### GPS CNAV IONO ###
-                    std::shared_ptr<Gps_CNAV_Iono> gps_cnav_iono;
-                    gps_cnav_iono = boost::any_cast<std::shared_ptr<Gps_CNAV_Iono>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->gps_cnav_iono = *gps_cnav_iono;
-                    if (d_enable_rx_clock_correction == true)
+                    if (d_user_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris.i_satellite_PRN].d_Toe1 != gps_cnav_ephemeris.d_Toe1)
                         {
-                            d_user_pvt_solver->gps_cnav_iono = *gps_cnav_iono;
+                            new_annotation = true;
                         }
-                    DLOG(INFO) << "New CNAV IONO record has arrived ";
-                }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Gps_CNAV_Utc_Model>))
-                {
-                    // ### GPS CNAV UTC MODEL ###
-                    std::shared_ptr<Gps_CNAV_Utc_Model> gps_cnav_utc_model;
-                    gps_cnav_utc_model = boost::any_cast<std::shared_ptr<Gps_CNAV_Utc_Model>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->gps_cnav_utc_model = *gps_cnav_utc_model;
-                    {
-                        d_user_pvt_solver->gps_cnav_utc_model = *gps_cnav_utc_model;
-                    }
-                    DLOG(INFO) << "New CNAV UTC record has arrived ";
                 }
-
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Gps_Almanac>))
+            if (new_annotation == true)
                 {
-                    // ### GPS ALMANAC ###
-                    std::shared_ptr<Gps_Almanac> gps_almanac;
-                    gps_almanac = boost::any_cast<std::shared_ptr<Gps_Almanac>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->gps_almanac_map[gps_almanac->i_satellite_PRN] = *gps_almanac;
-                    if (d_enable_rx_clock_correction == true)
+                    // New record!
+                    std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
+                    std::map<int32_t, Gps_CNAV_Ephemeris> new_cnav_eph;
+                    std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
+                    new_cnav_eph[gps_cnav_ephemeris.i_satellite_PRN] = gps_cnav_ephemeris;
+                    switch (d_type_of_rx)
                         {
-                            d_user_pvt_solver->gps_almanac_map[gps_almanac->i_satellite_PRN] = *gps_almanac;
+                        case 2:  // GPS L2C only
+                            d_rp->log_rinex_nav(d_rp->navFile, new_cnav_eph);
+                            break;
+                        case 3:  // GPS L5 only
+                            d_rp->log_rinex_nav(d_rp->navFile, new_cnav_eph);
+                            break;
+                        case 7:  // GPS L1 C/A + GPS L2C
+                            d_rp->log_rinex_nav(d_rp->navFile, new_cnav_eph);
+                            break;
+                        case 13:  // L5+E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_gal_eph);
+                            break;
+                        case 28:  // GPS L2C + GLONASS L1 C/A
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_glo_eph);
+                            break;
+                        case 31:  // GPS L2C + GLONASS L2 C/A
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_glo_eph);
+                            break;
+                        default:
+                            break;
                         }
-                    DLOG(INFO) << "New GPS almanac record has arrived ";
                 }
+        }
+    if (d_enable_rx_clock_correction == true)
+        {
+            d_user_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris.i_satellite_PRN] = gps_cnav_ephemeris;
+        }
+}
+
+
+void rtklib_pvt_gs::handle_gps_cnav_iono(const Gps_CNAV_Iono& gps_cnav_iono)
+{
+    d_internal_pvt_solver->gps_cnav_iono = gps_cnav_iono;
+    save_assistance(gps_cnav_iono);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, gps_cnav_iono]() { d_user_pvt_solver->gps_cnav_iono = gps_cnav_iono; });
+        }
+    DLOG(INFO) << "New CNAV IONO record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_gps_cnav_utc_model(const Gps_CNAV_Utc_Model& gps_cnav_utc_model)
+{
+    d_internal_pvt_solver->gps_cnav_utc_model = gps_cnav_utc_model;
+    save_assistance(gps_cnav_utc_model);
+    {
+        run_in_user_solver_stage([this, gps_cnav_utc_model]() { d_user_pvt_solver->gps_cnav_utc_model = gps_cnav_utc_model; });
+    }
+    DLOG(INFO) << "New CNAV UTC record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_gps_almanac(const Gps_Almanac& gps_almanac)
+{
+    d_internal_pvt_solver->gps_almanac_map[gps_almanac.i_satellite_PRN] = gps_almanac;
+    save_assistance(gps_almanac, gps_almanac.i_satellite_PRN);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, gps_almanac]() { d_user_pvt_solver->gps_almanac_map[gps_almanac.i_satellite_PRN] = gps_almanac; });
+        }
+    DLOG(INFO) << "New GPS almanac record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_galileo_ephemeris(const Galileo_Ephemeris& galileo_eph)
+{
+    // insert new ephemeris record
+    DLOG(INFO) << "Galileo New Ephemeris record inserted in global map with TOW =" << galileo_eph.TOW_5
+               << ", GALILEO Week Number =" << galileo_eph.WN_5
+               << " and Ephemeris IOD = " << galileo_eph.IOD_ephemeris;
+    // logged and passed to the user solver in its stage, in order with the observation epochs
+    run_in_user_solver_stage([this, galileo_eph]() { update_user_solver(galileo_eph); });
+    // update/insert new ephemeris record to the global ephemeris map
+    d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph.i_satellite_PRN] = galileo_eph;
+    save_assistance(galileo_eph, galileo_eph.i_satellite_PRN);
+}
+
 
-            // **************** Galileo telemetry ********************
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Galileo_Ephemeris>))
+void rtklib_pvt_gs::update_user_solver(const Galileo_Ephemeris& galileo_eph)
+{
+    // runs before the ephemeris maps are updated, to tell new records from repeated ones
+    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
+        {
+            bool new_annotation = false;
+            if (d_user_pvt_solver->galileo_ephemeris_map.find(galileo_eph.i_satellite_PRN) == d_user_pvt_solver->galileo_ephemeris_map.cend())
                 {
-                    // ### Galileo EPHEMERIS ###
-                    std::shared_ptr<Galileo_Ephemeris> galileo_eph;
-                    galileo_eph = boost::any_cast<std::shared_ptr<Galileo_Ephemeris>>(pmt::any_ref(msg));
-                    // insert new ephemeris record
-                    DLOG(INFO) << "Galileo New Ephemeris record inserted in global map with TOW =" << galileo_eph->TOW_5
-                               << ", GALILEO Week Number =" << galileo_eph->WN_5
-                               << " and Ephemeris IOD = " << galileo_eph->IOD_ephemeris;
-                    // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
-                        {
-                            bool new_annotation = false;
-                            if (d_internal_pvt_solver->galileo_ephemeris_map.find(galileo_eph->i_satellite_PRN) == d_internal_pvt_solver->galileo_ephemeris_map.cend())
-                                {
-                                    new_annotation = true;
-                                }
-                            else
-                                {
-                                    if (d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph->i_satellite_PRN].t0e_1 != galileo_eph->t0e_1)
-                                        {
-                                            new_annotation = true;
-                                        }
-                                }
-                            if (new_annotation == true)
-                                {
-                                    // New record!
-                                    std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
-                                    std::map<int32_t, Gps_CNAV_Ephemeris> new_cnav_eph;
-                                    std::map<int32_t, Gps_Ephemeris> new_eph;
-                                    std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
-                                    new_gal_eph[galileo_eph->i_satellite_PRN] = *galileo_eph;
-                                    switch (d_type_of_rx)
-                                        {
-                                        case 4:  // Galileo E1B only
-                                            d_rp->log_rinex_nav(d_rp->navGalFile, new_gal_eph);
-                                            break;
-                                        case 5:  // Galileo E5a only
-                                            d_rp->log_rinex_nav(d_rp->navGalFile, new_gal_eph);
-                                            break;
-                                        case 6:  // Galileo E5b only
-                                            d_rp->log_rinex_nav(d_rp->navGalFile, new_gal_eph);
-                                            break;
-                                        case 9:  // GPS L1 C/A + Galileo E1B
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 10:  // GPS L1 C/A + Galileo E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 11:  // GPS L1 C/A + Galileo E5b
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 13:  // L5+E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_gal_eph);
-                                            break;
-                                        case 15:  // Galileo E1B + Galileo E5b
-                                            d_rp->log_rinex_nav(d_rp->navGalFile, new_gal_eph);
-                                            break;
-                                        case 27:  // Galileo E1B + GLONASS L1 C/A
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_gal_eph, new_glo_eph);
-                                            break;
-                                        case 30:  // Galileo E1B + GLONASS L2 C/A
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_gal_eph, new_glo_eph);
-                                            break;
-                                        case 32:  // L1+E1+L5+E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 33:  // L1+E1+E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        case 1001:  // L1+E1+L2+L5+E5a
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
-                                            break;
-                                        default:
-                                            break;
-                                        }
-                                }
-                        }
-                    d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph->i_satellite_PRN] = *galileo_eph;
-                    if (d_enable_rx_clock_correction == true)
-                        {
-                            d_user_pvt_solver->galileo_ephemeris_map[galileo_eph->i_satellite_PRN] = *galileo_eph;
-                        }
+                    new_annotation = true;
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Galileo_Iono>))
+            else
                 {
-                    // ### Galileo IONO ###
-                    std::shared_ptr<Galileo_Iono> galileo_iono;
-                    galileo_iono = boost::any_cast<std::shared_ptr<Galileo_Iono>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->galileo_iono = *galileo_iono;
-                    if (d_enable_rx_clock_correction == true)
+                    if (d_user_pvt_solver->galileo_ephemeris_map[galileo_eph.i_satellite_PRN].t0e_1 != galileo_eph.t0e_1)
                         {
-                            d_user_pvt_solver->galileo_iono = *galileo_iono;
+                            new_annotation = true;
                         }
-                    DLOG(INFO) << "New IONO record has arrived ";
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Galileo_Utc_Model>))
+            if (new_annotation == true)
                 {
-                    // ### Galileo UTC MODEL ###
-                    std::shared_ptr<Galileo_Utc_Model> galileo_utc_model;
-                    galileo_utc_model = boost::any_cast<std::shared_ptr<Galileo_Utc_Model>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->galileo_utc_model = *galileo_utc_model;
-                    if (d_enable_rx_clock_correction == true)
+                    // New record!
+                    std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
+                    std::map<int32_t, Gps_CNAV_Ephemeris> new_cnav_eph;
+                    std::map<int32_t, Gps_Ephemeris> new_eph;
+                    std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
+                    new_gal_eph[galileo_eph.i_satellite_PRN] = galileo_eph;
+                    switch (d_type_of_rx)
                         {
-                            d_user_pvt_solver->galileo_utc_model = *galileo_utc_model;
+                        case 4:  // Galileo E1B only
+                            d_rp->log_rinex_nav(d_rp->navGalFile, new_gal_eph);
+                            break;
+                        case 5:  // Galileo E5a only
+                            d_rp->log_rinex_nav(d_rp->navGalFile, new_gal_eph);
+                            break;
+                        case 6:  // Galileo E5b only
+                            d_rp->log_rinex_nav(d_rp->navGalFile, new_gal_eph);
+                            break;
+                        case 9:  // GPS L1 C/A + Galileo E1B
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 10:  // GPS L1 C/A + Galileo E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 11:  // GPS L1 C/A + Galileo E5b
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 13:  // L5+E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_gal_eph);
+                            break;
+                        case 15:  // Galileo E1B + Galileo E5b
+                            d_rp->log_rinex_nav(d_rp->navGalFile, new_gal_eph);
+                            break;
+                        case 27:  // Galileo E1B + GLONASS L1 C/A
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_gal_eph, new_glo_eph);
+                            break;
+                        case 30:  // Galileo E1B + GLONASS L2 C/A
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_gal_eph, new_glo_eph);
+                            break;
+                        case 32:  // L1+E1+L5+E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 33:  // L1+E1+E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        case 1001:  // L1+E1+L2+L5+E5a
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_gal_eph);
+                            break;
+                        default:
+                            break;
                         }
-                    DLOG(INFO) << "New UTC record has arrived ";
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Galileo_Almanac_Helper>))
+        }
+    if (d_enable_rx_clock_correction == true)
+        {
+            d_user_pvt_solver->galileo_ephemeris_map[galileo_eph.i_satellite_PRN] = galileo_eph;
+        }
+}
+
+
+void rtklib_pvt_gs::handle_galileo_iono(const Galileo_Iono& galileo_iono)
+{
+    d_internal_pvt_solver->galileo_iono = galileo_iono;
+    save_assistance(galileo_iono);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, galileo_iono]() { d_user_pvt_solver->galileo_iono = galileo_iono; });
+        }
+    DLOG(INFO) << "New IONO record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_galileo_utc_model(const Galileo_Utc_Model& galileo_utc_model)
+{
+    d_internal_pvt_solver->galileo_utc_model = galileo_utc_model;
+    save_assistance(galileo_utc_model);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, galileo_utc_model]() { d_user_pvt_solver->galileo_utc_model = galileo_utc_model; });
+        }
+    DLOG(INFO) << "New UTC record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_galileo_almanac_helper(const Galileo_Almanac_Helper& galileo_almanac_helper)
+{
+    Galileo_Almanac sv1 = galileo_almanac_helper.get_almanac(1);
+    Galileo_Almanac sv2 = galileo_almanac_helper.get_almanac(2);
+    Galileo_Almanac sv3 = galileo_almanac_helper.get_almanac(3);
+
+    if (sv1.i_satellite_PRN != 0)
+        {
+            d_internal_pvt_solver->galileo_almanac_map[sv1.i_satellite_PRN] = sv1;
+            save_assistance(sv1, sv1.i_satellite_PRN);
+            if (d_enable_rx_clock_correction == true)
+                {
+                    run_in_user_solver_stage([this, sv1]() { d_user_pvt_solver->galileo_almanac_map[sv1.i_satellite_PRN] = sv1; });
+                }
+        }
+    if (sv2.i_satellite_PRN != 0)
+        {
+            d_internal_pvt_solver->galileo_almanac_map[sv2.i_satellite_PRN] = sv2;
+            save_assistance(sv2, sv2.i_satellite_PRN);
+            if (d_enable_rx_clock_correction == true)
+                {
+                    run_in_user_solver_stage([this, sv2]() { d_user_pvt_solver->galileo_almanac_map[sv2.i_satellite_PRN] = sv2; });
+                }
+        }
+    if (sv3.i_satellite_PRN != 0)
+        {
+            d_internal_pvt_solver->galileo_almanac_map[sv3.i_satellite_PRN] = sv3;
+            save_assistance(sv3, sv3.i_satellite_PRN);
+            if (d_enable_rx_clock_correction == true)
                 {
-                    // ### Galileo Almanac ###
-                    std::shared_ptr<Galileo_Almanac_Helper> galileo_almanac_helper;
-                    galileo_almanac_helper = boost::any_cast<std::shared_ptr<Galileo_Almanac_Helper>>(pmt::any_ref(msg));
+                    run_in_user_solver_stage([this, sv3]() { d_user_pvt_solver->galileo_almanac_map[sv3.i_satellite_PRN] = sv3; });
+                }
+        }
+    DLOG(INFO) << "New Galileo Almanac data have arrived ";
+}
 
-                    Galileo_Almanac sv1 = galileo_almanac_helper->get_almanac(1);
-                    Galileo_Almanac sv2 = galileo_almanac_helper->get_almanac(2);
-                    Galileo_Almanac sv3 = galileo_almanac_helper->get_almanac(3);
 
-                    if (sv1.i_satellite_PRN != 0)
-                        {
-                            d_internal_pvt_solver->galileo_almanac_map[sv1.i_satellite_PRN] = sv1;
-                            if (d_enable_rx_clock_correction == true)
-                                {
-                                    d_user_pvt_solver->galileo_almanac_map[sv1.i_satellite_PRN] = sv1;
-                                }
-                        }
-                    if (sv2.i_satellite_PRN != 0)
-                        {
-                            d_internal_pvt_solver->galileo_almanac_map[sv2.i_satellite_PRN] = sv2;
-                            if (d_enable_rx_clock_correction == true)
-                                {
-                                    d_user_pvt_solver->galileo_almanac_map[sv2.i_satellite_PRN] = sv2;
-                                }
-                        }
-                    if (sv3.i_satellite_PRN != 0)
-                        {
-                            d_internal_pvt_solver->galileo_almanac_map[sv3.i_satellite_PRN] = sv3;
-                            if (d_enable_rx_clock_correction == true)
-                                {
-                                    d_user_pvt_solver->galileo_almanac_map[sv3.i_satellite_PRN] = sv3;
-                                }
-                        }
-                    DLOG(INFO) << "New Galileo Almanac data have arrived ";
+void rtklib_pvt_gs::handle_galileo_almanac(const Galileo_Almanac& galileo_alm)
+{
+    // update/insert new almanac record to the global almanac map
+    d_internal_pvt_solver->galileo_almanac_map[galileo_alm.i_satellite_PRN] = galileo_alm;
+    save_assistance(galileo_alm, galileo_alm.i_satellite_PRN);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, galileo_alm]() { d_user_pvt_solver->galileo_almanac_map[galileo_alm.i_satellite_PRN] = galileo_alm; });
+        }
+}
+
+
+void rtklib_pvt_gs::handle_glonass_gnav_ephemeris(const Glonass_Gnav_Ephemeris& glonass_gnav_eph)
+{
+    // TODO Add GLONASS with gps week number and tow,
+    // insert new ephemeris record
+    DLOG(INFO) << "GLONASS GNAV New Ephemeris record inserted in global map with TOW =" << glonass_gnav_eph.d_TOW
+               << ", Week Number =" << glonass_gnav_eph.d_WN
+               << " and Ephemeris IOD in UTC = " << glonass_gnav_eph.compute_GLONASS_time(glonass_gnav_eph.d_t_b)
+               << " from SV = " << glonass_gnav_eph.i_satellite_slot_number;
+    // logged and passed to the user solver in its stage, in order with the observation epochs
+    run_in_user_solver_stage([this, glonass_gnav_eph]() { update_user_solver(glonass_gnav_eph); });
+    // update/insert new ephemeris record to the global ephemeris map
+    d_internal_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph.i_satellite_PRN] = glonass_gnav_eph;
+    save_assistance(glonass_gnav_eph, glonass_gnav_eph.i_satellite_PRN);
+}
+
+
+void rtklib_pvt_gs::update_user_solver(const Glonass_Gnav_Ephemeris& glonass_gnav_eph)
+{
+    // runs before the ephemeris maps are updated, to tell new records from repeated ones
+    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
+        {
+            bool new_annotation = false;
+            if (d_user_pvt_solver->glonass_gnav_ephemeris_map.find(glonass_gnav_eph.i_satellite_PRN) == d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                {
+                    new_annotation = true;
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Galileo_Almanac>))
+            else
                 {
-                    // ### Galileo Almanac ###
-                    std::shared_ptr<Galileo_Almanac> galileo_alm;
-                    galileo_alm = boost::any_cast<std::shared_ptr<Galileo_Almanac>>(pmt::any_ref(msg));
-                    // update/insert new almanac record to the global almanac map
-                    d_internal_pvt_solver->galileo_almanac_map[galileo_alm->i_satellite_PRN] = *galileo_alm;
-                    if (d_enable_rx_clock_correction == true)
+                    if (d_user_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph.i_satellite_PRN].d_t_b != glonass_gnav_eph.d_t_b)
                         {
-                            d_user_pvt_solver->galileo_almanac_map[galileo_alm->i_satellite_PRN] = *galileo_alm;
+                            new_annotation = true;
                         }
                 }
-
-            // **************** GLONASS GNAV Telemetry **************************
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Glonass_Gnav_Ephemeris>))
+            if (new_annotation == true)
                 {
-                    // ### GLONASS GNAV EPHEMERIS ###
-                    std::shared_ptr<Glonass_Gnav_Ephemeris> glonass_gnav_eph;
-                    glonass_gnav_eph = boost::any_cast<std::shared_ptr<Glonass_Gnav_Ephemeris>>(pmt::any_ref(msg));
-                    // TODO Add GLONASS with gps week number and tow,
-                    // insert new ephemeris record
-                    DLOG(INFO) << "GLONASS GNAV New Ephemeris record inserted in global map with TOW =" << glonass_gnav_eph->d_TOW
-                               << ", Week Number =" << glonass_gnav_eph->d_WN
-                               << " and Ephemeris IOD in UTC = " << glonass_gnav_eph->compute_GLONASS_time(glonass_gnav_eph->d_t_b)
-                               << " from SV = " << glonass_gnav_eph->i_satellite_slot_number;
-                    // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
+                    // New record!
+                    std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
+                    std::map<int32_t, Gps_CNAV_Ephemeris> new_cnav_eph;
+                    std::map<int32_t, Gps_Ephemeris> new_eph;
+                    std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
+                    new_glo_eph[glonass_gnav_eph.i_satellite_PRN] = glonass_gnav_eph;
+                    switch (d_type_of_rx)
                         {
-                            bool new_annotation = false;
-                            if (d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(glonass_gnav_eph->i_satellite_PRN) == d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                        case 23:  // GLONASS L1 C/A
+                            d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
+                            break;
+                        case 24:  // GLONASS L2 C/A
+                            d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
+                            break;
+                        case 25:  // GLONASS L1 C/A + GLONASS L2 C/A
+                            d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
+                            break;
+                        case 26:  // GPS L1 C/A + GLONASS L1 C/A
+                            if (d_rinex_version == 3)
                                 {
-                                    new_annotation = true;
+                                    d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_glo_eph);
                                 }
-                            else
+                            if (d_rinex_version == 2)
                                 {
-                                    if (d_internal_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->i_satellite_PRN].d_t_b != glonass_gnav_eph->d_t_b)
-                                        {
-                                            new_annotation = true;
-                                        }
+                                    d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
                                 }
-                            if (new_annotation == true)
+                            break;
+                        case 27:  // Galileo E1B + GLONASS L1 C/A
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_gal_eph, new_glo_eph);
+                            break;
+                        case 28:  // GPS L2C + GLONASS L1 C/A
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_glo_eph);
+                            break;
+                        case 29:  // GPS L1 C/A + GLONASS L2 C/A
+                            if (d_rinex_version == 3)
                                 {
-                                    // New record!
-                                    std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
-                                    std::map<int32_t, Gps_CNAV_Ephemeris> new_cnav_eph;
-                                    std::map<int32_t, Gps_Ephemeris> new_eph;
-                                    std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
-                                    new_glo_eph[glonass_gnav_eph->i_satellite_PRN] = *glonass_gnav_eph;
-                                    switch (d_type_of_rx)
-                                        {
-                                        case 23:  // GLONASS L1 C/A
-                                            d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
-                                            break;
-                                        case 24:  // GLONASS L2 C/A
-                                            d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
-                                            break;
-                                        case 25:  // GLONASS L1 C/A + GLONASS L2 C/A
-                                            d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
-                                            break;
-                                        case 26:  // GPS L1 C/A + GLONASS L1 C/A
-                                            if (d_rinex_version == 3)
-                                                {
-                                                    d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_glo_eph);
-                                                }
-                                            if (d_rinex_version == 2)
-                                                {
-                                                    d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
-                                                }
-                                            break;
-                                        case 27:  // Galileo E1B + GLONASS L1 C/A
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_gal_eph, new_glo_eph);
-                                            break;
-                                        case 28:  // GPS L2C + GLONASS L1 C/A
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_glo_eph);
-                                            break;
-                                        case 29:  // GPS L1 C/A + GLONASS L2 C/A
-                                            if (d_rinex_version == 3)
-                                                {
-                                                    d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_glo_eph);
-                                                }
-                                            if (d_rinex_version == 2)
-                                                {
-                                                    d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
-                                                }
-                                            break;
-                                        case 30:  // Galileo E1B + GLONASS L2 C/A
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_gal_eph, new_glo_eph);
-                                            break;
-                                        case 31:  // GPS L2C + GLONASS L2 C/A
-                                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_glo_eph);
-                                            break;
-                                        default:
-                                            break;
-                                        }
+                                    d_rp->log_rinex_nav(d_rp->navMixFile, new_eph, new_glo_eph);
                                 }
-                        }
-                    d_internal_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->i_satellite_PRN] = *glonass_gnav_eph;
-                    if (d_enable_rx_clock_correction == true)
-                        {
-                            d_user_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->i_satellite_PRN] = *glonass_gnav_eph;
+                            if (d_rinex_version == 2)
+                                {
+                                    d_rp->log_rinex_nav(d_rp->navGloFile, new_glo_eph);
+                                }
+                            break;
+                        case 30:  // Galileo E1B + GLONASS L2 C/A
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_gal_eph, new_glo_eph);
+                            break;
+                        case 31:  // GPS L2C + GLONASS L2 C/A
+                            d_rp->log_rinex_nav(d_rp->navMixFile, new_cnav_eph, new_glo_eph);
+                            break;
+                        default:
+                            break;
                         }
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Glonass_Gnav_Utc_Model>))
+        }
+    if (d_enable_rx_clock_correction == true)
+        {
+            d_user_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph.i_satellite_PRN] = glonass_gnav_eph;
+        }
+}
+
+
+void rtklib_pvt_gs::handle_glonass_gnav_utc_model(const Glonass_Gnav_Utc_Model& glonass_gnav_utc_model)
+{
+    d_internal_pvt_solver->glonass_gnav_utc_model = glonass_gnav_utc_model;
+    save_assistance(glonass_gnav_utc_model);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, glonass_gnav_utc_model]() { d_user_pvt_solver->glonass_gnav_utc_model = glonass_gnav_utc_model; });
+        }
+    DLOG(INFO) << "New GLONASS GNAV UTC record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_glonass_gnav_almanac(const Glonass_Gnav_Almanac& glonass_gnav_almanac)
+{
+    d_internal_pvt_solver->glonass_gnav_almanac = glonass_gnav_almanac;
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, glonass_gnav_almanac]() { d_user_pvt_solver->glonass_gnav_almanac = glonass_gnav_almanac; });
+        }
+    DLOG(INFO) << "New GLONASS GNAV Almanac has arrived "
+               << ", GLONASS GNAV Slot Number =" << glonass_gnav_almanac.d_n_A;
+}
+
+
+void rtklib_pvt_gs::handle_beidou_dnav_ephemeris(const Beidou_Dnav_Ephemeris& bds_dnav_eph)
+{
+    const auto sat_block = bds_dnav_eph.satelliteBlock.find(bds_dnav_eph.i_satellite_PRN);
+    DLOG(INFO) << "Ephemeris record has arrived from SAT ID "
+               << bds_dnav_eph.i_satellite_PRN << " (Block "
+               << (sat_block != bds_dnav_eph.satelliteBlock.cend() ? sat_block->second : std::string()) << ")"
+               << "inserted with Toe=" << bds_dnav_eph.d_Toe << " and BDS Week="
+               << bds_dnav_eph.i_BEIDOU_week;
+    // logged and passed to the user solver in its stage, in order with the observation epochs
+    run_in_user_solver_stage([this, bds_dnav_eph]() { update_user_solver(bds_dnav_eph); });
+    // update/insert new ephemeris record to the global ephemeris map
+    d_internal_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph.i_satellite_PRN] = bds_dnav_eph;
+    save_assistance(bds_dnav_eph, bds_dnav_eph.i_satellite_PRN);
+}
+
+
+void rtklib_pvt_gs::update_user_solver(const Beidou_Dnav_Ephemeris& bds_dnav_eph)
+{
+    // runs before the ephemeris maps are updated, to tell new records from repeated ones
+    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
+        {
+            bool new_annotation = false;
+            if (d_user_pvt_solver->beidou_dnav_ephemeris_map.find(bds_dnav_eph.i_satellite_PRN) == d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
                 {
-                    // ### GLONASS GNAV UTC MODEL ###
-                    std::shared_ptr<Glonass_Gnav_Utc_Model> glonass_gnav_utc_model;
-                    glonass_gnav_utc_model = boost::any_cast<std::shared_ptr<Glonass_Gnav_Utc_Model>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->glonass_gnav_utc_model = *glonass_gnav_utc_model;
-                    if (d_enable_rx_clock_correction == true)
-                        {
-                            d_user_pvt_solver->glonass_gnav_utc_model = *glonass_gnav_utc_model;
-                        }
-                    DLOG(INFO) << "New GLONASS GNAV UTC record has arrived ";
+                    new_annotation = true;
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Glonass_Gnav_Almanac>))
+            else
                 {
-                    // ### GLONASS GNAV Almanac ###
-                    std::shared_ptr<Glonass_Gnav_Almanac> glonass_gnav_almanac;
-                    glonass_gnav_almanac = boost::any_cast<std::shared_ptr<Glonass_Gnav_Almanac>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->glonass_gnav_almanac = *glonass_gnav_almanac;
-                    if (d_enable_rx_clock_correction == true)
+                    if (d_user_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph.i_satellite_PRN].d_Toc != bds_dnav_eph.d_Toc)
                         {
-                            d_user_pvt_solver->glonass_gnav_almanac = *glonass_gnav_almanac;
+                            new_annotation = true;
                         }
-                    DLOG(INFO) << "New GLONASS GNAV Almanac has arrived "
-                               << ", GLONASS GNAV Slot Number =" << glonass_gnav_almanac->d_n_A;
                 }
-
-            // ************* BeiDou telemetry *****************
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Beidou_Dnav_Ephemeris>))
+            if (new_annotation == true)
                 {
-                    // ### Beidou EPHEMERIS ###
-                    std::shared_ptr<Beidou_Dnav_Ephemeris> bds_dnav_eph;
-                    bds_dnav_eph = boost::any_cast<std::shared_ptr<Beidou_Dnav_Ephemeris>>(pmt::any_ref(msg));
-                    DLOG(INFO) << "Ephemeris record has arrived from SAT ID "
-                               << bds_dnav_eph->i_satellite_PRN << " (Block "
-                               << bds_dnav_eph->satelliteBlock[bds_dnav_eph->i_satellite_PRN] << ")"
-                               << "inserted with Toe=" << bds_dnav_eph->d_Toe << " and BDS Week="
-                               << bds_dnav_eph->i_BEIDOU_week;
-                    // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
-                        {
-                            bool new_annotation = false;
-                            if (d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(bds_dnav_eph->i_satellite_PRN) == d_internal_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                {
-                                    new_annotation = true;
-                                }
-                            else
-                                {
-                                    if (d_internal_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->i_satellite_PRN].d_Toc != bds_dnav_eph->d_Toc)
-                                        {
-                                            new_annotation = true;
-                                        }
-                                }
-                            if (new_annotation == true)
-                                {
-                                    // New record!
-                                    std::map<int32_t, Beidou_Dnav_Ephemeris> new_bds_eph;
-                                    new_bds_eph[bds_dnav_eph->i_satellite_PRN] = *bds_dnav_eph;
-                                    switch (d_type_of_rx)
-                                        {
-                                        case 500:  // BDS B1I only
-                                            d_rp->log_rinex_nav(d_rp->navFile, new_bds_eph);
-                                            break;
-                                        case 600:  // BDS B3I only
-                                            d_rp->log_rinex_nav(d_rp->navFile, new_bds_eph);
-                                            break;
-                                        default:
-                                            break;
-                                        }
-                                }
-                        }
-                    d_internal_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->i_satellite_PRN] = *bds_dnav_eph;
-                    if (d_enable_rx_clock_correction == true)
+                    // New record!
+                    std::map<int32_t, Beidou_Dnav_Ephemeris> new_bds_eph;
+                    new_bds_eph[bds_dnav_eph.i_satellite_PRN] = bds_dnav_eph;
+                    switch (d_type_of_rx)
                         {
-                            d_user_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->i_satellite_PRN] = *bds_dnav_eph;
+                        case 500:  // BDS B1I only
+                            d_rp->log_rinex_nav(d_rp->navFile, new_bds_eph);
+                            break;
+                        case 600:  // BDS B3I only
+                            d_rp->log_rinex_nav(d_rp->navFile, new_bds_eph);
+                            break;
+                        default:
+                            break;
                         }
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Beidou_Dnav_Iono>))
+        }
+    if (d_enable_rx_clock_correction == true)
+        {
+            d_user_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph.i_satellite_PRN] = bds_dnav_eph;
+        }
+}
+
+
+void rtklib_pvt_gs::handle_beidou_dnav_iono(const Beidou_Dnav_Iono& bds_dnav_iono)
+{
+    d_internal_pvt_solver->beidou_dnav_iono = bds_dnav_iono;
+    save_assistance(bds_dnav_iono);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, bds_dnav_iono]() { d_user_pvt_solver->beidou_dnav_iono = bds_dnav_iono; });
+        }
+    DLOG(INFO) << "New BeiDou DNAV IONO record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_beidou_dnav_utc_model(const Beidou_Dnav_Utc_Model& bds_dnav_utc_model)
+{
+    d_internal_pvt_solver->beidou_dnav_utc_model = bds_dnav_utc_model;
+    save_assistance(bds_dnav_utc_model);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, bds_dnav_utc_model]() { d_user_pvt_solver->beidou_dnav_utc_model = bds_dnav_utc_model; });
+        }
+    DLOG(INFO) << "New BeiDou DNAV UTC record has arrived ";
+}
+
+
+void rtklib_pvt_gs::handle_beidou_dnav_almanac(const Beidou_Dnav_Almanac& bds_dnav_almanac)
+{
+    d_internal_pvt_solver->beidou_dnav_almanac_map[bds_dnav_almanac.i_satellite_PRN] = bds_dnav_almanac;
+    save_assistance(bds_dnav_almanac, bds_dnav_almanac.i_satellite_PRN);
+    if (d_enable_rx_clock_correction == true)
+        {
+            run_in_user_solver_stage([this, bds_dnav_almanac]() { d_user_pvt_solver->beidou_dnav_almanac_map[bds_dnav_almanac.i_satellite_PRN] = bds_dnav_almanac; });
+        }
+    DLOG(INFO) << "New BeiDou DNAV almanac record has arrived ";
+}
+
+
+void rtklib_pvt_gs::print_position(bool kml, bool gpx, bool geojson, bool nmea)
+{
+    if (!(kml or gpx or geojson or nmea))
+        {
+            return;
+        }
+    if (!d_output_stage)
+        {
+            if (kml)
                 {
-                    // ### BeiDou IONO ###
-                    std::shared_ptr<Beidou_Dnav_Iono> bds_dnav_iono;
-                    bds_dnav_iono = boost::any_cast<std::shared_ptr<Beidou_Dnav_Iono>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->beidou_dnav_iono = *bds_dnav_iono;
-                    if (d_enable_rx_clock_correction == true)
-                        {
-                            d_user_pvt_solver->beidou_dnav_iono = *bds_dnav_iono;
-                        }
-                    DLOG(INFO) << "New BeiDou DNAV IONO record has arrived ";
+                    d_kml_dump->print_position(d_user_pvt_solver.get(), false);
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Beidou_Dnav_Utc_Model>))
+            if (gpx)
                 {
-                    // ### BeiDou UTC MODEL ###
-                    std::shared_ptr<Beidou_Dnav_Utc_Model> bds_dnav_utc_model;
-                    bds_dnav_utc_model = boost::any_cast<std::shared_ptr<Beidou_Dnav_Utc_Model>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->beidou_dnav_utc_model = *bds_dnav_utc_model;
-                    if (d_enable_rx_clock_correction == true)
-                        {
-                            d_user_pvt_solver->beidou_dnav_utc_model = *bds_dnav_utc_model;
-                        }
-                    DLOG(INFO) << "New BeiDou DNAV UTC record has arrived ";
+                    d_gpx_dump->print_position(d_user_pvt_solver.get(), false);
                 }
-            else if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Beidou_Dnav_Almanac>))
+            if (geojson)
                 {
-                    // ### BeiDou ALMANAC ###
-                    std::shared_ptr<Beidou_Dnav_Almanac> bds_dnav_almanac;
-                    bds_dnav_almanac = boost::any_cast<std::shared_ptr<Beidou_Dnav_Almanac>>(pmt::any_ref(msg));
-                    d_internal_pvt_solver->beidou_dnav_almanac_map[bds_dnav_almanac->i_satellite_PRN] = *bds_dnav_almanac;
-                    if (d_enable_rx_clock_correction == true)
-                        {
-                            d_user_pvt_solver->beidou_dnav_almanac_map[bds_dnav_almanac->i_satellite_PRN] = *bds_dnav_almanac;
-                        }
-                    DLOG(INFO) << "New BeiDou DNAV almanac record has arrived ";
+                    d_geojson_printer->print_position(d_user_pvt_solver.get(), false);
                 }
-            else
+            if (nmea)
                 {
-                    LOG(WARNING) << "msg_handler_telemetry unknown object type!";
+                    d_nmea_printer->Print_Nmea_Line(d_user_pvt_solver.get(), false);
                 }
+            return;
         }
-    catch (boost::bad_any_cast& e)
+    // The printers get a copy of the solution, since the solver goes on with
+    // the next epochs. Each printer always goes to the same worker, so that
+    // it is only used by one thread and its output stays in order.
+    const auto solution = std::make_shared<const Rtklib_Solution_Snapshot>(*d_user_pvt_solver);
+    if (kml)
         {
-            LOG(WARNING) << "msg_handler_telemetry Bad any cast!";
+            d_output_stage->post(0, [this, solution]() { d_kml_dump->print_position(solution.get(), false); });
+        }
+    if (gpx)
+        {
+            d_output_stage->post(1, [this, solution]() { d_gpx_dump->print_position(solution.get(), false); });
+        }
+    if (geojson)
+        {
+            d_output_stage->post(2, [this, solution]() { d_geojson_printer->print_position(solution.get(), false); });
+        }
+    if (nmea)
+        {
+            d_output_stage->post(3, [this, solution]() { d_nmea_printer->Print_Nmea_Line(solution.get(), false); });
         }
 }
 
@@ -1684,12 +1877,14 @@ void rtklib_pvt_gs::clear_ephemeris()
     d_internal_pvt_solver->beidou_dnav_almanac_map.clear();
     if (d_enable_rx_clock_correction == true)
         {
-            d_user_pvt_solver->gps_ephemeris_map.clear();
-            d_user_pvt_solver->gps_almanac_map.clear();
-            d_user_pvt_solver->galileo_ephemeris_map.clear();
-            d_user_pvt_solver->galileo_almanac_map.clear();
-            d_user_pvt_solver->beidou_dnav_ephemeris_map.clear();
-            d_user_pvt_solver->beidou_dnav_almanac_map.clear();
+            run_in_user_solver_stage([this]() {
+                d_user_pvt_solver->gps_ephemeris_map.clear();
+                d_user_pvt_solver->gps_almanac_map.clear();
+                d_user_pvt_solver->galileo_ephemeris_map.clear();
+                d_user_pvt_solver->galileo_almanac_map.clear();
+                d_user_pvt_solver->beidou_dnav_ephemeris_map.clear();
+                d_user_pvt_solver->beidou_dnav_almanac_map.clear();
+            });
         }
 }
 
@@ -1716,13 +1911,14 @@ bool rtklib_pvt_gs::send_sys_v_ttff_msg(d_ttff_msgbuf ttff)
 
 bool rtklib_pvt_gs::save_gnss_synchro_map_xml(const std::string& file_name)
 {
-    if (d_gnss_observables_map.empty() == false)
+    if (d_gnss_observables.empty() == false)
         {
             std::ofstream ofs;
             try
                 {
                     ofs.open(file_name.c_str(), std::ofstream::trunc | std::ofstream::out);
                     boost::archive::xml_oarchive xml(ofs);
+                    d_gnss_observables.to_map(d_gnss_observables_map);
                     xml << boost::serialization::make_nvp("GNSS-SDR_gnss_synchro_map", d_gnss_observables_map);
                     LOG(INFO) << "Saved gnss_sychro map data";
                 }
@@ -1749,6 +1945,7 @@ bool rtklib_pvt_gs::load_gnss_synchro_map_xml(const std::string& file_name)
             boost::archive::xml_iarchive xml(ifs);
             d_gnss_observables_map.clear();
             xml >> boost::serialization::make_nvp("GNSS-SDR_gnss_synchro_map", d_gnss_observables_map);
+            d_gnss_observables.from_map(d_gnss_observables_map);
             // std::cout << "Loaded gnss_synchro map data with " << gnss_synchro_map.size() << " pseudoranges" << std::endl;
         }
     catch (const std::exception& e)
@@ -1815,52 +2012,50 @@ bool rtklib_pvt_gs::get_latest_PVT(double* longitude_deg,
 }
 
 
-void rtklib_pvt_gs::apply_rx_clock_offset(std::map<int, Gnss_Synchro>& observables_map,
+void rtklib_pvt_gs::apply_rx_clock_offset(Gnss_Observables_Epoch& observables,
     double rx_clock_offset_s)
 {
     // apply corrections according to Rinex 3.04, Table 1: Observation Corrections for Receiver Clock Offset
-    std::map<int, Gnss_Synchro>::iterator observables_iter;
-
-    for (observables_iter = observables_map.begin(); observables_iter != observables_map.end(); observables_iter++)
+    for (Gnss_Synchro& observable : observables)
         {
-            // all observables in the map are valid
-            observables_iter->second.RX_time -= rx_clock_offset_s;
-            observables_iter->second.Pseudorange_m -= rx_clock_offset_s * SPEED_OF_LIGHT;
+            // only the valid observables are visited
+            observable.RX_time -= rx_clock_offset_s;
+            observable.Pseudorange_m -= rx_clock_offset_s * SPEED_OF_LIGHT;
 
-            switch (d_mapStringValues[observables_iter->second.Signal])
+            switch (d_mapStringValues[observable.Signal])
                 {
                 case evGPS_1C:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ1 * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ1 * PI_2;
                     break;
                 case evGPS_L5:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ5 * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ5 * PI_2;
                     break;
                 case evSBAS_1C:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ1 * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ1 * PI_2;
                     break;
                 case evGAL_1B:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ1 * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ1 * PI_2;
                     break;
                 case evGAL_5X:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ5 * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ5 * PI_2;
                     break;
                 case evGPS_2S:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ2 * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ2 * PI_2;
                     break;
                 case evBDS_B3:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ3_BDS * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ3_BDS * PI_2;
                     break;
                 case evGLO_1G:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ1_GLO * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ1_GLO * PI_2;
                     break;
                 case evGLO_2G:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ2_GLO * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ2_GLO * PI_2;
                     break;
                 case evBDS_B1:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ1_BDS * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ1_BDS * PI_2;
                     break;
                 case evBDS_B2:
-                    observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ2_BDS * PI_2;
+                    observable.Carrier_phase_rads -= rx_clock_offset_s * FREQ2_BDS * PI_2;
                     break;
                 default:
                     break;
@@ -1869,67 +2064,60 @@ void rtklib_pvt_gs::apply_rx_clock_offset(std::map<int, Gnss_Synchro>& observabl
 }
 
 
-std::map<int, Gnss_Synchro> rtklib_pvt_gs::interpolate_observables(const std::map<int, Gnss_Synchro>& observables_map_t0,
-    const std::map<int, Gnss_Synchro>& observables_map_t1,
-    double rx_time_s)
+void rtklib_pvt_gs::interpolate_observables(const Gnss_Observables_Epoch& observables_t0,
+    const Gnss_Observables_Epoch& observables_t1,
+    double rx_time_s,
+    Gnss_Observables_Epoch& interp_observables)
 {
-    std::map<int, Gnss_Synchro> interp_observables_map;
+    interp_observables.clear();
     // Linear interpolation: y(t) = y(t0) + (y(t1) - y(t0)) * (t - t0) / (t1 - t0)
 
     // check TOW rollover
     double time_factor;
-    if ((observables_map_t1.cbegin()->second.RX_time -
-            observables_map_t0.cbegin()->second.RX_time) > 0)
+    if ((observables_t1.front().RX_time -
+            observables_t0.front().RX_time) > 0)
         {
-            time_factor = (rx_time_s - observables_map_t0.cbegin()->second.RX_time) /
-                          (observables_map_t1.cbegin()->second.RX_time -
-                              observables_map_t0.cbegin()->second.RX_time);
+            time_factor = (rx_time_s - observables_t0.front().RX_time) /
+                          (observables_t1.front().RX_time -
+                              observables_t0.front().RX_time);
         }
     else
         {
             // TOW rollover situation
-            time_factor = (604800000.0 + rx_time_s - observables_map_t0.cbegin()->second.RX_time) /
-                          (604800000.0 + observables_map_t1.cbegin()->second.RX_time -
-                              observables_map_t0.cbegin()->second.RX_time);
+            time_factor = (604800000.0 + rx_time_s - observables_t0.front().RX_time) /
+                          (604800000.0 + observables_t1.front().RX_time -
+                              observables_t0.front().RX_time);
         }
 
-    std::map<int, Gnss_Synchro>::const_iterator observables_iter;
-    for (observables_iter = observables_map_t0.cbegin(); observables_iter != observables_map_t0.cend(); observables_iter++)
+    for (auto observables_iter = observables_t0.cbegin(); observables_iter != observables_t0.cend(); ++observables_iter)
         {
             // 1. Check if the observable exist in t0 and t1
-            // the map key is the channel ID (see work())
-            try
-                {
-                    if (observables_map_t1.at(observables_iter->first).PRN == observables_iter->second.PRN)
-                        {
-                            interp_observables_map.insert(std::pair<int, Gnss_Synchro>(observables_iter->first, observables_iter->second));
-                            interp_observables_map.at(observables_iter->first).RX_time = rx_time_s;  // interpolation point
-                            interp_observables_map.at(observables_iter->first).Pseudorange_m += (observables_map_t1.at(observables_iter->first).Pseudorange_m - observables_iter->second.Pseudorange_m) * time_factor;
-                            interp_observables_map.at(observables_iter->first).Carrier_phase_rads += (observables_map_t1.at(observables_iter->first).Carrier_phase_rads - observables_iter->second.Carrier_phase_rads) * time_factor;
-                            interp_observables_map.at(observables_iter->first).Carrier_Doppler_hz += (observables_map_t1.at(observables_iter->first).Carrier_Doppler_hz - observables_iter->second.Carrier_Doppler_hz) * time_factor;
-                        }
-                }
-            catch (const std::out_of_range& oor)
+            // the index is the channel ID (see work())
+            const uint32_t ch = observables_iter.channel();
+            if (observables_t1.valid(ch) and observables_t1[ch].PRN == observables_iter->PRN)
                 {
-                    // observable does not exist in t1
+                    interp_observables.set(ch, *observables_iter);
+                    Gnss_Synchro& interp_observable = interp_observables[ch];
+                    interp_observable.RX_time = rx_time_s;  // interpolation point
+                    interp_observable.Pseudorange_m += (observables_t1[ch].Pseudorange_m - observables_iter->Pseudorange_m) * time_factor;
+                    interp_observable.Carrier_phase_rads += (observables_t1[ch].Carrier_phase_rads - observables_iter->Carrier_phase_rads) * time_factor;
+                    interp_observable.Carrier_Doppler_hz += (observables_t1[ch].Carrier_Doppler_hz - observables_iter->Carrier_Doppler_hz) * time_factor;
                 }
         }
-    return interp_observables_map;
 }
 
 
-void rtklib_pvt_gs::initialize_and_apply_carrier_phase_offset()
+void rtklib_pvt_gs::initialize_and_apply_carrier_phase_offset(Gnss_Observables_Epoch& observables)
 {
     // we have a valid PVT. First check if we need to reset the initial carrier phase offsets to match their pseudoranges
-    std::map<int, Gnss_Synchro>::iterator observables_iter;
-    for (observables_iter = d_gnss_observables_map.begin(); observables_iter != d_gnss_observables_map.end(); observables_iter++)
+    for (Gnss_Synchro& observable : observables)
         {
             // check if an initialization is required (new satellite or loss of lock)
-            // it is set to false by the work function if the gnss_synchro is not valid
-            if (d_channel_initialized.at(observables_iter->second.Channel_ID) == false)
+            // it is set to false by process_user_epoch() if the gnss_synchro is not valid
+            if (d_channel_initialized.at(observable.Channel_ID) == false)
                 {
                     double wavelength_m = 0;
-                    switch (d_mapStringValues[observables_iter->second.Signal])
+                    switch (d_mapStringValues[observable.Signal])
                         {
                         case evGPS_1C:
                             wavelength_m = SPEED_OF_LIGHT / FREQ1;
@@ -1967,2333 +2155,2381 @@ void rtklib_pvt_gs::initialize_and_apply_carrier_phase_offset()
                         default:
                             break;
                         }
-                    double wrap_carrier_phase_rad = fmod(observables_iter->second.Carrier_phase_rads, PI_2);
-                    d_initial_carrier_phase_offset_estimation_rads.at(observables_iter->second.Channel_ID) = PI_2 * round(observables_iter->second.Pseudorange_m / wavelength_m) - observables_iter->second.Carrier_phase_rads + wrap_carrier_phase_rad;
-                    d_channel_initialized.at(observables_iter->second.Channel_ID) = true;
-                    DLOG(INFO) << "initialized carrier phase at channel " << observables_iter->second.Channel_ID;
+                    double wrap_carrier_phase_rad = fmod(observable.Carrier_phase_rads, PI_2);
+                    d_initial_carrier_phase_offset_estimation_rads.at(observable.Channel_ID) = PI_2 * round(observable.Pseudorange_m / wavelength_m) - observable.Carrier_phase_rads + wrap_carrier_phase_rad;
+                    d_channel_initialized.at(observable.Channel_ID) = true;
+                    DLOG(INFO) << "initialized carrier phase at channel " << observable.Channel_ID;
                 }
             // apply the carrier phase offset to this satellite
-            observables_iter->second.Carrier_phase_rads = observables_iter->second.Carrier_phase_rads + d_initial_carrier_phase_offset_estimation_rads.at(observables_iter->second.Channel_ID);
+            observable.Carrier_phase_rads = observable.Carrier_phase_rads + d_initial_carrier_phase_offset_estimation_rads.at(observable.Channel_ID);
         }
 }
 
 
-int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_items,
-    gr_vector_void_star& output_items __attribute__((unused)))
+void rtklib_pvt_gs::run_in_user_solver_stage(std::function<void()> task)
 {
-    for (int32_t epoch = 0; epoch < noutput_items; epoch++)
+    if (d_user_solver_stage)
         {
-            bool flag_display_pvt = false;
-            bool flag_compute_pvt_output = false;
-            bool flag_write_RTCM_1019_output = false;
-            bool flag_write_RTCM_1020_output = false;
-            bool flag_write_RTCM_1045_output = false;
-            bool flag_write_RTCM_MSM_output = false;
-            bool flag_write_RINEX_obs_output = false;
+            d_user_solver_stage->post(0, std::move(task));
+        }
+    else
+        {
+            task();
+        }
+}
 
-            d_gnss_observables_map.clear();
-            const auto** in = reinterpret_cast<const Gnss_Synchro**>(&input_items[0]);  // Get the input buffer pointer
-            // ############ 1. READ PSEUDORANGES ####
-            for (uint32_t i = 0; i < d_nchannels; i++)
+
+void rtklib_pvt_gs::update_rtcm_lock_times(const Gnss_Observables_Epoch& valid_pseudoranges)
+{
+    if (d_user_pvt_solver != d_internal_pvt_solver)
+        {
+            // the ephemeris maps of the user solver may have changed since its last solution
+            d_user_pvt_solver->index_ephemeris();
+        }
+    for (const Gnss_Synchro& observable : valid_pseudoranges)
+        {
+            const Gps_Ephemeris* tmp_eph_gps = d_user_pvt_solver->find_gps_ephemeris(observable.PRN);
+            const Galileo_Ephemeris* tmp_eph_gal = d_user_pvt_solver->find_galileo_ephemeris(observable.PRN);
+            const Gps_CNAV_Ephemeris* tmp_eph_cnav = d_user_pvt_solver->find_gps_cnav_ephemeris(observable.PRN);
+            const Glonass_Gnav_Ephemeris* tmp_eph_glo_gnav = d_user_pvt_solver->find_glonass_gnav_ephemeris(observable.PRN);
+            try
                 {
-                    if (in[i][epoch].Flag_valid_pseudorange)
+                    if (tmp_eph_gps != nullptr)
                         {
-                            auto tmp_eph_iter_gps = d_internal_pvt_solver->gps_ephemeris_map.find(in[i][epoch].PRN);
-                            auto tmp_eph_iter_gal = d_internal_pvt_solver->galileo_ephemeris_map.find(in[i][epoch].PRN);
-                            auto tmp_eph_iter_cnav = d_internal_pvt_solver->gps_cnav_ephemeris_map.find(in[i][epoch].PRN);
-                            auto tmp_eph_iter_glo_gnav = d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(in[i][epoch].PRN);
-                            auto tmp_eph_iter_bds_dnav = d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(in[i][epoch].PRN);
-
-                            bool store_valid_observable = false;
+                            d_rtcm_printer->lock_time(*tmp_eph_gps, observable.RX_time, observable);  // keep track of locking time
+                        }
+                    if (tmp_eph_gal != nullptr)
+                        {
+                            d_rtcm_printer->lock_time(*tmp_eph_gal, observable.RX_time, observable);  // keep track of locking time
+                        }
+                    if (tmp_eph_cnav != nullptr)
+                        {
+                            d_rtcm_printer->lock_time(*tmp_eph_cnav, observable.RX_time, observable);  // keep track of locking time
+                        }
+                    if (tmp_eph_glo_gnav != nullptr)
+                        {
+                            d_rtcm_printer->lock_time(*tmp_eph_glo_gnav, observable.RX_time, observable);  // keep track of locking time
+                        }
+                }
+            catch (const boost::exception& ex)
+                {
+                    std::cout << "RTCM boost exception: " << boost::diagnostic_information(ex) << std::endl;
+                    LOG(ERROR) << "RTCM boost exception: " << boost::diagnostic_information(ex);
+                }
+            catch (const std::exception& ex)
+                {
+                    std::cout << "RTCM std exception: " << ex.what() << std::endl;
+                    LOG(ERROR) << "RTCM std exception: " << ex.what();
+                }
+        }
+}
+
+
+void rtklib_pvt_gs::process_user_epoch(User_Pvt_Epoch& epoch)
+{
+    for (uint32_t i = 0; i < d_nchannels; i++)
+        {
+            if (!epoch.valid_pseudoranges.valid(i))
+                {
+                    d_channel_initialized.at(i) = false;  // the current channel is not reporting valid observable
+                }
+        }
+    if (d_rtcm_enabled)
+        {
+            update_rtcm_lock_times(epoch.valid_pseudoranges);
+        }
+    if (epoch.observables.empty())
+        {
+            return;
+        }
+
+    bool flag_display_pvt = false;
+    bool flag_write_RTCM_1019_output = false;
+    bool flag_write_RTCM_1020_output = false;
+    bool flag_write_RTCM_1045_output = false;
+    bool flag_write_RTCM_MSM_output = false;
+    bool flag_write_RINEX_obs_output = false;
+    bool flag_pvt_valid = epoch.pvt_valid;
+    const uint32_t current_RX_time_ms = epoch.rx_time_ms;
+    d_rx_time = epoch.rx_time;
+
+    // compute on the fly PVT solution
+    if (epoch.compute_pvt_output == true)
+        {
+            flag_pvt_valid = d_user_pvt_solver->get_PVT(epoch.observables, false);
+        }
 
-                            if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
+    if (flag_pvt_valid == true)
+        {
+            // initialize (if needed) the accumulated phase offset and apply it to the active channels
+            // required to report accumulated phase cycles comparable to pseudoranges
+            initialize_and_apply_carrier_phase_offset(epoch.observables);
+
+            double Rx_clock_offset_s = d_user_pvt_solver->get_time_offset_s();
+            if (d_enable_rx_clock_correction == true and fabs(Rx_clock_offset_s) > 0.000001)  // 1us !!
+                {
+                    LOG(INFO) << "Warning: Rx clock offset at interpolated RX time: " << Rx_clock_offset_s * 1000.0 << "[ms]"
+                              << " at RX time: " << static_cast<uint32_t>(d_rx_time * 1000.0) << " [ms]";
+                }
+            else
+                {
+                    DLOG(INFO) << "Rx clock offset at interpolated RX time: " << Rx_clock_offset_s * 1000.0 << "[s]"
+                               << " at RX time: " << static_cast<uint32_t>(d_rx_time * 1000.0) << " [ms]";
+                    // Optional debug code: export observables snapshot for rtklib unit testing
+                    // std::cout << "step 1: save gnss_synchro map" << std::endl;
+                    // save_gnss_synchro_map_xml("./gnss_synchro_map.xml");
+                    // getchar(); // stop the execution
+                    // end debug
+                    if (d_display_rate_ms != 0)
+                        {
+                            if (current_RX_time_ms % d_display_rate_ms == 0)
                                 {
-                                    uint32_t prn_aux = tmp_eph_iter_gps->second.i_satellite_PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) and (std::string(in[i][epoch].Signal) == "1C"))
-                                        {
-                                            store_valid_observable = true;
-                                        }
+                                    flag_display_pvt = true;
                                 }
-                            if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
+                        }
+                    if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                        {
+                            if (current_RX_time_ms % d_rtcm_MT1019_rate_ms == 0)
                                 {
-                                    uint32_t prn_aux = tmp_eph_iter_gal->second.i_satellite_PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) and ((std::string(in[i][epoch].Signal) == "1B") or (std::string(in[i][epoch].Signal) == "5X")))
-                                        {
-                                            store_valid_observable = true;
-                                        }
+                                    flag_write_RTCM_1019_output = true;
                                 }
-                            if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
+                        }
+                    if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                        {
+                            if (current_RX_time_ms % d_rtcm_MT1020_rate_ms == 0)
                                 {
-                                    uint32_t prn_aux = tmp_eph_iter_cnav->second.i_satellite_PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) and ((std::string(in[i][epoch].Signal) == "2S") or (std::string(in[i][epoch].Signal) == "L5")))
-                                        {
-                                            store_valid_observable = true;
-                                        }
+                                    flag_write_RTCM_1020_output = true;
                                 }
-                            if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                        }
+                    if (d_rtcm_MT1045_rate_ms != 0)
+                        {
+                            if (current_RX_time_ms % d_rtcm_MT1045_rate_ms == 0)
                                 {
-                                    uint32_t prn_aux = tmp_eph_iter_glo_gnav->second.i_satellite_PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) and ((std::string(in[i][epoch].Signal) == "1G") or (std::string(in[i][epoch].Signal) == "2G")))
-                                        {
-                                            store_valid_observable = true;
-                                        }
+                                    flag_write_RTCM_1045_output = true;
                                 }
-                            if (tmp_eph_iter_bds_dnav != d_internal_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                        }
+                    // TODO: RTCM 1077, 1087 and 1097 are not used, so, disable the output rates
+                    // if (current_RX_time_ms % d_rtcm_MT1077_rate_ms==0 and d_rtcm_MT1077_rate_ms != 0)
+                    //     {
+                    //         last_RTCM_1077_output_time = current_RX_time;
+                    //     }
+                    // if (current_RX_time_ms % d_rtcm_MT1087_rate_ms==0 and d_rtcm_MT1087_rate_ms != 0)
+                    //     {
+                    //         last_RTCM_1087_output_time = current_RX_time;
+                    //     }
+                    // if (current_RX_time_ms % d_rtcm_MT1097_rate_ms==0 and d_rtcm_MT1097_rate_ms != 0)
+                    //     {
+                    //         last_RTCM_1097_output_time = current_RX_time;
+                    //     }
+                    if (d_rtcm_MSM_rate_ms != 0)
+                        {
+                            if (current_RX_time_ms % d_rtcm_MSM_rate_ms == 0)
                                 {
-                                    uint32_t prn_aux = tmp_eph_iter_bds_dnav->second.i_satellite_PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) and ((std::string(in[i][epoch].Signal) == "B1") or (std::string(in[i][epoch].Signal) == "B3")))
-                                        {
-                                            store_valid_observable = true;
-                                        }
+                                    flag_write_RTCM_MSM_output = true;
                                 }
-
-                            if (store_valid_observable)
+                        }
+                    if (d_rinexobs_rate_ms != 0)
+                        {
+                            if (current_RX_time_ms % static_cast<uint32_t>(d_rinexobs_rate_ms) == 0)
                                 {
-                                    // store valid observables in a map.
-                                    d_gnss_observables_map.insert(std::pair<int, Gnss_Synchro>(i, in[i][epoch]));
+                                    flag_write_RINEX_obs_output = true;
                                 }
+                        }
 
-                            if (d_rtcm_enabled)
+                    if (d_first_fix == true)
+                        {
+                            if (d_show_local_time_zone)
                                 {
-                                    try
-                                        {
-                                            if (d_internal_pvt_solver->gps_ephemeris_map.empty() == false)
-                                                {
-                                                    if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->gps_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
-                                                }
-                                            if (d_internal_pvt_solver->galileo_ephemeris_map.empty() == false)
-                                                {
-                                                    if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->galileo_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
-                                                }
-                                            if (d_internal_pvt_solver->gps_cnav_ephemeris_map.empty() == false)
-                                                {
-                                                    if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->gps_cnav_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
-                                                }
-                                            if (d_internal_pvt_solver->glonass_gnav_ephemeris_map.empty() == false)
-                                                {
-                                                    if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
-                                                }
-                                        }
-                                    catch (const boost::exception& ex)
-                                        {
-                                            std::cout << "RTCM boost exception: " << boost::diagnostic_information(ex) << std::endl;
-                                            LOG(ERROR) << "RTCM boost exception: " << boost::diagnostic_information(ex);
-                                        }
-                                    catch (const std::exception& ex)
-                                        {
-                                            std::cout << "RTCM std exception: " << ex.what() << std::endl;
-                                            LOG(ERROR) << "RTCM std exception: " << ex.what();
-                                        }
+                                    boost::posix_time::ptime time_first_solution = d_user_pvt_solver->get_position_UTC_time() + d_utc_diff_time;
+                                    std::cout << "First position fix at " << time_first_solution << d_local_time_str;
+                                }
+                            else
+                                {
+                                    std::cout << "First position fix at " << d_user_pvt_solver->get_position_UTC_time() << " UTC";
                                 }
+                            std::cout << " is Lat = " << d_user_pvt_solver->get_latitude() << " [deg], Long = " << d_user_pvt_solver->get_longitude()
+                                      << " [deg], Height= " << d_user_pvt_solver->get_height() << " [m]" << std::endl;
+                            d_ttff_msgbuf ttff;
+                            ttff.mtype = 1;
+                            d_end = std::chrono::system_clock::now();
+                            std::chrono::duration<double> elapsed_seconds = d_end - d_start;
+                            ttff.ttff = elapsed_seconds.count();
+                            send_sys_v_ttff_msg(ttff);
+                            d_first_fix = false;
                         }
-                    else
+                    print_position(d_kml_output_enabled and (current_RX_time_ms % d_kml_rate_ms == 0),
+                        d_gpx_output_enabled and (current_RX_time_ms % d_gpx_rate_ms == 0),
+                        d_geojson_output_enabled and (current_RX_time_ms % d_geojson_rate_ms == 0),
+                        d_nmea_output_file_enabled and (current_RX_time_ms % d_nmea_rate_ms == 0));
+
+                    /*
+                     *   TYPE  |  RECEIVER
+                     *     0   |  Unknown
+                     *     1   |  GPS L1 C/A
+                     *     2   |  GPS L2C
+                     *     3   |  GPS L5
+                     *     4   |  Galileo E1B
+                     *     5   |  Galileo E5a
+                     *     6   |  Galileo E5b
+                     *     7   |  GPS L1 C/A + GPS L2C
+                     *     8   |  GPS L1 C/A + GPS L5
+                     *     9   |  GPS L1 C/A + Galileo E1B
+                     *    10   |  GPS L1 C/A + Galileo E5a
+                     *    11   |  GPS L1 C/A + Galileo E5b
+                     *    12   |  Galileo E1B + GPS L2C
+                     *    13   |  Galileo E5a + GPS L5
+                     *    14   |  Galileo E1B + Galileo E5a
+                     *    15   |  Galileo E1B + Galileo E5b
+                     *    16   |  GPS L2C + GPS L5
+                     *    17   |  GPS L2C + Galileo E5a
+                     *    18   |  GPS L2C + Galileo E5b
+                     *    21   |  GPS L1 C/A + Galileo E1B + GPS L2C
+                     *    22   |  GPS L1 C/A + Galileo E1B + GPS L5
+                     *    23   |  GLONASS L1 C/A
+                     *    24   |  GLONASS L2 C/A
+                     *    25   |  GLONASS L1 C/A + GLONASS L2 C/A
+                     *    26   |  GPS L1 C/A + GLONASS L1 C/A
+                     *    27   |  Galileo E1B + GLONASS L1 C/A
+                     *    28   |  GPS L2C + GLONASS L1 C/A
+                     *    29   |  GPS L1 C/A + GLONASS L2 C/A
+                     *    30   |  Galileo E1B + GLONASS L2 C/A
+                     *    31   |  GPS L2C + GLONASS L2 C/A
+                     *    32   |  GPS L1 C/A + Galileo E1B + GPS L5 + Galileo E5a
+                     *    500   |  BeiDou B1I
+                     *    501   |  BeiDou B1I + GPS L1 C/A
+                     *    502   |  BeiDou B1I + Galileo E1B
+                     *    503   |  BeiDou B1I + GLONASS L1 C/A
+                     *    504   |  BeiDou B1I + GPS L1 C/A + Galileo E1B
+                     *    505   |  BeiDou B1I + GPS L1 C/A + GLONASS L1 C/A + Galileo E1B
+                     *    506   |  BeiDou B1I + Beidou B3I
+                     *    600   |  BeiDou B3I
+                     *    601   |  BeiDou B3I + GPS L2C
+                     *    602   |  BeiDou B3I + GLONASS L2 C/A
+                     *    603   |  BeiDou B3I + GPS L2C + GLONASS L2 C/A
+                     *    604   |  BeiDou B3I + GPS L1 C/A
+                     *    605   |  BeiDou B3I + Galileo E1B
+                     *    606   |  BeiDou B3I + GLONASS L1 C/A
+                     *    607   |  BeiDou B3I + GPS L1 C/A + Galileo E1B
+                     *    608   |  BeiDou B3I + GPS L1 C/A + Galileo E1B + BeiDou B1I
+                     *    609   |  BeiDou B3I + GPS L1 C/A + Galileo E1B + GLONASS L1 C/A
+                     *    610   |  BeiDou B3I + GPS L1 C/A + Galileo E1B + GLONASS L1 C/A + BeiDou B1I
+                     *   1000   |  GPS L1 C/A + GPS L2C + GPS L5
+                     *   1001   |  GPS L1 C/A + Galileo E1B + GPS L2C + GPS L5 + Galileo E5a
+                     */
+
+                    // the RINEX and RTCM printers take the observables as a map, only built at the epochs they log
+                    if ((d_rinex_output_enabled and flag_write_RINEX_obs_output) or (d_rtcm_enabled and (flag_write_RTCM_MSM_output or !d_rtcm_writing_started)))
                         {
-                            d_channel_initialized.at(i) = false;  // the current channel is not reporting valid observable
+                            epoch.observables.to_map(d_gnss_observables_map);
                         }
-                }
 
-            // ############ 2 COMPUTE THE PVT ################################
-            bool flag_pvt_valid = false;
-            if (d_gnss_observables_map.empty() == false)
-                {
-                    // LOG(INFO) << "diff raw obs time: " << d_gnss_observables_map.cbegin()->second.RX_time * 1000.0 - old_time_debug;
-                    // old_time_debug = d_gnss_observables_map.cbegin()->second.RX_time * 1000.0;
-                    uint32_t current_RX_time_ms = 0;
-                    // #### solve PVT and store the corrected observable set
-                    if (d_internal_pvt_solver->get_PVT(d_gnss_observables_map, false))
+                    // ####################### RINEX FILES #################
+                    if (d_rinex_output_enabled)
                         {
-                            double Rx_clock_offset_s = d_internal_pvt_solver->get_time_offset_s();
-                            if (fabs(Rx_clock_offset_s) * 1000.0 > d_max_obs_block_rx_clock_offset_ms)
+                            std::map<int, Galileo_Ephemeris>::const_iterator galileo_ephemeris_iter;
+                            std::map<int, Gps_Ephemeris>::const_iterator gps_ephemeris_iter;
+                            std::map<int, Gps_CNAV_Ephemeris>::const_iterator gps_cnav_ephemeris_iter;
+                            std::map<int, Glonass_Gnav_Ephemeris>::const_iterator glonass_gnav_ephemeris_iter;
+                            std::map<int, Beidou_Dnav_Ephemeris>::const_iterator beidou_dnav_ephemeris_iter;
+                            if (d_rinex_rotation_s != 0)
                                 {
-                                    if (!d_waiting_obs_block_rx_clock_offset_correction_msg)
+                                    const boost::posix_time::ptime utc_epoch = d_user_pvt_solver->get_position_UTC_time();
+                                    const int64_t rinex_period = static_cast<int64_t>(convert_to_time_t(utc_epoch)) / d_rinex_rotation_s;
+                                    if (d_rinex_header_written and rinex_period != d_rinex_period)
                                         {
-                                            this->message_port_pub(pmt::mp("pvt_to_observables"), pmt::make_any(Rx_clock_offset_s));
-                                            d_waiting_obs_block_rx_clock_offset_correction_msg = true;
-                                            LOG(INFO) << "Sent clock offset correction to observables: " << Rx_clock_offset_s << "[s]";
+                                            // the new files get their own headers, written and updated as for the first ones
+                                            d_rp->rotate_files(utc_epoch);
+                                            d_rinex_header_written = false;
+                                            d_rinex_header_updated = false;
                                         }
+                                    d_rinex_period = rinex_period;
                                 }
-                            else
+                            if (!d_rinex_header_written)  // & we have utc data in nav message!
                                 {
-                                    if (d_enable_rx_clock_correction == true)
+                                    galileo_ephemeris_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                    gps_ephemeris_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                    gps_cnav_ephemeris_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
+                                    glonass_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                    beidou_dnav_ephemeris_iter = d_user_pvt_solver->beidou_dnav_ephemeris_map.cbegin();
+                                    switch (d_type_of_rx)
                                         {
-                                            d_waiting_obs_block_rx_clock_offset_correction_msg = false;
-                                            d_gnss_observables_map_t0 = d_gnss_observables_map_t1;
-                                            apply_rx_clock_offset(d_gnss_observables_map, Rx_clock_offset_s);
-                                            d_gnss_observables_map_t1 = d_gnss_observables_map;
-
-                                            // ### select the rx_time and interpolate observables at that time
-                                            if (!d_gnss_observables_map_t0.empty())
+                                        case 1:  // GPS L1 C/A only
+                                            if (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
                                                 {
-                                                    uint32_t t0_int_ms = static_cast<uint32_t>(d_gnss_observables_map_t0.cbegin()->second.RX_time * 1000.0);
-                                                    uint32_t adjust_next_20ms = 20 - t0_int_ms % 20;
-                                                    current_RX_time_ms = t0_int_ms + adjust_next_20ms;
-
-                                                    if (current_RX_time_ms % d_output_rate_ms == 0)
-                                                        {
-                                                            d_rx_time = static_cast<double>(current_RX_time_ms) / 1000.0;
-                                                            // std::cout << " obs time t0: " << d_gnss_observables_map_t0.cbegin()->second.RX_time
-                                                            //           << " t1: " << d_gnss_observables_map_t1.cbegin()->second.RX_time
-                                                            //           << " interp time: " << d_rx_time << std::endl;
-                                                            d_gnss_observables_map = interpolate_observables(d_gnss_observables_map_t0,
-                                                                d_gnss_observables_map_t1,
-                                                                d_rx_time);
-                                                            flag_compute_pvt_output = true;
-                                                            // d_rx_time = current_RX_time;
-                                                            // std::cout.precision(17);
-                                                            // std::cout << "current_RX_time: " << current_RX_time << " map time: " << d_gnss_observables_map.begin()->second.RX_time << std::endl;
-                                                        }
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, d_rx_time);
+                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
+                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-                                    else
-                                        {
-                                            d_rx_time = d_gnss_observables_map.begin()->second.RX_time;
-                                            current_RX_time_ms = static_cast<uint32_t>(d_rx_time * 1000.0);
-                                            if (current_RX_time_ms % d_output_rate_ms == 0)
+                                            break;
+                                        case 2:  // GPS L2C only
+                                            if (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
                                                 {
-                                                    flag_compute_pvt_output = true;
-                                                    // std::cout.precision(17);
-                                                    // std::cout << "current_RX_time: " << current_RX_time << " map time: " << d_gnss_observables_map.begin()->second.RX_time << std::endl;
+                                                    std::string signal("2S");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, d_rx_time, signal);
+                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_cnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                            flag_pvt_valid = true;
-                                        }
-                                }
-                        }
-                    // debug code
-                    // else
-                    //     {
-                    //         DLOG(INFO) << "Internal PVT solver error";
-                    //     }
-
-                    // compute on the fly PVT solution
-                    if (flag_compute_pvt_output == true)
-                        {
-                            flag_pvt_valid = d_user_pvt_solver->get_PVT(d_gnss_observables_map, false);
-                        }
-
-                    if (flag_pvt_valid == true)
-                        {
-                            // initialize (if needed) the accumulated phase offset and apply it to the active channels
-                            // required to report accumulated phase cycles comparable to pseudoranges
-                            initialize_and_apply_carrier_phase_offset();
-
-                            double Rx_clock_offset_s = d_user_pvt_solver->get_time_offset_s();
-                            if (d_enable_rx_clock_correction == true and fabs(Rx_clock_offset_s) > 0.000001)  // 1us !!
-                                {
-                                    LOG(INFO) << "Warning: Rx clock offset at interpolated RX time: " << Rx_clock_offset_s * 1000.0 << "[ms]"
-                                              << " at RX time: " << static_cast<uint32_t>(d_rx_time * 1000.0) << " [ms]";
-                                }
-                            else
-                                {
-                                    DLOG(INFO) << "Rx clock offset at interpolated RX time: " << Rx_clock_offset_s * 1000.0 << "[s]"
-                                               << " at RX time: " << static_cast<uint32_t>(d_rx_time * 1000.0) << " [ms]";
-                                    // Optional debug code: export observables snapshot for rtklib unit testing
-                                    // std::cout << "step 1: save gnss_synchro map" << std::endl;
-                                    // save_gnss_synchro_map_xml("./gnss_synchro_map.xml");
-                                    // getchar(); // stop the execution
-                                    // end debug
-                                    if (d_display_rate_ms != 0)
-                                        {
-                                            if (current_RX_time_ms % d_display_rate_ms == 0)
+                                            break;
+                                        case 3:  // GPS L5 only
+                                            if (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
                                                 {
-                                                    flag_display_pvt = true;
+                                                    std::string signal("L5");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, d_rx_time, signal);
+                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_cnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-                                    if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                        {
-                                            if (current_RX_time_ms % d_rtcm_MT1019_rate_ms == 0)
+                                            break;
+                                        case 4:  // Galileo E1B only
+                                            if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
                                                 {
-                                                    flag_write_RTCM_1019_output = true;
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time);
+                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-                                    if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                        {
-                                            if (current_RX_time_ms % d_rtcm_MT1020_rate_ms == 0)
+                                            break;
+                                        case 5:  // Galileo E5a only
+                                            if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
                                                 {
-                                                    flag_write_RTCM_1020_output = true;
+                                                    std::string signal("5X");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, signal);
+                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-                                    if (d_rtcm_MT1045_rate_ms != 0)
-                                        {
-                                            if (current_RX_time_ms % d_rtcm_MT1045_rate_ms == 0)
+                                            break;
+                                        case 6:  // Galileo E5b only
+                                            if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
                                                 {
-                                                    flag_write_RTCM_1045_output = true;
+                                                    std::string signal("7X");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, signal);
+                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-                                    // TODO: RTCM 1077, 1087 and 1097 are not used, so, disable the output rates
-                                    // if (current_RX_time_ms % d_rtcm_MT1077_rate_ms==0 and d_rtcm_MT1077_rate_ms != 0)
-                                    //     {
-                                    //         last_RTCM_1077_output_time = current_RX_time;
-                                    //     }
-                                    // if (current_RX_time_ms % d_rtcm_MT1087_rate_ms==0 and d_rtcm_MT1087_rate_ms != 0)
-                                    //     {
-                                    //         last_RTCM_1087_output_time = current_RX_time;
-                                    //     }
-                                    // if (current_RX_time_ms % d_rtcm_MT1097_rate_ms==0 and d_rtcm_MT1097_rate_ms != 0)
-                                    //     {
-                                    //         last_RTCM_1097_output_time = current_RX_time;
-                                    //     }
-                                    if (d_rtcm_MSM_rate_ms != 0)
-                                        {
-                                            if (current_RX_time_ms % d_rtcm_MSM_rate_ms == 0)
+                                            break;
+                                        case 7:  // GPS L1 C/A + GPS L2C
+                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
                                                 {
-                                                    flag_write_RTCM_MSM_output = true;
+                                                    std::string signal("1C 2S");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, signal);
+                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
+                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_cnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-                                    if (d_rinexobs_rate_ms != 0)
-                                        {
-                                            if (current_RX_time_ms % static_cast<uint32_t>(d_rinexobs_rate_ms) == 0)
+                                            break;
+                                        case 8:  // GPS L1 + GPS L5
+                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
                                                 {
-                                                    flag_write_RINEX_obs_output = true;
+                                                    std::string signal("1C L5");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, signal);
+                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
+                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-
-                                    if (d_first_fix == true)
-                                        {
-                                            if (d_show_local_time_zone)
+                                            break;
+                                        case 9:  // GPS L1 C/A + Galileo E1B
+                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
                                                 {
-                                                    boost::posix_time::ptime time_first_solution = d_user_pvt_solver->get_position_UTC_time() + d_utc_diff_time;
-                                                    std::cout << "First position fix at " << time_first_solution << d_local_time_str;
+                                                    std::string gal_signal("1B");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                            else
+                                            break;
+                                        case 10:  // GPS L1 C/A + Galileo E5a
+                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
                                                 {
-                                                    std::cout << "First position fix at " << d_user_pvt_solver->get_position_UTC_time() << " UTC";
+                                                    std::string gal_signal("5X");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                            std::cout << " is Lat = " << d_user_pvt_solver->get_latitude() << " [deg], Long = " << d_user_pvt_solver->get_longitude()
-                                                      << " [deg], Height= " << d_user_pvt_solver->get_height() << " [m]" << std::endl;
-                                            d_ttff_msgbuf ttff;
-                                            ttff.mtype = 1;
-                                            d_end = std::chrono::system_clock::now();
-                                            std::chrono::duration<double> elapsed_seconds = d_end - d_start;
-                                            ttff.ttff = elapsed_seconds.count();
-                                            send_sys_v_ttff_msg(ttff);
-                                            d_first_fix = false;
-                                        }
-                                    if (d_kml_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_kml_rate_ms == 0)
+                                            break;
+                                        case 11:  // GPS L1 C/A + Galileo E5b
+                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
                                                 {
-                                                    d_kml_dump->print_position(d_user_pvt_solver.get(), false);
+                                                    std::string gal_signal("7X");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-                                    if (d_gpx_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_gpx_rate_ms == 0)
+                                            break;
+                                        case 13:  // L5+E5a
+                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
                                                 {
-                                                    d_gpx_dump->print_position(d_user_pvt_solver.get(), false);
+                                                    std::string gal_signal("5X");
+                                                    std::string gps_signal("L5");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gps_signal, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-                                    if (d_geojson_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_geojson_rate_ms == 0)
+                                            break;
+                                        case 14:  // Galileo E1B + Galileo E5a
+                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
                                                 {
-                                                    d_geojson_printer->print_position(d_user_pvt_solver.get(), false);
+                                                    std::string gal_signal("1B 5X");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
-                                    if (d_nmea_output_file_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_nmea_rate_ms == 0)
+                                            break;
+                                        case 15:  // Galileo E1B + Galileo E5b
+                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
                                                 {
-                                                    d_nmea_printer->Print_Nmea_Line(d_user_pvt_solver.get(), false);
+                                                    std::string gal_signal("1B 7X");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 23:  // GLONASS L1 C/A only
+                                            if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                {
+                                                    std::string signal("1G");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, signal);
+                                                    d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
+                                                    d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 24:  // GLONASS L2 C/A only
+                                            if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                {
+                                                    std::string signal("2G");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, signal);
+                                                    d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
+                                                    d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 25:  // GLONASS L1 C/A + GLONASS L2 C/A
+                                            if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                {
+                                                    std::string signal("1G 2G");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, signal);
+                                                    d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
+                                                    d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 26:  // GPS L1 C/A + GLONASS L1 C/A
+                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
+                                                {
+                                                    std::string glo_signal("1G");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal);
+                                                    if (d_rinex_version == 3)
+                                                        {
+                                                            d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                            d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                        }
+                                                    if (d_rinex_version == 2)
+                                                        {
+                                                            d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
+                                                            d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
+                                                            d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
+                                                            d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                        }
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 27:  // Galileo E1B + GLONASS L1 C/A
+                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
+                                                {
+                                                    std::string glo_signal("1G");
+                                                    std::string gal_signal("1B");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->galileo_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 28:  // GPS L2C + GLONASS L1 C/A
+                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                {
+                                                    std::string glo_signal("1G");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 29:  // GPS L1 C/A + GLONASS L2 C/A
+                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
+                                                {
+                                                    std::string glo_signal("2G");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal);
+                                                    if (d_rinex_version == 3)
+                                                        {
+                                                            d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                            d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                        }
+                                                    if (d_rinex_version == 2)
+                                                        {
+                                                            d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
+                                                            d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
+                                                            d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
+                                                            d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                        }
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 30:  // Galileo E1B + GLONASS L2 C/A
+                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
+                                                {
+                                                    std::string glo_signal("2G");
+                                                    std::string gal_signal("1B");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->galileo_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 31:  // GPS L2C + GLONASS L2 C/A
+                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                {
+                                                    std::string glo_signal("2G");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 32:  // L1+E1+L5+E5a
+                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
+                                                (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()) and
+                                                (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
+                                                {
+                                                    std::string gal_signal("1B 5X");
+                                                    std::string gps_signal("1C L5");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gps_signal, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 33:  // L1+E1+E5a
+                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
+                                                (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
+                                                {
+                                                    std::string gal_signal("1B 5X");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 500:  // BDS B1I only
+                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                                {
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
+                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
 
-                                    /*
-                                     *   TYPE  |  RECEIVER
-                                     *     0   |  Unknown
-                                     *     1   |  GPS L1 C/A
-                                     *     2   |  GPS L2C
-                                     *     3   |  GPS L5
-                                     *     4   |  Galileo E1B
-                                     *     5   |  Galileo E5a
-                                     *     6   |  Galileo E5b
-                                     *     7   |  GPS L1 C/A + GPS L2C
-                                     *     8   |  GPS L1 C/A + GPS L5
-                                     *     9   |  GPS L1 C/A + Galileo E1B
-                                     *    10   |  GPS L1 C/A + Galileo E5a
-                                     *    11   |  GPS L1 C/A + Galileo E5b
-                                     *    12   |  Galileo E1B + GPS L2C
-                                     *    13   |  Galileo E5a + GPS L5
-                                     *    14   |  Galileo E1B + Galileo E5a
-                                     *    15   |  Galileo E1B + Galileo E5b
-                                     *    16   |  GPS L2C + GPS L5
-                                     *    17   |  GPS L2C + Galileo E5a
-                                     *    18   |  GPS L2C + Galileo E5b
-                                     *    21   |  GPS L1 C/A + Galileo E1B + GPS L2C
-                                     *    22   |  GPS L1 C/A + Galileo E1B + GPS L5
-                                     *    23   |  GLONASS L1 C/A
-                                     *    24   |  GLONASS L2 C/A
-                                     *    25   |  GLONASS L1 C/A + GLONASS L2 C/A
-                                     *    26   |  GPS L1 C/A + GLONASS L1 C/A
-                                     *    27   |  Galileo E1B + GLONASS L1 C/A
-                                     *    28   |  GPS L2C + GLONASS L1 C/A
-                                     *    29   |  GPS L1 C/A + GLONASS L2 C/A
-                                     *    30   |  Galileo E1B + GLONASS L2 C/A
-                                     *    31   |  GPS L2C + GLONASS L2 C/A
-                                     *    32   |  GPS L1 C/A + Galileo E1B + GPS L5 + Galileo E5a
-                                     *    500   |  BeiDou B1I
-                                     *    501   |  BeiDou B1I + GPS L1 C/A
-                                     *    502   |  BeiDou B1I + Galileo E1B
-                                     *    503   |  BeiDou B1I + GLONASS L1 C/A
-                                     *    504   |  BeiDou B1I + GPS L1 C/A + Galileo E1B
-                                     *    505   |  BeiDou B1I + GPS L1 C/A + GLONASS L1 C/A + Galileo E1B
-                                     *    506   |  BeiDou B1I + Beidou B3I
-                                     *    600   |  BeiDou B3I
-                                     *    601   |  BeiDou B3I + GPS L2C
-                                     *    602   |  BeiDou B3I + GLONASS L2 C/A
-                                     *    603   |  BeiDou B3I + GPS L2C + GLONASS L2 C/A
-                                     *    604   |  BeiDou B3I + GPS L1 C/A
-                                     *    605   |  BeiDou B3I + Galileo E1B
-                                     *    606   |  BeiDou B3I + GLONASS L1 C/A
-                                     *    607   |  BeiDou B3I + GPS L1 C/A + Galileo E1B
-                                     *    608   |  BeiDou B3I + GPS L1 C/A + Galileo E1B + BeiDou B1I
-                                     *    609   |  BeiDou B3I + GPS L1 C/A + Galileo E1B + GLONASS L1 C/A
-                                     *    610   |  BeiDou B3I + GPS L1 C/A + Galileo E1B + GLONASS L1 C/A + BeiDou B1I
-                                     *   1000   |  GPS L1 C/A + GPS L2C + GPS L5
-                                     *   1001   |  GPS L1 C/A + Galileo E1B + GPS L2C + GPS L5 + Galileo E5a
-                                     */
-
-                                    // ####################### RINEX FILES #################
-                                    if (d_rinex_output_enabled)
-                                        {
-                                            std::map<int, Galileo_Ephemeris>::const_iterator galileo_ephemeris_iter;
-                                            std::map<int, Gps_Ephemeris>::const_iterator gps_ephemeris_iter;
-                                            std::map<int, Gps_CNAV_Ephemeris>::const_iterator gps_cnav_ephemeris_iter;
-                                            std::map<int, Glonass_Gnav_Ephemeris>::const_iterator glonass_gnav_ephemeris_iter;
-                                            std::map<int, Beidou_Dnav_Ephemeris>::const_iterator beidou_dnav_ephemeris_iter;
-                                            if (!d_rinex_header_written)  // & we have utc data in nav message!
+                                            break;
+                                        case 501:  // BeiDou B1I + GPS L1 C/A
+                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend()))
                                                 {
-                                                    galileo_ephemeris_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                    gps_ephemeris_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                    gps_cnav_ephemeris_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                                    glonass_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                    beidou_dnav_ephemeris_iter = d_user_pvt_solver->beidou_dnav_ephemeris_map.cbegin();
-                                                    switch (d_type_of_rx)
-                                                        {
-                                                        case 1:  // GPS L1 C/A only
-                                                            if (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                {
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, d_rx_time);
-                                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
-                                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 2:  // GPS L2C only
-                                                            if (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                                                {
-                                                                    std::string signal("2S");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, d_rx_time, signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_cnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 3:  // GPS L5 only
-                                                            if (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                                                {
-                                                                    std::string signal("L5");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, d_rx_time, signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_cnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 4:  // Galileo E1B only
-                                                            if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                {
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time);
-                                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 5:  // Galileo E5a only
-                                                            if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                {
-                                                                    std::string signal("5X");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 6:  // Galileo E5b only
-                                                            if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                {
-                                                                    std::string signal("7X");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 7:  // GPS L1 C/A + GPS L2C
-                                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string signal("1C 2S");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
-                                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_cnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 8:  // GPS L1 + GPS L5
-                                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string signal("1C L5");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
-                                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 9:  // GPS L1 C/A + Galileo E1B
-                                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gal_signal("1B");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 10:  // GPS L1 C/A + Galileo E5a
-                                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gal_signal("5X");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 11:  // GPS L1 C/A + Galileo E5b
-                                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gal_signal("7X");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 13:  // L5+E5a
-                                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gal_signal("5X");
-                                                                    std::string gps_signal("L5");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gps_signal, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 14:  // Galileo E1B + Galileo E5a
-                                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gal_signal("1B 5X");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 15:  // Galileo E1B + Galileo E5b
-                                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gal_signal("1B 7X");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navGalFile, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 23:  // GLONASS L1 C/A only
-                                                            if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                {
-                                                                    std::string signal("1G");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
-                                                                    d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 24:  // GLONASS L2 C/A only
-                                                            if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                {
-                                                                    std::string signal("2G");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
-                                                                    d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 25:  // GLONASS L1 C/A + GLONASS L2 C/A
-                                                            if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                {
-                                                                    std::string signal("1G 2G");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
-                                                                    d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 26:  // GPS L1 C/A + GLONASS L1 C/A
-                                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string glo_signal("1G");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal);
-                                                                    if (d_rinex_version == 3)
-                                                                        {
-                                                                            d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                            d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                        }
-                                                                    if (d_rinex_version == 2)
-                                                                        {
-                                                                            d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
-                                                                            d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
-                                                                            d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
-                                                                            d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                        }
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 27:  // Galileo E1B + GLONASS L1 C/A
-                                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string glo_signal("1G");
-                                                                    std::string gal_signal("1B");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->galileo_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 28:  // GPS L2C + GLONASS L1 C/A
-                                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string glo_signal("1G");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 29:  // GPS L1 C/A + GLONASS L2 C/A
-                                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string glo_signal("2G");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal);
-                                                                    if (d_rinex_version == 3)
-                                                                        {
-                                                                            d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                            d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                        }
-                                                                    if (d_rinex_version == 2)
-                                                                        {
-                                                                            d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
-                                                                            d_rp->rinex_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
-                                                                            d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
-                                                                            d_rp->log_rinex_nav(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                        }
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 30:  // Galileo E1B + GLONASS L2 C/A
-                                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string glo_signal("2G");
-                                                                    std::string gal_signal("1B");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->galileo_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 31:  // GPS L2C + GLONASS L2 C/A
-                                                            if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string glo_signal("2G");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, glo_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_ephemeris_map, d_user_pvt_solver->glonass_gnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 32:  // L1+E1+L5+E5a
-                                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
-                                                                (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()) and
-                                                                (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gal_signal("1B 5X");
-                                                                    std::string gps_signal("1C L5");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gps_signal, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 33:  // L1+E1+E5a
-                                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
-                                                                (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gal_signal("1B 5X");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 500:  // BDS B1I only
-                                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                {
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
-                                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-
-                                                            break;
-                                                        case 501:  // BeiDou B1I + GPS L1 C/A
-                                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string bds_signal("B1");
-                                                                    // d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, beidou_dnav_ephemeris_iter->second, d_rx_time, bds_signal);
-                                                                    // d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-
-                                                            break;
-                                                        case 502:  // BeiDou B1I + Galileo E1B
-                                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string bds_signal("B1");
-                                                                    std::string gal_signal("1B");
-                                                                    // d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, beidou_dnav_ephemeris_iter->second, d_rx_time, gal_signal, bds_signal);
-                                                                    // d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-
-                                                            break;
-                                                        case 503:  // BeiDou B1I + GLONASS L1 C/A
-                                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                {
-                                                                    // d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
-                                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    // d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-
-                                                            break;
-                                                        case 504:  // BeiDou B1I + GPS L1 C/A + Galileo E1B
-                                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                {
-                                                                    // d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
-                                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    // d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-
-                                                            break;
-                                                        case 505:  // BeiDou B1I + GPS L1 C/A + GLONASS L1 C/A + Galileo E1B
-                                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                {
-                                                                    // d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
-                                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    // d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-
-                                                            break;
-                                                        case 506:  // BeiDou B1I + Beidou B3I
-                                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                {
-                                                                    // d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
-                                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    // d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-
-                                                            break;
-                                                        case 600:  // BDS B3I only
-                                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                {
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B3");
-                                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-
-                                                            break;
-                                                        case 601:  // BeiDou B3I + GPS L2C
-                                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                {
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B3");
-                                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-
-                                                            break;
-                                                        case 602:  // BeiDou B3I + GLONASS L2 C/A
-                                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                {
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B3");
-                                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
+                                                    std::string bds_signal("B1");
+                                                    // d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, beidou_dnav_ephemeris_iter->second, d_rx_time, bds_signal);
+                                                    // d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
 
-                                                            break;
-                                                        case 603:  // BeiDou B3I + GPS L2C + GLONASS L2 C/A
-                                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                {
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B3");
-                                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
+                                            break;
+                                        case 502:  // BeiDou B1I + Galileo E1B
+                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend()))
+                                                {
+                                                    std::string bds_signal("B1");
+                                                    std::string gal_signal("1B");
+                                                    // d_rp->rinex_obs_header(d_rp->obsFile, galileo_ephemeris_iter->second, beidou_dnav_ephemeris_iter->second, d_rx_time, gal_signal, bds_signal);
+                                                    // d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
 
-                                                            break;
-                                                        case 1000:  // GPS L1 C/A + GPS L2C + GPS L5
-                                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
-                                                                (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gps_signal("1C 2S L5");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, gps_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
-                                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        case 1001:  // GPS L1 C/A + Galileo E1B + GPS L2C + GPS L5 + Galileo E5a
-                                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and
-                                                                (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
-                                                                (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                {
-                                                                    std::string gal_signal("1B 5X");
-                                                                    std::string gps_signal("1C 2S L5");
-                                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gps_signal, gal_signal);
-                                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
-                                                                    d_rinex_header_written = true;  // do not write header anymore
-                                                                }
-                                                            break;
-                                                        default:
-                                                            break;
-                                                        }
+                                            break;
+                                        case 503:  // BeiDou B1I + GLONASS L1 C/A
+                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                                {
+                                                    // d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
+                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    // d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                            if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
+
+                                            break;
+                                        case 504:  // BeiDou B1I + GPS L1 C/A + Galileo E1B
+                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
                                                 {
-                                                    galileo_ephemeris_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                    gps_ephemeris_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                    gps_cnav_ephemeris_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                                    glonass_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                    beidou_dnav_ephemeris_iter = d_user_pvt_solver->beidou_dnav_ephemeris_map.cbegin();
+                                                    // d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
+                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    // d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
 
-                                                    // Log observables into the RINEX file
-                                                    if (flag_write_RINEX_obs_output)
-                                                        {
-                                                            switch (d_type_of_rx)
-                                                                {
-                                                                case 1:  // GPS L1 C/A only
-                                                                    if (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
-                                                                                {
-                                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                                    d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_utc_model, d_user_pvt_solver->gps_iono, gps_ephemeris_iter->second);
-                                                                                    d_rinex_header_updated = true;
-                                                                                }
-                                                                        }
-                                                                    break;
-                                                                case 2:  // GPS L2C only
-                                                                    if (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 3:  // GPS L5
-                                                                    if (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 4:  // Galileo E1B only
-                                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1B");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                        {
-                                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 5:  // Galileo E5a only
-                                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "5X");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                        {
-                                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 6:  // Galileo E5b only
-                                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "7X");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                        {
-                                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 7:  // GPS L1 C/A + GPS L2C
-                                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
-                                                                                {
-                                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                                    d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_utc_model, d_user_pvt_solver->gps_iono, gps_ephemeris_iter->second);
-                                                                                    d_rinex_header_updated = true;
-                                                                                }
-                                                                        }
-                                                                    break;
-                                                                case 8:  // L1+L5
-                                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                            if (!d_rinex_header_updated and ((d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0) or (d_user_pvt_solver->gps_utc_model.d_A0 != 0)))
-                                                                                {
-                                                                                    if (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0)
-                                                                                        {
-                                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
-                                                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono);
-                                                                                        }
-                                                                                    else
-                                                                                        {
-                                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_utc_model, d_user_pvt_solver->gps_iono, gps_ephemeris_iter->second);
-                                                                                        }
-                                                                                    d_rinex_header_updated = true;
-                                                                                }
-                                                                        }
-                                                                    break;
-                                                                case 9:  // GPS L1 C/A + Galileo E1B
-                                                                    if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
-                                                                                {
-                                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                                    d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                                    d_rinex_header_updated = true;
-                                                                                }
-                                                                        }
-                                                                    break;
-                                                                case 13:  // L5+E5a
-                                                                    if ((gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0) and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rinex_header_updated = true;  // do not write header anymore
-                                                                        }
-                                                                    break;
-                                                                case 14:  // Galileo E1B + Galileo E5a
-                                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1B 5X");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                        {
-                                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 15:  // Galileo E1B + Galileo E5b
-                                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1B 7X");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                        {
-                                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 23:  // GLONASS L1 C/A only
-                                                                    if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1C");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->glonass_gnav_utc_model.d_tau_c != 0))
-                                                                        {
-                                                                            d_rp->update_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->glonass_gnav_utc_model);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 24:  // GLONASS L2 C/A only
-                                                                    if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "2C");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->glonass_gnav_utc_model.d_tau_c != 0))
-                                                                        {
-                                                                            d_rp->update_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->glonass_gnav_utc_model);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 25:  // GLONASS L1 C/A + GLONASS L2 C/A
-                                                                    if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1C 2C");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->glonass_gnav_utc_model.d_tau_c != 0))
-                                                                        {
-                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->glonass_gnav_utc_model);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 26:  // GPS L1 C/A + GLONASS L1 C/A
-                                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
-                                                                                {
-                                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                                    d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                                    d_rinex_header_updated = true;  // do not write header anymore
-                                                                                }
-                                                                        }
-                                                                    break;
-                                                                case 27:  // Galileo E1B + GLONASS L1 C/A
-                                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                            d_rinex_header_updated = true;  // do not write header anymore
-                                                                        }
-                                                                    break;
-                                                                case 28:  // GPS L2C + GLONASS L1 C/A
-                                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                            d_rinex_header_updated = true;  // do not write header anymore
-                                                                        }
-                                                                    break;
-                                                                case 29:  // GPS L1 C/A + GLONASS L2 C/A
-                                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
-                                                                                {
-                                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                                    d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                                    d_rinex_header_updated = true;  // do not write header anymore
-                                                                                }
-                                                                        }
-                                                                    break;
-                                                                case 30:  // Galileo E1B + GLONASS L2 C/A
-                                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                            d_rinex_header_updated = true;  // do not write header anymore
-                                                                        }
-                                                                    break;
-                                                                case 31:  // GPS L2C + GLONASS L2 C/A
-                                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
-                                                                            d_rinex_header_updated = true;  // do not write header anymore
-                                                                        }
-                                                                    break;
-                                                                case 32:  // L1+E1+L5+E5a
-                                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                            if (!d_rinex_header_updated and ((d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0) or (d_user_pvt_solver->gps_utc_model.d_A0 != 0)) and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                                {
-                                                                                    if (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0)
-                                                                                        {
-                                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
-                                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                                        }
-                                                                                    else
-                                                                                        {
-                                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                                        }
-                                                                                    d_rinex_header_updated = true;  // do not write header anymore
-                                                                                }
-                                                                        }
-                                                                    break;
-                                                                case 33:  // L1+E1+E5a
-                                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
-                                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0) and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                                {
-                                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                                    d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                                    d_rinex_header_updated = true;  // do not write header anymore
-                                                                                }
-                                                                        }
-                                                                    break;
-                                                                case 500:  // BDS B1I only
-                                                                    if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "B1");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->beidou_dnav_utc_model.d_A0_UTC != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_utc_model, d_user_pvt_solver->beidou_dnav_iono);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 600:  // BDS B3I only
-                                                                    if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "B3");
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->beidou_dnav_utc_model.d_A0_UTC != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->beidou_dnav_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_utc_model, d_user_pvt_solver->beidou_dnav_iono);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 1000:  // GPS L1 C/A + GPS L2C + GPS L5
-                                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
-                                                                        (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, true);
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_utc_model, d_user_pvt_solver->gps_iono, gps_ephemeris_iter->second);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                case 1001:  // GPS L1 C/A + Galileo E1B + GPS L2C + GPS L5 + Galileo E5a
-                                                                    if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and
-                                                                        (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
-                                                                        (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, true);
-                                                                        }
-                                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0) and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
-                                                                        {
-                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
-                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
-                                                                            d_rinex_header_updated = true;
-                                                                        }
-                                                                    break;
-                                                                default:
-                                                                    break;
-                                                                }
-                                                        }
+                                            break;
+                                        case 505:  // BeiDou B1I + GPS L1 C/A + GLONASS L1 C/A + Galileo E1B
+                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                                {
+                                                    // d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
+                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    // d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
                                                 }
-                                        }
 
-                                    // ####################### RTCM MESSAGES #################
-                                    try
-                                        {
-                                            if (d_rtcm_writing_started and d_rtcm_enabled)
+                                            break;
+                                        case 506:  // BeiDou B1I + Beidou B3I
+                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
                                                 {
-                                                    switch (d_type_of_rx)
-                                                        {
-                                                        case 1:  // GPS L1 C/A
-                                                            if (flag_write_RTCM_1019_output == true)
-                                                                {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_MSM_output == true)
-                                                                {
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            break;
-                                                        case 4:
-                                                        case 5:
-                                                        case 6:
-                                                            if (flag_write_RTCM_1045_output == true)
-                                                                {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_MSM_output == true)
-                                                                {
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            break;
-                                                        case 7:  // GPS L1 C/A + GPS L2C
-                                                            if (flag_write_RTCM_1019_output == true)
-                                                                {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_MSM_output == true)
-                                                                {
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                                                    if ((gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            break;
-                                                        case 8:  // L1+L5
-                                                            if (flag_write_RTCM_1019_output == true)
-                                                                {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_MSM_output == true)
-                                                                {
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                                                    if ((gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            break;
-                                                        case 9:  // GPS L1 C/A + Galileo E1B
-                                                            if (flag_write_RTCM_1019_output == true)
-                                                                {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_1045_output == true)
-                                                                {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_MSM_output == true)
-                                                                {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    int gps_channel = 0;
-                                                                    int gal_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
-                                                                        {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gps_channel == 0)
-                                                                                {
-                                                                                    if (system == "G")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gps_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (gal_channel == 0)
-                                                                                {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                        }
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            break;
-                                                        case 13:  // L5+E5a
-                                                            if (flag_write_RTCM_1045_output == true)
-                                                                {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
-                                                                        }
-                                                                }
+                                                    // d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B1");
+                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    // d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
 
-                                                            if (flag_write_RTCM_MSM_output and d_rtcm_MSM_rate_ms != 0)
-                                                                {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                                                    int gal_channel = 0;
-                                                                    int gps_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
-                                                                        {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gps_channel == 0)
-                                                                                {
-                                                                                    if (system == "G")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gps_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (gal_channel == 0)
-                                                                                {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                        }
+                                            break;
+                                        case 600:  // BDS B3I only
+                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                                {
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B3");
+                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->beidou_dnav_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
 
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend() and (d_rtcm_MT1097_rate_ms != 0))
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend() and (d_rtcm_MT1077_rate_ms != 0))
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            break;
-                                                        case 14:
-                                                        case 15:
-                                                            if (flag_write_RTCM_1045_output == true)
-                                                                {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_MSM_output == true)
-                                                                {
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            break;
-                                                        case 23:
-                                                        case 24:
-                                                        case 25:
-                                                            if (flag_write_RTCM_1020_output == true)
-                                                                {
-                                                                    for (auto glonass_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_ephemeris_iter++)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_MSM_output == true)
-                                                                {
-                                                                    auto glo_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    if (glo_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glo_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 26:  // GPS L1 C/A + GLONASS L1 C/A
-                                                            if (flag_write_RTCM_1019_output == true)
-                                                                {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_1020_output == true)
+                                            break;
+                                        case 601:  // BeiDou B3I + GPS L2C
+                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                                {
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B3");
+                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+
+                                            break;
+                                        case 602:  // BeiDou B3I + GLONASS L2 C/A
+                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                                {
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B3");
+                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+
+                                            break;
+                                        case 603:  // BeiDou B3I + GPS L2C + GLONASS L2 C/A
+                                            if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                                {
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, "B3");
+                                                    // d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_iono, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+
+                                            break;
+                                        case 1000:  // GPS L1 C/A + GPS L2C + GPS L5
+                                            if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
+                                                (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                {
+                                                    std::string gps_signal("1C 2S L5");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, gps_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
+                                                    d_rp->log_rinex_nav(d_rp->navFile, d_user_pvt_solver->gps_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        case 1001:  // GPS L1 C/A + Galileo E1B + GPS L2C + GPS L5 + Galileo E5a
+                                            if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and
+                                                (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
+                                                (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                {
+                                                    std::string gal_signal("1B 5X");
+                                                    std::string gps_signal("1C 2S L5");
+                                                    d_rp->rinex_obs_header(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, gps_signal, gal_signal);
+                                                    d_rp->rinex_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                    d_rp->log_rinex_nav(d_rp->navMixFile, d_user_pvt_solver->gps_ephemeris_map, d_user_pvt_solver->galileo_ephemeris_map);
+                                                    d_rinex_header_written = true;  // do not write header anymore
+                                                }
+                                            break;
+                                        default:
+                                            break;
+                                        }
+                                }
+                            if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
+                                {
+                                    galileo_ephemeris_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                    gps_ephemeris_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                    gps_cnav_ephemeris_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
+                                    glonass_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                    beidou_dnav_ephemeris_iter = d_user_pvt_solver->beidou_dnav_ephemeris_map.cbegin();
+
+                                    // Log observables into the RINEX file
+                                    if (flag_write_RINEX_obs_output)
+                                        {
+                                            switch (d_type_of_rx)
+                                                {
+                                                case 1:  // GPS L1 C/A only
+                                                    if (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
                                                                 {
-                                                                    for (auto glonass_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_ephemeris_iter++)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
-                                                                        }
+                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                                    d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_utc_model, d_user_pvt_solver->gps_iono, gps_ephemeris_iter->second);
+                                                                    d_rinex_header_updated = true;
                                                                 }
-                                                            if (flag_write_RTCM_MSM_output == true)
+                                                        }
+                                                    break;
+                                                case 2:  // GPS L2C only
+                                                    if (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 3:  // GPS L5
+                                                    if (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 4:  // Galileo E1B only
+                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1B");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
+                                                        {
+                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 5:  // Galileo E5a only
+                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "5X");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
+                                                        {
+                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 6:  // Galileo E5b only
+                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "7X");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
+                                                        {
+                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 7:  // GPS L1 C/A + GPS L2C
+                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
                                                                 {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    int gps_channel = 0;
-                                                                    int glo_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
-                                                                        {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gps_channel == 0)
-                                                                                {
-                                                                                    if (system == "G")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gps_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (glo_channel == 0)
-                                                                                {
-                                                                                    if (system == "R")
-                                                                                        {
-                                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    glo_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                        }
-
-                                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
+                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                                    d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_utc_model, d_user_pvt_solver->gps_iono, gps_ephemeris_iter->second);
+                                                                    d_rinex_header_updated = true;
                                                                 }
-                                                            break;
-                                                        case 27:  // GLONASS L1 C/A + Galileo E1B
-                                                            if (flag_write_RTCM_1020_output == true)
+                                                        }
+                                                    break;
+                                                case 8:  // L1+L5
+                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                            if (!d_rinex_header_updated and ((d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0) or (d_user_pvt_solver->gps_utc_model.d_A0 != 0)))
                                                                 {
-                                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                                    if (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0)
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
+                                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono);
                                                                         }
-                                                                }
-                                                            if (flag_write_RTCM_1045_output == true)
-                                                                {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                                    else
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_utc_model, d_user_pvt_solver->gps_iono, gps_ephemeris_iter->second);
                                                                         }
+                                                                    d_rinex_header_updated = true;
                                                                 }
-                                                            if (flag_write_RTCM_MSM_output == true)
+                                                        }
+                                                    break;
+                                                case 9:  // GPS L1 C/A + Galileo E1B
+                                                    if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
                                                                 {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    int gal_channel = 0;
-                                                                    int glo_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
-                                                                        {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gal_channel == 0)
-                                                                                {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (glo_channel == 0)
-                                                                                {
-                                                                                    if (system == "R")
-                                                                                        {
-                                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    glo_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                        }
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
+                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                                    d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                                    d_rinex_header_updated = true;
                                                                 }
-                                                            break;
-                                                        case 29:  // GPS L1 C/A + GLONASS L2 C/A
-                                                            if (flag_write_RTCM_1019_output == true)
+                                                        }
+                                                    break;
+                                                case 13:  // L5+E5a
+                                                    if ((gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0) and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rinex_header_updated = true;  // do not write header anymore
+                                                        }
+                                                    break;
+                                                case 14:  // Galileo E1B + Galileo E5a
+                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1B 5X");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
+                                                        {
+                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 15:  // Galileo E1B + Galileo E5b
+                                                    if (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1B 7X");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
+                                                        {
+                                                            d_rp->update_nav_header(d_rp->navGalFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 23:  // GLONASS L1 C/A only
+                                                    if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1C");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->glonass_gnav_utc_model.d_tau_c != 0))
+                                                        {
+                                                            d_rp->update_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 24:  // GLONASS L2 C/A only
+                                                    if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "2C");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->glonass_gnav_utc_model.d_tau_c != 0))
+                                                        {
+                                                            d_rp->update_nav_header(d_rp->navGloFile, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 25:  // GLONASS L1 C/A + GLONASS L2 C/A
+                                                    if (glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "1C 2C");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->glonass_gnav_utc_model.d_tau_c != 0))
+                                                        {
+                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 26:  // GPS L1 C/A + GLONASS L1 C/A
+                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
                                                                 {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
-                                                                        }
+                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                                    d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                                    d_rinex_header_updated = true;  // do not write header anymore
                                                                 }
-                                                            if (flag_write_RTCM_1020_output == true)
+                                                        }
+                                                    break;
+                                                case 27:  // Galileo E1B + GLONASS L1 C/A
+                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                            d_rinex_header_updated = true;  // do not write header anymore
+                                                        }
+                                                    break;
+                                                case 28:  // GPS L2C + GLONASS L1 C/A
+                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                            d_rinex_header_updated = true;  // do not write header anymore
+                                                        }
+                                                    break;
+                                                case 29:  // GPS L1 C/A + GLONASS L2 C/A
+                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
                                                                 {
-                                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
-                                                                        }
+                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                                    d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                                    d_rinex_header_updated = true;  // do not write header anymore
                                                                 }
-                                                            if (flag_write_RTCM_MSM_output == true)
+                                                        }
+                                                    break;
+                                                case 30:  // Galileo E1B + GLONASS L2 C/A
+                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                            d_rinex_header_updated = true;  // do not write header anymore
+                                                        }
+                                                    break;
+                                                case 31:  // GPS L2C + GLONASS L2 C/A
+                                                    if ((glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->glonass_gnav_utc_model, d_user_pvt_solver->glonass_gnav_almanac);
+                                                            d_rinex_header_updated = true;  // do not write header anymore
+                                                        }
+                                                    break;
+                                                case 32:  // L1+E1+L5+E5a
+                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                            if (!d_rinex_header_updated and ((d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0) or (d_user_pvt_solver->gps_utc_model.d_A0 != 0)) and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
                                                                 {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    int gps_channel = 0;
-                                                                    int glo_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
-                                                                        {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gps_channel == 0)
-                                                                                {
-                                                                                    if (system == "G")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gps_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (glo_channel == 0)
-                                                                                {
-                                                                                    if (system == "R")
-                                                                                        {
-                                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    glo_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                        }
-                                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                                    if (d_user_pvt_solver->gps_cnav_utc_model.d_A0 != 0)
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_cnav_utc_model);
+                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_cnav_utc_model, d_user_pvt_solver->gps_cnav_iono, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
                                                                         }
-                                                                }
-                                                            break;
-                                                        case 30:  // GLONASS L2 C/A + Galileo E1B
-                                                            if (flag_write_RTCM_1020_output == true)
-                                                                {
-                                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                                    else
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
                                                                         }
+                                                                    d_rinex_header_updated = true;  // do not write header anymore
                                                                 }
-                                                            if (flag_write_RTCM_1045_output == true)
+                                                        }
+                                                    break;
+                                                case 33:  // L1+E1+E5a
+                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map);
+                                                            if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0) and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
                                                                 {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
-                                                                        }
+                                                                    d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                                    d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                                    d_rinex_header_updated = true;  // do not write header anymore
                                                                 }
-                                                            if (flag_write_RTCM_MSM_output == true)
+                                                        }
+                                                    break;
+                                                case 500:  // BDS B1I only
+                                                    if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "B1");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->beidou_dnav_utc_model.d_A0_UTC != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_utc_model, d_user_pvt_solver->beidou_dnav_iono);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 600:  // BDS B3I only
+                                                    if (beidou_dnav_ephemeris_iter != d_user_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, beidou_dnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, "B3");
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->beidou_dnav_utc_model.d_A0_UTC != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->beidou_dnav_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->beidou_dnav_utc_model, d_user_pvt_solver->beidou_dnav_iono);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 1000:  // GPS L1 C/A + GPS L2C + GPS L5
+                                                    if ((gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
+                                                        (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, true);
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navFile, d_user_pvt_solver->gps_utc_model, d_user_pvt_solver->gps_iono, gps_ephemeris_iter->second);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                case 1001:  // GPS L1 C/A + Galileo E1B + GPS L2C + GPS L5 + Galileo E5a
+                                                    if ((galileo_ephemeris_iter != d_user_pvt_solver->galileo_ephemeris_map.cend()) and
+                                                        (gps_ephemeris_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and
+                                                        (gps_cnav_ephemeris_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rp->log_rinex_obs(d_rp->obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, true);
+                                                        }
+                                                    if (!d_rinex_header_updated and (d_user_pvt_solver->gps_utc_model.d_A0 != 0) and (d_user_pvt_solver->galileo_utc_model.A0_6 != 0))
+                                                        {
+                                                            d_rp->update_obs_header(d_rp->obsFile, d_user_pvt_solver->gps_utc_model);
+                                                            d_rp->update_nav_header(d_rp->navMixFile, d_user_pvt_solver->gps_iono, d_user_pvt_solver->gps_utc_model, gps_ephemeris_iter->second, d_user_pvt_solver->galileo_iono, d_user_pvt_solver->galileo_utc_model);
+                                                            d_rinex_header_updated = true;
+                                                        }
+                                                    break;
+                                                default:
+                                                    break;
+                                                }
+                                        }
+                                }
+                        }
+
+                    // ####################### RTCM MESSAGES #################
+                    try
+                        {
+                            if (d_rtcm_writing_started and d_rtcm_enabled)
+                                {
+                                    switch (d_type_of_rx)
+                                        {
+                                        case 1:  // GPS L1 C/A
+                                            if (flag_write_RTCM_1019_output == true)
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 4:
+                                        case 5:
+                                        case 6:
+                                            if (flag_write_RTCM_1045_output == true)
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 7:  // GPS L1 C/A + GPS L2C
+                                            if (flag_write_RTCM_1019_output == true)
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
+                                                    if ((gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 8:  // L1+L5
+                                            if (flag_write_RTCM_1019_output == true)
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
+                                                    if ((gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 9:  // GPS L1 C/A + Galileo E1B
+                                            if (flag_write_RTCM_1019_output == true)
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_1045_output == true)
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    int gps_channel = 0;
+                                                    int gal_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gps_channel == 0)
                                                                 {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    int gal_channel = 0;
-                                                                    int glo_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                                    if (system == "G")
                                                                         {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gal_channel == 0)
-                                                                                {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (glo_channel == 0)
+                                                                            // This is a channel with valid GPS signal
+                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
                                                                                 {
-                                                                                    if (system == "R")
-                                                                                        {
-                                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    glo_channel = 1;
-                                                                                                }
-                                                                                        }
+                                                                                    gps_channel = 1;
                                                                                 }
                                                                         }
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            break;
-                                                        case 32:  // L1+E1+L5+E5a
-                                                            if (flag_write_RTCM_1019_output == true)
-                                                                {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (flag_write_RTCM_1045_output == true)
-                                                                {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
-                                                                        }
                                                                 }
-                                                            if (flag_write_RTCM_MSM_output == true)
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    int gal_channel = 0;
-                                                                    int gps_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                                    if (system == "E")
                                                                         {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gal_channel == 0)
-                                                                                {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (gps_channel == 0)
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
                                                                                 {
-                                                                                    if (system == "G")
-                                                                                        {
-                                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gps_channel = 1;
-                                                                                                }
-                                                                                        }
+                                                                                    gal_channel = 1;
                                                                                 }
                                                                         }
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
                                                                 }
-                                                            break;
-                                                        default:
-                                                            break;
+                                                        }
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
                                                         }
                                                 }
-
-                                            if (!d_rtcm_writing_started and d_rtcm_enabled)  // the first time
+                                            break;
+                                        case 13:  // L5+E5a
+                                            if (flag_write_RTCM_1045_output == true)
                                                 {
-                                                    switch (d_type_of_rx)
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
                                                         {
-                                                        case 1:                              // GPS L1 C/A
-                                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                                                {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (d_rtcm_MSM_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                                                {
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
 
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 4:
-                                                        case 5:
-                                                        case 6:
-                                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                                                {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
-                                                                        }
-                                                                }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
-                                                                {
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 7:                              // GPS L1 C/A + GPS L2C
-                                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                            if (flag_write_RTCM_MSM_output and d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
+                                                    int gal_channel = 0;
+                                                    int gps_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gps_channel == 0)
                                                                 {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                                    if (system == "G")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                                            // This is a channel with valid GPS signal
+                                                                            gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend())
+                                                                                {
+                                                                                    gps_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                                                    if ((gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                                    if (system == "E")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                                                {
+                                                                                    gal_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 8:                              // L1+L5
-                                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                        }
+
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend() and (d_rtcm_MT1097_rate_ms != 0))
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend() and (d_rtcm_MT1077_rate_ms != 0))
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 14:
+                                        case 15:
+                                            if (flag_write_RTCM_1045_output == true)
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 23:
+                                        case 24:
+                                        case 25:
+                                            if (flag_write_RTCM_1020_output == true)
+                                                {
+                                                    for (auto glonass_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_ephemeris_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    auto glo_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    if (glo_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glo_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 26:  // GPS L1 C/A + GLONASS L1 C/A
+                                            if (flag_write_RTCM_1019_output == true)
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_1020_output == true)
+                                                {
+                                                    for (auto glonass_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_ephemeris_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_ephemeris_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    int gps_channel = 0;
+                                                    int glo_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gps_channel == 0)
                                                                 {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                                    if (system == "G")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                                            // This is a channel with valid GPS signal
+                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                                                {
+                                                                                    gps_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                            if (glo_channel == 0)
                                                                 {
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                                                    if ((gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                                    if (system == "R")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                                                {
+                                                                                    glo_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 9:                              // GPS L1 C/A + Galileo E1B
-                                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                        }
+
+                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 27:  // GLONASS L1 C/A + Galileo E1B
+                                            if (flag_write_RTCM_1020_output == true)
+                                                {
+                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_1045_output == true)
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    int gal_channel = 0;
+                                                    int glo_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                                    if (system == "E")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                                            // This is a channel with valid GPS signal
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                                                {
+                                                                                    gal_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MT1045_rate_ms != 0)
+                                                            if (glo_channel == 0)
                                                                 {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                                    if (system == "R")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                                                {
+                                                                                    glo_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                        }
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 29:  // GPS L1 C/A + GLONASS L2 C/A
+                                            if (flag_write_RTCM_1019_output == true)
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_1020_output == true)
+                                                {
+                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    int gps_channel = 0;
+                                                    int glo_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gps_channel == 0)
                                                                 {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    int gps_channel = 0;
-                                                                    int gal_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                                    if (system == "G")
                                                                         {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gps_channel == 0)
-                                                                                {
-                                                                                    if (system == "G")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gps_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (gal_channel == 0)
+                                                                            // This is a channel with valid GPS signal
+                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
                                                                                 {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
+                                                                                    gps_channel = 1;
                                                                                 }
                                                                         }
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
                                                                 }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-
-                                                        case 13:  // L5+E5a
-                                                            if (d_rtcm_MT1045_rate_ms != 0)
+                                                            if (glo_channel == 0)
                                                                 {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                                    if (system == "R")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                                                {
+                                                                                    glo_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                        }
+                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 30:  // GLONASS L2 C/A + Galileo E1B
+                                            if (flag_write_RTCM_1020_output == true)
+                                                {
+                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_1045_output == true)
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    int gal_channel = 0;
+                                                    int glo_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    int gal_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                                    if (system == "E")
                                                                         {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gal_channel == 0)
+                                                                            // This is a channel with valid GPS signal
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
                                                                                 {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
+                                                                                    gal_channel = 1;
                                                                                 }
                                                                         }
-
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend() and (d_rtcm_MT1097_rate_ms != 0))
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
                                                                 }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 14:
-                                                        case 15:
-                                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                            if (glo_channel == 0)
                                                                 {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                                    if (system == "R")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                                                {
+                                                                                    glo_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                        }
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        case 32:  // L1+E1+L5+E5a
+                                            if (flag_write_RTCM_1019_output == true)
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_1045_output == true)
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (flag_write_RTCM_MSM_output == true)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    int gal_channel = 0;
+                                                    int gps_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                                    if (system == "E")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                                            // This is a channel with valid GPS signal
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                                                {
+                                                                                    gal_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 23:
-                                                        case 24:
-                                                        case 25:
-                                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                            if (gps_channel == 0)
                                                                 {
-                                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                                    if (system == "G")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                                                {
+                                                                                    gps_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                        }
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            break;
+                                        default:
+                                            break;
+                                        }
+                                }
+
+                            if (!d_rtcm_writing_started and d_rtcm_enabled)  // the first time
+                                {
+                                    switch (d_type_of_rx)
+                                        {
+                                        case 1:                              // GPS L1 C/A
+                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 4:
+                                        case 5:
+                                        case 6:
+                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 7:                              // GPS L1 C/A + GPS L2C
+                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
+                                                    if ((gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 8:                              // L1+L5
+                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    auto gps_cnav_eph_iter = d_user_pvt_solver->gps_cnav_ephemeris_map.cbegin();
+                                                    if ((gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != d_user_pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 9:                              // GPS L1 C/A + Galileo E1B
+                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MT1045_rate_ms != 0)
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    int gps_channel = 0;
+                                                    int gal_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gps_channel == 0)
                                                                 {
-                                                                    auto glo_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    if (glo_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                                    if (system == "G")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glo_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                                            // This is a channel with valid GPS signal
+                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                                                {
+                                                                                    gps_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 26:                             // GPS L1 C/A + GLONASS L1 C/A
-                                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                                    if (system == "E")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                                                {
+                                                                                    gal_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                        }
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+
+                                        case 13:  // L5+E5a
+                                            if (d_rtcm_MT1045_rate_ms != 0)
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    int gal_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                                    if (system == "E")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                                                {
+                                                                                    gal_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                        }
+
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend() and (d_rtcm_MT1097_rate_ms != 0))
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 14:
+                                        case 15:
+                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 23:
+                                        case 24:
+                                        case 25:
+                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    auto glo_gnav_ephemeris_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    if (glo_gnav_ephemeris_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glo_gnav_ephemeris_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 26:                             // GPS L1 C/A + GLONASS L1 C/A
+                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    int gps_channel = 0;
+                                                    int glo_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gps_channel == 0)
                                                                 {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    int gps_channel = 0;
-                                                                    int glo_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                                    if (system == "G")
                                                                         {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gps_channel == 0)
-                                                                                {
-                                                                                    if (system == "G")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gps_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (glo_channel == 0)
+                                                                            // This is a channel with valid GPS signal
+                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
                                                                                 {
-                                                                                    if (system == "R")
-                                                                                        {
-                                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    glo_channel = 1;
-                                                                                                }
-                                                                                        }
+                                                                                    gps_channel = 1;
                                                                                 }
                                                                         }
-                                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 27:                             // GLONASS L1 C/A + Galileo E1B
-                                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                                                {
-                                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
-                                                                        }
-                                                                }
-                                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                                                {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
-                                                                        }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                            if (glo_channel == 0)
                                                                 {
-                                                                    int gal_channel = 0;
-                                                                    int glo_channel = 0;
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                                    if (system == "R")
                                                                         {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gal_channel == 0)
-                                                                                {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (glo_channel == 0)
+                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
                                                                                 {
-                                                                                    if (system == "R")
-                                                                                        {
-                                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    glo_channel = 1;
-                                                                                                }
-                                                                                        }
+                                                                                    glo_channel = 1;
                                                                                 }
                                                                         }
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 29:                             // GPS L1 C/A + GLONASS L2 C/A
-                                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                                                {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
-                                                                        }
                                                                 }
-                                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                        }
+                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 27:                             // GLONASS L1 C/A + Galileo E1B
+                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    int gal_channel = 0;
+                                                    int glo_channel = 0;
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                                    if (system == "E")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                                            // This is a channel with valid GPS signal
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                                                {
+                                                                                    gal_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                            if (glo_channel == 0)
                                                                 {
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    int gps_channel = 0;
-                                                                    int glo_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                                    if (system == "R")
                                                                         {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gps_channel == 0)
+                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
                                                                                 {
-                                                                                    if (system == "G")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gps_channel = 1;
-                                                                                                }
-                                                                                        }
+                                                                                    glo_channel = 1;
                                                                                 }
-                                                                            if (glo_channel == 0)
-                                                                                {
-                                                                                    if (system == "R")
-                                                                                        {
-                                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    glo_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                        }
-                                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
                                                                         }
                                                                 }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 30:                             // GLONASS L2 C/A + Galileo E1B
-                                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                        }
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 29:                             // GPS L1 C/A + GLONASS L2 C/A
+                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    int gps_channel = 0;
+                                                    int glo_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gps_channel == 0)
                                                                 {
-                                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                                    if (system == "G")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                                            // This is a channel with valid GPS signal
+                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                                                {
+                                                                                    gps_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                            if (glo_channel == 0)
                                                                 {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                                    if (system == "R")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                                                {
+                                                                                    glo_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                        }
+                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 30:                             // GLONASS L2 C/A + Galileo E1B
+                                            if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin(); glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend(); glonass_gnav_eph_iter++)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1020(glonass_gnav_eph_iter->second, d_user_pvt_solver->glonass_gnav_utc_model);
+                                                        }
+                                                }
+                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    int gal_channel = 0;
+                                                    int glo_channel = 0;
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    int gal_channel = 0;
-                                                                    int glo_channel = 0;
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    auto glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                                    if (system == "E")
                                                                         {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gal_channel == 0)
-                                                                                {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (glo_channel == 0)
+                                                                            // This is a channel with valid GPS signal
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
                                                                                 {
-                                                                                    if (system == "R")
-                                                                                        {
-                                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    glo_channel = 1;
-                                                                                                }
-                                                                                        }
+                                                                                    gal_channel = 1;
                                                                                 }
                                                                         }
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
                                                                 }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        case 32:                             // L1+E1+L5+E5a
-                                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                            if (glo_channel == 0)
                                                                 {
-                                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                                    if (system == "R")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                                            glonass_gnav_eph_iter = d_user_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                                                {
+                                                                                    glo_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                        }
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (glonass_gnav_eph_iter != d_user_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        case 32:                             // L1+E1+L5+E5a
+                                            if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gps_eph_iter : d_user_pvt_solver->gps_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1019(gps_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                                                {
+                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                        }
+                                                }
+                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                {
+                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
+                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
+                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
+                                                    int gps_channel = 0;
+                                                    int gal_channel = 0;
+                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                        {
+                                                            std::string system(&gnss_observables_iter->second.System, 1);
+                                                            if (gps_channel == 0)
                                                                 {
-                                                                    for (const auto& gal_eph_iter : d_user_pvt_solver->galileo_ephemeris_map)
+                                                                    if (system == "G")
                                                                         {
-                                                                            d_rtcm_printer->Print_Rtcm_MT1045(gal_eph_iter.second);
+                                                                            // This is a channel with valid GPS signal
+                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                                                {
+                                                                                    gps_channel = 1;
+                                                                                }
                                                                         }
                                                                 }
-                                                            if (d_rtcm_MSM_rate_ms != 0)
+                                                            if (gal_channel == 0)
                                                                 {
-                                                                    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-                                                                    auto gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.cbegin();
-                                                                    auto gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.cbegin();
-                                                                    int gps_channel = 0;
-                                                                    int gal_channel = 0;
-                                                                    for (gnss_observables_iter = d_gnss_observables_map.cbegin(); gnss_observables_iter != d_gnss_observables_map.cend(); gnss_observables_iter++)
+                                                                    if (system == "E")
                                                                         {
-                                                                            std::string system(&gnss_observables_iter->second.System, 1);
-                                                                            if (gps_channel == 0)
-                                                                                {
-                                                                                    if (system == "G")
-                                                                                        {
-                                                                                            // This is a channel with valid GPS signal
-                                                                                            gps_eph_iter = d_user_pvt_solver->gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gps_channel = 1;
-                                                                                                }
-                                                                                        }
-                                                                                }
-                                                                            if (gal_channel == 0)
+                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
                                                                                 {
-                                                                                    if (system == "E")
-                                                                                        {
-                                                                                            gal_eph_iter = d_user_pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                                                                            if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                                                {
-                                                                                                    gal_channel = 1;
-                                                                                                }
-                                                                                        }
+                                                                                    gal_channel = 1;
                                                                                 }
                                                                         }
-                                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
-                                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
-                                                                        {
-                                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
-                                                                        }
                                                                 }
-                                                            d_rtcm_writing_started = true;
-                                                            break;
-                                                        default:
-                                                            break;
+                                                        }
+                                                    if (gps_eph_iter != d_user_pvt_solver->gps_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
+                                                        }
+                                                    if (gal_eph_iter != d_user_pvt_solver->galileo_ephemeris_map.cend())
+                                                        {
+                                                            d_rtcm_printer->Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, d_rx_time, d_gnss_observables_map, d_enable_rx_clock_correction, 0, 0, false, false);
                                                         }
                                                 }
+                                            d_rtcm_writing_started = true;
+                                            break;
+                                        default:
+                                            break;
                                         }
-                                    catch (const boost::exception& ex)
+                                }
+                        }
+                    catch (const boost::exception& ex)
+                        {
+                            std::cout << "RTCM boost exception: " << boost::diagnostic_information(ex) << std::endl;
+                            LOG(ERROR) << "RTCM boost exception: " << boost::diagnostic_information(ex);
+                        }
+                    catch (const std::exception& ex)
+                        {
+                            std::cout << "RTCM std exception: " << ex.what() << std::endl;
+                            LOG(ERROR) << "RTCM std exception: " << ex.what();
+                        }
+                }
+        }
+
+    // DEBUG MESSAGE: Display position in console output
+    if (d_user_pvt_solver->is_valid_position() and flag_display_pvt)
+        {
+            boost::posix_time::ptime time_solution;
+            std::string UTC_solution_str;
+            if (d_show_local_time_zone)
+                {
+                    time_solution = d_user_pvt_solver->get_position_UTC_time() + d_utc_diff_time;
+                    UTC_solution_str = d_local_time_str;
+                }
+            else
+                {
+                    time_solution = d_user_pvt_solver->get_position_UTC_time();
+                    UTC_solution_str = " UTC";
+                }
+            std::streamsize ss = std::cout.precision();  // save current precision
+            std::cout.setf(std::ios::fixed, std::ios::floatfield);
+            auto facet = new boost::posix_time::time_facet("%Y-%b-%d %H:%M:%S.%f %z");
+            std::cout.imbue(std::locale(std::cout.getloc(), facet));
+            std::cout
+                << TEXT_BOLD_GREEN
+                << "Position at " << time_solution << UTC_solution_str
+                << " using " << d_user_pvt_solver->get_num_valid_observations()
+                << std::fixed << std::setprecision(9)
+                << " observations is Lat = " << d_user_pvt_solver->get_latitude() << " [deg], Long = " << d_user_pvt_solver->get_longitude()
+                << std::fixed << std::setprecision(3)
+                << " [deg], Height = " << d_user_pvt_solver->get_height() << " [m]" << TEXT_RESET << std::endl;
+
+            std::cout << std::setprecision(ss);
+            DLOG(INFO) << "RX clock offset: " << d_user_pvt_solver->get_time_offset_s() << "[s]";
+
+            std::cout
+                << TEXT_BOLD_GREEN
+                << "Velocity: " << std::fixed << std::setprecision(3)
+                << "East: " << d_user_pvt_solver->get_rx_vel()[0] << " [m/s], North: " << d_user_pvt_solver->get_rx_vel()[1]
+                << " [m/s], Up = " << d_user_pvt_solver->get_rx_vel()[2] << " [m/s]" << TEXT_RESET << std::endl;
+
+            std::cout << std::setprecision(ss);
+            DLOG(INFO) << "RX clock drift: " << d_user_pvt_solver->get_clock_drift_ppm() << " [ppm]";
+
+            // boost::posix_time::ptime p_time;
+            // gtime_t rtklib_utc_time = gpst2time(adjgpsweek(d_user_pvt_solver->gps_ephemeris_map.cbegin()->second.i_GPS_week), d_rx_time);
+            // p_time = boost::posix_time::from_time_t(rtklib_utc_time.time);
+            // p_time += boost::posix_time::microseconds(round(rtklib_utc_time.sec * 1e6));
+            // std::cout << TEXT_MAGENTA << "Observable RX time (GPST) " << boost::posix_time::to_simple_string(p_time) << TEXT_RESET << std::endl;
+
+            DLOG(INFO) << "Position at " << boost::posix_time::to_simple_string(d_user_pvt_solver->get_position_UTC_time())
+                       << " UTC using " << d_user_pvt_solver->get_num_valid_observations() << " observations is Lat = " << d_user_pvt_solver->get_latitude() << " [deg], Long = " << d_user_pvt_solver->get_longitude()
+                       << " [deg], Height = " << d_user_pvt_solver->get_height() << " [m]";
+
+            /* std::cout << "Dilution of Precision at " << boost::posix_time::to_simple_string(d_user_pvt_solver->get_position_UTC_time())
+                         << " UTC using "<< d_user_pvt_solver->get_num_valid_observations() <<" observations is HDOP = " << d_user_pvt_solver->get_hdop() << " VDOP = "
+                         << d_user_pvt_solver->get_vdop()
+                         << " GDOP = " << d_user_pvt_solver->get_gdop() << std::endl; */
+        }
+
+    // PVT MONITOR
+    if (d_user_pvt_solver->is_valid_position())
+        {
+            std::shared_ptr<Monitor_Pvt> monitor_pvt = std::make_shared<Monitor_Pvt>(d_user_pvt_solver->get_monitor_pvt());
+
+            // publish new position to the gnss_flowgraph channel status monitor
+            if (current_RX_time_ms % d_report_rate_ms == 0)
+                {
+                    this->message_port_pub(pmt::mp("status"), pmt::make_any(monitor_pvt));
+                }
+            if (d_flag_monitor_pvt_enabled)
+                {
+                    d_udp_sink_ptr->write_monitor_pvt(monitor_pvt.get());
+                }
+        }
+}
+
+
+int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items __attribute__((unused)))
+{
+    for (int32_t epoch = 0; epoch < noutput_items; epoch++)
+        {
+            bool flag_compute_pvt_output = false;
+            // take the next epoch of the ring, which is no longer in use by the user solver stage
+            User_Pvt_Epoch& user_epoch = d_user_epochs[d_user_epoch_index];
+            d_user_epoch_index = (d_user_epoch_index + 1) % d_user_epochs.size();
+            user_epoch.valid_pseudoranges.clear();
+
+            d_gnss_observables.clear();
+            d_internal_pvt_solver->index_ephemeris();
+            const auto** in = reinterpret_cast<const Gnss_Synchro**>(&input_items[0]);  // Get the input buffer pointer
+            // ############ 1. READ PSEUDORANGES ####
+            for (uint32_t i = 0; i < d_nchannels; i++)
+                {
+                    if (in[i][epoch].Flag_valid_pseudorange)
+                        {
+                            const Gps_Ephemeris* tmp_eph_gps = d_internal_pvt_solver->find_gps_ephemeris(in[i][epoch].PRN);
+                            const Galileo_Ephemeris* tmp_eph_gal = d_internal_pvt_solver->find_galileo_ephemeris(in[i][epoch].PRN);
+                            const Gps_CNAV_Ephemeris* tmp_eph_cnav = d_internal_pvt_solver->find_gps_cnav_ephemeris(in[i][epoch].PRN);
+                            const Glonass_Gnav_Ephemeris* tmp_eph_glo_gnav = d_internal_pvt_solver->find_glonass_gnav_ephemeris(in[i][epoch].PRN);
+                            const Beidou_Dnav_Ephemeris* tmp_eph_bds_dnav = d_internal_pvt_solver->find_beidou_dnav_ephemeris(in[i][epoch].PRN);
+                            const std::string signal(in[i][epoch].Signal);
+
+                            bool store_valid_observable = false;
+
+                            if (tmp_eph_gps != nullptr)
+                                {
+                                    uint32_t prn_aux = tmp_eph_gps->i_satellite_PRN;
+                                    if ((prn_aux == in[i][epoch].PRN) and (signal == "1C"))
                                         {
-                                            std::cout << "RTCM boost exception: " << boost::diagnostic_information(ex) << std::endl;
-                                            LOG(ERROR) << "RTCM boost exception: " << boost::diagnostic_information(ex);
+                                            store_valid_observable = true;
                                         }
-                                    catch (const std::exception& ex)
+                                }
+                            if (tmp_eph_gal != nullptr)
+                                {
+                                    uint32_t prn_aux = tmp_eph_gal->i_satellite_PRN;
+                                    if ((prn_aux == in[i][epoch].PRN) and ((signal == "1B") or (signal == "5X")))
                                         {
-                                            std::cout << "RTCM std exception: " << ex.what() << std::endl;
-                                            LOG(ERROR) << "RTCM std exception: " << ex.what();
+                                            store_valid_observable = true;
                                         }
                                 }
-                        }
-
-                    // DEBUG MESSAGE: Display position in console output
-                    if (d_user_pvt_solver->is_valid_position() and flag_display_pvt)
-                        {
-                            boost::posix_time::ptime time_solution;
-                            std::string UTC_solution_str;
-                            if (d_show_local_time_zone)
+                            if (tmp_eph_cnav != nullptr)
                                 {
-                                    time_solution = d_user_pvt_solver->get_position_UTC_time() + d_utc_diff_time;
-                                    UTC_solution_str = d_local_time_str;
+                                    uint32_t prn_aux = tmp_eph_cnav->i_satellite_PRN;
+                                    if ((prn_aux == in[i][epoch].PRN) and ((signal == "2S") or (signal == "L5")))
+                                        {
+                                            store_valid_observable = true;
+                                        }
                                 }
-                            else
+                            if (tmp_eph_glo_gnav != nullptr)
+                                {
+                                    uint32_t prn_aux = tmp_eph_glo_gnav->i_satellite_PRN;
+                                    if ((prn_aux == in[i][epoch].PRN) and ((signal == "1G") or (signal == "2G")))
+                                        {
+                                            store_valid_observable = true;
+                                        }
+                                }
+                            if (tmp_eph_bds_dnav != nullptr)
+                                {
+                                    uint32_t prn_aux = tmp_eph_bds_dnav->i_satellite_PRN;
+                                    if ((prn_aux == in[i][epoch].PRN) and ((signal == "B1") or (signal == "B3")))
+                                        {
+                                            store_valid_observable = true;
+                                        }
+                                }
+
+                            if (store_valid_observable)
                                 {
-                                    time_solution = d_user_pvt_solver->get_position_UTC_time();
-                                    UTC_solution_str = " UTC";
+                                    // store valid observables at the position of their channel
+                                    d_gnss_observables.set(i, in[i][epoch]);
                                 }
-                            std::streamsize ss = std::cout.precision();  // save current precision
-                            std::cout.setf(std::ios::fixed, std::ios::floatfield);
-                            auto facet = new boost::posix_time::time_facet("%Y-%b-%d %H:%M:%S.%f %z");
-                            std::cout.imbue(std::locale(std::cout.getloc(), facet));
-                            std::cout
-                                << TEXT_BOLD_GREEN
-                                << "Position at " << time_solution << UTC_solution_str
-                                << " using " << d_user_pvt_solver->get_num_valid_observations()
-                                << std::fixed << std::setprecision(9)
-                                << " observations is Lat = " << d_user_pvt_solver->get_latitude() << " [deg], Long = " << d_user_pvt_solver->get_longitude()
-                                << std::fixed << std::setprecision(3)
-                                << " [deg], Height = " << d_user_pvt_solver->get_height() << " [m]" << TEXT_RESET << std::endl;
-
-                            std::cout << std::setprecision(ss);
-                            DLOG(INFO) << "RX clock offset: " << d_user_pvt_solver->get_time_offset_s() << "[s]";
-
-                            std::cout
-                                << TEXT_BOLD_GREEN
-                                << "Velocity: " << std::fixed << std::setprecision(3)
-                                << "East: " << d_user_pvt_solver->get_rx_vel()[0] << " [m/s], North: " << d_user_pvt_solver->get_rx_vel()[1]
-                                << " [m/s], Up = " << d_user_pvt_solver->get_rx_vel()[2] << " [m/s]" << TEXT_RESET << std::endl;
-
-                            std::cout << std::setprecision(ss);
-                            DLOG(INFO) << "RX clock drift: " << d_user_pvt_solver->get_clock_drift_ppm() << " [ppm]";
-
-                            // boost::posix_time::ptime p_time;
-                            // gtime_t rtklib_utc_time = gpst2time(adjgpsweek(d_user_pvt_solver->gps_ephemeris_map.cbegin()->second.i_GPS_week), d_rx_time);
-                            // p_time = boost::posix_time::from_time_t(rtklib_utc_time.time);
-                            // p_time += boost::posix_time::microseconds(round(rtklib_utc_time.sec * 1e6));
-                            // std::cout << TEXT_MAGENTA << "Observable RX time (GPST) " << boost::posix_time::to_simple_string(p_time) << TEXT_RESET << std::endl;
-
-                            DLOG(INFO) << "Position at " << boost::posix_time::to_simple_string(d_user_pvt_solver->get_position_UTC_time())
-                                       << " UTC using " << d_user_pvt_solver->get_num_valid_observations() << " observations is Lat = " << d_user_pvt_solver->get_latitude() << " [deg], Long = " << d_user_pvt_solver->get_longitude()
-                                       << " [deg], Height = " << d_user_pvt_solver->get_height() << " [m]";
-
-                            /* std::cout << "Dilution of Precision at " << boost::posix_time::to_simple_string(d_user_pvt_solver->get_position_UTC_time())
-                                         << " UTC using "<< d_user_pvt_solver->get_num_valid_observations() <<" observations is HDOP = " << d_user_pvt_solver->get_hdop() << " VDOP = "
-                                         << d_user_pvt_solver->get_vdop()
-                                         << " GDOP = " << d_user_pvt_solver->get_gdop() << std::endl; */
+
+                            // the carrier phase offsets and the RTCM lock times are kept by the user solver stage
+                            user_epoch.valid_pseudoranges.set(i, in[i][epoch]);
                         }
+                }
 
-                    // PVT MONITOR
-                    if (d_user_pvt_solver->is_valid_position())
+            // ############ 2 COMPUTE THE PVT ################################
+            bool flag_pvt_valid = false;
+            uint32_t current_RX_time_ms = 0;
+            double rx_time = 0.0;
+            if (d_gnss_observables.empty() == false)
+                {
+                    // LOG(INFO) << "diff raw obs time: " << d_gnss_observables.front().RX_time * 1000.0 - old_time_debug;
+                    // old_time_debug = d_gnss_observables.front().RX_time * 1000.0;
+                    // #### solve PVT and store the corrected observable set
+                    if (d_internal_pvt_solver->get_PVT(d_gnss_observables, false))
                         {
-                            std::shared_ptr<Monitor_Pvt> monitor_pvt = std::make_shared<Monitor_Pvt>(d_user_pvt_solver->get_monitor_pvt());
-
-                            // publish new position to the gnss_flowgraph channel status monitor
-                            if (current_RX_time_ms % d_report_rate_ms == 0)
+                            double Rx_clock_offset_s = d_internal_pvt_solver->get_time_offset_s();
+                            if (fabs(Rx_clock_offset_s) * 1000.0 > d_max_obs_block_rx_clock_offset_ms)
                                 {
-                                    this->message_port_pub(pmt::mp("status"), pmt::make_any(monitor_pvt));
+                                    if (!d_waiting_obs_block_rx_clock_offset_correction_msg)
+                                        {
+                                            this->message_port_pub(pmt::mp("pvt_to_observables"), pmt::make_any(Rx_clock_offset_s));
+                                            d_waiting_obs_block_rx_clock_offset_correction_msg = true;
+                                            LOG(INFO) << "Sent clock offset correction to observables: " << Rx_clock_offset_s << "[s]";
+                                        }
                                 }
-                            if (d_flag_monitor_pvt_enabled)
+                            else
                                 {
-                                    d_udp_sink_ptr->write_monitor_pvt(monitor_pvt.get());
+                                    if (d_enable_rx_clock_correction == true)
+                                        {
+                                            d_waiting_obs_block_rx_clock_offset_correction_msg = false;
+                                            std::swap(d_gnss_observables_t0, d_gnss_observables_t1);
+                                            apply_rx_clock_offset(d_gnss_observables, Rx_clock_offset_s);
+                                            d_gnss_observables_t1 = d_gnss_observables;
+
+                                            // ### select the rx_time and interpolate observables at that time
+                                            if (!d_gnss_observables_t0.empty())
+                                                {
+                                                    uint32_t t0_int_ms = static_cast<uint32_t>(d_gnss_observables_t0.front().RX_time * 1000.0);
+                                                    uint32_t adjust_next_epoch_ms = d_observable_interval_ms - t0_int_ms % d_observable_interval_ms;
+                                                    current_RX_time_ms = t0_int_ms + adjust_next_epoch_ms;
+
+                                                    if (current_RX_time_ms % d_output_rate_ms == 0)
+                                                        {
+                                                            rx_time = static_cast<double>(current_RX_time_ms) / 1000.0;
+                                                            // std::cout << " obs time t0: " << d_gnss_observables_t0.front().RX_time
+                                                            //           << " t1: " << d_gnss_observables_t1.front().RX_time
+                                                            //           << " interp time: " << rx_time << std::endl;
+                                                            interpolate_observables(d_gnss_observables_t0,
+                                                                d_gnss_observables_t1,
+                                                                rx_time,
+                                                                d_gnss_observables);
+                                                            flag_compute_pvt_output = true;
+                                                            // rx_time = current_RX_time;
+                                                            // std::cout.precision(17);
+                                                            // std::cout << "current_RX_time: " << current_RX_time << " map time: " << d_gnss_observables.front().RX_time << std::endl;
+                                                        }
+                                                }
+                                        }
+                                    else
+                                        {
+                                            rx_time = d_gnss_observables.front().RX_time;
+                                            current_RX_time_ms = static_cast<uint32_t>(rx_time * 1000.0);
+                                            if (current_RX_time_ms % d_output_rate_ms == 0)
+                                                {
+                                                    flag_compute_pvt_output = true;
+                                                    // std::cout.precision(17);
+                                                    // std::cout << "current_RX_time: " << current_RX_time << " map time: " << d_gnss_observables.front().RX_time << std::endl;
+                                                }
+                                            flag_pvt_valid = true;
+                                        }
                                 }
                         }
+                    // debug code
+                    // else
+                    //     {
+                    //         DLOG(INFO) << "Internal PVT solver error";
+                    //     }
                 }
+
+            user_epoch.observables = d_gnss_observables;
+            user_epoch.rx_time = rx_time;
+            user_epoch.rx_time_ms = current_RX_time_ms;
+            user_epoch.compute_pvt_output = flag_compute_pvt_output;
+            user_epoch.pvt_valid = flag_pvt_valid;
+            // the user solver and its outputs run off the path of the receiver clock steering, if enabled
+            run_in_user_solver_stage([this, &user_epoch]() { process_user_epoch(user_epoch); });
         }
 
     return noutput_items;
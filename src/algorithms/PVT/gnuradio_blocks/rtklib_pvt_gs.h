@@ -20,6 +20,7 @@
 #ifndef GNSS_SDR_RTKLIB_PVT_GS_H
 #define GNSS_SDR_RTKLIB_PVT_GS_H
 
+#include "gnss_observables_epoch.h"
 #include "gnss_synchro.h"
 #include "rtklib.h"
 #include <boost/date_time/gregorian/gregorian.hpp>
@@ -28,12 +29,16 @@
 #include <gnuradio/types.h>       // for gr_vector_const_void_star
 #include <pmt/pmt.h>              // for pmt_t
 #include <chrono>                 // for system_clock
+#include <cstddef>                // for size_t
 #include <cstdint>                // for int32_t
 #include <ctime>                  // for time_t
+#include <functional>             // for function
 #include <map>                    // for map
 #include <memory>                 // for shared_ptr, unique_ptr
 #include <string>                 // for string
 #include <sys/types.h>            // for key_t
+#include <typeindex>              // for type_index
+#include <unordered_map>          // for unordered_map
 #include <vector>                 // for vector
 #if GNURADIO_USES_STD_POINTERS
 #else
@@ -42,16 +47,31 @@
 
 class Beidou_Dnav_Almanac;
 class Beidou_Dnav_Ephemeris;
+class Beidou_Dnav_Iono;
+class Beidou_Dnav_Utc_Model;
 class Galileo_Almanac;
+class Galileo_Almanac_Helper;
 class Galileo_Ephemeris;
+class Galileo_Iono;
+class Galileo_Utc_Model;
 class GeoJSON_Printer;
+class Gnss_Assistance_Store;
+class Glonass_Gnav_Almanac;
+class Glonass_Gnav_Ephemeris;
+class Glonass_Gnav_Utc_Model;
 class Gps_Almanac;
+class Gps_CNAV_Ephemeris;
+class Gps_CNAV_Iono;
+class Gps_CNAV_Utc_Model;
 class Gps_Ephemeris;
+class Gps_Iono;
+class Gps_Utc_Model;
 class Gpx_Printer;
 class Kml_Printer;
 class Monitor_Pvt_Udp_Sink;
 class Nmea_Printer;
 class Pvt_Conf;
+class Pvt_Output_Stage;
 class Rinex_Printer;
 class Rtcm_Printer;
 class Rtklib_Solver;
@@ -134,14 +154,69 @@ private:
 
     void msg_handler_telemetry(const pmt::pmt_t& msg);
 
-    void initialize_and_apply_carrier_phase_offset();
+    template <typename T>
+    void add_telemetry_handler(void (rtklib_pvt_gs::*handler)(const T&));  //!< Handles the telemetry messages carrying a std::shared_ptr<T>
+    void register_gps_telemetry_handlers();
+    void register_galileo_telemetry_handlers();
+    void register_glonass_telemetry_handlers();
+    void register_beidou_telemetry_handlers();
+
+    void handle_gps_ephemeris(const Gps_Ephemeris& gps_eph);
+    void handle_gps_iono(const Gps_Iono& gps_iono);
+    void handle_gps_utc_model(const Gps_Utc_Model& gps_utc_model);
+    void handle_gps_cnav_ephemeris(const Gps_CNAV_Ephemeris& gps_cnav_ephemeris);
+    void handle_gps_cnav_iono(const Gps_CNAV_Iono& gps_cnav_iono);
+    void handle_gps_cnav_utc_model(const Gps_CNAV_Utc_Model& gps_cnav_utc_model);
+    void handle_gps_almanac(const Gps_Almanac& gps_almanac);
+    void handle_galileo_ephemeris(const Galileo_Ephemeris& galileo_eph);
+    void handle_galileo_iono(const Galileo_Iono& galileo_iono);
+    void handle_galileo_utc_model(const Galileo_Utc_Model& galileo_utc_model);
+    void handle_galileo_almanac_helper(const Galileo_Almanac_Helper& galileo_almanac_helper);
+    void handle_galileo_almanac(const Galileo_Almanac& galileo_alm);
+    void handle_glonass_gnav_ephemeris(const Glonass_Gnav_Ephemeris& glonass_gnav_eph);
+    void handle_glonass_gnav_utc_model(const Glonass_Gnav_Utc_Model& glonass_gnav_utc_model);
+    void handle_glonass_gnav_almanac(const Glonass_Gnav_Almanac& glonass_gnav_almanac);
+    void handle_beidou_dnav_ephemeris(const Beidou_Dnav_Ephemeris& bds_dnav_eph);
+    void handle_beidou_dnav_iono(const Beidou_Dnav_Iono& bds_dnav_iono);
+    void handle_beidou_dnav_utc_model(const Beidou_Dnav_Utc_Model& bds_dnav_utc_model);
+    void handle_beidou_dnav_almanac(const Beidou_Dnav_Almanac& bds_dnav_almanac);
+
+    // Logging of a new ephemeris record in the RINEX navigation file, and update of the user solver
+    void update_user_solver(const Gps_Ephemeris& gps_eph);
+    void update_user_solver(const Gps_CNAV_Ephemeris& gps_cnav_ephemeris);
+    void update_user_solver(const Galileo_Ephemeris& galileo_eph);
+    void update_user_solver(const Glonass_Gnav_Ephemeris& glonass_gnav_eph);
+    void update_user_solver(const Beidou_Dnav_Ephemeris& bds_dnav_eph);
+
+    // Epoch of the user solver, filled by work() and processed in the user solver stage
+    struct User_Pvt_Epoch
+    {
+        Gnss_Observables_Epoch valid_pseudoranges;  // channels with a valid pseudorange
+        Gnss_Observables_Epoch observables;         // observables to solve, interpolated at the output epochs
+        double rx_time{0.0};
+        uint32_t rx_time_ms{0};
+        bool compute_pvt_output{false};
+        bool pvt_valid{false};  // solution of the internal solver, when it is also the user solver
+    };
+
+    void run_in_user_solver_stage(std::function<void()> task);  // inline if the stage is not enabled
+
+    template <typename T>
+    void save_assistance(const T& record, uint32_t key = 0);  // to the assistance store, if enabled
+    void process_user_epoch(User_Pvt_Epoch& epoch);             // user solution and outputs
+    void update_rtcm_lock_times(const Gnss_Observables_Epoch& valid_pseudoranges);
 
-    void apply_rx_clock_offset(std::map<int, Gnss_Synchro>& observables_map,
+    void initialize_and_apply_carrier_phase_offset(Gnss_Observables_Epoch& observables);
+
+    void print_position(bool kml, bool gpx, bool geojson, bool nmea);  // in the output stage, if enabled
+
+    void apply_rx_clock_offset(Gnss_Observables_Epoch& observables,
         double rx_clock_offset_s);
 
-    std::map<int, Gnss_Synchro> interpolate_observables(const std::map<int, Gnss_Synchro>& observables_map_t0,
-        const std::map<int, Gnss_Synchro>& observables_map_t1,
-        double rx_time_s);
+    void interpolate_observables(const Gnss_Observables_Epoch& observables_t0,
+        const Gnss_Observables_Epoch& observables_t1,
+        double rx_time_s,
+        Gnss_Observables_Epoch& interp_observables);
 
     inline std::time_t convert_to_time_t(const boost::posix_time::ptime pt) const
     {
@@ -170,6 +245,9 @@ private:
     std::unique_ptr<GeoJSON_Printer> d_geojson_printer;
     std::unique_ptr<Rtcm_Printer> d_rtcm_printer;
     std::unique_ptr<Monitor_Pvt_Udp_Sink> d_udp_sink_ptr;
+    std::unique_ptr<Gnss_Assistance_Store> d_assistance_store;  // navigation data written as it arrives, for the next start
+    std::unique_ptr<Pvt_Output_Stage> d_output_stage;       // destroyed before the printers it uses
+    std::unique_ptr<Pvt_Output_Stage> d_user_solver_stage;  // runs the user solver, destroyed before d_output_stage
 
     std::chrono::time_point<std::chrono::system_clock> d_start;
     std::chrono::time_point<std::chrono::system_clock> d_end;
@@ -196,19 +274,24 @@ private:
         evBDS_B3
     };
     std::map<std::string, StringValue_> d_mapStringValues;
-    std::map<int, Gnss_Synchro> d_gnss_observables_map;
-    std::map<int, Gnss_Synchro> d_gnss_observables_map_t0;
-    std::map<int, Gnss_Synchro> d_gnss_observables_map_t1;
+    std::unordered_map<std::type_index, std::function<void(const pmt::pmt_t&)>> d_telemetry_handlers;
+    Gnss_Observables_Epoch d_gnss_observables;
+    Gnss_Observables_Epoch d_gnss_observables_t0;
+    Gnss_Observables_Epoch d_gnss_observables_t1;
+    std::map<int, Gnss_Synchro> d_gnss_observables_map;  // copy of the user epoch observables for the RINEX and RTCM printers, only at the epochs they log
+    std::vector<User_Pvt_Epoch> d_user_epochs;           // ring of epochs handed over to the user solver stage
+    size_t d_user_epoch_index;
 
     boost::posix_time::time_duration d_utc_diff_time;
 
     double d_rinex_version;
-    double d_rx_time;
+    double d_rx_time;  // time of the epoch being processed by the user solver
 
     key_t d_sysv_msg_key;
     int d_sysv_msqid;
 
     int32_t d_rinexobs_rate_ms;
+    int32_t d_rinex_rotation_s;     // length of the RINEX files, 0 for a single file
     int32_t d_rtcm_MT1045_rate_ms;  // Galileo Broadcast Ephemeris
     int32_t d_rtcm_MT1019_rate_ms;  // GPS Broadcast Ephemeris (orbits)
     int32_t d_rtcm_MT1020_rate_ms;  // GLONASS Broadcast Ephemeris (orbits)
@@ -221,11 +304,14 @@ private:
     int32_t d_geojson_rate_ms;
     int32_t d_nmea_rate_ms;
     int32_t d_last_status_print_seg;  // for status printer
+    int32_t d_observable_interval_ms;
     int32_t d_output_rate_ms;
     int32_t d_display_rate_ms;
     int32_t d_report_rate_ms;
     int32_t d_max_obs_block_rx_clock_offset_ms;
 
+    int64_t d_rinex_period;  // UTC hour or day of the RINEX files being written
+
     uint32_t d_nchannels;
     uint32_t d_type_of_rx;
 
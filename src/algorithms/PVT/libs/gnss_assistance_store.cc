@@ -0,0 +1,396 @@
+/*!
+ * \file gnss_assistance_store.cc
+ * \brief Binary, append-only store of the navigation data received by the
+ * receiver (ephemeris, almanac, ionospheric and UTC models), used as GNSS
+ * assistance at the next start
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_assistance_store.h"
+#include "beidou_dnav_almanac.h"
+#include "beidou_dnav_ephemeris.h"
+#include "beidou_dnav_iono.h"
+#include "beidou_dnav_utc_model.h"
+#include "galileo_almanac.h"
+#include "galileo_ephemeris.h"
+#include "galileo_iono.h"
+#include "galileo_utc_model.h"
+#include "glonass_gnav_ephemeris.h"
+#include "glonass_gnav_utc_model.h"
+#include "gps_almanac.h"
+#include "gps_cnav_ephemeris.h"
+#include "gps_cnav_iono.h"
+#include "gps_cnav_utc_model.h"
+#include "gps_ephemeris.h"
+#include "gps_iono.h"
+#include "gps_utc_model.h"
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/crc.hpp>
+#include <glog/logging.h>
+#include <algorithm>  // for equal
+#include <array>      // for array
+#include <cstdio>     // for rename, remove
+#include <cstring>    // for memcpy
+#include <exception>  // for exception
+#include <fcntl.h>    // for open, O_RDONLY
+#include <sstream>    // for istringstream, ostringstream
+#include <sys/mman.h>  // for mmap, munmap
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+
+
+namespace
+{
+const std::array<char, 8> MAGIC{{'G', 'S', 'D', 'R', 'A', 'S', 'S', 'T'}};
+const std::size_t FILE_HEADER_LENGTH = 12;  // magic and format version
+
+// the numbers are written in the byte order of the host, as the Boost binary archives of the records
+template <typename T>
+T read_field(const char* data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+
+template <typename T>
+void write_field(std::string& buffer, T value)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+
+uint32_t crc32(const char* data, std::size_t length)
+{
+    boost::crc_32_type crc;
+    crc.process_bytes(data, length);
+    return crc.checksum();
+}
+}  // namespace
+
+
+// the numbers of the types are part of the file format, they must not change
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Gps_Ephemeris>() { return 1; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Gps_CNAV_Ephemeris>() { return 2; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Galileo_Ephemeris>() { return 3; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Glonass_Gnav_Ephemeris>() { return 4; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Beidou_Dnav_Ephemeris>() { return 5; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Gps_Almanac>() { return 6; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Galileo_Almanac>() { return 7; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Beidou_Dnav_Almanac>() { return 8; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Gps_Iono>() { return 9; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Gps_CNAV_Iono>() { return 10; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Galileo_Iono>() { return 11; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Beidou_Dnav_Iono>() { return 12; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Gps_Utc_Model>() { return 13; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Gps_CNAV_Utc_Model>() { return 14; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Galileo_Utc_Model>() { return 15; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Glonass_Gnav_Utc_Model>() { return 16; }
+template <>
+uint16_t Gnss_Assistance_Store::record_type<Beidou_Dnav_Utc_Model>() { return 17; }
+
+
+Gnss_Assistance_Store::Gnss_Assistance_Store(std::string filename) : d_filename(std::move(filename))
+{
+}
+
+
+Gnss_Assistance_Store::~Gnss_Assistance_Store()
+{
+    try
+        {
+            if (d_file.is_open())
+                {
+                    d_file.close();
+                }
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Problem closing the GNSS assistance store " << d_filename << ": " << e.what();
+        }
+}
+
+
+bool Gnss_Assistance_Store::load()
+{
+    const int fd = ::open(d_filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        {
+            return false;
+        }
+    struct stat file_status
+    {
+    };
+    if (fstat(fd, &file_status) != 0 or static_cast<std::size_t>(file_status.st_size) < FILE_HEADER_LENGTH)
+        {
+            close(fd);
+            LOG(WARNING) << d_filename << " is not a GNSS assistance store";
+            return false;
+        }
+    const auto length = static_cast<std::size_t>(file_status.st_size);
+    void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+        {
+            LOG(WARNING) << "Cannot map the GNSS assistance store " << d_filename << " in memory";
+            return false;
+        }
+    const char* data = static_cast<const char*>(mapped);
+    if (!std::equal(MAGIC.cbegin(), MAGIC.cend(), data) or read_field<uint32_t>(data + MAGIC.size()) != FORMAT_VERSION)
+        {
+            munmap(mapped, length);
+            LOG(WARNING) << d_filename << " is not a GNSS assistance store of version " << FORMAT_VERSION;
+            return false;
+        }
+
+    d_records.clear();
+    d_records_length = 0;
+    std::size_t pos = FILE_HEADER_LENGTH;
+    while (pos + RECORD_HEADER_LENGTH <= length)
+        {
+            const auto payload_length = read_field<uint32_t>(data + pos);
+            if (payload_length > length - pos - RECORD_HEADER_LENGTH or
+                read_field<uint32_t>(data + pos + 4) != crc32(data + pos + 8, 4 + payload_length))
+                {
+                    break;
+                }
+            const Record_Key record_key(read_field<uint16_t>(data + pos + 8), read_field<uint16_t>(data + pos + 10));
+            const auto it = d_records.find(record_key);
+            if (it != d_records.cend())
+                {
+                    d_records_length -= RECORD_HEADER_LENGTH + it->second.size();
+                }
+            d_records[record_key] = std::string(data + pos + RECORD_HEADER_LENGTH, payload_length);
+            d_records_length += RECORD_HEADER_LENGTH + payload_length;
+            pos += RECORD_HEADER_LENGTH + payload_length;
+        }
+    if (pos != length)
+        {
+            // the tail of a record being written when the receiver stopped
+            LOG(WARNING) << "Truncated or corrupted record at byte " << pos << " of the GNSS assistance store " << d_filename << ", the rest of the file is ignored";
+        }
+    munmap(mapped, length);
+    return true;
+}
+
+
+bool Gnss_Assistance_Store::open()
+{
+    load();
+    return rewrite();
+}
+
+
+template <typename T>
+bool Gnss_Assistance_Store::save(const T& record, uint32_t key)
+{
+    std::ostringstream os;
+    try
+        {
+            boost::archive::binary_oarchive archive(os);
+            archive << record;
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Cannot serialize a record of type " << record_type<T>() << " for the GNSS assistance store: " << e.what();
+            return false;
+        }
+    return append(record_type<T>(), static_cast<uint16_t>(key), os.str());
+}
+
+
+template <typename T>
+bool Gnss_Assistance_Store::get(T& record, uint32_t key) const
+{
+    const auto it = d_records.find(Record_Key(record_type<T>(), static_cast<uint16_t>(key)));
+    if (it == d_records.cend())
+        {
+            return false;
+        }
+    try
+        {
+            std::istringstream is(it->second);
+            boost::archive::binary_iarchive archive(is);
+            archive >> record;
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Cannot read a record of type " << it->first.first << " from the GNSS assistance store " << d_filename << ": " << e.what();
+            return false;
+        }
+    return true;
+}
+
+
+template <typename T>
+std::map<int, T> Gnss_Assistance_Store::get_all() const
+{
+    std::map<int, T> records;
+    const uint16_t type = record_type<T>();
+    for (auto it = d_records.lower_bound(Record_Key(type, 0)); it != d_records.cend() and it->first.first == type; ++it)
+        {
+            T record;
+            if (get(record, it->first.second))
+                {
+                    records[it->first.second] = record;
+                }
+        }
+    return records;
+}
+
+
+bool Gnss_Assistance_Store::append(uint16_t type, uint16_t key, std::string payload)
+{
+    const Record_Key record_key(type, key);
+    const auto it = d_records.find(record_key);
+    if (it != d_records.cend() and it->second == payload)
+        {
+            return true;  // repeated record, nothing new to write
+        }
+    if (!d_file.is_open())
+        {
+            return false;
+        }
+    const std::string record = encode(record_key, payload);
+    d_file.write(record.data(), record.size());
+    d_file.flush();
+    if (!d_file)
+        {
+            LOG(WARNING) << "Cannot write to the GNSS assistance store " << d_filename;
+            return false;
+        }
+    if (it != d_records.cend())
+        {
+            d_records_length -= RECORD_HEADER_LENGTH + it->second.size();
+        }
+    d_records[record_key] = std::move(payload);
+    d_records_length += record.size();
+    d_file_length += record.size();
+    if (d_file_length > MIN_COMPACTION_LENGTH and d_file_length > 2 * (FILE_HEADER_LENGTH + d_records_length))
+        {
+            return rewrite();
+        }
+    return true;
+}
+
+
+bool Gnss_Assistance_Store::rewrite()
+{
+    if (d_file.is_open())
+        {
+            d_file.close();
+        }
+    // the new file replaces the old one only once it is complete
+    const std::string tmp_filename = d_filename + ".tmp";
+    std::ofstream tmp_file(tmp_filename, std::ios::binary | std::ios::trunc);
+    tmp_file.write(MAGIC.data(), MAGIC.size());
+    std::string header;
+    write_field(header, FORMAT_VERSION);
+    tmp_file.write(header.data(), header.size());
+    for (const auto& record : d_records)
+        {
+            const std::string encoded = encode(record.first, record.second);
+            tmp_file.write(encoded.data(), encoded.size());
+        }
+    tmp_file.close();
+    if (!tmp_file or std::rename(tmp_filename.c_str(), d_filename.c_str()) != 0)
+        {
+            std::remove(tmp_filename.c_str());
+            LOG(WARNING) << "Cannot write the GNSS assistance store " << d_filename;
+            return false;
+        }
+    d_file_length = FILE_HEADER_LENGTH + d_records_length;
+    d_file.open(d_filename, std::ios::binary | std::ios::app);
+    return d_file.is_open();
+}
+
+
+std::string Gnss_Assistance_Store::encode(const Record_Key& record_key, const std::string& payload) const
+{
+    std::string record;
+    record.reserve(RECORD_HEADER_LENGTH + payload.size());
+    write_field(record, static_cast<uint32_t>(payload.size()));
+    write_field(record, uint32_t{0});  // CRC-32 of the type, the key and the payload, computed below
+    write_field(record, record_key.first);
+    write_field(record, record_key.second);
+    record += payload;
+    const uint32_t crc = crc32(record.data() + 8, record.size() - 8);
+    std::memcpy(&record[4], &crc, sizeof(crc));
+    return record;
+}
+
+
+template bool Gnss_Assistance_Store::save(const Gps_Ephemeris&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Gps_CNAV_Ephemeris&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Galileo_Ephemeris&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Glonass_Gnav_Ephemeris&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Beidou_Dnav_Ephemeris&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Gps_Almanac&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Galileo_Almanac&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Beidou_Dnav_Almanac&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Gps_Iono&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Gps_CNAV_Iono&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Galileo_Iono&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Beidou_Dnav_Iono&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Gps_Utc_Model&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Gps_CNAV_Utc_Model&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Galileo_Utc_Model&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Glonass_Gnav_Utc_Model&, uint32_t);
+template bool Gnss_Assistance_Store::save(const Beidou_Dnav_Utc_Model&, uint32_t);
+
+template bool Gnss_Assistance_Store::get(Gps_Ephemeris&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Gps_CNAV_Ephemeris&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Galileo_Ephemeris&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Glonass_Gnav_Ephemeris&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Beidou_Dnav_Ephemeris&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Gps_Almanac&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Galileo_Almanac&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Beidou_Dnav_Almanac&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Gps_Iono&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Gps_CNAV_Iono&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Galileo_Iono&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Beidou_Dnav_Iono&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Gps_Utc_Model&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Gps_CNAV_Utc_Model&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Galileo_Utc_Model&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Glonass_Gnav_Utc_Model&, uint32_t) const;
+template bool Gnss_Assistance_Store::get(Beidou_Dnav_Utc_Model&, uint32_t) const;
+
+template std::map<int, Gps_Ephemeris> Gnss_Assistance_Store::get_all() const;
+template std::map<int, Gps_CNAV_Ephemeris> Gnss_Assistance_Store::get_all() const;
+template std::map<int, Galileo_Ephemeris> Gnss_Assistance_Store::get_all() const;
+template std::map<int, Glonass_Gnav_Ephemeris> Gnss_Assistance_Store::get_all() const;
+template std::map<int, Beidou_Dnav_Ephemeris> Gnss_Assistance_Store::get_all() const;
+template std::map<int, Gps_Almanac> Gnss_Assistance_Store::get_all() const;
+template std::map<int, Galileo_Almanac> Gnss_Assistance_Store::get_all() const;
+template std::map<int, Beidou_Dnav_Almanac> Gnss_Assistance_Store::get_all() const;
@@ -0,0 +1,118 @@
+/*!
+ * \file gnss_assistance_store.h
+ * \brief Binary, append-only store of the navigation data received by the
+ * receiver (ephemeris, almanac, ionospheric and UTC models), used as GNSS
+ * assistance at the next start
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_ASSISTANCE_STORE_H
+#define GNSS_SDR_GNSS_ASSISTANCE_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+
+/*!
+ * \brief Keeps the latest record of each satellite and navigation model in a
+ * binary file, written as the records arrive.
+ *
+ * The file starts with a magic string and the version of the format, followed
+ * by the records: the length of the record, its CRC-32, the type and the key
+ * (the PRN, or 0 for the ionospheric and UTC models) of the record, and the
+ * record serialized with a Boost binary archive. New records are appended and
+ * flushed, so that a crash loses at most the record being written, which the
+ * CRC tells apart. The latest record of each type and key overrides the
+ * previous ones. When the file grows well beyond its latest records, it is
+ * rewritten with only them.
+ *
+ * Supported records: Gps_Ephemeris, Gps_CNAV_Ephemeris, Galileo_Ephemeris,
+ * Glonass_Gnav_Ephemeris, Beidou_Dnav_Ephemeris, Gps_Almanac,
+ * Galileo_Almanac, Beidou_Dnav_Almanac, Gps_Iono, Gps_CNAV_Iono,
+ * Galileo_Iono, Beidou_Dnav_Iono, Gps_Utc_Model, Gps_CNAV_Utc_Model,
+ * Galileo_Utc_Model, Glonass_Gnav_Utc_Model and Beidou_Dnav_Utc_Model.
+ */
+class Gnss_Assistance_Store
+{
+public:
+    static const uint32_t FORMAT_VERSION = 1;  //!< Version of the file format, checked on load
+
+    explicit Gnss_Assistance_Store(std::string filename);
+
+    ~Gnss_Assistance_Store();
+
+    /*!
+     * \brief Reads the records of the file, mapped in memory. A truncated or
+     * corrupted record ends the reading, keeping the records before it.
+     * Returns false if the file does not exist or is not a store of this
+     * version.
+     */
+    bool load();
+
+    /*!
+     * \brief Loads the records of the file, if any, rewrites the file with
+     * them and opens it to append the next ones. Returns false if the file
+     * cannot be written.
+     */
+    bool open();
+
+    /*!
+     * \brief Appends a record to the file, if it is open and the record
+     * differs from the latest one of its type and key.
+     */
+    template <typename T>
+    bool save(const T& record, uint32_t key = 0);
+
+    /*!
+     * \brief Latest record of type T with the given key. Returns false if
+     * there is none.
+     */
+    template <typename T>
+    bool get(T& record, uint32_t key = 0) const;
+
+    /*!
+     * \brief Latest records of type T, by key
+     */
+    template <typename T>
+    std::map<int, T> get_all() const;
+
+    inline std::size_t size() const { return d_records.size(); }  //!< Number of records kept
+
+    inline const std::string& filename() const { return d_filename; }  //!< Name of the file
+
+private:
+    static const uint32_t RECORD_HEADER_LENGTH = 12;          // length, CRC-32, type and key
+    static const std::size_t MIN_COMPACTION_LENGTH = 65536;  // the file is not rewritten while it is shorter
+
+    using Record_Key = std::pair<uint16_t, uint16_t>;  // type and key
+
+    template <typename T>
+    static uint16_t record_type();
+
+    bool append(uint16_t type, uint16_t key, std::string payload);
+    bool rewrite();
+    std::string encode(const Record_Key& record_key, const std::string& payload) const;
+
+    std::map<Record_Key, std::string> d_records;  // latest serialized record of each type and key
+    std::ofstream d_file;
+    std::string d_filename;
+    std::size_t d_file_length{};
+    std::size_t d_records_length{};
+};
+
+#endif  // GNSS_SDR_GNSS_ASSISTANCE_STORE_H
@@ -0,0 +1,85 @@
+/*!
+ * \file gnss_observables_epoch.cc
+ * \brief Observables of one epoch, stored in an array indexed by channel
+ * with a bitmap of the valid channels
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_observables_epoch.h"
+#include <algorithm>  // for std::max
+
+
+Gnss_Observables_Epoch::Gnss_Observables_Epoch(uint32_t nchannels)
+{
+    reset(nchannels);
+}
+
+
+void Gnss_Observables_Epoch::reset(uint32_t nchannels)
+{
+    d_obs.assign(nchannels, Gnss_Synchro());
+    d_valid.assign((nchannels + 63) / 64, 0);
+    d_size = 0;
+}
+
+
+uint32_t Gnss_Observables_Epoch::next(uint32_t ch) const
+{
+    const auto nchannels = static_cast<uint32_t>(d_obs.size());
+    while (ch < nchannels)
+        {
+            const uint64_t word = d_valid[ch / 64] >> (ch % 64);
+            if (word == 0)
+                {
+                    // no valid channel left in this word, go to the next one
+                    ch = (ch / 64 + 1) * 64;
+                    continue;
+                }
+            if (word & UINT64_C(1))
+                {
+                    return ch;
+                }
+            ch++;
+        }
+    return nchannels;
+}
+
+
+void Gnss_Observables_Epoch::to_map(std::map<int, Gnss_Synchro>& observables_map) const
+{
+    observables_map.clear();
+    for (auto it = cbegin(); it != cend(); ++it)
+        {
+            observables_map.insert(observables_map.cend(), std::pair<int, Gnss_Synchro>(it.channel(), *it));
+        }
+}
+
+
+void Gnss_Observables_Epoch::from_map(const std::map<int, Gnss_Synchro>& observables_map)
+{
+    uint32_t nchannels = capacity();
+    if (!observables_map.empty() and observables_map.crbegin()->first >= 0)
+        {
+            nchannels = std::max(nchannels, static_cast<uint32_t>(observables_map.crbegin()->first + 1));
+        }
+    reset(nchannels);
+    for (const auto& observable : observables_map)
+        {
+            if (observable.first >= 0)
+                {
+                    set(observable.first, observable.second);
+                }
+        }
+}
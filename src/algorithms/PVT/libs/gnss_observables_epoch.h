@@ -0,0 +1,153 @@
+/*!
+ * \file gnss_observables_epoch.h
+ * \brief Observables of one epoch, stored in an array indexed by channel
+ * with a bitmap of the valid channels
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_OBSERVABLES_EPOCH_H
+#define GNSS_SDR_GNSS_OBSERVABLES_EPOCH_H
+
+#include "gnss_synchro.h"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <vector>
+
+/*!
+ * \brief Observables of the channels of the receiver at one epoch.
+ *
+ * Replaces the std::map<int, Gnss_Synchro> keyed by channel that the PVT
+ * block used to rebuild at every epoch: the observables are stored in a
+ * fixed array of one element per channel, allocated once, and a bitmap
+ * tells which channels hold a valid observable. Iterating visits the valid
+ * channels in increasing order, as the map did, so front() is the
+ * observable of the lowest valid channel, which is the one the PVT block
+ * takes its receiver time from.
+ */
+class Gnss_Observables_Epoch
+{
+public:
+    template <typename Epoch, typename Value>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Gnss_Synchro;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator(Epoch* epoch, uint32_t channel) : d_epoch(epoch), d_channel(channel) {}
+        inline reference operator*() const { return (*d_epoch)[d_channel]; }
+        inline pointer operator->() const { return &(*d_epoch)[d_channel]; }
+        inline uint32_t channel() const { return d_channel; }  //!< Channel of the observable
+        inline Iterator& operator++()
+        {
+            d_channel = d_epoch->next(d_channel + 1);
+            return *this;
+        }
+        inline bool operator==(const Iterator& other) const { return d_channel == other.d_channel; }
+        inline bool operator!=(const Iterator& other) const { return d_channel != other.d_channel; }
+
+    private:
+        Epoch* d_epoch;
+        uint32_t d_channel;
+    };
+
+    using iterator = Iterator<Gnss_Observables_Epoch, Gnss_Synchro>;
+    using const_iterator = Iterator<const Gnss_Observables_Epoch, const Gnss_Synchro>;
+
+    Gnss_Observables_Epoch() = default;
+    explicit Gnss_Observables_Epoch(uint32_t nchannels);  //!< nchannels = number of channels of the receiver
+
+    void reset(uint32_t nchannels);  //!< Re-sets the number of channels, all of them invalid
+
+    //! Marks all the channels as invalid, without touching the stored observables
+    inline void clear()
+    {
+        for (auto& word : d_valid)
+            {
+                word = 0;
+            }
+        d_size = 0;
+    }
+
+    //! Stores the observable of channel ch and marks the channel as valid
+    inline void set(uint32_t ch, const Gnss_Synchro& obs)
+    {
+        d_obs[ch] = obs;
+        if (!valid(ch))
+            {
+                d_valid[ch / 64] |= (UINT64_C(1) << (ch % 64));
+                d_size++;
+            }
+    }
+
+    //! Marks channel ch as invalid
+    inline void erase(uint32_t ch)
+    {
+        if (valid(ch))
+            {
+                d_valid[ch / 64] &= ~(UINT64_C(1) << (ch % 64));
+                d_size--;
+            }
+    }
+
+    inline bool valid(uint32_t ch) const { return (d_valid[ch / 64] >> (ch % 64)) & UINT64_C(1); }
+
+    inline Gnss_Synchro& operator[](uint32_t ch) { return d_obs[ch]; }
+    inline const Gnss_Synchro& operator[](uint32_t ch) const { return d_obs[ch]; }
+
+    /*!
+     * \brief Lowest valid channel not less than ch, or capacity() if there
+     * is none
+     */
+    uint32_t next(uint32_t ch) const;
+
+    inline uint32_t capacity() const { return static_cast<uint32_t>(d_obs.size()); }  //!< Number of channels
+    inline uint32_t size() const { return d_size; }                                   //!< Number of valid channels
+    inline bool empty() const { return d_size == 0; }
+
+    //! Observable of the lowest valid channel. The epoch must not be empty.
+    inline const Gnss_Synchro& front() const { return d_obs[next(0)]; }
+
+    inline iterator begin() { return {this, next(0)}; }
+    inline iterator end() { return {this, capacity()}; }
+    inline const_iterator begin() const { return {this, next(0)}; }
+    inline const_iterator end() const { return {this, capacity()}; }
+    inline const_iterator cbegin() const { return begin(); }
+    inline const_iterator cend() const { return end(); }
+
+    /*!
+     * \brief Copies the valid observables to observables_map, keyed by
+     * channel, for the printers that take a map
+     */
+    void to_map(std::map<int, Gnss_Synchro>& observables_map) const;
+
+    /*!
+     * \brief Replaces the content by the observables of a map keyed by
+     * channel. The number of channels grows if a key does not fit.
+     */
+    void from_map(const std::map<int, Gnss_Synchro>& observables_map);
+
+private:
+    std::vector<Gnss_Synchro> d_obs;
+    std::vector<uint64_t> d_valid;  // one bit per channel
+    uint32_t d_size{0};
+};
+
+#endif  // GNSS_SDR_GNSS_OBSERVABLES_EPOCH_H
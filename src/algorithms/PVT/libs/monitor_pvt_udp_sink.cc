@@ -20,54 +20,49 @@
 
 #include "monitor_pvt_udp_sink.h"
 #include <boost/archive/binary_oarchive.hpp>
-#include <iostream>
+#include <glog/logging.h>
 #include <sstream>
 
 
-Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled) : socket{io_context}
+Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled)
+    : use_protobuf(protobuf_enabled),
+      // the clients expect a single object in each datagram
+      sink(addresses, port, QUEUE_LENGTH, 1,
+          [this](const std::vector<Monitor_Pvt>& monitor_pvt) { return serialize(monitor_pvt.front()); })
 {
-    for (const auto& address : addresses)
+}
+
+
+Monitor_Pvt_Udp_Sink::~Monitor_Pvt_Udp_Sink()
+{
+    sink.stop();
+    if (sink.dropped() > 0)
         {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
+            LOG(WARNING) << "PVT monitor dropped " << sink.dropped() << " of " << sink.written() + sink.dropped()
+                         << " objects, " << sink.datagrams() << " datagrams sent, " << sink.failed() << " failed";
         }
-
-    use_protobuf = protobuf_enabled;
-    if (use_protobuf)
+    else
         {
-            serdes = Serdes_Monitor_Pvt();
+            LOG(INFO) << "PVT monitor sent " << sink.written() << " objects in " << sink.datagrams()
+                      << " datagrams, " << sink.failed() << " failed";
         }
 }
 
 
 bool Monitor_Pvt_Udp_Sink::write_monitor_pvt(const Monitor_Pvt* monitor_pvt)
 {
-    std::string outbound_data;
+    return sink.write(monitor_pvt, 1);
+}
+
+
+std::string Monitor_Pvt_Udp_Sink::serialize(const Monitor_Pvt& monitor_pvt)
+{
     if (use_protobuf == false)
         {
             std::ostringstream archive_stream;
             boost::archive::binary_oarchive oa{archive_stream};
-            oa << *monitor_pvt;
-            outbound_data = archive_stream.str();
-        }
-    else
-        {
-            outbound_data = serdes.createProtobuffer(monitor_pvt);
-        }
-
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
-
-            try
-                {
-                    socket.send(boost::asio::buffer(outbound_data));
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    return false;
-                }
+            oa << monitor_pvt;
+            return archive_stream.str();
         }
-    return true;
+    return serdes.createProtobuffer(&monitor_pvt);
 }
@@ -21,32 +21,42 @@
 #ifndef GNSS_SDR_MONITOR_PVT_UDP_SINK_H
 #define GNSS_SDR_MONITOR_PVT_UDP_SINK_H
 
+#include "async_udp_sink.h"
 #include "monitor_pvt.h"
 #include "serdes_monitor_pvt.h"
-#include <boost/asio.hpp>
-#include <memory>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
+/*!
+ * \brief This class sends serialized Monitor_Pvt objects over UDP to one or
+ * multiple endpoints, from an I/O thread so that writing them does not block
+ * the PVT block. Each datagram carries one object.
+ */
 class Monitor_Pvt_Udp_Sink
 {
 public:
+    static const size_t QUEUE_LENGTH = 64;  //!< Objects that can wait to be sent
+
     Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled);
+    ~Monitor_Pvt_Udp_Sink();
+
+    /*!
+     * \brief Queues a copy of the object. Returns false if it was dropped
+     * because the queue was full.
+     */
     bool write_monitor_pvt(const Monitor_Pvt* monitor_pvt);
 
+    inline uint64_t written() const { return sink.written(); }  //!< Objects queued
+    inline uint64_t dropped() const { return sink.dropped(); }  //!< Objects dropped because the queue was full
+
 private:
+    std::string serialize(const Monitor_Pvt& monitor_pvt);  // in the I/O thread
+
     Serdes_Monitor_Pvt serdes;
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
-    boost::system::error_code error;
     bool use_protobuf;
+    Async_Udp_Sink<Monitor_Pvt> sink;  // last, so that its thread stops before serdes is destroyed
 };
 
 
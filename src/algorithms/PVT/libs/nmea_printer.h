@@ -25,11 +25,13 @@
 #ifndef GNSS_SDR_NMEA_PRINTER_H
 #define GNSS_SDR_NMEA_PRINTER_H
 
+#include "rtklib.h"                                // for sol_t, ssat_t
 #include <boost/date_time/posix_time/ptime.hpp>  // for ptime
 #include <fstream>                               // for ofstream
 #include <memory>                                // for shared_ptr
 #include <string>                                // for string
 
+class Rtklib_Solution_Snapshot;
 class Rtklib_Solver;
 
 /*!
@@ -56,6 +58,11 @@ public:
      */
     bool Print_Nmea_Line(const Rtklib_Solver* pvt_data, bool print_average_values);
 
+    /*!
+     * \brief Print NMEA PVT and satellite info of a copy of the solution
+     */
+    bool Print_Nmea_Line(const Rtklib_Solution_Snapshot* pvt_data, bool print_average_values);
+
 private:
     int init_serial(const std::string& serial_device);  // serial port control
     void close_serial();
@@ -67,8 +74,10 @@ private:
     std::string longitude_to_hm(double longitude);
     std::string latitude_to_hm(double lat);
     char checkSum(const std::string& sentence);
+    bool print_sentences();
 
-    const Rtklib_Solver* d_PVT_data;
+    const sol_t* d_pvt_sol;
+    const ssat_t* d_pvt_ssat;
 
     std::ofstream nmea_file_descriptor;  // Output file stream for NMEA log file
 
@@ -22,6 +22,7 @@
 Pvt_Conf::Pvt_Conf()
 {
     type_of_receiver = 0U;
+    observable_interval_ms = 20;
     output_rate_ms = 0;
     display_rate_ms = 0;
     kml_rate_ms = 1000;
@@ -32,6 +33,7 @@ Pvt_Conf::Pvt_Conf()
     max_obs_block_rx_clock_offset_ms = 40;
     rinex_version = 0;
     rinexobs_rate_ms = 0;
+    rinex_rotation_s = 0;
     rinex_name = "-";
 
     dump = false;
@@ -45,6 +47,10 @@ Pvt_Conf::Pvt_Conf()
     rtcm_station_id = 0U;
 
     output_enabled = true;
+    output_queue_depth = 32;
+    output_workers = 1;
+    user_solver_queue_depth = 16;
+    output_queue_drop_when_full = false;
     rinex_output_enabled = true;
     gpx_output_enabled = true;
     geojson_output_enabled = true;
@@ -47,6 +47,7 @@ public:
     std::string udp_addresses;
 
     uint32_t type_of_receiver;
+    int32_t observable_interval_ms;
     int32_t output_rate_ms;
     int32_t display_rate_ms;
     int32_t kml_rate_ms;
@@ -55,8 +56,12 @@ public:
     int32_t nmea_rate_ms;
     int32_t rinex_version;
     int32_t rinexobs_rate_ms;
+    int32_t rinex_rotation_s;
     int32_t max_obs_block_rx_clock_offset_ms;
     int udp_port;
+    uint32_t output_queue_depth;
+    uint32_t output_workers;
+    uint32_t user_solver_queue_depth;
 
     uint16_t rtcm_tcp_port;
     uint16_t rtcm_station_id;
@@ -65,6 +70,7 @@ public:
     bool flag_rtcm_server;
     bool flag_rtcm_tty_port;
     bool output_enabled;
+    bool output_queue_drop_when_full;
     bool rinex_output_enabled;
     bool gpx_output_enabled;
     bool geojson_output_enabled;
@@ -0,0 +1,157 @@
+/*!
+ * \file pvt_output_stage.cc
+ * \brief Worker threads that run the output tasks of the PVT block (file,
+ * serial port and network printers) out of the PVT thread, through bounded
+ * queues
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "pvt_output_stage.h"
+#include <glog/logging.h>
+#include <algorithm>  // for std::max
+#include <exception>  // for std::exception
+#include <utility>    // for std::move
+
+
+Pvt_Output_Stage::Pvt_Output_Stage(size_t queue_depth, bool drop_when_full, uint32_t n_workers)
+{
+    d_queue_depth = std::max(queue_depth, static_cast<size_t>(1));
+    d_drop_when_full = drop_when_full;
+    n_workers = std::max(n_workers, 1U);
+    d_workers.reserve(n_workers);
+    for (uint32_t i = 0; i < n_workers; i++)
+        {
+            d_workers.push_back(std::unique_ptr<Worker>(new Worker));
+            d_workers.back()->ring.resize(d_queue_depth);
+        }
+    // start the threads once all the workers exist
+    for (auto& worker : d_workers)
+        {
+            Worker* w = worker.get();
+            worker->thread = std::thread([this, w] { run(*w); });
+        }
+}
+
+
+Pvt_Output_Stage::~Pvt_Output_Stage()
+{
+    for (auto& worker : d_workers)
+        {
+            {
+                std::lock_guard<std::mutex> lock(worker->mutex);
+                worker->stop = true;
+            }
+            worker->not_empty.notify_all();
+            worker->not_full.notify_all();
+        }
+    for (auto& worker : d_workers)
+        {
+            if (worker->thread.joinable())
+                {
+                    worker->thread.join();
+                }
+        }
+    if (d_dropped.load() > 0)
+        {
+            LOG(WARNING) << "PVT output stage dropped " << d_dropped.load() << " of " << d_posted.load() + d_dropped.load()
+                         << " output tasks, maximum queue depth " << d_max_depth.load();
+        }
+    else
+        {
+            LOG(INFO) << "PVT output stage ran " << d_posted.load() << " output tasks, maximum queue depth " << d_max_depth.load();
+        }
+}
+
+
+bool Pvt_Output_Stage::post(uint32_t worker, Task task)
+{
+    Worker& w = *d_workers[worker % d_workers.size()];
+    size_t depth;
+    {
+        std::unique_lock<std::mutex> lock(w.mutex);
+        if (w.size == d_queue_depth)
+            {
+                if (d_drop_when_full or w.stop)
+                    {
+                        d_dropped++;
+                        return false;
+                    }
+                w.not_full.wait(lock, [this, &w] { return w.size < d_queue_depth or w.stop; });
+                if (w.stop)
+                    {
+                        d_dropped++;
+                        return false;
+                    }
+            }
+        w.ring[(w.head + w.size) % d_queue_depth] = std::move(task);
+        w.size++;
+        // counted before the worker can take the task out of the queue
+        depth = ++d_depth;
+    }
+    w.not_empty.notify_one();
+    d_posted++;
+    size_t max_depth = d_max_depth.load();
+    while (depth > max_depth and !d_max_depth.compare_exchange_weak(max_depth, depth))
+        {
+        }
+    return true;
+}
+
+
+void Pvt_Output_Stage::wait_idle()
+{
+    for (auto& worker : d_workers)
+        {
+            std::unique_lock<std::mutex> lock(worker->mutex);
+            worker->not_full.wait(lock, [&worker] { return (worker->size == 0 and !worker->running_task) or worker->stop; });
+        }
+}
+
+
+void Pvt_Output_Stage::run(Worker& worker)
+{
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    while (true)
+        {
+            worker.not_empty.wait(lock, [&worker] { return worker.size > 0 or worker.stop; });
+            if (worker.size == 0)
+                {
+                    // stop requested and nothing left to run
+                    break;
+                }
+            Task task = std::move(worker.ring[worker.head]);
+            worker.ring[worker.head] = nullptr;
+            worker.head = (worker.head + 1) % d_queue_depth;
+            worker.size--;
+            worker.running_task = true;
+            lock.unlock();
+            worker.not_full.notify_all();
+            d_depth--;
+            try
+                {
+                    task();
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(WARNING) << "Exception in a PVT output task: " << e.what();
+                }
+            lock.lock();
+            worker.running_task = false;
+            if (worker.size == 0)
+                {
+                    worker.not_full.notify_all();
+                }
+        }
+}
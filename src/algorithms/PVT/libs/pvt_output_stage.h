@@ -0,0 +1,100 @@
+/*!
+ * \file pvt_output_stage.h
+ * \brief Worker threads that run the output tasks of the PVT block (file,
+ * serial port and network printers) out of the PVT thread, through bounded
+ * queues
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_OUTPUT_STAGE_H
+#define GNSS_SDR_PVT_OUTPUT_STAGE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+ * \brief Runs output tasks on one or more worker threads.
+ *
+ * Each worker has its own bounded FIFO queue and runs its tasks in the order
+ * they were posted, so a printer whose tasks are always posted to the same
+ * worker is only ever used by that thread. When the queue of a worker is
+ * full, post() either drops the task or waits for room, depending on the
+ * policy chosen at construction.
+ *
+ * The destructor runs the tasks still queued before joining the workers.
+ */
+class Pvt_Output_Stage
+{
+public:
+    using Task = std::function<void()>;
+
+    /*!
+     * \brief queue_depth = maximum number of tasks waiting in the queue of
+     * each worker; drop_when_full = drop the new task instead of waiting
+     * when the queue is full; n_workers = number of worker threads
+     */
+    Pvt_Output_Stage(size_t queue_depth, bool drop_when_full, uint32_t n_workers = 1);
+    ~Pvt_Output_Stage();
+
+    Pvt_Output_Stage(const Pvt_Output_Stage&) = delete;
+    Pvt_Output_Stage& operator=(const Pvt_Output_Stage&) = delete;
+
+    /*!
+     * \brief Queues a task for the worker number worker (modulo the number
+     * of workers). Returns false if the task was dropped.
+     */
+    bool post(uint32_t worker, Task task);
+
+    void wait_idle();  //!< Waits until all the queued tasks have been run
+
+    inline uint32_t workers() const { return static_cast<uint32_t>(d_workers.size()); }
+    inline size_t depth() const { return d_depth.load(); }          //!< Tasks waiting in all the queues
+    inline size_t max_depth() const { return d_max_depth.load(); }  //!< Highest number of tasks waiting in all the queues
+    inline uint64_t posted() const { return d_posted.load(); }      //!< Tasks accepted by post()
+    inline uint64_t dropped() const { return d_dropped.load(); }    //!< Tasks dropped because their queue was full
+
+private:
+    struct Worker
+    {
+        std::vector<Task> ring;  // circular buffer of queue_depth tasks
+        size_t head{0};          // position of the oldest task
+        size_t size{0};
+        bool running_task{false};
+        bool stop{false};
+        std::mutex mutex;
+        std::condition_variable not_empty;
+        std::condition_variable not_full;  // also signalled when the worker becomes idle
+        std::thread thread;
+    };
+
+    void run(Worker& worker);
+
+    std::vector<std::unique_ptr<Worker>> d_workers;
+    std::atomic<size_t> d_depth{0};
+    std::atomic<size_t> d_max_depth{0};
+    std::atomic<uint64_t> d_posted{0};
+    std::atomic<uint64_t> d_dropped{0};
+    size_t d_queue_depth;
+    bool d_drop_when_full;
+};
+
+#endif  // GNSS_SDR_PVT_OUTPUT_STAGE_H
@@ -108,29 +108,9 @@ Rinex_Printer::Rinex_Printer(int32_t conf_version, const std::string& base_path,
             std::cout << "RINEX files will be stored at " << base_rinex_path << std::endl;
         }
 
-    navfilename = base_rinex_path + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_GPS_NAV", base_name);
-    obsfilename = base_rinex_path + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_OBS", base_name);
-    sbsfilename = base_rinex_path + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_SBAS", base_name);
-    navGalfilename = base_rinex_path + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_GAL_NAV", base_name);
-    navMixfilename = base_rinex_path + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_MIXED_NAV", base_name);
-    navGlofilename = base_rinex_path + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_GLO_NAV", base_name);
-    navBdsfilename = base_rinex_path + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_BDS_NAV", base_name);
-
-    Rinex_Printer::navFile.open(navfilename, std::ios::out | std::ios::in | std::ios::app);
-    Rinex_Printer::obsFile.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    Rinex_Printer::sbsFile.open(sbsfilename, std::ios::out | std::ios::app);
-    Rinex_Printer::navGalFile.open(navGalfilename, std::ios::out | std::ios::in | std::ios::app);
-    Rinex_Printer::navMixFile.open(navMixfilename, std::ios::out | std::ios::in | std::ios::app);
-    Rinex_Printer::navGloFile.open(navGlofilename, std::ios::out | std::ios::in | std::ios::app);
-    Rinex_Printer::navBdsFile.open(navBdsfilename, std::ios::out | std::ios::in | std::ios::app);
-
-
-    if (!Rinex_Printer::navFile.is_open() or !Rinex_Printer::obsFile.is_open() or
-        !Rinex_Printer::sbsFile.is_open() or !Rinex_Printer::navGalFile.is_open() or
-        !Rinex_Printer::navMixFile.is_open() or !Rinex_Printer::navGloFile.is_open())
-        {
-            std::cout << "RINEX files cannot be saved. Wrong permissions?" << std::endl;
-        }
+    base_path_ = base_rinex_path;
+    base_name_ = base_name;
+    Rinex_Printer::open_files();
 
     // RINEX v3.02 codes
     satelliteSystem["GPS"] = "G";
@@ -235,7 +215,42 @@ Rinex_Printer::Rinex_Printer(int32_t conf_version, const std::string& base_path,
 Rinex_Printer::~Rinex_Printer()
 {
     DLOG(INFO) << "RINEX printer destructor called.";
-    // close RINEX files
+    Rinex_Printer::close_files();
+}
+
+
+void Rinex_Printer::open_files()
+{
+    navfilename = base_path_ + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_GPS_NAV", base_name_);
+    obsfilename = base_path_ + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_OBS", base_name_);
+    sbsfilename = base_path_ + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_SBAS", base_name_);
+    navGalfilename = base_path_ + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_GAL_NAV", base_name_);
+    navMixfilename = base_path_ + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_MIXED_NAV", base_name_);
+    navGlofilename = base_path_ + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_GLO_NAV", base_name_);
+    navBdsfilename = base_path_ + fs::path::preferred_separator + Rinex_Printer::createFilename("RINEX_FILE_TYPE_BDS_NAV", base_name_);
+
+    // a rotated file holds the data of its period only, so a file of the same
+    // period left by a previous run on the same data is overwritten
+    const std::ios::openmode mode = rotated_files_ ? std::ios::trunc : std::ios::app;
+    Rinex_Printer::navFile.open(navfilename, std::ios::out | std::ios::in | mode);
+    Rinex_Printer::obsFile.open(obsfilename, std::ios::out | std::ios::in | mode);
+    Rinex_Printer::sbsFile.open(sbsfilename, std::ios::out | mode);
+    Rinex_Printer::navGalFile.open(navGalfilename, std::ios::out | std::ios::in | mode);
+    Rinex_Printer::navMixFile.open(navMixfilename, std::ios::out | std::ios::in | mode);
+    Rinex_Printer::navGloFile.open(navGlofilename, std::ios::out | std::ios::in | mode);
+    Rinex_Printer::navBdsFile.open(navBdsfilename, std::ios::out | std::ios::in | mode);
+
+    if (!Rinex_Printer::navFile.is_open() or !Rinex_Printer::obsFile.is_open() or
+        !Rinex_Printer::sbsFile.is_open() or !Rinex_Printer::navGalFile.is_open() or
+        !Rinex_Printer::navMixFile.is_open() or !Rinex_Printer::navGloFile.is_open())
+        {
+            std::cout << "RINEX files cannot be saved. Wrong permissions?" << std::endl;
+        }
+}
+
+
+void Rinex_Printer::close_files()
+{
     int64_t posn;
     int64_t poso;
     int64_t poss;
@@ -256,6 +271,7 @@ Rinex_Printer::~Rinex_Printer()
             Rinex_Printer::obsFile.close();
             Rinex_Printer::sbsFile.close();
             Rinex_Printer::navGalFile.close();
+            Rinex_Printer::navMixFile.close();
             Rinex_Printer::navGloFile.close();
             Rinex_Printer::navBdsFile.close();
         }
@@ -324,6 +340,15 @@ Rinex_Printer::~Rinex_Printer()
 }
 
 
+void Rinex_Printer::rotate_files(const boost::posix_time::ptime& utc_epoch)
+{
+    Rinex_Printer::close_files();
+    rotated_files_ = true;
+    rotation_epoch_ = utc_epoch;
+    Rinex_Printer::open_files();
+}
+
+
 void Rinex_Printer::lengthCheck(const std::string& line)
 {
     if (line.length() != 80)
@@ -339,7 +364,8 @@ void Rinex_Printer::lengthCheck(const std::string& line)
 std::string Rinex_Printer::createFilename(const std::string& type, const std::string& base_name)
 {
     const std::string stationName = "GSDR";  // 4-character station name designator
-    boost::gregorian::date today = boost::gregorian::day_clock::local_day();
+    // the rotated files are named after the UTC epoch of their data, the others after the local time
+    boost::gregorian::date today = rotated_files_ ? rotation_epoch_.date() : boost::gregorian::day_clock::local_day();
     const int32_t dayOfTheYear = today.day_of_year();
     std::stringstream strm0;
     if (dayOfTheYear < 100)
@@ -366,7 +392,7 @@ std::string Rinex_Printer::createFilename(const std::string& type, const std::st
     fileType.insert(std::pair<std::string, std::string>("RINEX_FILE_TYPE_SUMMARY", "S"));    // S - Summary file (used e.g., by IGS, not a standard!).
     fileType.insert(std::pair<std::string, std::string>("RINEX_FILE_TYPE_BDS_NAV", "F"));    // G - GLONASS navigation file.
 
-    boost::posix_time::ptime pt = boost::posix_time::second_clock::local_time();
+    boost::posix_time::ptime pt = rotated_files_ ? rotation_epoch_ : boost::posix_time::second_clock::local_time();
     tm pt_tm = boost::posix_time::to_tm(pt);
     int32_t local_hour = pt_tm.tm_hour;
     std::stringstream strm;
@@ -417,7 +443,15 @@ std::string Rinex_Printer::createFilename(const std::string& type, const std::st
 
     std::string typeOfFile = fileType[type];
     std::string filename;
-    if (base_name == "-")
+    if (rotated_files_)
+        {
+            // the files opened by rotate_files() are told apart by the epoch of their first data, down to the second
+            std::stringstream strm4;
+            strm4 << std::setw(2) << std::setfill('0') << pt_tm.tm_sec;
+            const std::string prefix = base_name == "-" ? stationName : base_name + "_";
+            filename = prefix + dayOfTheYearTag + hourTag + minTag + strm4.str() + "." + yearTag + typeOfFile;
+        }
+    else if (base_name == "-")
         {
             filename = stationName + dayOfTheYearTag + hourTag + minTag + "." + yearTag + typeOfFile;
         }
@@ -2551,6 +2585,79 @@ void Rinex_Printer::rinex_sbs_header(std::fstream& out)
 }
 
 
+std::string Rinex_Printer::reserved_header_line()
+{
+    return std::string(60, ' ') + Rinex_Printer::leftJustify("COMMENT", 20);
+}
+
+
+void Rinex_Printer::update_header(std::fstream& out, const std::string& filename, const std::vector<std::string>& header)
+{
+    std::string new_header;
+    for (const auto& line : header)
+        {
+            new_header += line;
+            new_header += '\n';
+        }
+    out.close();
+
+    std::ifstream in(filename, std::ios::binary);
+    std::string line_str;
+    int64_t header_length = 0;
+    while (std::getline(in, line_str))
+        {
+            header_length += static_cast<int64_t>(line_str.size()) + 1;
+            if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    break;
+                }
+        }
+
+    if (static_cast<int64_t>(new_header.size()) == header_length)
+        {
+            // the data records are not touched
+            in.close();
+            out.open(filename, std::ios::out | std::ios::in);
+            out.seekp(0);
+            out.write(new_header.data(), static_cast<std::streamsize>(new_header.size()));
+            out.close();
+        }
+    else
+        {
+            const std::string tmp_filename = filename + ".tmp";
+            std::ofstream tmp(tmp_filename, std::ios::binary | std::ios::trunc);
+            tmp << new_header;
+            in.clear();
+            in.seekg(header_length);
+            if (in.peek() != std::ifstream::traits_type::eof())
+                {
+                    tmp << in.rdbuf();
+                }
+            tmp.close();
+            const bool copied = !tmp.fail() and !in.bad();
+            in.close();
+            errorlib::error_code ec;
+            if (!copied)
+                {
+                    // a full disk or an I/O error must not replace the file with a truncated copy
+                    LOG(WARNING) << "Error writing " << tmp_filename << ", the header of " << filename << " is not updated";
+                    fs::remove(fs::path(tmp_filename), ec);
+                }
+            else
+                {
+                    fs::rename(fs::path(tmp_filename), fs::path(filename), ec);
+                    if (ec)
+                        {
+                            LOG(WARNING) << "Error updating the header of " << filename << ": " << ec.message();
+                            fs::remove(fs::path(tmp_filename), ec);
+                        }
+                }
+        }
+    out.open(filename, std::ios::out | std::ios::in | std::ios::app);
+    out.seekp(0, std::ios_base::end);
+}
+
+
 void Rinex_Printer::update_nav_header(std::fstream& out, const Glonass_Gnav_Utc_Model& glonass_gnav_utc_model, const Glonass_Gnav_Almanac& glonass_gnav_almanac)
 {
     if (glonass_gnav_almanac.i_satellite_freq_channel)
@@ -2559,7 +2666,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Glonass_Gnav_Utc_
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -2608,20 +2714,11 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Glonass_Gnav_Utc_
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(navGlofilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navGlofilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navGlofilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC info." << std::endl;
 }
 
@@ -2631,7 +2728,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -2703,20 +2799,11 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(navGalfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navGalfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navGalfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info." << std::endl;
 }
 
@@ -2726,7 +2813,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Utc_Model& ut
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -2882,20 +2968,11 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Utc_Model& ut
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info." << std::endl;
 }
 
@@ -2905,7 +2982,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -2977,20 +3053,11 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info." << std::endl;
 }
 
@@ -3000,7 +3067,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -3107,19 +3173,10 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info." << std::endl;
 }
 
@@ -3129,7 +3186,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -3250,20 +3306,11 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navMixfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info." << std::endl;
 }
 
@@ -3276,7 +3323,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -3372,20 +3418,11 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navMixfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info." << std::endl;
 }
 
@@ -3398,7 +3435,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Iono& gp
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -3480,20 +3516,11 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Iono& gp
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navMixfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info." << std::endl;
 }
 
@@ -3510,7 +3537,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -3582,20 +3608,11 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navMixfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info." << std::endl;
 }
 
@@ -3605,7 +3622,6 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Beidou_Dnav_Utc_M
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
@@ -3675,20 +3691,11 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Beidou_Dnav_Utc_M
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    Rinex_Printer::update_header(out, navfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info." << std::endl;
 }
 
@@ -5113,6 +5120,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Glonass_Gnav_Ephem
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- GLONASS SLOT / FRQ # (On;y version 3)
     if (version == 3)
         {
@@ -5469,6 +5479,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& gps
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- GLONASS SLOT / FRQ # (On;y version 3)
     if (version == 3)
         {
@@ -5793,6 +5806,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_CNAV_Ephemeris
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- GLONASS SLOT / FRQ #
     // TODO Need to provide system with list of all satellites and update this accordingly
     line.clear();
@@ -6156,6 +6172,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Galileo_Ephemeris&
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -6418,6 +6437,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& eph
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- SYS /PHASE SHIFTS
 
     // -------- end of header
@@ -6666,6 +6688,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_CNAV_Ephemeris
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- SYS /PHASE SHIFTS
 
     // -------- end of header
@@ -6941,6 +6966,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& eph
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- SYS /PHASE SHIFTS
 
     // -------- end of header
@@ -7294,6 +7322,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& gps
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -7615,6 +7646,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_CNAV_Ephemeris
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -7877,6 +7911,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Galileo_Ephemeris&
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- SYS /PHASE SHIFTS
 
     // -------- end of header
@@ -8172,6 +8209,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& gps
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -8402,6 +8442,9 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Beidou_Dnav_Epheme
     Rinex_Printer::lengthCheck(line);
     out << line << std::endl;
 
+    // -------- room for the LEAP SECONDS line, filled in by update_obs_header()
+    out << Rinex_Printer::reserved_header_line() << std::endl;
+
     // -------- SYS /PHASE SHIFTS
 
     // -------- end of header
@@ -8440,6 +8483,10 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_Utc_Model& ut
             if (!no_more_finds)
                 {
                     line_aux.clear();
+                    if (line_str == Rinex_Printer::reserved_header_line())
+                        {
+                            continue;  // its room is taken by the LEAP SECONDS line
+                        }
 
                     if (version == 2)
                         {
@@ -8488,20 +8535,11 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_Utc_Model& ut
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    Rinex_Printer::update_header(out, obsfilename, data);
 }
 
 
@@ -8523,6 +8561,10 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_CNAV_Utc_Mode
             if (!no_more_finds)
                 {
                     line_aux.clear();
+                    if (line_str == Rinex_Printer::reserved_header_line())
+                        {
+                            continue;  // its room is taken by the LEAP SECONDS line
+                        }
                     if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
                         {
                             data.push_back(line_str);
@@ -8546,20 +8588,11 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    Rinex_Printer::update_header(out, obsfilename, data);
 }
 
 
@@ -8581,6 +8614,10 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Galileo_Utc_Model
             if (!no_more_finds)
                 {
                     line_aux.clear();
+                    if (line_str == Rinex_Printer::reserved_header_line())
+                        {
+                            continue;  // its room is taken by the LEAP SECONDS line
+                        }
 
                     if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
                         {
@@ -8605,20 +8642,11 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Galileo_Utc_Model
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    Rinex_Printer::update_header(out, obsfilename, data);
 }
 
 
@@ -8640,6 +8668,10 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Beidou_Dnav_Utc_M
             if (!no_more_finds)
                 {
                     line_aux.clear();
+                    if (line_str == Rinex_Printer::reserved_header_line())
+                        {
+                            continue;  // its room is taken by the LEAP SECONDS line
+                        }
 
                     if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
                         {
@@ -8664,20 +8696,11 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Beidou_Dnav_Utc_M
                 }
             else
                 {
-                    data.push_back(line_str);
+                    break;  // the data records are not read
                 }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << std::endl;
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    Rinex_Printer::update_header(out, obsfilename, data);
 }
 
 
@@ -8767,7 +8790,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
             // line += rightJustify(asString(clockOffset, 12), 15);
             line += std::string(80 - line.size(), ' ');
             Rinex_Printer::lengthCheck(line);
-            out << line << std::endl;
+            out << line << '\n';
 
             for (observables_iter = observables.cbegin();
                  observables_iter != observables.cend();
@@ -8822,7 +8845,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                         {
                             lineObs += std::string(80 - lineObs.size(), ' ');
                         }
-                    out << lineObs << std::endl;
+                    out << lineObs << '\n';
                 }
         }
 
@@ -8868,7 +8891,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
 
             line += std::string(80 - line.size(), ' ');
             Rinex_Printer::lengthCheck(line);
-            out << line << std::endl;
+            out << line << '\n';
 
             for (observables_iter = observables.cbegin();
                  observables_iter != observables.cend();
@@ -8932,7 +8955,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Glonass_Gnav_Ephemeri
                         {
                             lineObs += std::string(80 - lineObs.size(), ' ');
                         }
-                    out << lineObs << std::endl;
+                    out << lineObs << '\n';
                 }
         }
 }
@@ -9127,7 +9150,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
         }
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     // -------- OBSERVATION record
     std::string s;
@@ -9206,7 +9229,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 
     std::pair<std::multimap<uint32_t, Gnss_Synchro>::iterator, std::multimap<uint32_t, Gnss_Synchro>::iterator> ret;
@@ -9278,7 +9301,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -9390,7 +9413,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     // -------- OBSERVATION record
     std::string s;
@@ -9466,7 +9489,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 
     std::pair<std::multimap<uint32_t, Gnss_Synchro>::iterator, std::multimap<uint32_t, Gnss_Synchro>::iterator> ret;
@@ -9536,7 +9559,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& g
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -9650,7 +9673,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     std::string s;
     std::string lineObs;
@@ -9722,7 +9745,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 
     std::pair<std::multimap<uint32_t, Gnss_Synchro>::iterator, std::multimap<uint32_t, Gnss_Synchro>::iterator> ret;
@@ -9789,7 +9812,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ga
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -9875,7 +9898,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
             // line += rightJustify(asString(clockOffset, 12), 15);
             line += std::string(80 - line.size(), ' ');
             Rinex_Printer::lengthCheck(line);
-            out << line << std::endl;
+            out << line << '\n';
 
             for (observables_iter = observables.cbegin();
                  observables_iter != observables.cend();
@@ -9930,7 +9953,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
                         {
                             lineObs += std::string(80 - lineObs.size(), ' ');
                         }
-                    out << lineObs << std::endl;
+                    out << lineObs << '\n';
                 }
         }
 
@@ -9977,7 +10000,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
 
             line += std::string(80 - line.size(), ' ');
             Rinex_Printer::lengthCheck(line);
-            out << line << std::endl;
+            out << line << '\n';
 
             for (observables_iter = observables.cbegin();
                  observables_iter != observables.cend();
@@ -10041,7 +10064,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
                         {
                             lineObs += std::string(80 - lineObs.size(), ' ');
                         }
-                    out << lineObs << std::endl;
+                    out << lineObs << '\n';
                 }
         }
 }
@@ -10104,7 +10127,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     for (observables_iter = observables.cbegin();
          observables_iter != observables.cend();
@@ -10169,7 +10192,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -10327,7 +10350,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
     // line += rightJustify(asString(clockOffset, 12), 15);
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     std::string lineObs;
     std::pair<std::multimap<uint32_t, Gnss_Synchro>::iterator, std::multimap<uint32_t, Gnss_Synchro>::iterator> ret;
@@ -10405,7 +10428,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& eph, c
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -10584,7 +10607,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ep
     // line += rightJustify(asString(clockOffset, 12), 15);
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     std::string lineObs;
     std::pair<std::multimap<uint32_t, Gnss_Synchro>::iterator, std::multimap<uint32_t, Gnss_Synchro>::iterator> ret;
@@ -10651,7 +10674,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Galileo_Ephemeris& ep
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -10784,7 +10807,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     std::string s;
     std::string lineObs;
@@ -10856,7 +10879,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 
     std::pair<std::multimap<uint32_t, Gnss_Synchro>::iterator, std::multimap<uint32_t, Gnss_Synchro>::iterator> ret;
@@ -10923,7 +10946,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -11089,7 +11112,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     std::string s;
     std::string lineObs;
@@ -11154,7 +11177,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
                     lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
                 }
 
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 
     for (it = available_gal_prns.begin();
@@ -11217,7 +11240,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_CNAV_Ephemeris& e
                 }
 
             // if (lineObs.size() < 80) lineObs += std::string(80 - lineObs.size(), ' ');
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -11404,7 +11427,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
 
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     std::string s;
     std::string lineObs;
@@ -11480,7 +11503,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                     lineObs += Rinex_Printer::rightJustify(asString(iter->second.CN0_dB_hz, 3), 14);
                 }
 
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 
     for (it = available_gal_prns.begin();
@@ -11543,7 +11566,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Gps_Ephemeris& gps_ep
                 }
 
             // if (lineObs.size() < 80) lineObs += std::string(80 - lineObs.size(), ' ');
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -11664,7 +11687,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Beidou_Dnav_Ephemeris
     // line += rightJustify(asString(clockOffset, 12), 15);
     line += std::string(80 - line.size(), ' ');
     Rinex_Printer::lengthCheck(line);
-    out << line << std::endl;
+    out << line << '\n';
 
     std::string lineObs;
     std::pair<std::multimap<uint32_t, Gnss_Synchro>::iterator, std::multimap<uint32_t, Gnss_Synchro>::iterator> ret;
@@ -11719,7 +11742,7 @@ void Rinex_Printer::log_rinex_obs(std::fstream& out, const Beidou_Dnav_Ephemeris
                 {
                     lineObs += std::string(80 - lineObs.size(), ' ');
                 }
-            out << lineObs << std::endl;
+            out << lineObs << '\n';
         }
 }
 
@@ -41,13 +41,16 @@
 #define GNSS_SDR_RINEX_PRINTER_H
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <array>    // for array
 #include <cstdint>  // for int32_t
+#include <cstdio>   // for snprintf
 #include <cstdlib>  // for strtol, strtod
 #include <fstream>  // for fstream
 #include <iomanip>  // for setprecision
 #include <map>      // for map
 #include <sstream>  // for stringstream
 #include <string>   // for string
+#include <vector>   // for vector
 
 class Beidou_Dnav_Ephemeris;
 class Beidou_Dnav_Iono;
@@ -439,6 +442,13 @@ public:
 
     void set_pre_2009_file(bool pre_2009_file);
 
+    /*!
+     * \brief Closes the current RINEX files and opens new ones, named after
+     * the UTC epoch of the data that starts them, for the hourly or daily
+     * rotation of the files. The headers have to be written again.
+     */
+    void rotate_files(const boost::posix_time::ptime& utc_epoch);
+
 private:
     /*
      * Generation of RINEX signal strength indicators
@@ -463,6 +473,30 @@ private:
      */
     std::string createFilename(const std::string& type, const std::string& base_name);
 
+    /*
+     * Opens the RINEX files, named after the current time, or after the
+     * rotation epoch once the files have been rotated
+     */
+    void open_files();
+
+    /*
+     * Closes the RINEX files, and removes the ones with nothing written
+     */
+    void close_files();
+
+    /*
+     * Blank COMMENT line written after TIME OF FIRST OBS, taking the room of
+     * the LEAP SECONDS line until update_obs_header() fills it in
+     */
+    std::string reserved_header_line();
+
+    /*
+     * Writes the updated header lines, up to END OF HEADER. The header is
+     * patched in place if its length did not change, otherwise the data
+     * records are copied after the new header.
+     */
+    void update_header(std::fstream& out, const std::string& filename, const std::vector<std::string>& header);
+
     /*
      * Generates the data for the PGM / RUN BY / DATE line
      */
@@ -652,6 +686,10 @@ private:
     int version;                  // RINEX version (2 for 2.10/2.11 and 3 for 3.01)
     int numberTypesObservations;  // Number of available types of observable in the system. Should be public?
     bool pre_2009_file_;
+    bool rotated_files_{};
+    boost::posix_time::ptime rotation_epoch_;  // UTC epoch of the first data of the rotated files
+    std::string base_path_;
+    std::string base_name_;
 };
 
 
@@ -864,9 +902,16 @@ inline std::string asString(const long double x, const std::string::size_type pr
 
 inline std::string Rinex_Printer::asString(const double x, const std::string::size_type precision)
 {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(precision) << x;
-    return ss.str();
+    // same output as std::fixed and std::setprecision, without building a stream for each field
+    std::array<char, 64> buffer{};
+    const int length = std::snprintf(buffer.data(), buffer.size(), "%.*f", static_cast<int>(precision), x);
+    if (length < 0 or length >= static_cast<int>(buffer.size()))
+        {
+            std::ostringstream ss;
+            ss << std::fixed << std::setprecision(precision) << x;
+            return ss.str();
+        }
+    return std::string(buffer.data(), length);
 }
 
 
@@ -906,4 +951,11 @@ inline std::string Rinex_Printer::asString(const X x)
 }
 
 
+template <>
+inline std::string Rinex_Printer::asString(const int32_t x)
+{
+    return std::to_string(x);
+}
+
+
 #endif
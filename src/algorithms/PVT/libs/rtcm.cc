@@ -125,26 +125,6 @@ bool Rtcm::is_server_running() const
 //
 // *****************************************************************************************************
 
-std::string Rtcm::add_CRC(const std::string& message_without_crc) const
-{
-    // ******  Computes Qualcomm CRC-24Q ******
-    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM;
-    // 1) Converts the string to a vector of uint8_t:
-    boost::dynamic_bitset<uint8_t> frame_bits(message_without_crc);
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    // 2) Computes CRC
-    CRC_RTCM.process_bytes(bytes.data(), bytes.size());
-    auto crc_frame = std::bitset<24>(CRC_RTCM.checksum());
-
-    // 3) Builds the complete message
-    std::string complete_message = message_without_crc + crc_frame.to_string();
-    return bin_to_binary_data(complete_message);
-}
-
-
 bool Rtcm::check_CRC(const std::string& message) const
 {
     boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM_CHECK;
@@ -400,19 +380,9 @@ int64_t Rtcm::hex_to_int(const std::string& s) const
 }
 
 
-std::string Rtcm::build_message(const std::string& data) const
+std::string Rtcm::build_message()
 {
-    uint32_t msg_length_bits = data.length();
-    uint32_t msg_length_bytes = std::ceil(static_cast<float>(msg_length_bits) / 8.0);
-    auto message_length = std::bitset<10>(msg_length_bytes);
-    uint32_t zeros_to_fill = 8 * msg_length_bytes - msg_length_bits;
-    std::string b(zeros_to_fill, '0');
-    std::string msg_content = data + b;
-    std::string msg_without_crc = preamble.to_string() +
-                                  reserved_field.to_string() +
-                                  message_length.to_string() +
-                                  msg_content;
-    return Rtcm::add_CRC(msg_without_crc);
+    return message_writer.frame();
 }
 
 
@@ -429,7 +399,7 @@ std::string Rtcm::build_message(const std::string& data) const
 //
 // ********************************************************
 
-std::bitset<64> Rtcm::get_MT1001_4_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
+void Rtcm::put_MT1001_4_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
     uint32_t ref_id, uint32_t smooth_int, bool sync_flag, bool divergence_free)
 {
     uint32_t reference_station_id = ref_id;  // Max: 4095
@@ -445,20 +415,17 @@ std::bitset<64> Rtcm::get_MT1001_4_header(uint32_t msg_number, double obs_time,
     Rtcm::set_DF007(divergence_free_smoothing_indicator);
     Rtcm::set_DF008(smoothing_interval);
 
-    std::string header = DF002.to_string() +
-                         DF003.to_string() +
-                         DF004.to_string() +
-                         DF005.to_string() +
-                         DF006.to_string() +
-                         DF007.to_string() +
-                         DF008.to_string();
-
-    std::bitset<64> header_msg(header);
-    return header_msg;
+    message_writer.put(DF002);
+    message_writer.put(DF003);
+    message_writer.put(DF004);
+    message_writer.put(DF005);
+    message_writer.put(DF006);
+    message_writer.put(DF007);
+    message_writer.put(DF008);
 }
 
 
-std::bitset<58> Rtcm::get_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::put_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchro);
@@ -467,14 +434,11 @@ std::bitset<58> Rtcm::get_MT1001_sat_content(const Gps_Ephemeris& eph, double ob
     Rtcm::set_DF012(gnss_synchro);
     Rtcm::set_DF013(eph, obs_time, gnss_synchro);
 
-    std::string content = DF009.to_string() +
-                          DF010.to_string() +
-                          DF011.to_string() +
-                          DF012.to_string() +
-                          DF013.to_string();
-
-    std::bitset<58> content_msg(content);
-    return content_msg;
+    message_writer.put(DF009);
+    message_writer.put(DF010);
+    message_writer.put(DF011);
+    message_writer.put(DF012);
+    message_writer.put(DF013);
 }
 
 
@@ -501,18 +465,17 @@ std::string Rtcm::print_MT1001(const Gps_Ephemeris& gps_eph, double obs_time, co
                 }
         }
 
-    std::bitset<64> header = Rtcm::get_MT1001_4_header(1001, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_writer.clear();
+    Rtcm::put_MT1001_4_header(1001, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (observables_iter = observablesL1.cbegin();
          observables_iter != observablesL1.cend();
          observables_iter++)
         {
-            std::bitset<58> content = Rtcm::get_MT1001_sat_content(gps_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::put_MT1001_sat_content(gps_eph, obs_time, observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -550,18 +513,17 @@ std::string Rtcm::print_MT1002(const Gps_Ephemeris& gps_eph, double obs_time, co
                 }
         }
 
-    std::bitset<64> header = Rtcm::get_MT1001_4_header(1002, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_writer.clear();
+    Rtcm::put_MT1001_4_header(1002, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (observables_iter = observablesL1.cbegin();
          observables_iter != observablesL1.cend();
          observables_iter++)
         {
-            std::bitset<74> content = Rtcm::get_MT1002_sat_content(gps_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::put_MT1002_sat_content(gps_eph, obs_time, observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -570,7 +532,7 @@ std::string Rtcm::print_MT1002(const Gps_Ephemeris& gps_eph, double obs_time, co
 }
 
 
-std::bitset<74> Rtcm::get_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::put_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchro);
@@ -579,16 +541,13 @@ std::bitset<74> Rtcm::get_MT1002_sat_content(const Gps_Ephemeris& eph, double ob
     Rtcm::set_DF012(gnss_synchro);
     Rtcm::set_DF013(eph, obs_time, gnss_synchro);
 
-    std::string content = DF009.to_string() +
-                          DF010.to_string() +
-                          DF011.to_string() +
-                          DF012.to_string() +
-                          DF013.to_string() +
-                          DF014.to_string() +
-                          DF015.to_string();
-
-    std::bitset<74> content_msg(content);
-    return content_msg;
+    message_writer.put(DF009);
+    message_writer.put(DF010);
+    message_writer.put(DF011);
+    message_writer.put(DF012);
+    message_writer.put(DF013);
+    message_writer.put(DF014);
+    message_writer.put(DF015);
 }
 
 
@@ -653,18 +612,17 @@ std::string Rtcm::print_MT1003(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
                 }
         }
 
-    std::bitset<64> header = Rtcm::get_MT1001_4_header(1003, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_writer.clear();
+    Rtcm::put_MT1001_4_header(1003, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (common_observables_iter = common_observables.cbegin();
          common_observables_iter != common_observables.cend();
          common_observables_iter++)
         {
-            std::bitset<101> content = Rtcm::get_MT1003_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::put_MT1003_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -673,7 +631,7 @@ std::string Rtcm::print_MT1003(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
 }
 
 
-std::bitset<101> Rtcm::get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::put_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchroL1);
@@ -686,18 +644,15 @@ std::bitset<101> Rtcm::get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const
     Rtcm::set_DF018(gnss_synchroL1, gnss_synchroL2);
     Rtcm::set_DF019(ephL2, obs_time, gnss_synchroL2);
 
-    std::string content = DF009.to_string() +
-                          DF010.to_string() +
-                          DF011.to_string() +
-                          DF012.to_string() +
-                          DF013.to_string() +
-                          DF016_.to_string() +
-                          DF017.to_string() +
-                          DF018.to_string() +
-                          DF019.to_string();
-
-    std::bitset<101> content_msg(content);
-    return content_msg;
+    message_writer.put(DF009);
+    message_writer.put(DF010);
+    message_writer.put(DF011);
+    message_writer.put(DF012);
+    message_writer.put(DF013);
+    message_writer.put(DF016_);
+    message_writer.put(DF017);
+    message_writer.put(DF018);
+    message_writer.put(DF019);
 }
 
 
@@ -762,18 +717,17 @@ std::string Rtcm::print_MT1004(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
                 }
         }
 
-    std::bitset<64> header = Rtcm::get_MT1001_4_header(1004, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_writer.clear();
+    Rtcm::put_MT1001_4_header(1004, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (common_observables_iter = common_observables.cbegin();
          common_observables_iter != common_observables.cend();
          common_observables_iter++)
         {
-            std::bitset<125> content = Rtcm::get_MT1004_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::put_MT1004_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -782,7 +736,7 @@ std::string Rtcm::print_MT1004(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
 }
 
 
-std::bitset<125> Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::put_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchroL1);
@@ -798,21 +752,18 @@ std::bitset<125> Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const
     Rtcm::set_DF019(ephL2, obs_time, gnss_synchroL2);
     Rtcm::set_DF020(gnss_synchroL2);
 
-    std::string content = DF009.to_string() +
-                          DF010.to_string() +
-                          DF011.to_string() +
-                          DF012.to_string() +
-                          DF013.to_string() +
-                          DF014.to_string() +
-                          DF015.to_string() +
-                          DF016_.to_string() +
-                          DF017.to_string() +
-                          DF018.to_string() +
-                          DF019.to_string() +
-                          DF020.to_string();
-
-    std::bitset<125> content_msg(content);
-    return content_msg;
+    message_writer.put(DF009);
+    message_writer.put(DF010);
+    message_writer.put(DF011);
+    message_writer.put(DF012);
+    message_writer.put(DF013);
+    message_writer.put(DF014);
+    message_writer.put(DF015);
+    message_writer.put(DF016_);
+    message_writer.put(DF017);
+    message_writer.put(DF018);
+    message_writer.put(DF019);
+    message_writer.put(DF020);
 }
 
 
@@ -832,7 +783,7 @@ std::bitset<125> Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const
    Expected output: D3 00 13 3E D7 D3 02 02 98 0E DE EF 34 B4 BD 62
                     AC 09 41 98 6F 33 36 0B 98
  */
-std::bitset<152> Rtcm::get_MT1005_test()
+void Rtcm::put_MT1005_test()
 {
     uint32_t mt1005 = 1005;
     uint32_t reference_station_id = 2003;  // Max: 4095
@@ -856,22 +807,19 @@ std::bitset<152> Rtcm::get_MT1005_test()
     DF364 = std::bitset<2>("00");  // Quarter Cycle Indicator
     Rtcm::set_DF027(ECEF_Z);
 
-    std::string message = DF002.to_string() +
-                          DF003.to_string() +
-                          DF021.to_string() +
-                          DF022.to_string() +
-                          DF023.to_string() +
-                          DF024.to_string() +
-                          DF141.to_string() +
-                          DF025.to_string() +
-                          DF142.to_string() +
-                          DF001_.to_string() +
-                          DF026.to_string() +
-                          DF364.to_string() +
-                          DF027.to_string();
-
-    std::bitset<152> test_msg(message);
-    return test_msg;
+    message_writer.put(DF002);
+    message_writer.put(DF003);
+    message_writer.put(DF021);
+    message_writer.put(DF022);
+    message_writer.put(DF023);
+    message_writer.put(DF024);
+    message_writer.put(DF141);
+    message_writer.put(DF025);
+    message_writer.put(DF142);
+    message_writer.put(DF001_);
+    message_writer.put(DF026);
+    message_writer.put(DF364);
+    message_writer.put(DF027);
 }
 
 
@@ -894,21 +842,22 @@ std::string Rtcm::print_MT1005(uint32_t ref_id, double ecef_x, double ecef_y, do
     DF364 = std::bitset<2>(quarter_cycle_indicator);
     Rtcm::set_DF027(ecef_z);
 
-    std::string data = DF002.to_string() +
-                       DF003.to_string() +
-                       DF021.to_string() +
-                       DF022.to_string() +
-                       DF023.to_string() +
-                       DF024.to_string() +
-                       DF141.to_string() +
-                       DF025.to_string() +
-                       DF142.to_string() +
-                       DF001_.to_string() +
-                       DF026.to_string() +
-                       DF364.to_string() +
-                       DF027.to_string();
-
-    std::string msg = build_message(data);
+    message_writer.clear();
+    message_writer.put(DF002);
+    message_writer.put(DF003);
+    message_writer.put(DF021);
+    message_writer.put(DF022);
+    message_writer.put(DF023);
+    message_writer.put(DF024);
+    message_writer.put(DF141);
+    message_writer.put(DF025);
+    message_writer.put(DF142);
+    message_writer.put(DF001_);
+    message_writer.put(DF026);
+    message_writer.put(DF364);
+    message_writer.put(DF027);
+
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -986,8 +935,9 @@ int32_t Rtcm::read_MT1005(const std::string& message, uint32_t& ref_id, double&
 
 std::string Rtcm::print_MT1005_test()
 {
-    std::bitset<152> mt1005 = get_MT1005_test();
-    return Rtcm::build_message(mt1005.to_string());
+    message_writer.clear();
+    Rtcm::put_MT1005_test();
+    return Rtcm::build_message();
 }
 
 // ********************************************************
@@ -1016,22 +966,23 @@ std::string Rtcm::print_MT1006(uint32_t ref_id, double ecef_x, double ecef_y, do
     Rtcm::set_DF027(ecef_z);
     Rtcm::set_DF028(height);
 
-    std::string data = DF002.to_string() +
-                       DF003.to_string() +
-                       DF021.to_string() +
-                       DF022.to_string() +
-                       DF023.to_string() +
-                       DF024.to_string() +
-                       DF141.to_string() +
-                       DF025.to_string() +
-                       DF142.to_string() +
-                       DF001_.to_string() +
-                       DF026.to_string() +
-                       DF364.to_string() +
-                       DF027.to_string() +
-                       DF028.to_string();
-
-    std::string msg = build_message(data);
+    message_writer.clear();
+    message_writer.put(DF002);
+    message_writer.put(DF003);
+    message_writer.put(DF021);
+    message_writer.put(DF022);
+    message_writer.put(DF023);
+    message_writer.put(DF024);
+    message_writer.put(DF141);
+    message_writer.put(DF025);
+    message_writer.put(DF142);
+    message_writer.put(DF001_);
+    message_writer.put(DF026);
+    message_writer.put(DF364);
+    message_writer.put(DF027);
+    message_writer.put(DF028);
+
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -1059,11 +1010,13 @@ std::string Rtcm::print_MT1008(uint32_t ref_id, const std::string& antenna_descr
         }
     DF029 = std::bitset<8>(len);
 
-    std::string DF030_str_;
+    message_writer.clear();
+    message_writer.put(DF002_);
+    message_writer.put(DF003);
+    message_writer.put(DF029);
     for (char c : ant_descriptor)
         {
-            auto character = std::bitset<8>(c);
-            DF030_str_ += character.to_string();
+            message_writer.put(static_cast<uint8_t>(c), 8);  // DF030
         }
 
     Rtcm::set_DF031(antenna_setup_id);
@@ -1077,22 +1030,14 @@ std::string Rtcm::print_MT1008(uint32_t ref_id, const std::string& antenna_descr
         }
     DF032 = std::bitset<8>(len2);
 
-    std::string DF033_str_;
+    message_writer.put(DF031);
+    message_writer.put(DF032);
     for (char c : ant_sn)
         {
-            auto character = std::bitset<8>(c);
-            DF033_str_ += character.to_string();
+            message_writer.put(static_cast<uint8_t>(c), 8);  // DF033
         }
 
-    std::string data = DF002_.to_string() +
-                       DF003.to_string() +
-                       DF029.to_string() +
-                       DF030_str_ +
-                       DF031.to_string() +
-                       DF032.to_string() +
-                       DF033_str_;
-
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -1106,7 +1051,7 @@ std::string Rtcm::print_MT1008(uint32_t ref_id, const std::string& antenna_descr
 //   MESSAGE TYPE 1009 (GLONASS L1 Basic RTK Observables)
 //
 // ********************************************************
-std::bitset<61> Rtcm::get_MT1009_12_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
+void Rtcm::put_MT1009_12_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
     uint32_t ref_id, uint32_t smooth_int, bool sync_flag, bool divergence_free)
 {
     uint32_t reference_station_id = ref_id;  // Max: 4095
@@ -1122,20 +1067,17 @@ std::bitset<61> Rtcm::get_MT1009_12_header(uint32_t msg_number, double obs_time,
     Rtcm::set_DF036(divergence_free_smoothing_indicator);
     Rtcm::set_DF037(smoothing_interval);
 
-    std::string header = DF002.to_string() +
-                         DF003.to_string() +
-                         DF034.to_string() +
-                         DF005.to_string() +
-                         DF035.to_string() +
-                         DF036.to_string() +
-                         DF037.to_string();
-
-    std::bitset<61> header_msg(header);
-    return header_msg;
+    message_writer.put(DF002);
+    message_writer.put(DF003);
+    message_writer.put(DF034);
+    message_writer.put(DF005);
+    message_writer.put(DF035);
+    message_writer.put(DF036);
+    message_writer.put(DF037);
 }
 
 
-std::bitset<64> Rtcm::get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::put_MT1009_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchro);
@@ -1145,15 +1087,12 @@ std::bitset<64> Rtcm::get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& eph,
     Rtcm::set_DF042(gnss_synchro);
     Rtcm::set_DF043(eph, obs_time, gnss_synchro);
 
-    std::string content = DF038.to_string() +
-                          DF039.to_string() +
-                          DF040.to_string() +
-                          DF041.to_string() +
-                          DF042.to_string() +
-                          DF043.to_string();
-
-    std::bitset<64> content_msg(content);
-    return content_msg;
+    message_writer.put(DF038);
+    message_writer.put(DF039);
+    message_writer.put(DF040);
+    message_writer.put(DF041);
+    message_writer.put(DF042);
+    message_writer.put(DF043);
 }
 
 
@@ -1180,18 +1119,17 @@ std::string Rtcm::print_MT1009(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, d
                 }
         }
 
-    std::bitset<61> header = Rtcm::get_MT1009_12_header(1009, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_writer.clear();
+    Rtcm::put_MT1009_12_header(1009, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (observables_iter = observablesL1.begin();
          observables_iter != observablesL1.end();
          observables_iter++)
         {
-            std::bitset<64> content = Rtcm::get_MT1009_sat_content(glonass_gnav_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::put_MT1009_sat_content(glonass_gnav_eph, obs_time, observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -1229,18 +1167,17 @@ std::string Rtcm::print_MT1010(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, d
                 }
         }
 
-    std::bitset<61> header = Rtcm::get_MT1009_12_header(1010, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_writer.clear();
+    Rtcm::put_MT1009_12_header(1010, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (observables_iter = observablesL1.begin();
          observables_iter != observablesL1.end();
          observables_iter++)
         {
-            std::bitset<79> content = Rtcm::get_MT1010_sat_content(glonass_gnav_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::put_MT1010_sat_content(glonass_gnav_eph, obs_time, observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -1249,7 +1186,7 @@ std::string Rtcm::print_MT1010(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, d
 }
 
 
-std::bitset<79> Rtcm::get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::put_MT1010_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchro);
@@ -1261,17 +1198,14 @@ std::bitset<79> Rtcm::get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& eph,
     Rtcm::set_DF044(gnss_synchro);
     Rtcm::set_DF045(gnss_synchro);
 
-    std::string content = DF038.to_string() +
-                          DF039.to_string() +
-                          DF040.to_string() +
-                          DF041.to_string() +
-                          DF042.to_string() +
-                          DF043.to_string() +
-                          DF044.to_string() +
-                          DF045.to_string();
-
-    std::bitset<79> content_msg(content);
-    return content_msg;
+    message_writer.put(DF038);
+    message_writer.put(DF039);
+    message_writer.put(DF040);
+    message_writer.put(DF041);
+    message_writer.put(DF042);
+    message_writer.put(DF043);
+    message_writer.put(DF044);
+    message_writer.put(DF045);
 }
 
 
@@ -1336,18 +1270,17 @@ std::string Rtcm::print_MT1011(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
                 }
         }
 
-    std::bitset<61> header = Rtcm::get_MT1009_12_header(1011, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_writer.clear();
+    Rtcm::put_MT1009_12_header(1011, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (common_observables_iter = common_observables.begin();
          common_observables_iter != common_observables.end();
          common_observables_iter++)
         {
-            std::bitset<107> content = Rtcm::get_MT1011_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::put_MT1011_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -1356,7 +1289,7 @@ std::string Rtcm::print_MT1011(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
 }
 
 
-std::bitset<107> Rtcm::get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::put_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchroL1);
@@ -1370,19 +1303,16 @@ std::bitset<107> Rtcm::get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL
     Rtcm::set_DF048(gnss_synchroL1, gnss_synchroL2);
     Rtcm::set_DF049(ephL2, obs_time, gnss_synchroL2);
 
-    std::string content = DF038.to_string() +
-                          DF039.to_string() +
-                          DF040.to_string() +
-                          DF041.to_string() +
-                          DF042.to_string() +
-                          DF043.to_string() +
-                          DF046_.to_string() +
-                          DF047.to_string() +
-                          DF048.to_string() +
-                          DF049.to_string();
-
-    std::bitset<107> content_msg(content);
-    return content_msg;
+    message_writer.put(DF038);
+    message_writer.put(DF039);
+    message_writer.put(DF040);
+    message_writer.put(DF041);
+    message_writer.put(DF042);
+    message_writer.put(DF043);
+    message_writer.put(DF046_);
+    message_writer.put(DF047);
+    message_writer.put(DF048);
+    message_writer.put(DF049);
 }
 
 
@@ -1447,18 +1377,17 @@ std::string Rtcm::print_MT1012(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
                 }
         }
 
-    std::bitset<61> header = Rtcm::get_MT1009_12_header(1012, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_writer.clear();
+    Rtcm::put_MT1009_12_header(1012, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (common_observables_iter = common_observables.begin();
          common_observables_iter != common_observables.end();
          common_observables_iter++)
         {
-            std::bitset<130> content = Rtcm::get_MT1012_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::put_MT1012_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -1467,7 +1396,7 @@ std::string Rtcm::print_MT1012(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
 }
 
 
-std::bitset<130> Rtcm::get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::put_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchroL1);
@@ -1484,22 +1413,19 @@ std::bitset<130> Rtcm::get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL
     Rtcm::set_DF049(ephL2, obs_time, gnss_synchroL2);
     Rtcm::set_DF050(gnss_synchroL2);
 
-    std::string content = DF038.to_string() +
-                          DF039.to_string() +
-                          DF040.to_string() +
-                          DF041.to_string() +
-                          DF042.to_string() +
-                          DF043.to_string() +
-                          DF044.to_string() +
-                          DF045.to_string() +
-                          DF046_.to_string() +
-                          DF047.to_string() +
-                          DF048.to_string() +
-                          DF049.to_string() +
-                          DF050.to_string();
-
-    std::bitset<130> content_msg(content);
-    return content_msg;
+    message_writer.put(DF038);
+    message_writer.put(DF039);
+    message_writer.put(DF040);
+    message_writer.put(DF041);
+    message_writer.put(DF042);
+    message_writer.put(DF043);
+    message_writer.put(DF044);
+    message_writer.put(DF045);
+    message_writer.put(DF046_);
+    message_writer.put(DF047);
+    message_writer.put(DF048);
+    message_writer.put(DF049);
+    message_writer.put(DF050);
 }
 
 
@@ -1545,46 +1471,45 @@ std::string Rtcm::print_MT1019(const Gps_Ephemeris& gps_eph)
     Rtcm::set_DF103(gps_eph);
     Rtcm::set_DF137(gps_eph);
 
-    std::string data;
-    data.clear();
-    data = DF002.to_string() +
-           DF009.to_string() +
-           DF076.to_string() +
-           DF077.to_string() +
-           DF078.to_string() +
-           DF079.to_string() +
-           DF071.to_string() +
-           DF081.to_string() +
-           DF082.to_string() +
-           DF083.to_string() +
-           DF084.to_string() +
-           DF085.to_string() +
-           DF086.to_string() +
-           DF087.to_string() +
-           DF088.to_string() +
-           DF089.to_string() +
-           DF090.to_string() +
-           DF091.to_string() +
-           DF092.to_string() +
-           DF093.to_string() +
-           DF094.to_string() +
-           DF095.to_string() +
-           DF096.to_string() +
-           DF097.to_string() +
-           DF098.to_string() +
-           DF099.to_string() +
-           DF100.to_string() +
-           DF101.to_string() +
-           DF102.to_string() +
-           DF103.to_string() +
-           DF137.to_string();
-
-    if (data.length() != 488)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1019 (488 bits expected, found " << data.length() << ")";
-        }
-
-    std::string msg = build_message(data);
+    message_writer.clear();
+    message_writer.put(DF002);
+    message_writer.put(DF009);
+    message_writer.put(DF076);
+    message_writer.put(DF077);
+    message_writer.put(DF078);
+    message_writer.put(DF079);
+    message_writer.put(DF071);
+    message_writer.put(DF081);
+    message_writer.put(DF082);
+    message_writer.put(DF083);
+    message_writer.put(DF084);
+    message_writer.put(DF085);
+    message_writer.put(DF086);
+    message_writer.put(DF087);
+    message_writer.put(DF088);
+    message_writer.put(DF089);
+    message_writer.put(DF090);
+    message_writer.put(DF091);
+    message_writer.put(DF092);
+    message_writer.put(DF093);
+    message_writer.put(DF094);
+    message_writer.put(DF095);
+    message_writer.put(DF096);
+    message_writer.put(DF097);
+    message_writer.put(DF098);
+    message_writer.put(DF099);
+    message_writer.put(DF100);
+    message_writer.put(DF101);
+    message_writer.put(DF102);
+    message_writer.put(DF103);
+    message_writer.put(DF137);
+
+    if (message_writer.size() != 488)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1019 (488 bits expected, found " << message_writer.size() << ")";
+        }
+
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -1772,52 +1697,51 @@ std::string Rtcm::print_MT1020(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, c
     Rtcm::set_DF135(glonass_gnav_utc_model);
     Rtcm::set_DF136(glonass_gnav_eph);
 
-    std::string data;
-    data.clear();
-    data = DF002.to_string() +
-           DF038.to_string() +
-           DF040.to_string() +
-           DF104.to_string() +
-           DF105.to_string() +
-           DF106.to_string() +
-           DF107.to_string() +
-           DF108.to_string() +
-           DF109.to_string() +
-           DF110.to_string() +
-           DF111.to_string() +
-           DF112.to_string() +
-           DF113.to_string() +
-           DF114.to_string() +
-           DF115.to_string() +
-           DF116.to_string() +
-           DF117.to_string() +
-           DF118.to_string() +
-           DF119.to_string() +
-           DF120.to_string() +
-           DF121.to_string() +
-           DF122.to_string() +
-           DF123.to_string() +
-           DF124.to_string() +
-           DF125.to_string() +
-           DF126.to_string() +
-           DF127.to_string() +
-           DF128.to_string() +
-           DF129.to_string() +
-           DF130.to_string() +
-           DF131.to_string() +
-           DF132.to_string() +
-           DF133.to_string() +
-           DF134.to_string() +
-           DF135.to_string() +
-           DF136.to_string() +
-           std::bitset<7>().to_string();  // Reserved bits
-
-    if (data.length() != 360)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1020 (360 bits expected, found " << data.length() << ")";
-        }
-
-    std::string msg = build_message(data);
+    message_writer.clear();
+    message_writer.put(DF002);
+    message_writer.put(DF038);
+    message_writer.put(DF040);
+    message_writer.put(DF104);
+    message_writer.put(DF105);
+    message_writer.put(DF106);
+    message_writer.put(DF107);
+    message_writer.put(DF108);
+    message_writer.put(DF109);
+    message_writer.put(DF110);
+    message_writer.put(DF111);
+    message_writer.put(DF112);
+    message_writer.put(DF113);
+    message_writer.put(DF114);
+    message_writer.put(DF115);
+    message_writer.put(DF116);
+    message_writer.put(DF117);
+    message_writer.put(DF118);
+    message_writer.put(DF119);
+    message_writer.put(DF120);
+    message_writer.put(DF121);
+    message_writer.put(DF122);
+    message_writer.put(DF123);
+    message_writer.put(DF124);
+    message_writer.put(DF125);
+    message_writer.put(DF126);
+    message_writer.put(DF127);
+    message_writer.put(DF128);
+    message_writer.put(DF129);
+    message_writer.put(DF130);
+    message_writer.put(DF131);
+    message_writer.put(DF132);
+    message_writer.put(DF133);
+    message_writer.put(DF134);
+    message_writer.put(DF135);
+    message_writer.put(DF136);
+    message_writer.put(0, 7);  // Reserved bits
+
+    if (message_writer.size() != 360)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1020 (360 bits expected, found " << message_writer.size() << ")";
+        }
+
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -2004,7 +1928,6 @@ std::string Rtcm::print_MT1029(uint32_t ref_id, const Gps_Ephemeris& gps_eph, do
 
     uint32_t i = 0;
     bool first = true;
-    std::string text_binary;
     for (char c : message)
         {
             if (isgraph(c))
@@ -2029,22 +1952,24 @@ std::string Rtcm::print_MT1029(uint32_t ref_id, const Gps_Ephemeris& gps_eph, do
                             first = false;
                         }
                 }
-            auto character = std::bitset<8>(c);
-            text_binary += character.to_string();
         }
 
     auto DF138_ = std::bitset<7>(i);
     auto DF139_ = std::bitset<8>(message.length());
 
-    std::string data = DF002.to_string() +
-                       DF003.to_string() +
-                       DF051.to_string() +
-                       DF052.to_string() +
-                       DF138_.to_string() +
-                       DF139_.to_string() +
-                       text_binary;
+    message_writer.clear();
+    message_writer.put(DF002);
+    message_writer.put(DF003);
+    message_writer.put(DF051);
+    message_writer.put(DF052);
+    message_writer.put(DF138_);
+    message_writer.put(DF139_);
+    for (char c : message)
+        {
+            message_writer.put(static_cast<uint8_t>(c), 8);
+        }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -2093,44 +2018,43 @@ std::string Rtcm::print_MT1045(const Galileo_Ephemeris& gal_eph)
     uint32_t seven_zero = 0;
     auto DF001_ = std::bitset<7>(seven_zero);
 
-    std::string data;
-    data.clear();
-    data = DF002.to_string() +
-           DF252.to_string() +
-           DF289.to_string() +
-           DF290.to_string() +
-           DF291.to_string() +
-           DF292.to_string() +
-           DF293.to_string() +
-           DF294.to_string() +
-           DF295.to_string() +
-           DF296.to_string() +
-           DF297.to_string() +
-           DF298.to_string() +
-           DF299.to_string() +
-           DF300.to_string() +
-           DF301.to_string() +
-           DF302.to_string() +
-           DF303.to_string() +
-           DF304.to_string() +
-           DF305.to_string() +
-           DF306.to_string() +
-           DF307.to_string() +
-           DF308.to_string() +
-           DF309.to_string() +
-           DF310.to_string() +
-           DF311.to_string() +
-           DF312.to_string() +
-           DF314.to_string() +
-           DF315.to_string() +
-           DF001_.to_string();
-
-    if (data.length() != 496)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1045 (496 bits expected, found " << data.length() << ")";
-        }
-
-    std::string msg = build_message(data);
+    message_writer.clear();
+    message_writer.put(DF002);
+    message_writer.put(DF252);
+    message_writer.put(DF289);
+    message_writer.put(DF290);
+    message_writer.put(DF291);
+    message_writer.put(DF292);
+    message_writer.put(DF293);
+    message_writer.put(DF294);
+    message_writer.put(DF295);
+    message_writer.put(DF296);
+    message_writer.put(DF297);
+    message_writer.put(DF298);
+    message_writer.put(DF299);
+    message_writer.put(DF300);
+    message_writer.put(DF301);
+    message_writer.put(DF302);
+    message_writer.put(DF303);
+    message_writer.put(DF304);
+    message_writer.put(DF305);
+    message_writer.put(DF306);
+    message_writer.put(DF307);
+    message_writer.put(DF308);
+    message_writer.put(DF309);
+    message_writer.put(DF310);
+    message_writer.put(DF311);
+    message_writer.put(DF312);
+    message_writer.put(DF314);
+    message_writer.put(DF315);
+    message_writer.put(DF001_);
+
+    if (message_writer.size() != 496)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1045 (496 bits expected, found " << message_writer.size() << ")";
+        }
+
+    std::string msg = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(msg);
@@ -2304,7 +2228,8 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
             msg_number = 1071;
         }
 
-    std::string header = Rtcm::get_MSM_header(msg_number,
+    message_writer.clear();
+    Rtcm::put_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2314,11 +2239,11 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::put_MSM_1_content_sat_data(observables);
 
-    std::string signal_data = Rtcm::get_MSM_1_content_signal_data(observables);
+    Rtcm::put_MSM_1_content_signal_data(observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message();
 
     if (server_is_running)
         {
@@ -2329,7 +2254,7 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_header(uint32_t msg_number,
+void Rtcm::put_MSM_header(uint32_t msg_number,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables,
     uint32_t ref_id,
@@ -2356,41 +2281,38 @@ std::string Rtcm::get_MSM_header(uint32_t msg_number,
     Rtcm::set_DF394(observables);
     Rtcm::set_DF395(observables);
 
-    std::string header = DF002.to_string() + DF003.to_string();
+    message_writer.put(DF002);
+    message_writer.put(DF003);
     // GNSS Epoch Time Specific to each constellation
     if ((sys == "R"))
         {
             // GLONASS Epoch Time
             Rtcm::set_DF034(obs_time);
-            header += DF034.to_string();
+            message_writer.put(DF034);
         }
     else
         {
             // GPS, Galileo Epoch Time
             Rtcm::set_DF004(obs_time);
-            header += DF004.to_string();
+            message_writer.put(DF004);
         }
 
-    header = header + DF393.to_string() +
-             DF409.to_string() +
-             DF001_.to_string() +
-             DF411.to_string() +
-             DF417.to_string() +
-             DF412.to_string() +
-             DF418.to_string() +
-             DF394.to_string() +
-             DF395.to_string() +
-             Rtcm::set_DF396(observables);
-
-    return header;
+    message_writer.put(DF393);
+    message_writer.put(DF409);
+    message_writer.put(DF001_);
+    message_writer.put(DF411);
+    message_writer.put(DF417);
+    message_writer.put(DF412);
+    message_writer.put(DF418);
+    message_writer.put(DF394);
+    message_writer.put(DF395);
+    Rtcm::set_DF396(observables);
+    message_writer.put(DF396.to_ullong(), DF396_length);
 }
 
 
-std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::put_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-    sat_data.clear();
-
     Rtcm::set_DF394(observables);
     uint32_t num_satellites = DF394.count();
 
@@ -2416,17 +2338,13 @@ std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchr
     for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
         {
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            sat_data += DF398.to_string();
+            message_writer.put(DF398);
         }
-
-    return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::put_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    signal_data.clear();
     uint32_t Ncells = observables.size();
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > observables_vector;
@@ -2446,10 +2364,8 @@ std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Syn
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
-            signal_data += DF400.to_string();
+            message_writer.put(DF400);
         }
-
-    return signal_data;
 }
 
 
@@ -2499,7 +2415,8 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
             msg_number = 1072;
         }
 
-    std::string header = Rtcm::get_MSM_header(msg_number,
+    message_writer.clear();
+    Rtcm::put_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2509,11 +2426,11 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::put_MSM_1_content_sat_data(observables);
 
-    std::string signal_data = Rtcm::get_MSM_2_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::put_MSM_2_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2523,18 +2440,13 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::put_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-
     uint32_t Ncells = observables.size();
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > observables_vector;
@@ -2551,18 +2463,22 @@ std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     std::vector<std::pair<int32_t, Gnss_Synchro> > ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field for all the cells, and then the next one
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF401);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF402);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF401.to_string();
-            second_data_type += DF402.to_string();
-            third_data_type += DF420.to_string();
+            message_writer.put(DF420);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type;
-    return signal_data;
 }
 
 
@@ -2612,7 +2528,8 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
             msg_number = 1073;
         }
 
-    std::string header = Rtcm::get_MSM_header(msg_number,
+    message_writer.clear();
+    Rtcm::put_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2622,11 +2539,11 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::put_MSM_1_content_sat_data(observables);
 
-    std::string signal_data = Rtcm::get_MSM_3_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::put_MSM_3_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2636,19 +2553,13 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::put_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-
     uint32_t Ncells = observables.size();
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > observables_vector;
@@ -2665,20 +2576,27 @@ std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     std::vector<std::pair<int32_t, Gnss_Synchro> > ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field for all the cells, and then the next one
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF400);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF401);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF402);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
+            message_writer.put(DF420);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
-    return signal_data;
 }
 
 
@@ -2728,7 +2646,8 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
             msg_number = 1074;
         }
 
-    std::string header = Rtcm::get_MSM_header(msg_number,
+    message_writer.clear();
+    Rtcm::put_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2738,11 +2657,11 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    Rtcm::put_MSM_4_content_sat_data(observables);
 
-    std::string signal_data = Rtcm::get_MSM_4_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::put_MSM_4_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2752,12 +2671,8 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::put_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
-
     Rtcm::set_DF394(observables);
     uint32_t num_satellites = DF394.count();
 
@@ -2780,32 +2695,27 @@ std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchr
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(observables_vector);
 
+    // each data field for all the satellites, and then the next one
     for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
         {
             Rtcm::set_DF397(ordered_by_PRN_pos.at(nsat).second);
+            message_writer.put(DF397);
+        }
+    for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
+        {
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            first_data_type += DF397.to_string();
-            second_data_type += DF398.to_string();
+            message_writer.put(DF398);
         }
-    sat_data = first_data_type + second_data_type;
-    return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::put_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-
     uint32_t Ncells = observables.size();
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > observables_vector;
@@ -2822,22 +2732,32 @@ std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     std::vector<std::pair<int32_t, Gnss_Synchro> > ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field for all the cells, and then the next one
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF400);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF401);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF402);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF420);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
+            message_writer.put(DF403);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
-    return signal_data;
 }
 
 
@@ -2887,7 +2807,8 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
             msg_number = 1075;
         }
 
-    std::string header = Rtcm::get_MSM_header(msg_number,
+    message_writer.clear();
+    Rtcm::put_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2897,11 +2818,11 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    Rtcm::put_MSM_5_content_sat_data(observables);
 
-    std::string signal_data = Rtcm::get_MSM_5_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::put_MSM_5_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2911,14 +2832,8 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::put_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-
     Rtcm::set_DF394(observables);
     uint32_t num_satellites = DF394.count();
 
@@ -2941,37 +2856,36 @@ std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchr
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(observables_vector);
 
+    // each data field for all the satellites, and then the next one
     for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
         {
             Rtcm::set_DF397(ordered_by_PRN_pos.at(nsat).second);
+            message_writer.put(DF397);
+        }
+    for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
+        {
+            message_writer.put(0, 4);  // reserved
+        }
+    for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
+        {
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
+            message_writer.put(DF398);
+        }
+    for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
+        {
             Rtcm::set_DF399(ordered_by_PRN_pos.at(nsat).second);
-            auto reserved = std::bitset<4>("0000");
-            first_data_type += DF397.to_string();
-            second_data_type += reserved.to_string();
-            third_data_type += DF398.to_string();
-            fourth_data_type += DF399.to_string();
+            message_writer.put(DF399);
         }
-    sat_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
-    return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::put_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
-
     uint32_t Ncells = observables.size();
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > observables_vector;
@@ -2988,24 +2902,37 @@ std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     std::vector<std::pair<int32_t, Gnss_Synchro> > ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field for all the cells, and then the next one
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF400);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF401);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF402);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF420);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF403);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
-            sixth_data_type += DF404.to_string();
+            message_writer.put(DF404);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
-    return signal_data;
 }
 
 
@@ -3055,7 +2982,8 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    std::string header = Rtcm::get_MSM_header(msg_number,
+    message_writer.clear();
+    Rtcm::put_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3065,11 +2993,11 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    Rtcm::put_MSM_4_content_sat_data(observables);
 
-    std::string signal_data = Rtcm::get_MSM_6_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::put_MSM_6_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -3079,20 +3007,13 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::put_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-
     uint32_t Ncells = observables.size();
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > observables_vector;
@@ -3109,22 +3030,32 @@ std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     std::vector<std::pair<int32_t, Gnss_Synchro> > ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field for all the cells, and then the next one
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF405(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF405);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF406(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF406);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF407(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF407);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF420);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
+            message_writer.put(DF408);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
-    return signal_data;
 }
 
 
@@ -3174,7 +3105,8 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    std::string header = Rtcm::get_MSM_header(msg_number,
+    message_writer.clear();
+    Rtcm::put_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3184,11 +3116,11 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    Rtcm::put_MSM_5_content_sat_data(observables);
 
-    std::string signal_data = Rtcm::get_MSM_7_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::put_MSM_7_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -3198,21 +3130,13 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::put_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
-
     uint32_t Ncells = observables.size();
 
     std::vector<std::pair<int32_t, Gnss_Synchro> > observables_vector;
@@ -3229,24 +3153,37 @@ std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     std::vector<std::pair<int32_t, Gnss_Synchro> > ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field for all the cells, and then the next one
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF405(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF405);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF406(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF406);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF407(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF407);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF420);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
+            message_writer.put(DF408);
+        }
+    for (uint32_t cell = 0; cell < Ncells; cell++)
+        {
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
-            sixth_data_type += DF404.to_string();
+            message_writer.put(DF404);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
-    return signal_data;
 }
 
 
@@ -5144,19 +5081,24 @@ int32_t Rtcm::set_DF395(const std::map<int32_t, Gnss_Synchro>& gnss_synchro)
 }
 
 
-std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
+int32_t Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string DF396;
     std::map<int32_t, Gnss_Synchro>::const_iterator observables_iter;
     Rtcm::set_DF394(observables);
     Rtcm::set_DF395(observables);
     uint32_t num_signals = DF395.count();
     uint32_t num_satellites = DF394.count();
 
+    DF396.reset();
+    DF396_length = 0;
     if ((num_signals == 0) || (num_satellites == 0))
         {
-            std::string s("");
-            return s;
+            return 0;
+        }
+    if (num_signals * num_satellites > 64)
+        {
+            LOG(WARNING) << "RTCM MSM cell mask longer than 64 bits (" << num_satellites << " satellites, " << num_signals << " signals)";
+            return 1;
         }
     std::vector<std::vector<bool> > matrix(num_signals, std::vector<bool>());
 
@@ -5260,25 +5202,17 @@ std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
                 }
         }
 
-    // write the matrix column-wise
-    DF396.clear();
+    // write the matrix column-wise, the first cell in the most significant bit
     for (uint32_t col = 0; col < num_satellites; col++)
         {
             for (uint32_t row = 0; row < num_signals; row++)
                 {
-                    std::string ss;
-                    if (matrix[row].at(col))
-                        {
-                            ss = "1";
-                        }
-                    else
-                        {
-                            ss = "0";
-                        }
-                    DF396 += ss;
+                    DF396 <<= 1;
+                    DF396[0] = matrix[row].at(col);
                 }
         }
-    return DF396;
+    DF396_length = num_signals * num_satellites;
+    return 0;
 }
 
 
@@ -29,6 +29,7 @@
 #include "gnss_synchro.h"
 #include "gps_cnav_ephemeris.h"
 #include "gps_ephemeris.h"
+#include "rtcm_bit_writer.h"
 #include <boost/asio.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <glog/logging.h>
@@ -371,9 +372,9 @@ public:
 
 private:
     //
-    // Generation of messages content
+    // Generation of messages content, appended to message_writer
     //
-    std::bitset<64> get_MT1001_4_header(uint32_t msg_number,
+    void put_MT1001_4_header(uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
@@ -381,15 +382,15 @@ private:
         bool sync_flag,
         bool divergence_free);
 
-    std::bitset<58> get_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
-    std::bitset<74> get_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
-    std::bitset<101> get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
-    std::bitset<125> get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void put_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void put_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void put_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void put_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
 
-    std::bitset<152> get_MT1005_test();
+    void put_MT1005_test();
 
     /*!
-     * \brief Generates contents of message header for types 1009, 1010, 1011 and 1012. GLONASS RTK Message
+     * \brief Appends the message header for types 1009, 1010, 1011 and 1012 to the message being built. GLONASS RTK Message
      * \note Code added as part of GSoC 2017 program
      * \param msg_number Message type number, acceptable options include 1009 to 1012
      * \param obs_time Time of observation at the moment of printing
@@ -397,9 +398,8 @@ private:
      * \param ref_id
      * \param smooth_int
      * \param divergence_free
-     * \return Returns the message header content as set of bits
      */
-    std::bitset<61> get_MT1009_12_header(uint32_t msg_number,
+    void put_MT1009_12_header(uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
@@ -408,27 +408,25 @@ private:
         bool divergence_free);
 
     /*!
-     * \brief Get the contents of the satellite specific portion of a type 1009 Message (GLONASS Basic RTK, L1 Only)
+     * \brief Appends the satellite specific portion of a type 1009 Message (GLONASS Basic RTK, L1 Only)
      * \details Contents generated for each satellite. See table 3.5-11
      * \note Code added as part of GSoC 2017 program
      * \param ephGNAV Ephemeris for GLONASS GNAV in L1 satellites
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchro Information generated by channels while processing the satellite
-     * \return Returns the message content as set of bits
      */
-    std::bitset<64> get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void put_MT1009_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
     /*!
-     * \brief Get the contents of the satellite specific portion of a type 1010 Message (GLONASS Extended RTK, L1 Only)
+     * \brief Appends the satellite specific portion of a type 1010 Message (GLONASS Extended RTK, L1 Only)
      * \details Contents generated for each satellite. See table 3.5-12
      * \note Code added as part of GSoC 2017 program
      * \param ephGNAV Ephemeris for GLONASS GNAV in L1 satellites
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchro Information generated by channels while processing the satellite
-     * \return Returns the message content as set of bits
      */
-    std::bitset<79> get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void put_MT1010_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
     /*!
-     * \brief Get the contents of the satellite specific portion of a type 1011 Message (GLONASS Basic RTK, L1 & L2)
+     * \brief Appends the satellite specific portion of a type 1011 Message (GLONASS Basic RTK, L1 & L2)
      * \details Contents generated for each satellite. See table 3.5-13
      * \note Code added as part of GSoC 2017 program
      * \param ephGNAVL1 Ephemeris for GLONASS GNAV in L1 satellites
@@ -436,11 +434,10 @@ private:
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchroL1 Information generated by channels while processing the GLONASS GNAV L1 satellite
      * \param gnss_synchroL2 Information generated by channels while processing the GLONASS GNAV L2 satellite
-     * \return Returns the message content as set of bits
      */
-    std::bitset<107> get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void put_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
     /*!
-     * \brief Get the contents of the satellite specific portion of a type 1012 Message (GLONASS Extended RTK, L1 & L2)
+     * \brief Appends the satellite specific portion of a type 1012 Message (GLONASS Extended RTK, L1 & L2)
      * \details Contents generated for each satellite. See table 3.5-14
      * \note Code added as part of GSoC 2017 program
      * \param ephGNAVL1 Ephemeris for GLONASS GNAV in L1 satellites
@@ -448,11 +445,10 @@ private:
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchroL1 Information generated by channels while processing the GLONASS GNAV L1 satellite
      * \param gnss_synchroL2 Information generated by channels while processing the GLONASS GNAV L2 satellite
-     * \return Returns the message content as set of bits
      */
-    std::bitset<130> get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void put_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
 
-    std::string get_MSM_header(uint32_t msg_number,
+    void put_MSM_header(uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
@@ -462,17 +458,17 @@ private:
         bool divergence_free,
         bool more_messages);
 
-    std::string get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
 
-    std::string get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void put_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
 
     //
     // Utilities
@@ -588,11 +584,14 @@ private:
     };
 
 
+    // Body of a message, stored once and shared by the write queues of all the sessions
+    using Rtcm_Frame = std::shared_ptr<const std::string>;
+
     class RtcmListener
     {
     public:
         virtual ~RtcmListener() = default;
-        virtual void deliver(const Rtcm_Message& msg) = 0;
+        virtual void deliver(const Rtcm_Frame& frame) = 0;
     };
 
 
@@ -602,9 +601,9 @@ private:
         inline void join(const std::shared_ptr<RtcmListener>& participant)
         {
             participants_.insert(participant);
-            for (auto msg : recent_msgs_)
+            for (const auto& frame : recent_msgs_)
                 {
-                    participant->deliver(msg);
+                    participant->deliver(frame);
                 }
         }
 
@@ -615,7 +614,9 @@ private:
 
         inline void deliver(const Rtcm_Message& msg)
         {
-            recent_msgs_.push_back(msg);
+            // one copy of the message, whatever the number of participants
+            const auto frame = std::make_shared<const std::string>(msg.body(), msg.body_length());
+            recent_msgs_.push_back(frame);
             while (recent_msgs_.size() > max_recent_msgs)
                 {
                     recent_msgs_.pop_front();
@@ -623,7 +624,7 @@ private:
 
             for (const auto& participant : participants_)
                 {
-                    participant->deliver(msg);
+                    participant->deliver(frame);
                 }
         }
 
@@ -633,7 +634,7 @@ private:
         {
             max_recent_msgs = 1
         };
-        std::deque<Rtcm_Message> recent_msgs_;
+        std::deque<Rtcm_Frame> recent_msgs_;
     };
 
 
@@ -642,17 +643,35 @@ private:
           public std::enable_shared_from_this<Rtcm_Session>
     {
     public:
-        Rtcm_Session(boost::asio::ip::tcp::socket socket, Rtcm_Listener_Room& room) : socket_(std::move(socket)), room_(room) {}
+        Rtcm_Session(boost::asio::ip::tcp::socket socket, Rtcm_Listener_Room& room) : socket_(std::move(socket)), room_(room)
+        {
+            write_buffers_.reserve(max_gathered_msgs);
+        }
+
         inline void start()
         {
             room_.join(shared_from_this());
             do_read_message_header();
         }
 
-        inline void deliver(const Rtcm_Message& msg)
+        inline void deliver(const Rtcm_Frame& frame)
         {
+            if (!socket_.is_open())
+                {
+                    return;  // evicted, waiting for the pending operations to be aborted
+                }
+            if (write_msgs_.size() >= max_queued_msgs)
+                {
+                    // The client does not keep up with the stream. Closing the socket
+                    // aborts the pending read and write, whose handlers leave the room.
+                    std::cout << "RTCM client too slow, closing connection" << std::endl;
+                    LOG(WARNING) << "RTCM client too slow, " << write_msgs_.size() << " messages not sent. Closing connection";
+                    boost::system::error_code ec;
+                    socket_.close(ec);
+                    return;
+                }
             bool write_in_progress = !write_msgs_.empty();
-            write_msgs_.push_back(msg);
+            write_msgs_.push_back(frame);
             if (!write_in_progress)
                 {
                     do_write();
@@ -719,12 +738,22 @@ private:
         inline void do_write()
         {
             auto self(shared_from_this());
-            boost::asio::async_write(socket_,
-                boost::asio::buffer(write_msgs_.front().body(), write_msgs_.front().body_length()),
-                [this, self](boost::system::error_code ec, std::size_t /*length*/) {
+            // the messages queued while the previous write was in progress go out in a single gathered write
+            write_buffers_.clear();
+            for (const auto& frame : write_msgs_)
+                {
+                    if (write_buffers_.size() == max_gathered_msgs)
+                        {
+                            break;
+                        }
+                    write_buffers_.emplace_back(frame->data(), frame->size());
+                }
+            const std::size_t msgs_in_flight = write_buffers_.size();
+            boost::asio::async_write(socket_, write_buffers_,
+                [this, self, msgs_in_flight](boost::system::error_code ec, std::size_t /*length*/) {
                     if (!ec)
                         {
-                            write_msgs_.pop_front();
+                            write_msgs_.erase(write_msgs_.begin(), write_msgs_.begin() + msgs_in_flight);
                             if (!write_msgs_.empty())
                                 {
                                     do_write();
@@ -738,10 +767,16 @@ private:
                 });
         }
 
+        enum
+        {
+            max_queued_msgs = 256,  // messages waiting for a slow client before it is evicted
+            max_gathered_msgs = 64  // messages sent by each write
+        };
         boost::asio::ip::tcp::socket socket_;
         Rtcm_Listener_Room& room_;
         Rtcm_Message read_msg_;
-        std::deque<Rtcm_Message> write_msgs_;
+        std::deque<Rtcm_Frame> write_msgs_;
+        std::vector<boost::asio::const_buffer> write_buffers_;
         std::string client_says;
     };
 
@@ -956,8 +991,8 @@ private:
     //
     std::bitset<8> preamble;
     std::bitset<6> reserved_field;
-    std::string add_CRC(const std::string& m) const;
-    std::string build_message(const std::string& data) const;  // adds 0s to complete a byte and adds the CRC
+    Rtcm_Bit_Writer message_writer;  // data message being built by the print_* functions
+    std::string build_message();      // adds 0s to complete a byte and adds the CRC
 
     //
     // Data Fields
@@ -1410,7 +1445,9 @@ private:
     std::bitset<32> DF395;
     int32_t set_DF395(const std::map<int32_t, Gnss_Synchro>& gnss_synchro);
 
-    std::string set_DF396(const std::map<int32_t, Gnss_Synchro>& observables);
+    std::bitset<64> DF396;
+    uint32_t DF396_length{};  // number of cells of the mask, in the least significant bits of DF396
+    int32_t set_DF396(const std::map<int32_t, Gnss_Synchro>& observables);
 
     std::bitset<8> DF397;
     int32_t set_DF397(const Gnss_Synchro& gnss_synchro);
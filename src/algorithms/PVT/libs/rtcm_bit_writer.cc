@@ -0,0 +1,58 @@
+/*!
+ * \file rtcm_bit_writer.cc
+ * \brief Writer of the bit fields of an RTCM 3 message into a preallocated
+ * transport layer frame
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "rtcm_bit_writer.h"
+#include "gnss_crc.h"
+#include <glog/logging.h>
+#include <algorithm>
+
+
+void Rtcm_Bit_Writer::clear()
+{
+    // put() only sets bits, so the bytes written by the previous message,
+    // including its CRC, are zeroed
+    const uint32_t used_bytes = (d_bits + 7) / 8 + CRC_LENGTH_BYTES;
+    std::fill_n(d_buffer.begin() + HEADER_LENGTH_BYTES, used_bytes, 0);
+    d_bits = 0;
+    d_overflow = false;
+}
+
+
+std::string Rtcm_Bit_Writer::frame()
+{
+    if (d_overflow)
+        {
+            LOG(WARNING) << "RTCM message longer than " << MAX_MESSAGE_LENGTH_BYTES << " bytes, not sent";
+            return std::string();
+        }
+    // the padding bits are already zero
+    const uint32_t length_bytes = (d_bits + 7) / 8;
+    d_buffer[0] = 0xD3;  // preamble, followed by six reserved bits set to 0
+    d_buffer[1] = static_cast<uint8_t>((length_bytes >> 8U) & 0x03U);
+    d_buffer[2] = static_cast<uint8_t>(length_bytes & 0xFFU);
+
+    // Qualcomm CRC-24Q of the header and the data message
+    const uint32_t crc = compute_crc24q(d_buffer.data(), HEADER_LENGTH_BYTES + length_bytes);
+    uint8_t* crc_bytes = d_buffer.data() + HEADER_LENGTH_BYTES + length_bytes;
+    crc_bytes[0] = static_cast<uint8_t>((crc >> 16U) & 0xFFU);
+    crc_bytes[1] = static_cast<uint8_t>((crc >> 8U) & 0xFFU);
+    crc_bytes[2] = static_cast<uint8_t>(crc & 0xFFU);
+
+    return std::string(reinterpret_cast<const char*>(d_buffer.data()), HEADER_LENGTH_BYTES + length_bytes + CRC_LENGTH_BYTES);
+}
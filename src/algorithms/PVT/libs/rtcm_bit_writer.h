@@ -0,0 +1,100 @@
+/*!
+ * \file rtcm_bit_writer.h
+ * \brief Writer of the bit fields of an RTCM 3 message into a preallocated
+ * transport layer frame
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTCM_BIT_WRITER_H
+#define GNSS_SDR_RTCM_BIT_WRITER_H
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*!
+ * \brief Appends the data fields of an RTCM 3 message, most significant bit
+ * first, to a byte buffer sized for the largest frame of the transport layer.
+ *
+ * The data message starts after the room left for the preamble, the
+ * reserved bits and the message length, so that frame() only has to fill
+ * in those 24 bits and append the CRC-24Q, without copying the data. The
+ * buffer is allocated once with the writer: appending a field is a few
+ * shifts and masks, instead of the concatenation of bit strings that the
+ * messages used to be built with.
+ */
+class Rtcm_Bit_Writer
+{
+public:
+    static const uint32_t MAX_MESSAGE_LENGTH_BYTES = 1023;  //!< Largest data message allowed by the 10 bits of the message length
+
+    Rtcm_Bit_Writer() = default;
+
+    //! Empties the data message, so that the writer can be reused for another message
+    void clear();
+
+    //! Appends the nbits (up to 64) least significant bits of value
+    inline void put(uint64_t value, uint32_t nbits)
+    {
+        if (d_bits + nbits > 8 * MAX_MESSAGE_LENGTH_BYTES)
+            {
+                d_overflow = true;
+                return;
+            }
+        uint32_t pos = 8 * HEADER_LENGTH_BYTES + d_bits;
+        d_bits += nbits;
+        while (nbits > 0)
+            {
+                const uint32_t free_bits = 8 - (pos & 7U);
+                const uint32_t n = nbits < free_bits ? nbits : free_bits;
+                const auto chunk = static_cast<uint32_t>(value >> (nbits - n)) & ((1U << n) - 1U);
+                d_buffer[pos >> 3U] |= static_cast<uint8_t>(chunk << (free_bits - n));
+                pos += n;
+                nbits -= n;
+            }
+    }
+
+    //! Appends a data field
+    template <std::size_t N>
+    inline void put(const std::bitset<N>& field)
+    {
+        static_assert(N <= 64, "RTCM data fields are at most 64 bits long");
+        put(field.to_ullong(), N);
+    }
+
+    inline uint32_t size() const { return d_bits; }  //!< Length of the data message, in bits
+
+    inline bool overflow() const { return d_overflow; }  //!< True if the data message did not fit in a frame
+
+    /*!
+     * \brief Returns the transport layer frame of the data message: the
+     * preamble, the reserved bits, the message length, the data message
+     * padded with zeros to a whole number of bytes, and the CRC-24Q.
+     * Returns an empty string if the data message did not fit in a frame.
+     */
+    std::string frame();
+
+private:
+    static const uint32_t HEADER_LENGTH_BYTES = 3;  // preamble, reserved bits and message length
+    static const uint32_t CRC_LENGTH_BYTES = 3;
+
+    std::array<uint8_t, HEADER_LENGTH_BYTES + MAX_MESSAGE_LENGTH_BYTES + CRC_LENGTH_BYTES> d_buffer{};
+    uint32_t d_bits{};
+    bool d_overflow{};
+};
+
+#endif  // GNSS_SDR_RTCM_BIT_WRITER_H
@@ -403,14 +403,46 @@ Monitor_Pvt Rtklib_Solver::get_monitor_pvt() const
 }
 
 
+template <typename Ephemeris, size_t N>
+static void index_by_prn(const std::map<int, Ephemeris> &ephemeris_map, std::array<const Ephemeris *, N> &table)
+{
+    table.fill(nullptr);
+    for (const auto &ephemeris : ephemeris_map)
+        {
+            if (ephemeris.first >= 0 and static_cast<size_t>(ephemeris.first) < N)
+                {
+                    table[ephemeris.first] = &ephemeris.second;
+                }
+        }
+}
+
+
+void Rtklib_Solver::index_ephemeris()
+{
+    index_by_prn(gps_ephemeris_map, d_gps_ephemeris);
+    index_by_prn(gps_cnav_ephemeris_map, d_gps_cnav_ephemeris);
+    index_by_prn(galileo_ephemeris_map, d_galileo_ephemeris);
+    index_by_prn(glonass_gnav_ephemeris_map, d_glonass_gnav_ephemeris);
+    index_by_prn(beidou_dnav_ephemeris_map, d_beidou_dnav_ephemeris);
+}
+
+
 bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_map, bool flag_averaging)
 {
-    std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-    std::map<int, Galileo_Ephemeris>::const_iterator galileo_ephemeris_iter;
-    std::map<int, Gps_Ephemeris>::const_iterator gps_ephemeris_iter;
-    std::map<int, Gps_CNAV_Ephemeris>::const_iterator gps_cnav_ephemeris_iter;
-    std::map<int, Glonass_Gnav_Ephemeris>::const_iterator glonass_gnav_ephemeris_iter;
-    std::map<int, Beidou_Dnav_Ephemeris>::const_iterator beidou_ephemeris_iter;
+    d_observables_from_map.from_map(gnss_observables_map);
+    return get_PVT(d_observables_from_map, flag_averaging);
+}
+
+
+bool Rtklib_Solver::get_PVT(const Gnss_Observables_Epoch &gnss_observables, bool flag_averaging)
+{
+    const Galileo_Ephemeris *galileo_ephemeris = nullptr;
+    const Gps_Ephemeris *gps_ephemeris = nullptr;
+    const Gps_CNAV_Ephemeris *gps_cnav_ephemeris = nullptr;
+    const Glonass_Gnav_Ephemeris *glonass_gnav_ephemeris = nullptr;
+    const Beidou_Dnav_Ephemeris *beidou_ephemeris = nullptr;
+
+    index_ephemeris();
 
     const Glonass_Gnav_Utc_Model gnav_utc = this->glonass_gnav_utc_model;
 
@@ -423,22 +455,19 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
     int glo_valid_obs = 0;  // GLONASS L1/L2 valid observations counter
 
     obs_data.fill({});
-    std::vector<eph_t> eph_data(MAXOBS);
-    std::vector<geph_t> geph_data(MAXOBS);
+    // eph_data and geph_data are only read up to the number of valid observations, all written below
 
     // Workaround for NAV/CNAV clash problem
     bool gps_dual_band = false;
     bool band1 = false;
     bool band2 = false;
-    for (gnss_observables_iter = gnss_observables_map.cbegin();
-         gnss_observables_iter != gnss_observables_map.cend();
-         ++gnss_observables_iter)
+    for (const Gnss_Synchro &observable : gnss_observables)
         {
-            switch (gnss_observables_iter->second.System)
+            switch (observable.System)
                 {
                 case 'G':
                     {
-                        std::string sig_(gnss_observables_iter->second.Signal);
+                        std::string sig_(observable.Signal);
                         if (sig_ == "1C")
                             {
                                 band1 = true;
@@ -459,35 +488,33 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
             gps_dual_band = true;
         }
 
-    for (gnss_observables_iter = gnss_observables_map.cbegin();
-         gnss_observables_iter != gnss_observables_map.cend();
-         ++gnss_observables_iter)  // CHECK INCONSISTENCY when combining GLONASS + other system
+    for (const Gnss_Synchro &observable : gnss_observables)  // CHECK INCONSISTENCY when combining GLONASS + other system
         {
-            switch (gnss_observables_iter->second.System)
+            switch (observable.System)
                 {
                 case 'E':
                     {
-                        std::string sig_(gnss_observables_iter->second.Signal);
+                        std::string sig_(observable.Signal);
                         // Galileo E1
                         if (sig_ == "1B")
                             {
                                 // 1 Gal - find the ephemeris for the current GALILEO SV observation. The SV PRN ID is the map key
-                                galileo_ephemeris_iter = galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (galileo_ephemeris_iter != galileo_ephemeris_map.cend())
+                                galileo_ephemeris = find_galileo_ephemeris(observable.PRN);
+                                if (galileo_ephemeris != nullptr)
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second);
+                                        eph_data[valid_obs] = eph_to_rtklib(*galileo_ephemeris);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs = {{0, 0}, '0', '0', {}, {}, {}, {}, {}, {}};
                                         obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
-                                            gnss_observables_iter->second,
-                                            galileo_ephemeris_iter->second.WN_5,
+                                            observable,
+                                            galileo_ephemeris->WN_5,
                                             0);
                                         valid_obs++;
                                     }
                                 else  // the ephemeris are not available for this SV
                                     {
-                                        DLOG(INFO) << "No ephemeris data for SV " << gnss_observables_iter->second.PRN;
+                                        DLOG(INFO) << "No ephemeris data for SV " << observable.PRN;
                                     }
                             }
 
@@ -495,17 +522,17 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                         if (sig_ == "5X")
                             {
                                 // 1 Gal - find the ephemeris for the current GALILEO SV observation. The SV PRN ID is the map key
-                                galileo_ephemeris_iter = galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (galileo_ephemeris_iter != galileo_ephemeris_map.cend())
+                                galileo_ephemeris = find_galileo_ephemeris(observable.PRN);
+                                if (galileo_ephemeris != nullptr)
                                     {
                                         bool found_E1_obs = false;
                                         for (int i = 0; i < valid_obs; i++)
                                             {
-                                                if (eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO)))
+                                                if (eph_data[i].sat == (static_cast<int>(observable.PRN + NSATGPS + NSATGLO)))
                                                     {
                                                         obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(obs_data[i + glo_valid_obs],
-                                                            gnss_observables_iter->second,
-                                                            galileo_ephemeris_iter->second.WN_5,
+                                                            observable,
+                                                            galileo_ephemeris->WN_5,
                                                             2);  // Band 3 (L5/E5)
                                                         found_E1_obs = true;
                                                         break;
@@ -515,22 +542,22 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert Galileo E5 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second);
+                                                eph_data[valid_obs] = eph_to_rtklib(*galileo_ephemeris);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
                                                     {default_code_, default_code_, default_code_},
                                                     {}, {0.0, 0.0, 0.0}, {}};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
-                                                    gnss_observables_iter->second,
-                                                    galileo_ephemeris_iter->second.WN_5,
+                                                    observable,
+                                                    galileo_ephemeris->WN_5,
                                                     2);  // Band 3 (L5/E5)
                                                 valid_obs++;
                                             }
                                     }
                                 else  // the ephemeris are not available for this SV
                                     {
-                                        DLOG(INFO) << "No ephemeris data for SV " << gnss_observables_iter->second.PRN;
+                                        DLOG(INFO) << "No ephemeris data for SV " << observable.PRN;
                                     }
                             }
                         break;
@@ -539,48 +566,48 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     {
                         // GPS L1
                         // 1 GPS - find the ephemeris for the current GPS SV observation. The SV PRN ID is the map key
-                        std::string sig_(gnss_observables_iter->second.Signal);
+                        std::string sig_(observable.Signal);
                         if (sig_ == "1C")
                             {
-                                gps_ephemeris_iter = gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (gps_ephemeris_iter != gps_ephemeris_map.cend())
+                                gps_ephemeris = find_gps_ephemeris(observable.PRN);
+                                if (gps_ephemeris != nullptr)
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(gps_ephemeris_iter->second, d_pre_2009_file);
+                                        eph_data[valid_obs] = eph_to_rtklib(*gps_ephemeris, d_pre_2009_file);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs = {{0, 0}, '0', '0', {}, {}, {}, {}, {}, {}};
                                         obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
-                                            gnss_observables_iter->second,
-                                            gps_ephemeris_iter->second.i_GPS_week,
+                                            observable,
+                                            gps_ephemeris->i_GPS_week,
                                             0,
                                             d_pre_2009_file);
                                         valid_obs++;
                                     }
                                 else  // the ephemeris are not available for this SV
                                     {
-                                        DLOG(INFO) << "No ephemeris data for SV " << gnss_observables_iter->first;
+                                        DLOG(INFO) << "No ephemeris data for SV " << observable.PRN;
                                     }
                             }
                         // GPS L2 (todo: solve NAV/CNAV clash)
                         if ((sig_ == "2S") and (gps_dual_band == false))
                             {
-                                gps_cnav_ephemeris_iter = gps_cnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (gps_cnav_ephemeris_iter != gps_cnav_ephemeris_map.cend())
+                                gps_cnav_ephemeris = find_gps_cnav_ephemeris(observable.PRN);
+                                if (gps_cnav_ephemeris != nullptr)
                                     {
                                         // 1. Find the same satellite in GPS L1 band
-                                        gps_ephemeris_iter = gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                        if (gps_ephemeris_iter != gps_ephemeris_map.cend())
+                                        gps_ephemeris = find_gps_ephemeris(observable.PRN);
+                                        if (gps_ephemeris != nullptr)
                                             {
                                                 /* By the moment, GPS L2 observables are not used in pseudorange computations if GPS L1 is available
                                                 // 2. If found, replace the existing GPS L1 ephemeris with the GPS L2 ephemeris
                                                 // (more precise!), and attach the L2 observation to the L1 observation in RTKLIB structure
                                                 for (int i = 0; i < valid_obs; i++)
                                                     {
-                                                        if (eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
+                                                        if (eph_data[i].sat == static_cast<int>(observable.PRN))
                                                             {
-                                                                eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                                eph_data[i] = eph_to_rtklib(*gps_cnav_ephemeris);
                                                                 obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(obs_data[i + glo_valid_obs],
-                                                                    gnss_observables_iter->second,
+                                                                    observable,
                                                                     eph_data[i].week,
                                                                     1);  // Band 2 (L2)
                                                                 break;
@@ -592,44 +619,44 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // 3. If not found, insert the GPS L2 ephemeris and the observation
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                eph_data[valid_obs] = eph_to_rtklib(*gps_cnav_ephemeris);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
                                                     {default_code_, default_code_, default_code_},
                                                     {}, {0.0, 0.0, 0.0}, {}};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
-                                                    gnss_observables_iter->second,
-                                                    gps_cnav_ephemeris_iter->second.i_GPS_week,
+                                                    observable,
+                                                    gps_cnav_ephemeris->i_GPS_week,
                                                     1);  // Band 2 (L2)
                                                 valid_obs++;
                                             }
                                     }
                                 else  // the ephemeris are not available for this SV
                                     {
-                                        DLOG(INFO) << "No ephemeris data for SV " << gnss_observables_iter->second.PRN;
+                                        DLOG(INFO) << "No ephemeris data for SV " << observable.PRN;
                                     }
                             }
                         // GPS L5
                         if (sig_ == "L5")
                             {
-                                gps_cnav_ephemeris_iter = gps_cnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (gps_cnav_ephemeris_iter != gps_cnav_ephemeris_map.cend())
+                                gps_cnav_ephemeris = find_gps_cnav_ephemeris(observable.PRN);
+                                if (gps_cnav_ephemeris != nullptr)
                                     {
                                         // 1. Find the same satellite in GPS L1 band
-                                        gps_ephemeris_iter = gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                        if (gps_ephemeris_iter != gps_ephemeris_map.cend())
+                                        gps_ephemeris = find_gps_ephemeris(observable.PRN);
+                                        if (gps_ephemeris != nullptr)
                                             {
                                                 // 2. If found, replace the existing GPS L1 ephemeris with the GPS L5 ephemeris
                                                 // (more precise!), and attach the L5 observation to the L1 observation in RTKLIB structure
                                                 for (int i = 0; i < valid_obs; i++)
                                                     {
-                                                        if (eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
+                                                        if (eph_data[i].sat == static_cast<int>(observable.PRN))
                                                             {
-                                                                eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                                eph_data[i] = eph_to_rtklib(*gps_cnav_ephemeris);
                                                                 obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(obs_data[i],
-                                                                    gnss_observables_iter->second,
-                                                                    gps_cnav_ephemeris_iter->second.i_GPS_week,
+                                                                    observable,
+                                                                    gps_cnav_ephemeris->i_GPS_week,
                                                                     2);  // Band 3 (L5)
                                                                 break;
                                                             }
@@ -639,66 +666,66 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // 3. If not found, insert the GPS L5 ephemeris and the observation
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                eph_data[valid_obs] = eph_to_rtklib(*gps_cnav_ephemeris);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
                                                     {default_code_, default_code_, default_code_},
                                                     {}, {0.0, 0.0, 0.0}, {}};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
-                                                    gnss_observables_iter->second,
-                                                    gps_cnav_ephemeris_iter->second.i_GPS_week,
+                                                    observable,
+                                                    gps_cnav_ephemeris->i_GPS_week,
                                                     2);  // Band 3 (L5)
                                                 valid_obs++;
                                             }
                                     }
                                 else  // the ephemeris are not available for this SV
                                     {
-                                        DLOG(INFO) << "No ephemeris data for SV " << gnss_observables_iter->second.PRN;
+                                        DLOG(INFO) << "No ephemeris data for SV " << observable.PRN;
                                     }
                             }
                         break;
                     }
                 case 'R':  // TODO This should be using rtk lib nomenclature
                     {
-                        std::string sig_(gnss_observables_iter->second.Signal);
+                        std::string sig_(observable.Signal);
                         // GLONASS GNAV L1
                         if (sig_ == "1G")
                             {
                                 // 1 Glo - find the ephemeris for the current GLONASS SV observation. The SV Slot Number (PRN ID) is the map key
-                                glonass_gnav_ephemeris_iter = glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (glonass_gnav_ephemeris_iter != glonass_gnav_ephemeris_map.cend())
+                                glonass_gnav_ephemeris = find_glonass_gnav_ephemeris(observable.PRN);
+                                if (glonass_gnav_ephemeris != nullptr)
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                        geph_data[glo_valid_obs] = eph_to_rtklib(*glonass_gnav_ephemeris, gnav_utc);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs = {{0, 0}, '0', '0', {}, {}, {}, {}, {}, {}};
                                         obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
-                                            gnss_observables_iter->second,
-                                            glonass_gnav_ephemeris_iter->second.d_WN,
+                                            observable,
+                                            glonass_gnav_ephemeris->d_WN,
                                             0);  // Band 0 (L1)
                                         glo_valid_obs++;
                                     }
                                 else  // the ephemeris are not available for this SV
                                     {
-                                        DLOG(INFO) << "No ephemeris data for SV " << gnss_observables_iter->second.PRN;
+                                        DLOG(INFO) << "No ephemeris data for SV " << observable.PRN;
                                     }
                             }
                         // GLONASS GNAV L2
                         if (sig_ == "2G")
                             {
                                 // 1 GLONASS - find the ephemeris for the current GLONASS SV observation. The SV PRN ID is the map key
-                                glonass_gnav_ephemeris_iter = glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (glonass_gnav_ephemeris_iter != glonass_gnav_ephemeris_map.cend())
+                                glonass_gnav_ephemeris = find_glonass_gnav_ephemeris(observable.PRN);
+                                if (glonass_gnav_ephemeris != nullptr)
                                     {
                                         bool found_L1_obs = false;
                                         for (int i = 0; i < glo_valid_obs; i++)
                                             {
-                                                if (geph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS)))
+                                                if (geph_data[i].sat == (static_cast<int>(observable.PRN + NSATGPS)))
                                                     {
                                                         obs_data[i + valid_obs] = insert_obs_to_rtklib(obs_data[i + valid_obs],
-                                                            gnss_observables_iter->second,
-                                                            glonass_gnav_ephemeris_iter->second.d_WN,
+                                                            observable,
+                                                            glonass_gnav_ephemeris->d_WN,
                                                             1);  // Band 1 (L2)
                                                         found_L1_obs = true;
                                                         break;
@@ -708,19 +735,19 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert GLONASS GNAV L2 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                                geph_data[glo_valid_obs] = eph_to_rtklib(*glonass_gnav_ephemeris, gnav_utc);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {}, {}, {}, {}, {}};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
-                                                    gnss_observables_iter->second,
-                                                    glonass_gnav_ephemeris_iter->second.d_WN,
+                                                    observable,
+                                                    glonass_gnav_ephemeris->d_WN,
                                                     1);  // Band 1 (L2)
                                                 glo_valid_obs++;
                                             }
                                     }
                                 else  // the ephemeris are not available for this SV
                                     {
-                                        DLOG(INFO) << "No ephemeris data for SV " << gnss_observables_iter->second.PRN;
+                                        DLOG(INFO) << "No ephemeris data for SV " << observable.PRN;
                                     }
                             }
                         break;
@@ -729,41 +756,41 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     {
                         // BEIDOU B1I
                         //  - find the ephemeris for the current BEIDOU SV observation. The SV PRN ID is the map key
-                        std::string sig_(gnss_observables_iter->second.Signal);
+                        std::string sig_(observable.Signal);
                         if (sig_ == "B1")
                             {
-                                beidou_ephemeris_iter = beidou_dnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (beidou_ephemeris_iter != beidou_dnav_ephemeris_map.cend())
+                                beidou_ephemeris = find_beidou_dnav_ephemeris(observable.PRN);
+                                if (beidou_ephemeris != nullptr)
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                        eph_data[valid_obs] = eph_to_rtklib(*beidou_ephemeris);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs = {{0, 0}, '0', '0', {}, {}, {}, {}, {}, {}};
                                         obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
-                                            gnss_observables_iter->second,
-                                            beidou_ephemeris_iter->second.i_BEIDOU_week + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
+                                            observable,
+                                            beidou_ephemeris->i_BEIDOU_week + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
                                             0);
                                         valid_obs++;
                                     }
                                 else  // the ephemeris are not available for this SV
                                     {
-                                        DLOG(INFO) << "No ephemeris data for SV " << gnss_observables_iter->first;
+                                        DLOG(INFO) << "No ephemeris data for SV " << observable.PRN;
                                     }
                             }
                         // BeiDou B3
                         if (sig_ == "B3")
                             {
-                                beidou_ephemeris_iter = beidou_dnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (beidou_ephemeris_iter != beidou_dnav_ephemeris_map.cend())
+                                beidou_ephemeris = find_beidou_dnav_ephemeris(observable.PRN);
+                                if (beidou_ephemeris != nullptr)
                                     {
                                         bool found_B1I_obs = false;
                                         for (int i = 0; i < valid_obs; i++)
                                             {
-                                                if (eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO + NSATGAL + NSATQZS)))
+                                                if (eph_data[i].sat == (static_cast<int>(observable.PRN + NSATGPS + NSATGLO + NSATGAL + NSATQZS)))
                                                     {
                                                         obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(obs_data[i + glo_valid_obs],
-                                                            gnss_observables_iter->second,
-                                                            beidou_ephemeris_iter->second.i_BEIDOU_week + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
+                                                            observable,
+                                                            beidou_ephemeris->i_BEIDOU_week + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
                                                             2);  // Band 3 (L2/G2/B3)
                                                         found_B1I_obs = true;
                                                         break;
@@ -773,22 +800,22 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert BeiDou B3I obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                                eph_data[valid_obs] = eph_to_rtklib(*beidou_ephemeris);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
                                                     {default_code_, default_code_, default_code_},
                                                     {}, {0.0, 0.0, 0.0}, {}};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
-                                                    gnss_observables_iter->second,
-                                                    beidou_ephemeris_iter->second.i_BEIDOU_week + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
+                                                    observable,
+                                                    beidou_ephemeris->i_BEIDOU_week + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
                                                     2);  // Band 2 (L2/G2)
                                                 valid_obs++;
                                             }
                                     }
                                 else  // the ephemeris are not available for this SV
                                     {
-                                        DLOG(INFO) << "No ephemeris data for SV " << gnss_observables_iter->second.PRN;
+                                        DLOG(INFO) << "No ephemeris data for SV " << observable.PRN;
                                     }
                             }
                         break;
@@ -813,6 +840,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
             nav_data.geph = geph_data.data();
             nav_data.n = valid_obs;
             nav_data.ng = glo_valid_obs;
+            nav_data.orbcache = &d_orbit_cache;
             if (gps_iono.valid)
                 {
                     nav_data.ion_gps[0] = gps_iono.d_alpha0;
@@ -983,7 +1011,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
 
                     this->set_time_offset_s(rx_position_and_time(3));
 
-                    DLOG(INFO) << "RTKLIB Position at RX TOW = " << gnss_observables_map.begin()->second.RX_time
+                    DLOG(INFO) << "RTKLIB Position at RX TOW = " << gnss_observables.front().RX_time
                                << " in ECEF (X,Y,Z,t[meters]) = " << rx_position_and_time;
 
                     boost::posix_time::ptime p_time;
@@ -1004,11 +1032,11 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
 
                     // ######## PVT MONITOR #########
                     // TOW
-                    monitor_pvt.TOW_at_current_symbol_ms = gnss_observables_map.begin()->second.TOW_at_current_symbol_ms;
+                    monitor_pvt.TOW_at_current_symbol_ms = gnss_observables.front().TOW_at_current_symbol_ms;
                     // WEEK
                     monitor_pvt.week = adjgpsweek(nav_data.eph[0].week, d_pre_2009_file);
                     // PVT GPS time
-                    monitor_pvt.RX_time = gnss_observables_map.begin()->second.RX_time;
+                    monitor_pvt.RX_time = gnss_observables.front().RX_time;
                     // User clock offset [s]
                     monitor_pvt.user_clk_offset = rx_position_and_time(3);
 
@@ -1074,13 +1102,13 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                     double tmp_double;
                                     uint32_t tmp_uint32;
                                     // TOW
-                                    tmp_uint32 = gnss_observables_map.begin()->second.TOW_at_current_symbol_ms;
+                                    tmp_uint32 = gnss_observables.front().TOW_at_current_symbol_ms;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
                                     // WEEK
                                     tmp_uint32 = adjgpsweek(nav_data.eph[0].week, d_pre_2009_file);
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
                                     // PVT GPS time
-                                    tmp_double = gnss_observables_map.begin()->second.RX_time;
+                                    tmp_double = gnss_observables.front().RX_time;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
                                     // User clock offset [s]
                                     tmp_double = rx_position_and_time(3);
@@ -1150,3 +1178,14 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
         }
     return is_valid_position();
 }
+
+
+Rtklib_Solution_Snapshot::Rtklib_Solution_Snapshot(const Rtklib_Solver &solver) : Pvt_Solution(solver),
+                                                                                  pvt_sol(solver.pvt_sol),
+                                                                                  pvt_ssat(solver.pvt_ssat)
+{
+    d_hdop = solver.get_hdop();
+    d_vdop = solver.get_vdop();
+    d_pdop = solver.get_pdop();
+    d_gdop = solver.get_gdop();
+}
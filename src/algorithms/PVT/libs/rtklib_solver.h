@@ -45,6 +45,7 @@
 #include "glonass_gnav_almanac.h"
 #include "glonass_gnav_ephemeris.h"
 #include "glonass_gnav_utc_model.h"
+#include "gnss_observables_epoch.h"
 #include "gnss_synchro.h"
 #include "gps_almanac.h"
 #include "gps_cnav_ephemeris.h"
@@ -57,6 +58,7 @@
 #include "pvt_solution.h"
 #include "rtklib.h"
 #include <array>
+#include <cstdint>
 #include <fstream>
 #include <map>
 #include <string>
@@ -71,8 +73,28 @@ public:
     Rtklib_Solver(int nchannels, const std::string& dump_filename, bool flag_dump_to_file, bool flag_dump_to_mat, const rtk_t& rtk);
     ~Rtklib_Solver();
 
+    /*!
+     * \brief Computes the PVT solution from the valid observables of an
+     * epoch. The ephemeris maps are indexed by PRN at every call.
+     */
+    bool get_PVT(const Gnss_Observables_Epoch& gnss_observables, bool flag_averaging);
+
+    //! Same, from a map of observables keyed by channel
     bool get_PVT(const std::map<int, Gnss_Synchro>& gnss_observables_map, bool flag_averaging);
 
+    /*!
+     * \brief Indexes the ephemeris maps by PRN, for the find_*_ephemeris()
+     * lookups. Must be called again after any change to the maps.
+     */
+    void index_ephemeris();
+
+    //! Ephemeris of the satellite with the given PRN, or nullptr if there is none or the maps have not been indexed
+    inline const Gps_Ephemeris* find_gps_ephemeris(uint32_t prn) const { return prn < PRN_TABLE_SIZE ? d_gps_ephemeris[prn] : nullptr; }
+    inline const Gps_CNAV_Ephemeris* find_gps_cnav_ephemeris(uint32_t prn) const { return prn < PRN_TABLE_SIZE ? d_gps_cnav_ephemeris[prn] : nullptr; }
+    inline const Galileo_Ephemeris* find_galileo_ephemeris(uint32_t prn) const { return prn < PRN_TABLE_SIZE ? d_galileo_ephemeris[prn] : nullptr; }
+    inline const Glonass_Gnav_Ephemeris* find_glonass_gnav_ephemeris(uint32_t prn) const { return prn < PRN_TABLE_SIZE ? d_glonass_gnav_ephemeris[prn] : nullptr; }
+    inline const Beidou_Dnav_Ephemeris* find_beidou_dnav_ephemeris(uint32_t prn) const { return prn < PRN_TABLE_SIZE ? d_beidou_dnav_ephemeris[prn] : nullptr; }
+
     double get_hdop() const override;
     double get_vdop() const override;
     double get_pdop() const override;
@@ -107,9 +129,23 @@ public:
     std::map<int, Beidou_Dnav_Almanac> beidou_dnav_almanac_map;
 
 private:
+    static const uint32_t PRN_TABLE_SIZE = 64;  // PRNs and GLONASS slots of all the systems fit
+
     bool save_matfile();
 
+    // pointers into the ephemeris maps, indexed by PRN
+    std::array<const Gps_Ephemeris*, PRN_TABLE_SIZE> d_gps_ephemeris{};
+    std::array<const Gps_CNAV_Ephemeris*, PRN_TABLE_SIZE> d_gps_cnav_ephemeris{};
+    std::array<const Galileo_Ephemeris*, PRN_TABLE_SIZE> d_galileo_ephemeris{};
+    std::array<const Glonass_Gnav_Ephemeris*, PRN_TABLE_SIZE> d_glonass_gnav_ephemeris{};
+    std::array<const Beidou_Dnav_Ephemeris*, PRN_TABLE_SIZE> d_beidou_dnav_ephemeris{};
+
+    Gnss_Observables_Epoch d_observables_from_map;  // used by the overload of get_PVT() that takes a map
+
     std::array<obsd_t, MAXOBS> obs_data{};
+    std::array<eph_t, MAXOBS> eph_data{};
+    std::array<geph_t, MAXOBS> geph_data{};
+    orbcache_t d_orbit_cache{};  // satellite orbits and clocks at coarse nodes, interpolated at each epoch
     std::array<double, 4> dop_{};
     rtk_t rtk_{};
     Monitor_Pvt monitor_pvt{};
@@ -120,4 +156,30 @@ private:
     bool d_flag_dump_mat_enabled;
 };
 
+
+/*!
+ * \brief Copy of the solution of a Rtklib_Solver at a given epoch, with the
+ * data used by the position printers, which can be handed over to another
+ * thread while the solver goes on with the next epochs.
+ */
+class Rtklib_Solution_Snapshot : public Pvt_Solution
+{
+public:
+    explicit Rtklib_Solution_Snapshot(const Rtklib_Solver& solver);
+
+    double get_hdop() const override { return d_hdop; }
+    double get_vdop() const override { return d_vdop; }
+    double get_pdop() const override { return d_pdop; }
+    double get_gdop() const override { return d_gdop; }
+
+    sol_t pvt_sol{};
+    std::array<ssat_t, MAXSAT> pvt_ssat{};
+
+private:
+    double d_hdop;
+    double d_vdop;
+    double d_pdop;
+    double d_gdop;
+};
+
 #endif  // GNSS_SDR_RTKLIB_SOLVER_H
@@ -0,0 +1,76 @@
+/*!
+ * \file gnss_sdr_alloc_counter.cc
+ * \brief Count of the heap allocations made by the calling thread, used in
+ * Debug builds to check that the processing loops do not allocate memory in
+ * steady state
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_alloc_counter.h"
+
+#if ENABLE_ALLOCATION_COUNTER
+#include <cstdlib>  // for malloc, free
+#include <new>      // for std::bad_alloc, std::nothrow_t
+
+namespace
+{
+thread_local uint64_t thread_allocations = 0;
+}  // namespace
+
+
+uint64_t gnss_sdr_thread_allocations()
+{
+    return thread_allocations;
+}
+
+
+void* operator new(std::size_t size)
+{
+    thread_allocations++;
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+    return p;
+}
+
+
+void* operator new(std::size_t size, const std::nothrow_t& /* tag */) noexcept
+{
+    thread_allocations++;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+
+void operator delete(void* p, const std::nothrow_t& /* tag */) noexcept
+{
+    std::free(p);
+}
+
+#if __cpp_sized_deallocation
+void operator delete(void* p, std::size_t /* size */) noexcept
+{
+    std::free(p);
+}
+#endif
+
+#endif  // ENABLE_ALLOCATION_COUNTER
@@ -0,0 +1,41 @@
+/*!
+ * \file gnss_sdr_alloc_counter.h
+ * \brief Count of the heap allocations made by the calling thread, used in
+ * Debug builds to check that the processing loops do not allocate memory in
+ * steady state
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SDR_ALLOC_COUNTER_H
+#define GNSS_SDR_GNSS_SDR_ALLOC_COUNTER_H
+
+#include <cstdint>
+
+#if ENABLE_ALLOCATION_COUNTER
+/*!
+ * \brief Number of calls to the global operator new made so far by the
+ * calling thread. The global operator new is replaced by a counting one
+ * when ENABLE_ALLOCATION_COUNTER is defined, which is the case in Debug
+ * builds.
+ */
+uint64_t gnss_sdr_thread_allocations();
+#else
+inline uint64_t gnss_sdr_thread_allocations()
+{
+    return 0;
+}
+#endif
+
+#endif  // GNSS_SDR_GNSS_SDR_ALLOC_COUNTER_H
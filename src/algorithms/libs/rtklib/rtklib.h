@@ -741,6 +741,34 @@ typedef struct
 } pppcorr_t;
 
 
+typedef struct
+{                   /* satellite orbit and clock cache node type */
+    gtime_t time;   /* node time (gpst) */
+    double x[4];    /* satellite position {x,y,z} (ecef) (m) and clock bias (s) */
+    double xdot[4]; /* satellite velocity (m/s) and clock drift (s/s) */
+} orbnode_t;
+
+
+typedef struct
+{                      /* satellite orbit and clock cache entry type */
+    int sys;           /* navigation system of the cached ephemeris (0:empty) */
+    int iode;          /* IODE of the cached ephemeris */
+    gtime_t toe;       /* reference time of the cached ephemeris (gpst) */
+    double key[4];     /* parameters of the cached ephemeris, to detect new ones */
+    int nnode;         /* number of valid nodes (0:none,2:valid) */
+    orbnode_t node[2]; /* nodes bracketing the last requested time */
+    int nglo;          /* glonass state valid (0:no,1:yes) */
+    gtime_t tglo;      /* time of the glonass state (gpst) */
+    double xglo[6];    /* glonass position and velocity at tglo (m|m/s) */
+} orbcache_sat_t;
+
+
+typedef struct
+{                               /* satellite orbit and clock cache type */
+    orbcache_sat_t sat[MAXSAT]; /* cache entries indexed by satellite number - 1 */
+} orbcache_t;
+
+
 typedef struct
 {                                 /* navigation data type */
     int n, nmax;                  /* number of broadcast ephemeris */
@@ -787,6 +815,7 @@ typedef struct
     lexeph_t lexeph[MAXSAT];      /* LEX ephemeris */
     lexion_t lexion;              /* LEX ionosphere correction */
     pppcorr_t pppcorr;            /* ppp corrections */
+    orbcache_t *orbcache;         /* broadcast orbit and clock cache (NULL: not used) */
 } nav_t;
 
 
@@ -52,6 +52,8 @@ const double COS_5 = 0.9961946980917456;  /* cos(-5.0 deg) */
 
 const double ERREPH_GLO = 5.0;    /* error of glonass ephemeris (m) */
 const double TSTEP = 60.0;        /* integration step glonass ephemeris (s) */
+const int ORBCACHE_STEP = 10;     /* time between nodes of the orbit cache (s) */
+const double ORBCACHE_DT = 1e-3;  /* time step of the derivatives at the nodes (s) */
 const double RTOL_KEPLER = 1e-13; /* relative tolerance for Kepler equation */
 
 const double DEFURASSR = 0.15;                   /* default accuracy of ssr corr (m) */
@@ -378,6 +380,23 @@ void glorbit(double t, double *x, const double *acc)
 }
 
 
+/* glonass position and velocity integrated over t seconds in steps of TSTEP -*/
+void glorbit_span(double t, double *x, const double *acc)
+{
+    double tt = t < 0.0 ? -TSTEP : TSTEP;
+
+    while (fabs(t) > 1e-9)
+        {
+            if (fabs(t) < TSTEP)
+                {
+                    tt = t;
+                }
+            glorbit(tt, x, acc);
+            t -= tt;
+        }
+}
+
+
 /* glonass ephemeris to satellite clock bias -----------------------------------
  * compute satellite clock bias with glonass ephemeris
  * args   : gtime_t time     I   time by satellite clock (gpst)
@@ -416,7 +435,6 @@ void geph2pos(gtime_t time, const geph_t *geph, double *rs, double *dts,
     double *var)
 {
     double t;
-    double tt;
     double x[6];
     int i;
 
@@ -431,16 +449,7 @@ void geph2pos(gtime_t time, const geph_t *geph, double *rs, double *dts,
             x[i] = geph->pos[i];
             x[i + 3] = geph->vel[i];
         }
-    tt = t < 0.0 ? -TSTEP : TSTEP;
-    while (fabs(t) > 1e-9)
-        {
-            if (fabs(t) < TSTEP)
-                {
-                    tt = t;
-                }
-            glorbit(tt, x, geph->acc);
-            t -= tt;
-        }
+    glorbit_span(t, x, geph->acc);
     for (i = 0; i < 3; i++)
         {
             rs[i] = x[i];
@@ -693,6 +702,211 @@ int ephclk(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
 }
 
 
+/* reset orbit and clock cache -------------------------------------------------
+ * invalidate all the entries of the broadcast orbit and clock cache
+ * args   : orbcache_t *cache IO orbit and clock cache
+ * return : none
+ *-----------------------------------------------------------------------------*/
+void orbcache_reset(orbcache_t *cache)
+{
+    int i;
+
+    for (i = 0; i < MAXSAT; i++)
+        {
+            cache->sat[i].sys = 0;
+            cache->sat[i].nnode = 0;
+            cache->sat[i].nglo = 0;
+        }
+}
+
+
+/* orbit cache entry of a satellite, reset if its ephemeris has changed ------*/
+orbcache_sat_t *orbcache_entry(orbcache_t *cache, int sat, const eph_t *eph,
+    const geph_t *geph)
+{
+    orbcache_sat_t *c = cache->sat + sat - 1;
+    gtime_t toe;
+    double key[4];
+    int i;
+    int iode;
+    int sys;
+
+    if (eph)
+        {
+            sys = satsys(sat, nullptr);
+            iode = eph->iode;
+            toe = eph->toe;
+            key[0] = eph->A;
+            key[1] = eph->M0;
+            key[2] = eph->e;
+            key[3] = eph->f0;
+        }
+    else
+        {
+            sys = SYS_GLO;
+            iode = geph->iode;
+            toe = geph->toe;
+            key[0] = geph->pos[0];
+            key[1] = geph->vel[0];
+            key[2] = geph->taun;
+            key[3] = geph->gamn;
+        }
+    if (c->sys == sys && c->iode == iode && timediff(c->toe, toe) == 0.0 &&
+        c->key[0] == key[0] && c->key[1] == key[1] && c->key[2] == key[2] &&
+        c->key[3] == key[3])
+        {
+            return c;
+        }
+    trace(4, "orbcache: new ephemeris sat=%2d iode=%d\n", sat, iode);
+
+    c->sys = sys;
+    c->iode = iode;
+    c->toe = toe;
+    for (i = 0; i < 4; i++)
+        {
+            c->key[i] = key[i];
+        }
+    c->nnode = 0;
+    c->nglo = 0;
+    return c;
+}
+
+
+/* satellite position and clock at a node of the orbit cache ------------------
+ * the derivatives of the keplerian orbits are computed by central differences,
+ * and the glonass orbits are integrated from the closest of the last state and
+ * the ephemeris reference time
+ *-----------------------------------------------------------------------------*/
+void orbcache_node(orbcache_sat_t *c, gtime_t time, const eph_t *eph,
+    const geph_t *geph, orbnode_t *node)
+{
+    double rs[2][3] = {{0.0}};
+    double dts[2] = {0.0};
+    double x[6];
+    double t;
+    double var;
+    int i;
+
+    node->time = time;
+
+    if (eph)
+        {
+            for (i = 0; i < 4; i++)
+                {
+                    node->x[i] = 0.0;
+                }
+            eph2pos(time, eph, node->x, node->x + 3, &var);
+            eph2pos(timeadd(time, -ORBCACHE_DT), eph, rs[0], dts, &var);
+            eph2pos(timeadd(time, ORBCACHE_DT), eph, rs[1], dts + 1, &var);
+            for (i = 0; i < 3; i++)
+                {
+                    node->xdot[i] = (rs[1][i] - rs[0][i]) / (2.0 * ORBCACHE_DT);
+                }
+            node->xdot[3] = (dts[1] - dts[0]) / (2.0 * ORBCACHE_DT);
+            return;
+        }
+    t = timediff(time, geph->toe);
+
+    if (c->nglo && fabs(timediff(time, c->tglo)) < fabs(t))
+        {
+            matcpy(x, c->xglo, 6, 1);
+            glorbit_span(timediff(time, c->tglo), x, geph->acc);
+        }
+    else
+        {
+            for (i = 0; i < 3; i++)
+                {
+                    x[i] = geph->pos[i];
+                    x[i + 3] = geph->vel[i];
+                }
+            glorbit_span(t, x, geph->acc);
+        }
+    matcpy(c->xglo, x, 6, 1);
+    c->tglo = time;
+    c->nglo = 1;
+
+    for (i = 0; i < 3; i++)
+        {
+            node->x[i] = x[i];
+            node->xdot[i] = x[i + 3];
+        }
+    node->x[3] = -geph->taun + geph->gamn * t;
+    node->xdot[3] = geph->gamn;
+}
+
+
+/* satellite position and clock by the orbit and clock cache -------------------
+ * compute satellite position, velocity and clock by cubic hermite interpolation
+ * between nodes computed with the broadcast ephemeris every ORBCACHE_STEP s
+ * args   : orbcache_t *cache IO orbit and clock cache
+ *          gtime_t time     I   time (gpst)
+ *          int    sat       I   satellite number
+ *          eph_t  *eph      I   broadcast ephemeris (NULL: glonass)
+ *          geph_t *geph     I   glonass ephemeris (NULL: other systems)
+ *          double *rs       O   satellite position and velocity (ecef)
+ *                               {x,y,z,vx,vy,vz} (m|m/s)
+ *          double *dts      O   satellite clock {bias,drift} (s|s/s)
+ * return : none
+ * notes  : the entry of the satellite is reset when its ephemeris changes
+ *          the glonass orbit is integrated from the previous node instead of
+ *          from the ephemeris reference time
+ *-----------------------------------------------------------------------------*/
+void orbcache_pos(orbcache_t *cache, gtime_t time, int sat, const eph_t *eph,
+    const geph_t *geph, double *rs, double *dts)
+{
+    orbcache_sat_t *c = orbcache_entry(cache, sat, eph, geph);
+    const orbnode_t *n0;
+    const orbnode_t *n1;
+    gtime_t t0 = {0, 0.0};
+    double h = ORBCACHE_STEP;
+    double s;
+    double s2;
+    double s3;
+    double p;
+    double v;
+    int i;
+
+    t0.time = time.time - time.time % ORBCACHE_STEP;
+
+    if (c->nnode < 2 || timediff(c->node[0].time, t0) != 0.0)
+        {
+            if (c->nnode == 2 && timediff(c->node[1].time, t0) == 0.0)
+                {
+                    c->node[0] = c->node[1];
+                }
+            else
+                {
+                    orbcache_node(c, t0, eph, geph, c->node);
+                }
+            orbcache_node(c, timeadd(t0, h), eph, geph, c->node + 1);
+            c->nnode = 2;
+        }
+    n0 = c->node;
+    n1 = c->node + 1;
+    s = timediff(time, t0) / h;
+    s2 = s * s;
+    s3 = s2 * s;
+
+    for (i = 0; i < 4; i++)
+        {
+            p = (2.0 * s3 - 3.0 * s2 + 1.0) * n0->x[i] + (s3 - 2.0 * s2 + s) * h * n0->xdot[i] +
+                (-2.0 * s3 + 3.0 * s2) * n1->x[i] + (s3 - s2) * h * n1->xdot[i];
+            v = ((6.0 * s2 - 6.0 * s) * (n0->x[i] - n1->x[i])) / h +
+                (3.0 * s2 - 4.0 * s + 1.0) * n0->xdot[i] + (3.0 * s2 - 2.0 * s) * n1->xdot[i];
+            if (i < 3)
+                {
+                    rs[i] = p;
+                    rs[i + 3] = v;
+                }
+            else
+                {
+                    dts[0] = p;
+                    dts[1] = v;
+                }
+        }
+}
+
+
 /* satellite position and clock by broadcast ephemeris -----------------------*/
 int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     int iode, double *rs, double *dts, double *var, int *svh)
@@ -718,7 +932,13 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
                 {
                     return 0;
                 }
-
+            if (nav->orbcache)
+                {
+                    orbcache_pos(nav->orbcache, time, sat, eph, nullptr, rs, dts);
+                    *var = var_uraeph(eph->sva);
+                    *svh = eph->svh;
+                    return 1;
+                }
             eph2pos(time, eph, rs, dts, var);
             time = timeadd(time, tt);
             eph2pos(time, eph, rst, dtst, var);
@@ -730,6 +950,13 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
                 {
                     return 0;
                 }
+            if (nav->orbcache)
+                {
+                    orbcache_pos(nav->orbcache, time, sat, nullptr, geph, rs, dts);
+                    *var = std::pow(ERREPH_GLO, 2.0);
+                    *svh = geph->svh;
+                    return 1;
+                }
             geph2pos(time, geph, rs, dts, var);
             time = timeadd(time, tt);
             geph2pos(time, geph, rst, dtst, var);
@@ -44,6 +44,7 @@ void eph2pos(gtime_t time, const eph_t *eph, double *rs, double *dts,
     double *var);
 void deq(const double *x, double *xdot, const double *acc);
 void glorbit(double t, double *x, const double *acc);
+void glorbit_span(double t, double *x, const double *acc);
 double geph2clk(gtime_t time, const geph_t *geph);
 
 void geph2pos(gtime_t time, const geph_t *geph, double *rs, double *dts,
@@ -56,6 +57,13 @@ geph_t *selgeph(gtime_t time, int sat, int iode, const nav_t *nav);
 seph_t *selseph(gtime_t time, int sat, const nav_t *nav);
 int ephclk(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     double *dts);
+void orbcache_reset(orbcache_t *cache);
+orbcache_sat_t *orbcache_entry(orbcache_t *cache, int sat, const eph_t *eph,
+    const geph_t *geph);
+void orbcache_node(orbcache_sat_t *c, gtime_t time, const eph_t *eph,
+    const geph_t *geph, orbnode_t *node);
+void orbcache_pos(orbcache_t *cache, gtime_t time, int sat, const eph_t *eph,
+    const geph_t *geph, double *rs, double *dts);
 // satellite position and clock by broadcast ephemeris
 int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     int iode, double *rs, double *dts, double *var, int *svh);
@@ -30,6 +30,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "rtklib_rtkcmn.h"
+#include "rtklib_small_matrix.h"
 #include <glog/logging.h>
 #include <cstring>
 #include <dirent.h>
@@ -1132,9 +1133,48 @@ void matcpy(double *A, const double *B, int n, int m)
  *          double beta      I  beta
  *          double *C        IO matrix C (n x k)
  * return : none
+ * notes  : products of up to SMALL_MATMUL_MAX_OPS multiplications are
+ *          computed by the kernels of rtklib_small_matrix.h, where the
+ *          overhead of the blas call would dominate
  *-----------------------------------------------------------------------------*/
 void matmul(const char *tr, int n, int k, int m, double alpha,
     const double *A, const double *B, double beta, double *C)
+{
+    if (n * k * m > SMALL_MATMUL_MAX_OPS)
+        {
+            matmul_blas(tr, n, k, m, alpha, A, B, beta, C);
+            return;
+        }
+    const bool ta = tr[0] == 'T';
+    const bool tb = tr[1] == 'T';
+    if (ta)
+        {
+            if (tb)
+                {
+                    matmul_small_dispatch<true, true>(n, k, m, alpha, A, B, beta, C);
+                }
+            else
+                {
+                    matmul_small_dispatch<true, false>(n, k, m, alpha, A, B, beta, C);
+                }
+        }
+    else
+        {
+            if (tb)
+                {
+                    matmul_small_dispatch<false, true>(n, k, m, alpha, A, B, beta, C);
+                }
+            else
+                {
+                    matmul_small_dispatch<false, false>(n, k, m, alpha, A, B, beta, C);
+                }
+        }
+}
+
+
+/* multiply matrix by blas dgemm, whatever the size of the matrices ----------*/
+void matmul_blas(const char *tr, int n, int k, int m, double alpha,
+    const double *A, const double *B, double beta, double *C)
 {
     int lda = tr[0] == 'T' ? m : n;
     int ldb = tr[1] == 'T' ? k : m;
@@ -1149,8 +1189,22 @@ void matmul(const char *tr, int n, int k, int m, double alpha,
  * args   : double *A        IO  matrix (n x n)
  *          int    n         I   size of matrix A
  * return : status (0:ok,0>:error)
+ * notes  : matrices of up to SMALL_MATINV_MAX_N x SMALL_MATINV_MAX_N are
+ *          inverted by Gauss-Jordan elimination, without calling lapack
+ *          nor allocating memory
  *-----------------------------------------------------------------------------*/
 int matinv(double *A, int n)
+{
+    if (n <= SMALL_MATINV_MAX_N)
+        {
+            return matinv_small(A, n);
+        }
+    return matinv_lapack(A, n);
+}
+
+
+/* inverse of matrix by lapack dgetrf/dgetri, whatever its size --------------*/
+int matinv_lapack(double *A, int n)
 {
     double *work;
     int info;
@@ -126,7 +126,10 @@ int normv3(const double *a, double *b);
 void matcpy(double *A, const double *B, int n, int m);
 void matmul(const char *tr, int n, int k, int m, double alpha,
     const double *A, const double *B, double beta, double *C);
+void matmul_blas(const char *tr, int n, int k, int m, double alpha,
+    const double *A, const double *B, double beta, double *C);
 int matinv(double *A, int n);
+int matinv_lapack(double *A, int n);
 int solve(const char *tr, const double *A, const double *Y, int n,
     int m, double *X);
 int lsq(const double *A, const double *y, int n, int m, double *x,
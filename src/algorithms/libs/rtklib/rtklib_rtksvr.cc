@@ -751,6 +751,7 @@ int rtksvrinit(rtksvr_t *svr)
             svr->files[i][0] = '\0';
         }
     svr->moni = nullptr;
+    svr->nav.orbcache = nullptr;
     svr->tick = 0;
     svr->thread = 0;  // NOLINT
     svr->cputime = svr->prcout = 0;
@@ -0,0 +1,232 @@
+/*!
+ * \file rtklib_small_matrix.h
+ * \brief Matrix product and inverse kernels for the small matrices of the
+ * RTKLIB positioning algorithms, used instead of BLAS and LAPACK below a
+ * size threshold
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTKLIB_SMALL_MATRIX_H
+#define GNSS_SDR_RTKLIB_SMALL_MATRIX_H
+
+#include <cmath>
+
+/*
+ * All the matrices are stored in column-major order (fortran convention), as
+ * in the rest of RTKLIB. The arguments follow those of matmul(): op(A) is
+ * n x m, op(B) is m x k and C is n x k, where op(X) is X or its transpose.
+ * As in dgemm, C is not read when beta is zero.
+ */
+
+//! Largest product n * k * m computed by the small matrix kernels in matmul()
+const int SMALL_MATMUL_MAX_OPS = 64;
+
+//! Largest size of the matrices inverted by the small matrix kernel in matinv()
+const int SMALL_MATINV_MAX_N = 16;
+
+
+//! Column j of C = alpha * A^T * op(B) + beta * C, with four dot products at a time
+template <bool TB>
+inline void matmul_small_transposed_a(int n, int k, int m, int j, double alpha, const double *A, const double *B, double beta, double *c)
+{
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+        {
+            const double *a = A + i * m;
+            double s0 = 0.0;
+            double s1 = 0.0;
+            double s2 = 0.0;
+            double s3 = 0.0;
+            for (int l = 0; l < m; l++)
+                {
+                    const double b = TB ? B[j + l * k] : B[l + j * m];
+                    s0 += a[l] * b;
+                    s1 += a[l + m] * b;
+                    s2 += a[l + 2 * m] * b;
+                    s3 += a[l + 3 * m] * b;
+                }
+            c[i] = beta == 0.0 ? alpha * s0 : alpha * s0 + beta * c[i];
+            c[i + 1] = beta == 0.0 ? alpha * s1 : alpha * s1 + beta * c[i + 1];
+            c[i + 2] = beta == 0.0 ? alpha * s2 : alpha * s2 + beta * c[i + 2];
+            c[i + 3] = beta == 0.0 ? alpha * s3 : alpha * s3 + beta * c[i + 3];
+        }
+    for (; i < n; i++)
+        {
+            const double *a = A + i * m;
+            double s = 0.0;
+            for (int l = 0; l < m; l++)
+                {
+                    s += a[l] * (TB ? B[j + l * k] : B[l + j * m]);
+                }
+            c[i] = beta == 0.0 ? alpha * s : alpha * s + beta * c[i];
+        }
+}
+
+
+/*
+ * C = alpha * op(A) * op(B) + beta * C. The inner loops run along the
+ * columns of A, which are contiguous: as updates of the columns of C when A
+ * is not transposed, and as dot products with the columns of A when it is.
+ */
+template <bool TA, bool TB>
+inline void matmul_small(int n, int k, int m, double alpha, const double *A, const double *B, double beta, double *C)
+{
+    for (int j = 0; j < k; j++)
+        {
+            double *c = C + j * n;
+            if (!TA)
+                {
+                    for (int i = 0; i < n; i++)
+                        {
+                            c[i] = beta == 0.0 ? 0.0 : beta * c[i];
+                        }
+                    for (int l = 0; l < m; l++)
+                        {
+                            const double b = alpha * (TB ? B[j + l * k] : B[l + j * m]);
+                            const double *a = A + l * n;
+                            for (int i = 0; i < n; i++)
+                                {
+                                    c[i] += a[i] * b;
+                                }
+                        }
+                }
+            else
+                {
+                    matmul_small_transposed_a<TB>(n, k, m, j, alpha, A, B, beta, c);
+                }
+        }
+}
+
+
+//! Same as matmul_small(), with the sizes known at compile time, so that the compiler unrolls the loops
+template <bool TA, bool TB, int N, int K, int M>
+inline void matmul_fixed(double alpha, const double *A, const double *B, double beta, double *C)
+{
+    matmul_small<TA, TB>(N, K, M, alpha, A, B, beta, C);
+}
+
+
+/*
+ * Dispatches to the unrolled kernels for the 3 x 3 and 4 x 4 products of
+ * the coordinate transformations and DOP computations, and to the generic
+ * small kernel otherwise
+ */
+template <bool TA, bool TB>
+inline void matmul_small_dispatch(int n, int k, int m, double alpha, const double *A, const double *B, double beta, double *C)
+{
+    if (n == 3 && m == 3 && k == 1)
+        {
+            matmul_fixed<TA, TB, 3, 1, 3>(alpha, A, B, beta, C);
+        }
+    else if (n == 3 && m == 3 && k == 3)
+        {
+            matmul_fixed<TA, TB, 3, 3, 3>(alpha, A, B, beta, C);
+        }
+    else if (n == 4 && m == 4 && k == 4)
+        {
+            matmul_fixed<TA, TB, 4, 4, 4>(alpha, A, B, beta, C);
+        }
+    else
+        {
+            matmul_small<TA, TB>(n, k, m, alpha, A, B, beta, C);
+        }
+}
+
+
+/*
+ * In-place inverse by Gauss-Jordan elimination with partial pivoting, for
+ * n <= SMALL_MATINV_MAX_N. Returns 0 if ok, or the position (starting at
+ * 1) of the first zero pivot if the matrix is singular, as dgetrf does.
+ */
+inline int matinv_small(double *A, int n)
+{
+    int pivot_row[SMALL_MATINV_MAX_N];
+    for (int c = 0; c < n; c++)
+        {
+            // pivot: largest element of column c on or below the diagonal
+            int p = c;
+            double max_abs = std::fabs(A[c + c * n]);
+            for (int r = c + 1; r < n; r++)
+                {
+                    const double v = std::fabs(A[r + c * n]);
+                    if (v > max_abs)
+                        {
+                            max_abs = v;
+                            p = r;
+                        }
+                }
+            if (max_abs == 0.0)
+                {
+                    return c + 1;
+                }
+            pivot_row[c] = p;
+            if (p != c)
+                {
+                    for (int j = 0; j < n; j++)
+                        {
+                            const double tmp = A[c + j * n];
+                            A[c + j * n] = A[p + j * n];
+                            A[p + j * n] = tmp;
+                        }
+                }
+            // eliminate column c from the other rows, working along the
+            // contiguous columns of A
+            const double inv_pivot = 1.0 / A[c + c * n];
+            double *col_c = A + c * n;
+            for (int j = 0; j < n; j++)
+                {
+                    if (j == c)
+                        {
+                            continue;
+                        }
+                    double *col_j = A + j * n;
+                    const double f = col_j[c] * inv_pivot;
+                    col_j[c] = f;
+                    if (f != 0.0)
+                        {
+                            for (int r = 0; r < c; r++)
+                                {
+                                    col_j[r] -= col_c[r] * f;
+                                }
+                            for (int r = c + 1; r < n; r++)
+                                {
+                                    col_j[r] -= col_c[r] * f;
+                                }
+                        }
+                }
+            for (int r = 0; r < n; r++)
+                {
+                    col_c[r] *= -inv_pivot;
+                }
+            col_c[c] = inv_pivot;
+        }
+    // undo the row exchanges as column exchanges of the inverse, in reverse order
+    for (int c = n - 1; c >= 0; c--)
+        {
+            const int p = pivot_row[c];
+            if (p != c)
+                {
+                    for (int i = 0; i < n; i++)
+                        {
+                            const double tmp = A[i + c * n];
+                            A[i + c * n] = A[i + p * n];
+                            A[i + p * n] = tmp;
+                        }
+                }
+        }
+    return 0;
+}
+
+#endif  // GNSS_SDR_RTKLIB_SMALL_MATRIX_H
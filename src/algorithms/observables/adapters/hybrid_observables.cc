@@ -24,6 +24,13 @@
 #include "obs_conf.h"
 #include <glog/logging.h>
 #include <ostream>  // for operator<<
+#if USE_OLD_BOOST_MATH_COMMON_FACTOR
+#include <boost/math/common_factor_rt.hpp>
+namespace bc = boost::math;
+#else
+#include <boost/integer/common_factor_rt.hpp>
+namespace bc = boost::integer;
+#endif
 
 HybridObservables::HybridObservables(const ConfigurationInterface* configuration,
     const std::string& role, unsigned int in_streams, unsigned int out_streams) : role_(role), in_streams_(in_streams), out_streams_(out_streams)
@@ -42,6 +49,10 @@ HybridObservables::HybridObservables(const ConfigurationInterface* configuration
     conf.nchannels_in = in_streams_;
     conf.nchannels_out = out_streams_;
     conf.enable_carrier_smoothing = configuration->property(role + ".enable_carrier_smoothing", conf.enable_carrier_smoothing);
+    conf.history_depth_ms = configuration->property(role + ".history_depth_ms", conf.history_depth_ms);
+    // the epochs sent to PVT can be decimated, a multiple of the interval of the raw observables
+    conf.observable_interval_ms = configuration->property("GNSS-SDR.observable_interval_ms", conf.observable_interval_ms);
+    conf.pvt_interval_ms = bc::lcm(conf.observable_interval_ms, configuration->property("GNSS-SDR.pvt_observable_interval_ms", conf.observable_interval_ms));
 
     if (FLAGS_carrier_smoothing_factor == DEFAULT_CARRIER_SMOOTHING_FACTOR)
         {
@@ -52,6 +63,10 @@ HybridObservables::HybridObservables(const ConfigurationInterface* configuration
         {
             LOG(INFO) << "Observables carrier smoothing enabled with smoothing factor " << conf.smoothing_factor;
         }
+    if (conf.pvt_interval_ms > conf.observable_interval_ms)
+        {
+            LOG(INFO) << "Observables produced every " << conf.observable_interval_ms << " ms, sent to PVT every " << conf.pvt_interval_ms << " ms";
+        }
     observables_ = hybrid_observables_gs_make(conf);
     DLOG(INFO) << "Observables block ID (" << observables_->unique_id() << ")";
 }
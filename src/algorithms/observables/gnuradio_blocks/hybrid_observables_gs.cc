@@ -21,19 +21,20 @@
 #include "hybrid_observables_gs.h"
 #include "GPS_L1_CA.h"       // for GPS_STARTOFFSET_MS, GPS_TWO_PI
 #include "MATH_CONSTANTS.h"  // for SPEED_OF_LIGHT
-#include "gnss_circular_deque.h"
+#include "gnss_sdr_alloc_counter.h"
 #include "gnss_sdr_create_directory.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro.h"
+#include "trk_obs_history.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <matio.h>
+#include <algorithm>  // for std::max
 #include <array>
 #include <cmath>      // for round
-#include <cstdlib>    // for size_t, llabs
+#include <cstdlib>    // for size_t
 #include <exception>  // for exception
 #include <iostream>   // for cerr, cout
-#include <limits>     // for numeric_limits
 #include <utility>    // for move
 
 #if HAS_GENERIC_LAMBDA
@@ -69,7 +70,7 @@ hybrid_observables_gs_sptr hybrid_observables_gs_make(const Obs_Conf &conf_)
 
 hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_) : gr::block("hybrid_observables_gs",
                                                                           gr::io_signature::make(conf_.nchannels_in, conf_.nchannels_in, sizeof(Gnss_Synchro)),
-                                                                          gr::io_signature::make(conf_.nchannels_out, conf_.nchannels_out, sizeof(Gnss_Synchro)))
+                                                                          gr::io_signature::make(conf_.nchannels_out, 2 * conf_.nchannels_out, sizeof(Gnss_Synchro)))
 {
     // PVT input message port
     this->message_port_register_in(pmt::mp("pvt_to_observables"));
@@ -91,7 +92,7 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_) : gr::block(
     d_dump_filename = conf_.dump_filename;
     d_nchannels_out = conf_.nchannels_out;
     d_nchannels_in = conf_.nchannels_in;
-    d_gnss_synchro_history = std::make_unique<Gnss_circular_deque<Gnss_Synchro>>(1000, d_nchannels_out);
+    d_gnss_synchro_history = std::make_unique<Trk_Obs_History>(conf_.history_depth_ms, d_nchannels_out);
 
     // ############# ENABLE DATA FILE LOG #################
     if (d_dump)
@@ -138,12 +139,24 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_) : gr::block(
                 }
         }
     d_T_rx_TOW_ms = 0U;
-    d_T_rx_step_ms = 20;  // read from config at the adapter GNSS-SDR.observable_interval_ms!!
+    d_T_rx_step_ms = std::max(conf_.observable_interval_ms, 1U);
+    d_T_rx_pvt_step_ms = std::max(conf_.pvt_interval_ms, d_T_rx_step_ms);
     d_T_rx_TOW_set = false;
     d_T_status_report_timer_ms = 0;
     // rework
     d_Rx_clock_buffer.set_capacity(10);  // 10*20 ms = 200 ms of data in buffer
     d_Rx_clock_buffer.clear();           // Clear all the elements in the buffer
+    if (conf_.history_depth_ms < d_Rx_clock_buffer.capacity() * d_T_rx_step_ms)
+        {
+            LOG(WARNING) << "Observables history of " << conf_.history_depth_ms << " ms is shorter than the receiver clock delay of "
+                         << d_Rx_clock_buffer.capacity() * d_T_rx_step_ms << " ms, no observable will be produced";
+        }
+
+    d_epoch_data = std::vector<Gnss_Synchro>(d_nchannels_out);
+    // the history columns reach their final size after twice the history depth
+    d_epochs_to_steady_state = d_Rx_clock_buffer.capacity() + 2 * (conf_.history_depth_ms / d_T_rx_step_ms + 1);
+    d_epoch_counter = 0;
+    d_steady_state_allocations = 0;
 
     d_channel_last_pll_lock = std::vector<bool>(d_nchannels_out, false);
     d_channel_last_pseudorange_smooth = std::vector<double>(d_nchannels_out, 0.0);
@@ -201,10 +214,10 @@ void hybrid_observables_gs::msg_handler_pvt_to_observables(const pmt::pmt_t &msg
                     double new_rx_clock_offset_s;
                     new_rx_clock_offset_s = boost::any_cast<double>(pmt::any_ref(msg));
                     d_T_rx_TOW_ms = d_T_rx_TOW_ms - static_cast<int>(round(new_rx_clock_offset_s * 1000.0));
-                    // align the receiver clock to integer multiple of 20 ms
-                    if (d_T_rx_TOW_ms % 20)
+                    // align the receiver clock to integer multiple of the observable interval
+                    if (d_T_rx_TOW_ms % d_T_rx_step_ms)
                         {
-                            d_T_rx_TOW_ms += 20 - d_T_rx_TOW_ms % 20;
+                            d_T_rx_TOW_ms += d_T_rx_step_ms - d_T_rx_TOW_ms % d_T_rx_step_ms;
                         }
                     // d_Rx_clock_buffer.clear();  // Clear all the elements in the buffer
                     for (uint32_t n = 0; n < d_nchannels_out; n++)
@@ -365,98 +378,19 @@ double hybrid_observables_gs::compute_T_rx_s(const Gnss_Synchro &a) const
 }
 
 
-bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint32_t ch, uint64_t rx_clock) const
+void hybrid_observables_gs::check_epoch_allocations(uint64_t allocations)
 {
-    int32_t nearest_element = -1;
-    int64_t abs_diff;
-    int64_t old_abs_diff = std::numeric_limits<int64_t>::max();
-    for (uint32_t i = 0; i < d_gnss_synchro_history->size(ch); i++)
+    if (d_epoch_counter < d_epochs_to_steady_state)
         {
-            abs_diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(d_gnss_synchro_history->get(ch, i).Tracking_sample_counter));
-            if (old_abs_diff > abs_diff)
-                {
-                    old_abs_diff = abs_diff;
-                    nearest_element = static_cast<int32_t>(i);
-                }
+            d_epoch_counter++;
+            return;
         }
-
-    if (nearest_element != -1 and nearest_element != static_cast<int32_t>(d_gnss_synchro_history->size(ch)))
+    if (allocations > 0)
         {
-            if ((static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs)) < 0.02)
-                {
-                    int32_t neighbor_element;
-                    if (rx_clock > d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter)
-                        {
-                            neighbor_element = nearest_element + 1;
-                        }
-                    else
-                        {
-                            neighbor_element = nearest_element - 1;
-                        }
-                    if (neighbor_element < static_cast<int32_t>(d_gnss_synchro_history->size(ch)) and neighbor_element >= 0)
-                        {
-                            int32_t t1_idx;
-                            int32_t t2_idx;
-                            if (rx_clock > d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter)
-                                {
-                                    // std::cout << "S1= " << d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter
-                                    //           << " Si=" << rx_clock << " S2=" << d_gnss_synchro_history->get(ch, neighbor_element).Tracking_sample_counter << std::endl;
-                                    t1_idx = nearest_element;
-                                    t2_idx = neighbor_element;
-                                }
-                            else
-                                {
-                                    // std::cout << "inv S1= " << d_gnss_synchro_history->get(ch, neighbor_element).Tracking_sample_counter
-                                    //           << " Si=" << rx_clock << " S2=" << d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter << std::endl;
-                                    t1_idx = neighbor_element;
-                                    t2_idx = nearest_element;
-                                }
-
-                            // 1st: copy the nearest gnss_synchro data for that channel
-                            interpolated_obs = d_gnss_synchro_history->get(ch, nearest_element);
-
-                            // 2nd: Linear interpolation: y(t) = y(t1) + (y(t2) - y(t1)) * (t - t1) / (t2 - t1)
-                            double T_rx_s = static_cast<double>(rx_clock) / static_cast<double>(interpolated_obs.fs);
-
-                            double time_factor = (T_rx_s - d_gnss_synchro_history->get(ch, t1_idx).RX_time) /
-                                                 (d_gnss_synchro_history->get(ch, t2_idx).RX_time -
-                                                     d_gnss_synchro_history->get(ch, t1_idx).RX_time);
-
-                            // CARRIER PHASE INTERPOLATION
-                            interpolated_obs.Carrier_phase_rads = d_gnss_synchro_history->get(ch, t1_idx).Carrier_phase_rads + (d_gnss_synchro_history->get(ch, t2_idx).Carrier_phase_rads - d_gnss_synchro_history->get(ch, t1_idx).Carrier_phase_rads) * time_factor;
-                            // CARRIER DOPPLER INTERPOLATION
-                            interpolated_obs.Carrier_Doppler_hz = d_gnss_synchro_history->get(ch, t1_idx).Carrier_Doppler_hz + (d_gnss_synchro_history->get(ch, t2_idx).Carrier_Doppler_hz - d_gnss_synchro_history->get(ch, t1_idx).Carrier_Doppler_hz) * time_factor;
-                            // TOW INTERPOLATION
-                            // check TOW rollover
-                            if ((d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms - d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) > 0)
-                                {
-                                    interpolated_obs.interp_TOW_ms = static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) + (static_cast<double>(d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms) - static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms)) * time_factor;
-                                }
-                            else
-                                {
-                                    // TOW rollover situation
-                                    interpolated_obs.interp_TOW_ms = static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) + (static_cast<double>(d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms + 604800000) - static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms)) * time_factor;
-                                }
-
-                            // LOG(INFO) << "Channel " << ch << " int idx: " << t1_idx << " TOW Int: " << interpolated_obs.interp_TOW_ms
-                            //           << " TOW p1 : " << d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms
-                            //           << " TOW p2: "
-                            //           << d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms
-                            //           << " t2-t1: "
-                            //           << d_gnss_synchro_history->get(ch, t2_idx).RX_time - d_gnss_synchro_history->get(ch, t1_idx).RX_time
-                            //           << " trx - t1: "
-                            //           << T_rx_s - d_gnss_synchro_history->get(ch, t1_idx).RX_time;
-                            // std::cout << "Rx samplestamp: " << T_rx_s << " Channel " << ch << " interp buff idx " << nearest_element
-                            //           << " ,diff: " << old_abs_diff << " samples (" << static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs) << " s)\n";
-                            return true;
-                        }
-                    return false;
-                }
-            // std::cout << "ALERT: Channel " << ch << " interp buff idx " << nearest_element
-            //           << " ,diff: " << old_abs_diff << " samples (" << static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs) << " s)\n";
-            // usleep(1000);
+            d_steady_state_allocations += allocations;
+            LOG(WARNING) << "Observables epoch made " << allocations << " heap allocations in steady state ("
+                         << d_steady_state_allocations << " so far)";
         }
-    return false;
 }
 
 
@@ -494,10 +428,10 @@ void hybrid_observables_gs::update_TOW(const std::vector<Gnss_Synchro> &data)
                         }
                 }
             d_T_rx_TOW_ms = TOW_ref;
-            // align the receiver clock to integer multiple of 20 ms
-            if (d_T_rx_TOW_ms % 20)
+            // align the receiver clock to integer multiple of the observable interval
+            if (d_T_rx_TOW_ms % d_T_rx_step_ms)
                 {
-                    d_T_rx_TOW_ms += 20 - d_T_rx_TOW_ms % 20;
+                    d_T_rx_TOW_ms += d_T_rx_step_ms - d_T_rx_TOW_ms % d_T_rx_step_ms;
                 }
         }
     else
@@ -552,7 +486,9 @@ void hybrid_observables_gs::smooth_pseudoranges(std::vector<Gnss_Synchro> &data)
                 {
                     // 0. get wavelength for the current signal
                     double wavelength_m = 0;
-                    switch (d_mapStringValues[it->Signal])
+                    // look up without inserting, signals not in the map get the first value, as with operator[]
+                    const auto signal_it = d_mapStringValues.find(it->Signal);
+                    switch (signal_it != d_mapStringValues.cend() ? signal_it->second : evGPS_1C)
                         {
                         case evGPS_1C:
                             wavelength_m = SPEED_OF_LIGHT / FREQ1;
@@ -619,6 +555,7 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
 {
     const auto **in = reinterpret_cast<const Gnss_Synchro **>(&input_items[0]);
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
+    const uint64_t allocations_at_start = gnss_sdr_thread_allocations();
 
     // Push receiver clock into history buffer (connected to the last of the input channels)
     // The clock buffer gives time to the channels to compute the tracking observables
@@ -640,14 +577,13 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                             if (d_gnss_synchro_history->size(n) > 0)
                                 {
                                     // Check if the last Gnss_Synchro comes from the same satellite as the previous ones
-                                    if (d_gnss_synchro_history->front(n).PRN != in[n][m].PRN)
+                                    if (d_gnss_synchro_history->last(n).PRN != in[n][m].PRN)
                                         {
                                             d_gnss_synchro_history->clear(n);
-                                            // LOG(INFO) << "Channel " << d_gnss_synchro_history->front(n).Channel_ID << " changed satellite to PRN " << in[n][m].PRN;
+                                            // LOG(INFO) << "Channel " << d_gnss_synchro_history->last(n).Channel_ID << " changed satellite to PRN " << in[n][m].PRN;
                                         }
                                 }
-                            d_gnss_synchro_history->push_back(n, in[n][m]);
-                            d_gnss_synchro_history->back(n).RX_time = compute_T_rx_s(in[n][m]);
+                            d_gnss_synchro_history->push_back(n, in[n][m], compute_T_rx_s(in[n][m]));
                         }
                 }
             consume(n, ninput_items[n]);
@@ -655,27 +591,18 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
 
     if (d_Rx_clock_buffer.size() == d_Rx_clock_buffer.capacity())
         {
-            std::vector<Gnss_Synchro> epoch_data(d_nchannels_out);
-            int32_t n_valid = 0;
+            std::vector<Gnss_Synchro> &epoch_data = d_epoch_data;
             for (uint32_t n = 0; n < d_nchannels_out; n++)
                 {
-                    Gnss_Synchro interpolated_gnss_synchro{};
-                    if (!interp_trk_obs(interpolated_gnss_synchro, n, d_Rx_clock_buffer.front()))
-                        {
-                            // Produce an empty observation
-                            interpolated_gnss_synchro = Gnss_Synchro();
-                            interpolated_gnss_synchro.Flag_valid_pseudorange = false;
-                            interpolated_gnss_synchro.Flag_valid_word = false;
-                            interpolated_gnss_synchro.Flag_valid_acquisition = false;
-                            interpolated_gnss_synchro.fs = 0;
-                            interpolated_gnss_synchro.Channel_ID = n;
-                        }
-                    else
-                        {
-                            n_valid++;
-                        }
-                    epoch_data[n] = interpolated_gnss_synchro;
+                    // Produce an empty observation unless the channel can be interpolated
+                    epoch_data[n] = Gnss_Synchro();
+                    epoch_data[n].Flag_valid_pseudorange = false;
+                    epoch_data[n].Flag_valid_word = false;
+                    epoch_data[n].Flag_valid_acquisition = false;
+                    epoch_data[n].fs = 0;
+                    epoch_data[n].Channel_ID = n;
                 }
+            const int32_t n_valid = d_gnss_synchro_history->interpolate(d_Rx_clock_buffer.front(), epoch_data);
 
             if (d_T_rx_TOW_set)
                 {
@@ -699,11 +626,26 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                 {
                     smooth_pseudoranges(epoch_data);
                 }
-            // output the observables set to the PVT block
+            // output the observables set: every epoch on the raw ports, if connected, and only
+            // the epochs at the PVT interval on the PVT ports
+            const bool raw_ports = output_items.size() > d_nchannels_out;
+            const bool pvt_epoch = n_valid > 0 and d_T_rx_TOW_ms % d_T_rx_pvt_step_ms == 0;
             for (uint32_t n = 0; n < d_nchannels_out; n++)
                 {
-                    out[n][0] = epoch_data[n];
+                    if (pvt_epoch)
+                        {
+                            out[n][0] = epoch_data[n];
+                            produce(n, 1);
+                        }
+                    if (raw_ports and n_valid > 0)
+                        {
+                            out[d_nchannels_out + n][0] = epoch_data[n];
+                            produce(d_nchannels_out + n, 1);
+                        }
                 }
+            // the epoch must not allocate memory once the buffers have reached their size (only counted in Debug builds)
+            check_epoch_allocations(gnss_sdr_thread_allocations() - allocations_at_start);
+
             // report channel status every second
             d_T_status_report_timer_ms += d_T_rx_step_ms;
             if (d_T_status_report_timer_ms >= 1000)
@@ -725,19 +667,19 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                             double tmp_double;
                             for (uint32_t i = 0; i < d_nchannels_out; i++)
                                 {
-                                    tmp_double = out[i][0].RX_time;
+                                    tmp_double = epoch_data[i].RX_time;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].interp_TOW_ms / 1000.0;
+                                    tmp_double = epoch_data[i].interp_TOW_ms / 1000.0;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_Doppler_hz;
+                                    tmp_double = epoch_data[i].Carrier_Doppler_hz;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_phase_rads / GPS_TWO_PI;
+                                    tmp_double = epoch_data[i].Carrier_phase_rads / GPS_TWO_PI;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Pseudorange_m;
+                                    tmp_double = epoch_data[i].Pseudorange_m;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].PRN);
+                                    tmp_double = static_cast<double>(epoch_data[i].PRN);
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].Flag_valid_pseudorange);
+                                    tmp_double = static_cast<double>(epoch_data[i].Flag_valid_pseudorange);
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
                                 }
                         }
@@ -747,13 +689,6 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                             d_dump = false;
                         }
                 }
-
-            if (n_valid > 0)
-                {
-                    // LOG(INFO) << "OBS: diff time: " << out[0][0].RX_time * 1000.0 - old_time_debug;
-                    // old_time_debug = out[0][0].RX_time * 1000.0;
-                    return 1;
-                }
         }
-    return 0;
+    return WORK_CALLED_PRODUCE;
 }
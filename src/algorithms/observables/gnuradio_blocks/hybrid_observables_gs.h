@@ -23,6 +23,7 @@
 #ifndef GNSS_SDR_HYBRID_OBSERVABLES_GS_H
 #define GNSS_SDR_HYBRID_OBSERVABLES_GS_H
 
+#include "gnss_synchro.h"
 #include "obs_conf.h"
 #include <boost/circular_buffer.hpp>  // for boost::circular_buffer
 #include <gnuradio/block.h>           // for block
@@ -38,11 +39,8 @@
 #include <boost/shared_ptr.hpp>
 #endif
 
-class Gnss_Synchro;
 class hybrid_observables_gs;
-
-template <class T>
-class Gnss_circular_deque;
+class Trk_Obs_History;
 
 #if GNURADIO_USES_STD_POINTERS
 using hybrid_observables_gs_sptr = std::shared_ptr<hybrid_observables_gs>;
@@ -54,6 +52,11 @@ hybrid_observables_gs_sptr hybrid_observables_gs_make(const Obs_Conf& conf_);
 
 /*!
  * \brief This class implements a block that computes observables
+ *
+ * Output ports 0 to nchannels_out - 1 carry the epochs sent to PVT, one every
+ * pvt_interval_ms. The optional ports nchannels_out to 2 * nchannels_out - 1
+ * carry every epoch, one every observable_interval_ms, for the consumers that
+ * need the raw measurement rate.
  */
 class hybrid_observables_gs : public gr::block
 {
@@ -70,10 +73,10 @@ private:
 
     void msg_handler_pvt_to_observables(const pmt::pmt_t& msg);
     double compute_T_rx_s(const Gnss_Synchro& a) const;
-    bool interp_trk_obs(Gnss_Synchro& interpolated_obs, uint32_t ch, uint64_t rx_clock) const;
     void update_TOW(const std::vector<Gnss_Synchro>& data);
     void compute_pranges(std::vector<Gnss_Synchro>& data) const;
     void smooth_pseudoranges(std::vector<Gnss_Synchro>& data);
+    void check_epoch_allocations(uint64_t allocations);
     int32_t save_matfile() const;
 
     Obs_Conf d_conf;
@@ -94,10 +97,12 @@ private:
     };
     std::map<std::string, StringValue_> d_mapStringValues;
 
-    std::unique_ptr<Gnss_circular_deque<Gnss_Synchro>> d_gnss_synchro_history;  // Tracking observable history
+    std::unique_ptr<Trk_Obs_History> d_gnss_synchro_history;  // Tracking observable history
 
     boost::circular_buffer<uint64_t> d_Rx_clock_buffer;  // time history
 
+    std::vector<Gnss_Synchro> d_epoch_data;  // observables of the current epoch, indexed by channel
+
     std::vector<bool> d_channel_last_pll_lock;
     std::vector<double> d_channel_last_pseudorange_smooth;
     std::vector<double> d_channel_last_carrier_phase_rads;
@@ -108,8 +113,13 @@ private:
 
     double d_smooth_filter_M;
 
+    uint64_t d_epoch_counter;
+    uint64_t d_epochs_to_steady_state;
+    uint64_t d_steady_state_allocations;
+
     uint32_t d_T_rx_TOW_ms;
     uint32_t d_T_rx_step_ms;
+    uint32_t d_T_rx_pvt_step_ms;
     uint32_t d_T_status_report_timer_ms;
     uint32_t d_nchannels_in;
     uint32_t d_nchannels_out;
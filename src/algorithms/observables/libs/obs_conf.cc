@@ -25,6 +25,9 @@ Obs_Conf::Obs_Conf()
 {
     dump_filename = "obs_dump.dat";
     smoothing_factor = FLAGS_carrier_smoothing_factor;
+    history_depth_ms = 1000;
+    observable_interval_ms = 20;
+    pvt_interval_ms = 20;
     nchannels_in = 0;
     nchannels_out = 0;
     enable_carrier_smoothing = false;
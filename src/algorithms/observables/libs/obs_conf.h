@@ -31,6 +31,9 @@ public:
 
     std::string dump_filename;
     int32_t smoothing_factor;
+    uint32_t history_depth_ms;
+    uint32_t observable_interval_ms;
+    uint32_t pvt_interval_ms;
     uint32_t nchannels_in;
     uint32_t nchannels_out;
     bool enable_carrier_smoothing;
@@ -0,0 +1,260 @@
+/*!
+ * \file trk_obs_history.cc
+ * \brief Per-channel history of tracking observables, stored as columns of
+ * the fields used by the interpolation at the receiver clock
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "trk_obs_history.h"
+#include <algorithm>  // for std::lower_bound, std::min
+#include <cstdlib>    // for llabs
+
+
+Trk_Obs_History::Trk_Obs_History(uint32_t depth_ms, uint32_t nchann)
+{
+    reset(depth_ms, nchann);
+}
+
+
+void Trk_Obs_History::reset(uint32_t depth_ms, uint32_t nchann)
+{
+    d_depth_ms = depth_ms;
+    d_channels = std::vector<Channel_History>(nchann);
+    d_interp_channel = std::vector<uint32_t>(nchann);
+    d_interp_nearest = std::vector<uint32_t>(nchann);
+    d_interp_t_rx = std::vector<double>(nchann);
+    d_interp_t1 = std::vector<double>(nchann);
+    d_interp_t2 = std::vector<double>(nchann);
+    d_interp_phase1 = std::vector<double>(nchann);
+    d_interp_phase2 = std::vector<double>(nchann);
+    d_interp_doppler1 = std::vector<double>(nchann);
+    d_interp_doppler2 = std::vector<double>(nchann);
+    d_interp_tow1 = std::vector<double>(nchann);
+    d_interp_tow2 = std::vector<double>(nchann);
+}
+
+
+void Trk_Obs_History::push_back(uint32_t ch, const Gnss_Synchro& obs, double rx_time)
+{
+    auto& history = d_channels[ch];
+    if (!empty(ch) and obs.Tracking_sample_counter < history.sample_counter.back())
+        {
+            clear(ch);
+        }
+    history.sample_counter.push_back(obs.Tracking_sample_counter);
+    history.rx_time.push_back(rx_time);
+    history.carrier_phase_rads.push_back(obs.Carrier_phase_rads);
+    history.carrier_doppler_hz.push_back(obs.Carrier_Doppler_hz);
+    history.cn0_db_hz.push_back(obs.CN0_dB_hz);
+    history.code_phase_samples.push_back(obs.Code_phase_samples);
+    history.tow_ms.push_back(obs.TOW_at_current_symbol_ms);
+    history.prompt_i.push_back(obs.Prompt_I);
+    history.prompt_q.push_back(obs.Prompt_Q);
+    history.correlation_length_ms.push_back(obs.correlation_length_ms);
+    history.flag_valid_symbol_output.push_back(obs.Flag_valid_symbol_output);
+    history.flag_valid_word.push_back(obs.Flag_valid_word);
+    history.last = obs;
+    history.last.RX_time = rx_time;
+
+    // discard the observables older than the depth of the history
+    const uint64_t depth_samples = static_cast<uint64_t>(std::max<int64_t>(obs.fs, 0)) * d_depth_ms / 1000U;
+    size_t n_old = 0;
+    while (history.head + n_old < history.sample_counter.size() and history.sample_counter[history.head + n_old] + depth_samples < obs.Tracking_sample_counter)
+        {
+            n_old++;
+        }
+    pop_front(history, n_old);
+}
+
+
+void Trk_Obs_History::pop_front(Channel_History& history, size_t n)
+{
+    history.head += n;
+    history.cursor -= std::min(history.cursor, static_cast<uint32_t>(n));
+    // the discarded observables are moved out at once when they take up half of the columns
+    if (history.head > 0 and history.head >= history.sample_counter.size() / 2)
+        {
+            const auto first = static_cast<std::ptrdiff_t>(history.head);
+            history.sample_counter.erase(history.sample_counter.begin(), history.sample_counter.begin() + first);
+            history.rx_time.erase(history.rx_time.begin(), history.rx_time.begin() + first);
+            history.carrier_phase_rads.erase(history.carrier_phase_rads.begin(), history.carrier_phase_rads.begin() + first);
+            history.carrier_doppler_hz.erase(history.carrier_doppler_hz.begin(), history.carrier_doppler_hz.begin() + first);
+            history.cn0_db_hz.erase(history.cn0_db_hz.begin(), history.cn0_db_hz.begin() + first);
+            history.code_phase_samples.erase(history.code_phase_samples.begin(), history.code_phase_samples.begin() + first);
+            history.tow_ms.erase(history.tow_ms.begin(), history.tow_ms.begin() + first);
+            history.prompt_i.erase(history.prompt_i.begin(), history.prompt_i.begin() + first);
+            history.prompt_q.erase(history.prompt_q.begin(), history.prompt_q.begin() + first);
+            history.correlation_length_ms.erase(history.correlation_length_ms.begin(), history.correlation_length_ms.begin() + first);
+            history.flag_valid_symbol_output.erase(history.flag_valid_symbol_output.begin(), history.flag_valid_symbol_output.begin() + first);
+            history.flag_valid_word.erase(history.flag_valid_word.begin(), history.flag_valid_word.begin() + first);
+            history.head = 0;
+        }
+}
+
+
+void Trk_Obs_History::clear(uint32_t ch)
+{
+    auto& history = d_channels[ch];
+    history.sample_counter.clear();
+    history.rx_time.clear();
+    history.carrier_phase_rads.clear();
+    history.carrier_doppler_hz.clear();
+    history.cn0_db_hz.clear();
+    history.code_phase_samples.clear();
+    history.tow_ms.clear();
+    history.prompt_i.clear();
+    history.prompt_q.clear();
+    history.correlation_length_ms.clear();
+    history.flag_valid_symbol_output.clear();
+    history.flag_valid_word.clear();
+    history.head = 0;
+    history.cursor = 0;
+}
+
+
+uint32_t Trk_Obs_History::lower_bound(uint32_t ch, uint64_t rx_clock)
+{
+    const uint64_t* counter = sample_counter(ch);
+    const uint32_t size = this->size(ch);
+    uint32_t cursor = std::min(d_channels[ch].cursor, size);
+    if (cursor > 0 and counter[cursor - 1] >= rx_clock)
+        {
+            // the receiver clock went back: binary search before the cursor
+            cursor = static_cast<uint32_t>(std::lower_bound(counter, counter + cursor, rx_clock) - counter);
+        }
+    else
+        {
+            while (cursor < size and counter[cursor] < rx_clock)
+                {
+                    cursor++;
+                }
+        }
+    d_channels[ch].cursor = cursor;
+    return cursor;
+}
+
+
+int32_t Trk_Obs_History::nearest(uint32_t ch, uint64_t rx_clock)
+{
+    const uint32_t size = this->size(ch);
+    if (size == 0)
+        {
+            return -1;
+        }
+    const uint32_t upper = lower_bound(ch, rx_clock);
+    if (upper == 0)
+        {
+            return 0;
+        }
+    if (upper == size)
+        {
+            return static_cast<int32_t>(size - 1);
+        }
+    // the observables before upper are older than rx_clock, the others are not
+    const uint64_t* counter = sample_counter(ch);
+    const uint64_t diff_before = rx_clock - counter[upper - 1];
+    const uint64_t diff_after = counter[upper] - rx_clock;
+    return static_cast<int32_t>(diff_before <= diff_after ? upper - 1 : upper);
+}
+
+
+int32_t Trk_Obs_History::interpolate(uint64_t rx_clock, std::vector<Gnss_Synchro>& epoch_data)
+{
+    // 1st: gather the two observables around rx_clock of each channel
+    int32_t n_interp = 0;
+    for (uint32_t ch = 0; ch < static_cast<uint32_t>(d_channels.size()); ch++)
+        {
+            const int32_t nearest_element = nearest(ch, rx_clock);
+            if (nearest_element == -1)
+                {
+                    continue;
+                }
+            const auto& history = d_channels[ch];
+            const size_t nearest_pos = history.head + nearest_element;
+            const int64_t abs_diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(history.sample_counter[nearest_pos]));
+            if ((static_cast<double>(abs_diff) / static_cast<double>(history.last.fs)) >= 0.02)
+                {
+                    continue;
+                }
+            const int32_t neighbor_element = rx_clock > history.sample_counter[nearest_pos] ? nearest_element + 1 : nearest_element - 1;
+            if (neighbor_element >= static_cast<int32_t>(size(ch)) or neighbor_element < 0)
+                {
+                    continue;
+                }
+            const size_t t1 = history.head + std::min(nearest_element, neighbor_element);
+            const size_t t2 = history.head + std::max(nearest_element, neighbor_element);
+            d_interp_channel[n_interp] = ch;
+            d_interp_nearest[n_interp] = static_cast<uint32_t>(nearest_element);
+            d_interp_t_rx[n_interp] = static_cast<double>(rx_clock) / static_cast<double>(history.last.fs);
+            d_interp_t1[n_interp] = history.rx_time[t1];
+            d_interp_t2[n_interp] = history.rx_time[t2];
+            d_interp_phase1[n_interp] = history.carrier_phase_rads[t1];
+            d_interp_phase2[n_interp] = history.carrier_phase_rads[t2];
+            d_interp_doppler1[n_interp] = history.carrier_doppler_hz[t1];
+            d_interp_doppler2[n_interp] = history.carrier_doppler_hz[t2];
+            d_interp_tow1[n_interp] = static_cast<double>(history.tow_ms[t1]);
+            // check TOW rollover
+            if ((history.tow_ms[t2] - history.tow_ms[t1]) > 0)
+                {
+                    d_interp_tow2[n_interp] = static_cast<double>(history.tow_ms[t2]);
+                }
+            else
+                {
+                    d_interp_tow2[n_interp] = static_cast<double>(history.tow_ms[t2] + 604800000);
+                }
+            n_interp++;
+        }
+
+    // 2nd: Linear interpolation of all the channels: y(t) = y(t1) + (y(t2) - y(t1)) * (t - t1) / (t2 - t1)
+    for (int32_t i = 0; i < n_interp; i++)
+        {
+            const double time_factor = (d_interp_t_rx[i] - d_interp_t1[i]) / (d_interp_t2[i] - d_interp_t1[i]);
+            d_interp_phase1[i] += (d_interp_phase2[i] - d_interp_phase1[i]) * time_factor;
+            d_interp_doppler1[i] += (d_interp_doppler2[i] - d_interp_doppler1[i]) * time_factor;
+            d_interp_tow1[i] += (d_interp_tow2[i] - d_interp_tow1[i]) * time_factor;
+        }
+
+    // 3rd: copy the nearest observable of each channel, with the interpolated values
+    for (int32_t i = 0; i < n_interp; i++)
+        {
+            Gnss_Synchro& interpolated_obs = epoch_data[d_interp_channel[i]];
+            interpolated_obs = get(d_interp_channel[i], d_interp_nearest[i]);
+            interpolated_obs.Carrier_phase_rads = d_interp_phase1[i];
+            interpolated_obs.Carrier_Doppler_hz = d_interp_doppler1[i];
+            interpolated_obs.interp_TOW_ms = d_interp_tow1[i];
+        }
+    return n_interp;
+}
+
+
+Gnss_Synchro Trk_Obs_History::get(uint32_t ch, uint32_t pos) const
+{
+    const auto& history = d_channels[ch];
+    const size_t i = history.head + pos;
+    Gnss_Synchro obs = history.last;
+    obs.Tracking_sample_counter = history.sample_counter[i];
+    obs.RX_time = history.rx_time[i];
+    obs.Carrier_phase_rads = history.carrier_phase_rads[i];
+    obs.Carrier_Doppler_hz = history.carrier_doppler_hz[i];
+    obs.CN0_dB_hz = history.cn0_db_hz[i];
+    obs.Code_phase_samples = history.code_phase_samples[i];
+    obs.TOW_at_current_symbol_ms = history.tow_ms[i];
+    obs.Prompt_I = history.prompt_i[i];
+    obs.Prompt_Q = history.prompt_q[i];
+    obs.correlation_length_ms = history.correlation_length_ms[i];
+    obs.Flag_valid_symbol_output = history.flag_valid_symbol_output[i];
+    obs.Flag_valid_word = history.flag_valid_word[i];
+    return obs;
+}
@@ -0,0 +1,142 @@
+/*!
+ * \file trk_obs_history.h
+ * \brief Per-channel history of tracking observables, stored as columns of
+ * the fields used by the interpolation at the receiver clock
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TRK_OBS_HISTORY_H
+#define GNSS_SDR_TRK_OBS_HISTORY_H
+
+#include "gnss_synchro.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*!
+ * \brief History of the last tracking observables of each channel.
+ *
+ * Only the fields set by the tracking and telemetry blocks for each
+ * observable are stored, each one in its own contiguous column (structure of
+ * arrays). The other fields (satellite, signal, channel, sampling frequency,
+ * acquisition) are set once per track and are taken from the newest
+ * observable of the channel; the ones set by the Observables block are not
+ * kept.
+ *
+ * The depth of the history is set in time: observables older than depth_ms
+ * with respect to the newest one of the channel are discarded, whatever the
+ * integration time of the tracking loop.
+ *
+ * The observables of a channel are kept in increasing order of
+ * Tracking_sample_counter. The receiver clock at which they are interpolated
+ * also increases from one epoch to the next, so each channel remembers where
+ * the previous lookup ended and lower_bound() only walks over the observables
+ * received since then, which is amortized O(1) per epoch. A receiver clock
+ * going backwards falls back to a binary search.
+ */
+class Trk_Obs_History
+{
+public:
+    Trk_Obs_History() = default;
+    Trk_Obs_History(uint32_t depth_ms, uint32_t nchann);  //!< nchann = number of channels; depth_ms = time span of the history of each channel
+
+    void reset(uint32_t depth_ms, uint32_t nchann);  //!< Removes all the elements and re-sets the number of channels and the depth
+
+    /*!
+     * \brief Appends an observable to the history of channel ch, with its
+     * receive time rx_time in seconds, and discards the observables older
+     * than the depth of the history. An observable older than the last one
+     * in the history restarts it, so that the history stays ordered.
+     */
+    void push_back(uint32_t ch, const Gnss_Synchro& obs, double rx_time);
+
+    void clear(uint32_t ch);  //!< Removes all the elements of channel ch
+
+    /*!
+     * \brief Index of the first observable of channel ch whose
+     * Tracking_sample_counter is not less than rx_clock, or size(ch) if
+     * there is none.
+     */
+    uint32_t lower_bound(uint32_t ch, uint64_t rx_clock);
+
+    /*!
+     * \brief Index of the observable of channel ch nearest to rx_clock (the
+     * older one in case of a tie), or -1 if the history is empty.
+     */
+    int32_t nearest(uint32_t ch, uint64_t rx_clock);
+
+    /*!
+     * \brief Interpolates the carrier phase, Doppler and TOW of every channel
+     * at the receiver clock rx_clock, between the two observables around it.
+     * Channels with no observable less than 20 ms away from rx_clock, or
+     * with no neighbor on the other side, are left untouched in epoch_data.
+     * Returns the number of interpolated channels.
+     */
+    int32_t interpolate(uint64_t rx_clock, std::vector<Gnss_Synchro>& epoch_data);
+
+    //! Observable at position pos of channel ch, 0 being the oldest one
+    Gnss_Synchro get(uint32_t ch, uint32_t pos) const;
+
+    inline uint32_t size(uint32_t ch) const { return static_cast<uint32_t>(d_channels[ch].sample_counter.size() - d_channels[ch].head); }
+    inline bool empty(uint32_t ch) const { return size(ch) == 0; }
+
+    //! Newest observable received by channel ch, including the fields not stored in the history
+    inline const Gnss_Synchro& last(uint32_t ch) const { return d_channels[ch].last; }
+
+    //! Sample counters of the observables of channel ch, oldest first
+    inline const uint64_t* sample_counter(uint32_t ch) const { return d_channels[ch].sample_counter.data() + d_channels[ch].head; }
+
+private:
+    struct Channel_History
+    {
+        // one element per observable, head being the position of the oldest one
+        std::vector<uint64_t> sample_counter;
+        std::vector<double> rx_time;
+        std::vector<double> carrier_phase_rads;
+        std::vector<double> carrier_doppler_hz;
+        std::vector<double> cn0_db_hz;
+        std::vector<double> code_phase_samples;
+        std::vector<uint32_t> tow_ms;
+        std::vector<double> prompt_i;
+        std::vector<double> prompt_q;
+        std::vector<int32_t> correlation_length_ms;
+        std::vector<bool> flag_valid_symbol_output;
+        std::vector<bool> flag_valid_word;
+        size_t head{0};
+        Gnss_Synchro last{};
+        uint32_t cursor{0};  // result of the last lower_bound()
+    };
+
+    void pop_front(Channel_History& history, size_t n);
+
+    std::vector<Channel_History> d_channels;
+
+    // observables around the receiver clock, gathered by interpolate() for each channel
+    std::vector<uint32_t> d_interp_channel;
+    std::vector<uint32_t> d_interp_nearest;
+    std::vector<double> d_interp_t_rx;
+    std::vector<double> d_interp_t1;
+    std::vector<double> d_interp_t2;
+    std::vector<double> d_interp_phase1;
+    std::vector<double> d_interp_phase2;
+    std::vector<double> d_interp_doppler1;
+    std::vector<double> d_interp_doppler2;
+    std::vector<double> d_interp_tow1;
+    std::vector<double> d_interp_tow2;
+
+    uint32_t d_depth_ms{0};
+};
+
+#endif  // GNSS_SDR_TRK_OBS_HISTORY_H
@@ -38,6 +38,15 @@
 
 #define CRC_ERROR_LIMIT 8
 
+namespace
+{
+// Hard decision on a symbol, taking into account an inverted carrier phase
+inline int32_t symbol_to_bit(float symbol, bool inverted_polarity)
+{
+    return (inverted_polarity ? (symbol < 0) : (symbol > 0)) ? 1 : -1;
+}
+}  // namespace
+
 
 beidou_b1i_telemetry_decoder_gs_sptr
 beidou_b1i_make_telemetry_decoder_gs(const Gnss_Satellite &satellite, bool dump)
@@ -80,6 +89,8 @@ beidou_b1i_telemetry_decoder_gs::beidou_b1i_telemetry_decoder_gs(
                 }
         }
 
+    d_preamble_detector = Preamble_Detector(d_preamble_samples.data(), d_samples_per_preamble);
+
     d_required_symbols = BEIDOU_DNAV_SUBFRAME_SYMBOLS + d_samples_per_preamble;
     d_symbol_history.set_capacity(d_required_symbols);
 
@@ -157,6 +168,7 @@ void beidou_b1i_telemetry_decoder_gs::decode_bch15_11_01(const int32_t *bits, st
 void beidou_b1i_telemetry_decoder_gs::decode_word(
     int32_t word_counter,
     const float *enc_word_symbols,
+    bool inverted_polarity,
     int32_t *dec_word_symbols)
 {
     std::array<int32_t, 30> bitsbch{};
@@ -167,7 +179,7 @@ void beidou_b1i_telemetry_decoder_gs::decode_word(
         {
             for (uint32_t j = 0; j < 30; j++)
                 {
-                    dec_word_symbols[j] = static_cast<int32_t>(enc_word_symbols[j] > 0) ? (1) : (-1);
+                    dec_word_symbols[j] = symbol_to_bit(enc_word_symbols[j], inverted_polarity);
                 }
         }
     else
@@ -176,7 +188,7 @@ void beidou_b1i_telemetry_decoder_gs::decode_word(
                 {
                     for (uint32_t c = 0; c < 15; c++)
                         {
-                            bitsbch[r * 15 + c] = static_cast<int32_t>(enc_word_symbols[c * 2 + r] > 0) ? (1) : (-1);
+                            bitsbch[r * 15 + c] = symbol_to_bit(enc_word_symbols[c * 2 + r], inverted_polarity);
                         }
                 }
 
@@ -198,22 +210,22 @@ void beidou_b1i_telemetry_decoder_gs::decode_word(
 }
 
 
-void beidou_b1i_telemetry_decoder_gs::decode_subframe(float *frame_symbols)
+void beidou_b1i_telemetry_decoder_gs::decode_subframe(own::span<const float> frame_symbols, bool inverted_polarity)
 {
     // 1. Transform from symbols to bits
-    std::string data_bits;
+    Nav_Message_Bits<BEIDOU_DNAV_SUBFRAME_DATA_BITS> data_bits;
     std::array<int32_t, 30> dec_word_bits{};
 
     // Decode each word in subframe
     for (uint32_t ii = 0; ii < BEIDOU_DNAV_WORDS_SUBFRAME; ii++)
         {
             // decode the word
-            decode_word((ii + 1), &frame_symbols[ii * 30], dec_word_bits.data());
+            decode_word((ii + 1), frame_symbols.data() + ii * 30, inverted_polarity, dec_word_bits.data());
 
-            // Save word to string format
+            // Save word to the packed subframe
             for (uint32_t jj = 0; jj < (BEIDOU_DNAV_WORD_LENGTH_BITS); jj++)
                 {
-                    data_bits.push_back((dec_word_bits[jj] > 0) ? ('1') : ('0'));
+                    data_bits.set(static_cast<int32_t>(ii * BEIDOU_DNAV_WORD_LENGTH_BITS + jj + 1), dec_word_bits[jj] > 0);
                 }
         }
 
@@ -383,7 +395,17 @@ int beidou_b1i_telemetry_decoder_gs::general_work(int noutput_items __attribute_
     Gnss_Synchro current_symbol{};  // structure to save the synchronization information and send the output object to the next block
     // 1. Copy the current tracking output
     current_symbol = in[0][0];
+    const bool history_full = d_symbol_history.full();
     d_symbol_history.push_back(current_symbol.Prompt_I);  // add new symbol to the symbol queue
+    // the preamble is correlated with the oldest symbols of the queue
+    if (history_full)
+        {
+            d_preamble_detector.push(d_symbol_history[d_samples_per_preamble - 1]);
+        }
+    else if (d_symbol_history.size() <= static_cast<uint32_t>(d_samples_per_preamble))
+        {
+            d_preamble_detector.push(current_symbol.Prompt_I);
+        }
     d_sample_counter++;                                   // count for the processed samples
     consume_each(1);
     d_flag_preamble = false;
@@ -391,17 +413,7 @@ int beidou_b1i_telemetry_decoder_gs::general_work(int noutput_items __attribute_
     if (d_symbol_history.size() >= d_required_symbols)
         {
             // ******* preamble correlation ********
-            for (int32_t i = 0; i < d_samples_per_preamble; i++)
-                {
-                    if (d_symbol_history[i] < 0)  // symbols clipping
-                        {
-                            corr_value -= d_preamble_samples[i];
-                        }
-                    else
-                        {
-                            corr_value += d_preamble_samples[i];
-                        }
-                }
+            corr_value = d_preamble_detector.correlation();
         }
     // ******* frame sync ******************
     if (d_stat == 0)  // no preamble information
@@ -431,23 +443,9 @@ int beidou_b1i_telemetry_decoder_gs::general_work(int noutput_items __attribute_
                             d_stat = 2;
 
                             // ******* SAMPLES TO SYMBOLS *******
-                            if (corr_value > 0)  // normal PLL lock
-                                {
-                                    for (uint32_t i = 0; i < BEIDOU_DNAV_PREAMBLE_PERIOD_SYMBOLS; i++)
-                                        {
-                                            d_subframe_symbols[i] = d_symbol_history[i];
-                                        }
-                                }
-                            else  // 180 deg. inverted carrier phase PLL lock
-                                {
-                                    for (uint32_t i = 0; i < BEIDOU_DNAV_PREAMBLE_PERIOD_SYMBOLS; i++)
-                                        {
-                                            d_subframe_symbols[i] = -d_symbol_history[i];
-                                        }
-                                }
-
-                            // call the decoder
-                            decode_subframe(d_subframe_symbols.data());
+                            // the subframe symbols are read in place in the history, and inverted
+                            // if the carrier phase PLL is locked at 180 deg. (non-positive correlation)
+                            decode_subframe(d_symbol_history.span(0, BEIDOU_DNAV_PREAMBLE_PERIOD_SYMBOLS), corr_value <= 0);
 
                             if (d_nav.get_flag_CRC_test() == true)
                                 {
@@ -488,23 +486,9 @@ int beidou_b1i_telemetry_decoder_gs::general_work(int noutput_items __attribute_
             if (d_sample_counter == d_preamble_index + static_cast<uint64_t>(d_preamble_period_samples))
                 {
                     // ******* SAMPLES TO SYMBOLS *******
-                    if (corr_value > 0)  // normal PLL lock
-                        {
-                            for (uint32_t i = 0; i < BEIDOU_DNAV_PREAMBLE_PERIOD_SYMBOLS; i++)
-                                {
-                                    d_subframe_symbols[i] = d_symbol_history[i];
-                                }
-                        }
-                    else  // 180 deg. inverted carrier phase PLL lock
-                        {
-                            for (uint32_t i = 0; i < BEIDOU_DNAV_PREAMBLE_PERIOD_SYMBOLS; i++)
-                                {
-                                    d_subframe_symbols[i] = -d_symbol_history[i];
-                                }
-                        }
-
-                    // call the decoder
-                    decode_subframe(d_subframe_symbols.data());
+                    // the subframe symbols are read in place in the history, and inverted
+                    // if the carrier phase PLL is locked at 180 deg. (non-positive correlation)
+                    decode_subframe(d_symbol_history.span(0, BEIDOU_DNAV_PREAMBLE_PERIOD_SYMBOLS), corr_value <= 0);
 
                     if (d_nav.get_flag_CRC_test() == true)
                         {
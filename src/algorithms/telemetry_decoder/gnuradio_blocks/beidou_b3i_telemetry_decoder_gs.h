@@ -22,7 +22,8 @@
 
 #include "beidou_dnav_navigation_message.h"
 #include "gnss_satellite.h"
-#include <boost/circular_buffer.hpp>
+#include "preamble_detector.h"
+#include "symbol_ring.h"
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>
@@ -74,17 +75,17 @@ private:
 
     beidou_b3i_telemetry_decoder_gs(const Gnss_Satellite &satellite, bool dump);
 
-    void decode_subframe(float *symbols);
+    void decode_subframe(own::span<const float> symbols, bool inverted_polarity);
     void decode_word(int32_t word_counter, const float *enc_word_symbols,
-        int32_t *dec_word_symbols);
+        bool inverted_polarity, int32_t *dec_word_symbols);
     void decode_bch15_11_01(const int32_t *bits, std::array<int32_t, 15> &decbits);
 
     // Preamble decoding
     std::array<int32_t, BEIDOU_DNAV_PREAMBLE_LENGTH_SYMBOLS> d_preamble_samples{};
-    std::array<float, BEIDOU_DNAV_PREAMBLE_PERIOD_SYMBOLS> d_subframe_symbols{};
+    Preamble_Detector d_preamble_detector;
 
     // Storage for incoming data
-    boost::circular_buffer<float> d_symbol_history;
+    Symbol_Ring<float> d_symbol_history;
 
     // Navigation Message variable
     Beidou_Dnav_Navigation_Message d_nav;
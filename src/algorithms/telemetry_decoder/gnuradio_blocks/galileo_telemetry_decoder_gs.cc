@@ -21,13 +21,13 @@
 #include "galileo_telemetry_decoder_gs.h"
 #include "Galileo_E1.h"   // for GALILEO_E1_CODE_PERIOD_MS
 #include "Galileo_E5a.h"  // for GALILEO_E5A_CODE_PERIO...
-#include "convolutional.h"
 #include "display.h"
 #include "galileo_almanac_helper.h"  // for Galileo_Almanac_Helper
 #include "galileo_ephemeris.h"       // for Galileo_Ephemeris
 #include "galileo_iono.h"            // for Galileo_Iono
 #include "galileo_utc_model.h"       // for Galileo_Utc_Model
 #include "gnss_synchro.h"
+#include "viterbi_decoder.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
@@ -80,7 +80,7 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
                 d_preamble_period_symbols = GALILEO_INAV_PREAMBLE_PERIOD_SYMBOLS;
                 d_required_symbols = static_cast<uint32_t>(GALILEO_INAV_PAGE_SYMBOLS) + d_samples_per_preamble;
                 // preamble bits to sampled symbols
-                d_preamble_samples.reserve(d_samples_per_preamble);
+                d_preamble_samples.resize(d_samples_per_preamble);
                 d_frame_length_symbols = GALILEO_INAV_PAGE_PART_SYMBOLS - GALILEO_INAV_PREAMBLE_LENGTH_BITS;
                 d_codelength = GALILEO_INAV_PAGE_PART_SYMBOLS - GALILEO_INAV_PREAMBLE_LENGTH_BITS;
                 d_datalength = (d_codelength / d_nn) - d_mm;
@@ -97,7 +97,7 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
                 d_preamble_period_symbols = GALILEO_FNAV_SYMBOLS_PER_PAGE;
                 d_required_symbols = static_cast<uint32_t>(GALILEO_FNAV_SYMBOLS_PER_PAGE) + d_samples_per_preamble;
                 // preamble bits to sampled symbols
-                d_preamble_samples.reserve(d_samples_per_preamble);
+                d_preamble_samples.resize(d_samples_per_preamble);
                 d_frame_length_symbols = GALILEO_FNAV_SYMBOLS_PER_PAGE - GALILEO_FNAV_PREAMBLE_LENGTH_BITS;
                 d_codelength = GALILEO_FNAV_SYMBOLS_PER_PAGE - GALILEO_FNAV_PREAMBLE_LENGTH_BITS;
                 d_datalength = (d_codelength / d_nn) - d_mm;
@@ -117,7 +117,6 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
             std::cout << "Galileo unified telemetry decoder error: Unknown frame type " << std::endl;
         }
 
-    d_page_part_symbols.reserve(d_frame_length_symbols);
     for (int32_t i = 0; i < d_bits_per_preamble; i++)
         {
             switch (d_frame_type)
@@ -148,6 +147,7 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
                     }
                 }
         }
+    d_preamble_detector = Preamble_Detector(d_preamble_samples.data(), d_samples_per_preamble);
     d_sample_counter = 0ULL;
     d_stat = 0;
     d_preamble_index = 0ULL;
@@ -165,17 +165,11 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
     d_flag_PLL_180_deg_phase_locked = false;
     d_symbol_history.set_capacity(d_required_symbols + 1);
 
-    // vars for Viterbi decoder
-    int32_t max_states = 1U << static_cast<uint32_t>(d_mm);  // 2^d_mm
-    std::array<int32_t, 2> g_encoder{{121, 91}};             // Polynomial G1 and G2
-    d_out0.reserve(max_states);
-    d_out1.reserve(max_states);
-    d_state0.reserve(max_states);
-    d_state1.reserve(max_states);
-
-    // create appropriate transition matrices
-    nsc_transit(d_out0.data(), d_state0.data(), 0, g_encoder.data(), d_KK, d_nn);
-    nsc_transit(d_out1.data(), d_state1.data(), 1, g_encoder.data(), d_KK, d_nn);
+    // Viterbi decoder and page buffers, allocated once
+    const std::array<int32_t, 2> g_encoder{{121, 91}};  // Polynomial G1 and G2
+    d_viterbi = std::make_shared<Viterbi_Decoder>(g_encoder, d_datalength + d_mm);
+    d_page_symbols_deint.resize(d_frame_length_symbols);
+    d_page_bits.resize(d_frame_length_symbols / d_nn);
 }
 
 
@@ -196,13 +190,6 @@ galileo_telemetry_decoder_gs::~galileo_telemetry_decoder_gs()
 }
 
 
-void galileo_telemetry_decoder_gs::viterbi_decoder(float *page_part_symbols, int32_t *page_part_bits)
-{
-    Viterbi(page_part_bits, d_out0.data(), d_state0.data(), d_out1.data(), d_state1.data(),
-        page_part_symbols, d_KK, d_nn, d_datalength);
-}
-
-
 void galileo_telemetry_decoder_gs::deinterleaver(int32_t rows, int32_t cols, const float *in, float *out)
 {
     for (int32_t r = 0; r < rows; r++)
@@ -215,44 +202,39 @@ void galileo_telemetry_decoder_gs::deinterleaver(int32_t rows, int32_t cols, con
 }
 
 
-void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, int32_t frame_length)
+void galileo_telemetry_decoder_gs::remove_polarity(int32_t frame_length, bool inverted_polarity)
 {
-    // 1. De-interleave
-    std::vector<float> page_part_symbols_deint(frame_length);
-    deinterleaver(GALILEO_INAV_INTERLEAVER_ROWS, GALILEO_INAV_INTERLEAVER_COLS, page_part_symbols, page_part_symbols_deint.data());
-
-    // 2. Viterbi decoder
     // 2.1 Take into account the NOT gate in G2 polynomial (Galileo ICD Figure 13, FEC encoder)
     // 2.2 Take into account the possible inversion of the polarity due to PLL lock at 180º
+    const float polarity = inverted_polarity ? -1.0F : 1.0F;
     for (int32_t i = 0; i < frame_length; i++)
         {
-            if ((i + 1) % 2 == 0)
-                {
-                    page_part_symbols_deint[i] = -page_part_symbols_deint[i];
-                }
+            d_page_symbols_deint[i] *= ((i + 1) % 2 == 0) ? -polarity : polarity;
         }
+}
+
+
+void galileo_telemetry_decoder_gs::decode_INAV_word(own::span<const float> page_part_symbols, bool inverted_polarity)
+{
+    const auto frame_length = static_cast<int32_t>(page_part_symbols.size());
+    // 1. De-interleave, reading the symbols in place in the history
+    deinterleaver(GALILEO_INAV_INTERLEAVER_ROWS, GALILEO_INAV_INTERLEAVER_COLS, page_part_symbols.data(), d_page_symbols_deint.data());
 
-    std::vector<int32_t> page_part_bits(frame_length / 2);
-    viterbi_decoder(page_part_symbols_deint.data(), page_part_bits.data());
+    // 2. Viterbi decoder
+    remove_polarity(frame_length, inverted_polarity);
+    d_viterbi->decode_block(d_page_symbols_deint.data(), d_page_bits.data(), d_datalength);
 
-    // 3. Call the Galileo page decoder
-    std::string page_String;
-    for (int32_t i = 0; i < (frame_length / 2); i++)
+    // 3. Call the Galileo page decoder with the bits packed in words
+    Nav_Message_Bits<GALILEO_INAV_PAGE_PART_BITS> page_part_bits;
+    for (int32_t i = 0; i < GALILEO_INAV_PAGE_PART_BITS; i++)
         {
-            if (page_part_bits[i] > 0)
-                {
-                    page_String.push_back('1');
-                }
-            else
-                {
-                    page_String.push_back('0');
-                }
+            page_part_bits.set(i + 1, d_page_bits[i] > 0);
         }
 
-    if (page_part_bits[0] == 1)
+    if (d_page_bits[0] == 1)
         {
             // DECODE COMPLETE WORD (even + odd) and TEST CRC
-            d_inav_nav.split_page(page_String, flag_even_word_arrived);
+            d_inav_nav.split_page(page_part_bits, flag_even_word_arrived);
             if (d_inav_nav.get_flag_CRC_test() == true)
                 {
                     DLOG(INFO) << "Galileo E1 CRC correct in channel " << d_channel << " from satellite " << d_satellite;
@@ -266,7 +248,7 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
     else
         {
             // STORE HALF WORD (even page)
-            d_inav_nav.split_page(page_String, flag_even_word_arrived);
+            d_inav_nav.split_page(page_part_bits, flag_even_word_arrived);
             flag_even_word_arrived = 1;
         }
 
@@ -307,41 +289,25 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
 }
 
 
-void galileo_telemetry_decoder_gs::decode_FNAV_word(float *page_symbols, int32_t frame_length)
+void galileo_telemetry_decoder_gs::decode_FNAV_word(own::span<const float> page_symbols, bool inverted_polarity)
 {
-    // 1. De-interleave
-    std::vector<float> page_symbols_deint(frame_length);
-    deinterleaver(GALILEO_FNAV_INTERLEAVER_ROWS, GALILEO_FNAV_INTERLEAVER_COLS, page_symbols, page_symbols_deint.data());
+    const auto frame_length = static_cast<int32_t>(page_symbols.size());
+    // 1. De-interleave, reading the symbols in place in the history
+    deinterleaver(GALILEO_FNAV_INTERLEAVER_ROWS, GALILEO_FNAV_INTERLEAVER_COLS, page_symbols.data(), d_page_symbols_deint.data());
 
     // 2. Viterbi decoder
-    // 2.1 Take into account the NOT gate in G2 polynomial (Galileo ICD Figure 13, FEC encoder)
-    // 2.2 Take into account the possible inversion of the polarity due to PLL lock at 180 degrees
-    for (int32_t i = 0; i < frame_length; i++)
-        {
-            if ((i + 1) % 2 == 0)
-                {
-                    page_symbols_deint[i] = -page_symbols_deint[i];
-                }
-        }
-    std::vector<int32_t> page_bits(frame_length / 2);
-    viterbi_decoder(page_symbols_deint.data(), page_bits.data());
+    remove_polarity(frame_length, inverted_polarity);
+    d_viterbi->decode_block(d_page_symbols_deint.data(), d_page_bits.data(), d_datalength);
 
-    // 3. Call the Galileo page decoder
-    std::string page_String;
-    for (int32_t i = 0; i < frame_length; i++)
+    // 3. Call the Galileo page decoder with the bits packed in words
+    Nav_Message_Bits<GALILEO_FNAV_PAGE_BITS> page_bits;
+    for (int32_t i = 0; i < GALILEO_FNAV_PAGE_BITS; i++)
         {
-            if (page_bits[i] > 0)
-                {
-                    page_String.push_back('1');
-                }
-            else
-                {
-                    page_String.push_back('0');
-                }
+            page_bits.set(i + 1, d_page_bits[i] > 0);
         }
 
     // DECODE COMPLETE WORD (even + odd) and TEST CRC
-    d_fnav_nav.split_page(page_String);
+    d_fnav_nav.split_page(page_bits);
     if (d_fnav_nav.get_flag_CRC_test() == true)
         {
             DLOG(INFO) << "Galileo E5a CRC correct in channel " << d_channel << " from satellite " << d_satellite;
@@ -431,6 +397,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
     // 1. Copy the current tracking output
     current_symbol = in[0][0];
     // add new symbol to the symbol queue
+    const bool history_full = d_symbol_history.full();
     switch (d_frame_type)
         {
         case 1:  // INAV
@@ -449,6 +416,15 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                 break;
             }
         }
+    // the preamble is correlated with the oldest symbols of the queue
+    if (history_full and d_samples_per_preamble > 0)
+        {
+            d_preamble_detector.push(d_symbol_history[d_samples_per_preamble - 1]);
+        }
+    else if (d_symbol_history.size() <= static_cast<uint32_t>(d_samples_per_preamble))
+        {
+            d_preamble_detector.push(d_symbol_history.back());
+        }
     d_sample_counter++;  // count for the processed symbols
     consume_each(1);
     d_flag_preamble = false;
@@ -475,17 +451,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                 if (d_symbol_history.size() > d_required_symbols)
                     {
                         // ******* preamble correlation ********
-                        for (int32_t i = 0; i < d_samples_per_preamble; i++)
-                            {
-                                if (d_symbol_history[i] < 0.0)  // symbols clipping
-                                    {
-                                        corr_value -= d_preamble_samples[i];
-                                    }
-                                else
-                                    {
-                                        corr_value += d_preamble_samples[i];
-                                    }
-                            }
+                        corr_value = d_preamble_detector.correlation();
                         if (abs(corr_value) >= d_samples_per_preamble)
                             {
                                 d_preamble_index = d_sample_counter;  // record the preamble sample stamp
@@ -504,17 +470,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                 if (d_symbol_history.size() > d_required_symbols)
                     {
                         // ******* preamble correlation ********
-                        for (int32_t i = 0; i < d_samples_per_preamble; i++)
-                            {
-                                if (d_symbol_history[i] < 0.0)  // symbols clipping
-                                    {
-                                        corr_value -= d_preamble_samples[i];
-                                    }
-                                else
-                                    {
-                                        corr_value += d_preamble_samples[i];
-                                    }
-                            }
+                        corr_value = d_preamble_detector.correlation();
                         if (abs(corr_value) >= d_samples_per_preamble)
                             {
                                 // check preamble separation
@@ -555,41 +511,14 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                             {
                             case 1:  // INAV
                                      // NEW Galileo page part is received
-                                // 0. fetch the symbols into an array
-                                if (d_flag_PLL_180_deg_phase_locked == false)  // normal PLL lock
-                                    {
-                                        for (uint32_t i = 0; i < d_frame_length_symbols; i++)
-                                            {
-                                                d_page_part_symbols[i] = d_symbol_history[i + d_samples_per_preamble];  // because last symbol of the preamble is just received now!
-                                            }
-                                    }
-                                else  // 180 deg. inverted carrier phase PLL lock
-                                    {
-                                        for (uint32_t i = 0; i < d_frame_length_symbols; i++)
-                                            {
-                                                d_page_part_symbols[i] = -d_symbol_history[i + d_samples_per_preamble];  // because last symbol of the preamble is just received now!
-                                            }
-                                    }
-                                decode_INAV_word(d_page_part_symbols.data(), d_frame_length_symbols);
+                                // 0. view of the page part symbols in the history, after the preamble
+                                // (the last symbol of the preamble is just received now!)
+                                decode_INAV_word(d_symbol_history.span(d_samples_per_preamble, d_frame_length_symbols), d_flag_PLL_180_deg_phase_locked);
                                 break;
                             case 2:  // FNAV
                                      // NEW Galileo page part is received
-                                // 0. fetch the symbols into an array
-                                if (d_flag_PLL_180_deg_phase_locked == false)  // normal PLL lock
-                                    {
-                                        for (uint32_t i = 0; i < d_frame_length_symbols; i++)
-                                            {
-                                                d_page_part_symbols[i] = d_symbol_history[i + d_samples_per_preamble];  // because last symbol of the preamble is just received now!
-                                            }
-                                    }
-                                else  // 180 deg. inverted carrier phase PLL lock
-                                    {
-                                        for (uint32_t i = 0; i < d_frame_length_symbols; i++)
-                                            {
-                                                d_page_part_symbols[i] = -d_symbol_history[i + d_samples_per_preamble];  // because last symbol of the preamble is just received now!
-                                            }
-                                    }
-                                decode_FNAV_word(d_page_part_symbols.data(), d_frame_length_symbols);
+                                // 0. view of the page symbols in the history, after the preamble
+                                decode_FNAV_word(d_symbol_history.span(d_samples_per_preamble, d_frame_length_symbols), d_flag_PLL_180_deg_phase_locked);
                                 break;
                             default:
                                 return -1;
@@ -25,21 +25,22 @@
 #include "galileo_fnav_message.h"
 #include "galileo_navigation_message.h"
 #include "gnss_satellite.h"
-#include <boost/circular_buffer.hpp>
+#include "preamble_detector.h"
+#include "symbol_ring.h"
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>
 #include <cstdint>
 #include <fstream>
+#include <memory>  // for std::shared_ptr
 #include <string>
 #include <vector>
-#if GNURADIO_USES_STD_POINTERS
-#include <memory>  // for std::shared_ptr
-#else
+#if !GNURADIO_USES_STD_POINTERS
 #include <boost/shared_ptr.hpp>
 #endif
 
 class galileo_telemetry_decoder_gs;
+class Viterbi_Decoder;
 
 #if GNURADIO_USES_STD_POINTERS
 using galileo_telemetry_decoder_gs_sptr = std::shared_ptr<galileo_telemetry_decoder_gs>;
@@ -81,23 +82,22 @@ private:
     const int32_t d_nn = 2;  // Coding rate 1/n
     const int32_t d_KK = 7;  // Constraint Length
 
-    void viterbi_decoder(float *page_part_symbols, int32_t *page_part_bits);
     void deinterleaver(int32_t rows, int32_t cols, const float *in, float *out);
-    void decode_INAV_word(float *page_part_symbols, int32_t frame_length);
-    void decode_FNAV_word(float *page_symbols, int32_t frame_length);
+    void decode_INAV_word(own::span<const float> page_part_symbols, bool inverted_polarity);
+    void decode_FNAV_word(own::span<const float> page_symbols, bool inverted_polarity);
+    void remove_polarity(int32_t frame_length, bool inverted_polarity);
 
     // vars for Viterbi decoder
+    std::shared_ptr<Viterbi_Decoder> d_viterbi;
     std::vector<int32_t> d_preamble_samples;
-    std::vector<float> d_page_part_symbols;
-    std::vector<int32_t> d_out0;
-    std::vector<int32_t> d_out1;
-    std::vector<int32_t> d_state0;
-    std::vector<int32_t> d_state1;
+    Preamble_Detector d_preamble_detector;
+    std::vector<float> d_page_symbols_deint;
+    std::vector<int32_t> d_page_bits;
 
     std::string d_dump_filename;
     std::ofstream d_dump_file;
 
-    boost::circular_buffer<float> d_symbol_history;
+    Symbol_Ring<float> d_symbol_history;
 
     Gnss_Satellite d_satellite;
 
@@ -26,7 +26,8 @@
 #include "glonass_gnav_navigation_message.h"
 #include "gnss_satellite.h"
 #include "gnss_synchro.h"
-#include <boost/circular_buffer.hpp>
+#include "preamble_detector.h"
+#include "symbol_ring.h"
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>
@@ -85,15 +86,16 @@ private:
 
     const int32_t d_symbols_per_preamble = GLONASS_GNAV_PREAMBLE_LENGTH_SYMBOLS;
 
-    void decode_string(const double *symbols, int32_t frame_length);
+    void decode_string(own::span<const Gnss_Synchro> string_symbols, bool inverted_polarity);
 
     // Help with coherent tracking
 
     // Preamble decoding
     std::array<int32_t, GLONASS_GNAV_PREAMBLE_LENGTH_SYMBOLS> d_preambles_symbols{};
+    Preamble_Detector d_preamble_detector;
 
     // Storage for incoming data
-    boost::circular_buffer<Gnss_Synchro> d_symbol_history;
+    Symbol_Ring<Gnss_Synchro> d_symbol_history;
 
     // Navigation Message variable
     Glonass_Gnav_Navigation_Message d_nav;
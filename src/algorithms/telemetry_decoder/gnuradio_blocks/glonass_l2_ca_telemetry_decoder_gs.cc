@@ -77,6 +77,8 @@ glonass_l2_ca_telemetry_decoder_gs::glonass_l2_ca_telemetry_decoder_gs(
                 }
         }
 
+    d_preamble_detector = Preamble_Detector(d_preambles_symbols.data(), d_symbols_per_preamble);
+
     d_symbol_history.set_capacity(GLONASS_GNAV_STRING_SYMBOLS);
     d_sample_counter = 0ULL;
     d_stat = 0;
@@ -111,55 +113,33 @@ glonass_l2_ca_telemetry_decoder_gs::~glonass_l2_ca_telemetry_decoder_gs()
 }
 
 
-void glonass_l2_ca_telemetry_decoder_gs::decode_string(const double *frame_symbols, int32_t frame_length)
+void glonass_l2_ca_telemetry_decoder_gs::decode_string(own::span<const Gnss_Synchro> string_symbols, bool inverted_polarity)
 {
-    double chip_acc = 0.0;
-    int32_t chip_acc_counter = 0;
-
     // 1. Transform from symbols to bits
-    std::string bi_binary_code;
-    std::string relative_code;
-    std::string data_bits;
+    std::array<bool, 2 * GLONASS_GNAV_STRING_BITS> bi_binary_code{};
+    std::array<bool, GLONASS_GNAV_STRING_BITS> relative_code{};
+    Nav_Message_Bits<GLONASS_GNAV_STRING_BITS> data_bits;
 
     // Group samples into bi-binary code
-    for (int32_t i = 0; i < (frame_length); i++)
+    for (size_t k = 0; k < bi_binary_code.size(); k++)
         {
-            chip_acc += frame_symbols[i];
-            chip_acc_counter += 1;
-
-            if (chip_acc_counter == (GLONASS_GNAV_TELEMETRY_SYMBOLS_PER_BIT))
+            double chip_acc = 0.0;
+            for (int32_t i = 0; i < GLONASS_GNAV_TELEMETRY_SYMBOLS_PER_BIT; i++)
                 {
-                    if (chip_acc > 0)
-                        {
-                            bi_binary_code.push_back('1');
-                            chip_acc_counter = 0;
-                            chip_acc = 0;
-                        }
-                    else
-                        {
-                            bi_binary_code.push_back('0');
-                            chip_acc_counter = 0;
-                            chip_acc = 0;
-                        }
+                    chip_acc += string_symbols[k * GLONASS_GNAV_TELEMETRY_SYMBOLS_PER_BIT + i].Prompt_I;
                 }
+            // take into account the possible inversion of the polarity due to PLL lock at 180 deg.
+            bi_binary_code[k] = inverted_polarity ? (chip_acc < 0) : (chip_acc > 0);
         }
     // Convert from bi-binary code to relative code
     for (int32_t i = 0; i < (GLONASS_GNAV_STRING_BITS); i++)
         {
-            if (bi_binary_code[2 * i] == '1' && bi_binary_code[2 * i + 1] == '0')
-                {
-                    relative_code.push_back('1');
-                }
-            else
-                {
-                    relative_code.push_back('0');
-                }
+            relative_code[i] = bi_binary_code[2 * i] && !bi_binary_code[2 * i + 1];
         }
-    // Convert from relative code to data bits
-    data_bits.push_back('0');
+    // Convert from relative code to data bits (the first bit is zero)
     for (int32_t i = 1; i < (GLONASS_GNAV_STRING_BITS); i++)
         {
-            data_bits.push_back(((relative_code[i - 1] - '0') ^ (relative_code[i] - '0')) + '0');
+            data_bits.set(i + 1, relative_code[i - 1] != relative_code[i]);
         }
 
     // 2. Call the GLONASS GNAV string decoder
@@ -258,26 +238,26 @@ int glonass_l2_ca_telemetry_decoder_gs::general_work(int noutput_items __attribu
     Gnss_Synchro current_symbol{};  // structure to save the synchronization information and send the output object to the next block
     // 1. Copy the current tracking output
     current_symbol = in[0][0];
+    const bool history_full = d_symbol_history.full();
     d_symbol_history.push_back(current_symbol);  // add new symbol to the symbol queue
+    // the preamble is correlated with the oldest symbols of the queue
+    if (history_full)
+        {
+            d_preamble_detector.push(d_symbol_history[d_symbols_per_preamble - 1].Prompt_I);
+        }
+    else if (d_symbol_history.size() <= static_cast<uint32_t>(d_symbols_per_preamble))
+        {
+            d_preamble_detector.push(current_symbol.Prompt_I);
+        }
     d_sample_counter++;                          // count for the processed samples
     consume_each(1);
 
     d_flag_preamble = false;
 
-    if (static_cast<int32_t>(d_symbol_history.size()) >= d_symbols_per_preamble)
+    if (d_preamble_detector.ready())
         {
             // ******* preamble correlation ********
-            for (int32_t i = 0; i < d_symbols_per_preamble; i++)
-                {
-                    if (d_symbol_history[i].Prompt_I < 0.0)  // symbols clipping
-                        {
-                            corr_value -= d_preambles_symbols[i];
-                        }
-                    else
-                        {
-                            corr_value += d_preambles_symbols[i];
-                        }
-                }
+            corr_value = d_preamble_detector.correlation();
         }
 
     // ******* frame sync ******************
@@ -324,25 +304,12 @@ int glonass_l2_ca_telemetry_decoder_gs::general_work(int noutput_items __attribu
             if (d_sample_counter == d_preamble_index + static_cast<uint64_t>(GLONASS_GNAV_STRING_SYMBOLS))
                 {
                     // NEW GLONASS string received
-                    // 0. fetch the symbols into an array
-                    int32_t string_length = GLONASS_GNAV_STRING_SYMBOLS - d_symbols_per_preamble;
-                    std::array<double, GLONASS_GNAV_DATA_SYMBOLS> string_symbols{};
-
-                    // ******* SYMBOL TO BIT *******
-                    for (int32_t i = 0; i < string_length; i++)
-                        {
-                            if (corr_value > 0)
-                                {
-                                    string_symbols[i] = d_symbol_history[i + d_symbols_per_preamble].Prompt_I;  // because last symbol of the preamble is just received now!
-                                }
-                            else
-                                {
-                                    string_symbols[i] = -d_symbol_history[i + d_symbols_per_preamble].Prompt_I;  // because last symbol of the preamble is just received now!
-                                }
-                        }
+                    // 0. view of the string symbols in the history, after the preamble
+                    // (the last symbol of the preamble is just received now!)
+                    const int32_t string_length = GLONASS_GNAV_STRING_SYMBOLS - d_symbols_per_preamble;
 
                     // call the decoder
-                    decode_string(string_symbols.data(), string_length);
+                    decode_string(d_symbol_history.span(d_symbols_per_preamble, string_length), corr_value <= 0);
                     if (d_nav.get_flag_CRC_test() == true)
                         {
                             d_CRC_error_counter = 0;
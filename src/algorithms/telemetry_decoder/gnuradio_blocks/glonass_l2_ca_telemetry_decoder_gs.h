@@ -25,7 +25,8 @@
 #include "glonass_gnav_navigation_message.h"
 #include "gnss_satellite.h"
 #include "gnss_synchro.h"
-#include <boost/circular_buffer.hpp>
+#include "preamble_detector.h"
+#include "symbol_ring.h"
 #include <gnuradio/block.h>
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>
@@ -82,12 +83,13 @@ private:
 
     const int32_t d_symbols_per_preamble = GLONASS_GNAV_PREAMBLE_LENGTH_SYMBOLS;
 
-    void decode_string(const double *symbols, int32_t frame_length);
+    void decode_string(own::span<const Gnss_Synchro> string_symbols, bool inverted_polarity);
 
     // Storage for incoming data
-    boost::circular_buffer<Gnss_Synchro> d_symbol_history;
+    Symbol_Ring<Gnss_Synchro> d_symbol_history;
 
     std::array<int32_t, GLONASS_GNAV_PREAMBLE_LENGTH_SYMBOLS> d_preambles_symbols{};
+    Preamble_Detector d_preamble_detector;
 
     // Navigation Message variable
     Glonass_Gnav_Navigation_Message d_nav;
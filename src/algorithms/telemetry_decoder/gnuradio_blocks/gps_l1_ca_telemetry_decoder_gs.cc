@@ -19,6 +19,7 @@
  */
 
 #include "gps_l1_ca_telemetry_decoder_gs.h"
+#include "gnss_crc.h"       // for gps_lnav_word_parity_check
 #include "gps_ephemeris.h"  // for Gps_Ephemeris
 #include "gps_iono.h"       // for Gps_Iono
 #include "gps_utc_model.h"  // for Gps_Utc_Model
@@ -27,27 +28,11 @@
 #include <pmt/pmt.h>        // for make_any
 #include <pmt/pmt_sugar.h>  // for mp
 #include <cmath>            // for round
-#include <cstring>          // for memcpy
 #include <exception>        // for exception
 #include <iostream>         // for cout
 #include <memory>           // for shared_ptr
 
 
-#ifdef COMPILER_HAS_ROTL
-#include <bit>
-namespace my_rotl = std;
-#else
-namespace my_rotl
-{
-#if HAS_GENERIC_LAMBDA
-auto rotl = [](auto x, auto n) { return (((x) << (n)) ^ ((x) >> (32 - (n)))); };
-#else
-auto rotl = [](uint32_t x, uint32_t n) { return (((x) << (n)) ^ ((x) >> (32 - (n)))); };
-#endif
-}  // namespace my_rotl
-#endif
-
-
 gps_l1_ca_telemetry_decoder_gs_sptr
 gps_l1_ca_make_telemetry_decoder_gs(const Gnss_Satellite &satellite, bool dump)
 {
@@ -97,6 +82,7 @@ gps_l1_ca_telemetry_decoder_gs::gps_l1_ca_telemetry_decoder_gs(
                     n++;
                 }
         }
+    d_preamble_detector = Preamble_Detector(d_preamble_samples.data(), d_samples_per_preamble);
     d_sample_counter = 0ULL;
     d_stat = 0;
     d_preamble_index = 0ULL;
@@ -133,41 +119,6 @@ gps_l1_ca_telemetry_decoder_gs::~gps_l1_ca_telemetry_decoder_gs()
 }
 
 
-bool gps_l1_ca_telemetry_decoder_gs::gps_word_parityCheck(uint32_t gpsword)
-{
-    uint32_t d1;
-    uint32_t d2;
-    uint32_t d3;
-    uint32_t d4;
-    uint32_t d5;
-    uint32_t d6;
-    uint32_t d7;
-    uint32_t t;
-    uint32_t parity;
-    // XOR as many bits in parallel as possible.  The magic constants pick
-    //   up bits which are to be XOR'ed together to implement the GPS parity
-    //   check algorithm described in IS-GPS-200K.  This avoids lengthy shift-
-    //   and-xor loops.
-    d1 = gpsword & 0xFBFFBF00U;
-    d2 = my_rotl::rotl(gpsword, 1U) & 0x07FFBF01U;
-    d3 = my_rotl::rotl(gpsword, 2U) & 0xFC0F8100U;
-    d4 = my_rotl::rotl(gpsword, 3U) & 0xF81FFE02U;
-    d5 = my_rotl::rotl(gpsword, 4U) & 0xFC00000EU;
-    d6 = my_rotl::rotl(gpsword, 5U) & 0x07F00001U;
-    d7 = my_rotl::rotl(gpsword, 6U) & 0x00003000U;
-    t = d1 ^ d2 ^ d3 ^ d4 ^ d5 ^ d6 ^ d7;
-    // Now XOR the 5 6-bit fields together to produce the 6-bit final result.
-    parity = t ^ my_rotl::rotl(t, 6U) ^ my_rotl::rotl(t, 12U) ^ my_rotl::rotl(t, 18U) ^ my_rotl::rotl(t, 24U);
-    parity = parity & 0x3FU;
-    if (parity == (gpsword & 0x3FU))
-        {
-            return true;
-        }
-
-    return false;
-}
-
-
 void gps_l1_ca_telemetry_decoder_gs::set_satellite(const Gnss_Satellite &satellite)
 {
     d_nav = Gps_Navigation_Message();
@@ -209,7 +160,7 @@ void gps_l1_ca_telemetry_decoder_gs::set_channel(int32_t channel)
 
 bool gps_l1_ca_telemetry_decoder_gs::decode_subframe()
 {
-    std::array<char, GPS_SUBFRAME_LENGTH> subframe{};
+    Nav_Message_Bits<GPS_SUBFRAME_BITS> subframe_bits;
     int32_t frame_bit_index = 0;
     int32_t word_index = 0;
     uint32_t GPS_frame_4bytes = 0;
@@ -248,13 +199,13 @@ bool gps_l1_ca_telemetry_decoder_gs::decode_subframe()
                             GPS_frame_4bytes ^= 0x3FFFFFC0U;  // invert the data bits (using XOR)
                         }
                     // check parity. If ANY word inside the subframe fails the parity, set subframe_synchro_confirmation = false
-                    if (not gps_l1_ca_telemetry_decoder_gs::gps_word_parityCheck(GPS_frame_4bytes))
+                    if (not gps_lnav_word_parity_check(GPS_frame_4bytes))
                         {
                             subframe_synchro_confirmation = false;
                         }
                     // add word to subframe
                     // insert the word in the correct position of the subframe
-                    std::memcpy(&subframe[word_index * GPS_WORD_LENGTH], &GPS_frame_4bytes, sizeof(uint32_t));
+                    subframe_bits.insert(word_index * GPS_WORD_BITS + 1, GPS_WORD_BITS, GPS_frame_4bytes & 0x3FFFFFFFU);
                     word_index++;
                     d_prev_GPS_frame_4bytes = GPS_frame_4bytes;  // save the actual frame
                     GPS_frame_4bytes = 0;
@@ -269,7 +220,7 @@ bool gps_l1_ca_telemetry_decoder_gs::decode_subframe()
     // NEW GPS SUBFRAME HAS ARRIVED!
     if (subframe_synchro_confirmation)
         {
-            int32_t subframe_ID = d_nav.subframe_decoder(subframe.data());  // decode the subframe
+            int32_t subframe_ID = d_nav.subframe_decoder(subframe_bits);  // decode the subframe
             if (subframe_ID > 0 and subframe_ID < 6)
                 {
                     std::cout << "New GPS NAV message received in channel " << this->d_channel << ": "
@@ -320,6 +271,7 @@ void gps_l1_ca_telemetry_decoder_gs::reset()
     d_sent_tlm_failed_msg = false;
     d_flag_TOW_set = false;
     d_symbol_history.clear();
+    d_preamble_detector.reset();
     d_stat = 0;
     DLOG(INFO) << "Telemetry decoder reset for satellite " << d_satellite;
 }
@@ -335,7 +287,17 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
     // 1. Copy the current tracking output
     current_symbol = in[0][0];
     // add new symbol to the symbol queue
+    const bool history_full = d_symbol_history.full();
     d_symbol_history.push_back(current_symbol.Prompt_I);
+    // the preamble is correlated with the oldest symbols of the queue
+    if (history_full)
+        {
+            d_preamble_detector.push(d_symbol_history[GPS_CA_PREAMBLE_LENGTH_BITS - 1]);
+        }
+    else if (d_symbol_history.size() <= GPS_CA_PREAMBLE_LENGTH_BITS)
+        {
+            d_preamble_detector.push(current_symbol.Prompt_I);
+        }
     d_sample_counter++;  // count for the processed symbols
     consume_each(1);
     d_flag_preamble = false;
@@ -357,20 +319,10 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
             {
                 // correlate with preamble
                 int32_t corr_value = 0;
-                if (d_symbol_history.size() >= GPS_CA_PREAMBLE_LENGTH_BITS)
+                if (d_preamble_detector.ready())
                     {
                         // ******* preamble correlation ********
-                        for (int32_t i = 0; i < GPS_CA_PREAMBLE_LENGTH_BITS; i++)
-                            {
-                                if (d_symbol_history[i] < 0.0)  // symbols clipping
-                                    {
-                                        corr_value -= d_preamble_samples[i];
-                                    }
-                                else
-                                    {
-                                        corr_value += d_preamble_samples[i];
-                                    }
-                            }
+                        corr_value = d_preamble_detector.correlation();
                     }
                 if (abs(corr_value) >= d_samples_per_preamble)
                     {
@@ -387,20 +339,10 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
                 // correlate with preamble
                 int32_t corr_value = 0;
                 int32_t preamble_diff = 0;
-                if (d_symbol_history.size() >= GPS_CA_PREAMBLE_LENGTH_BITS)
+                if (d_preamble_detector.ready())
                     {
                         // ******* preamble correlation ********
-                        for (int32_t i = 0; i < GPS_CA_PREAMBLE_LENGTH_BITS; i++)
-                            {
-                                if (d_symbol_history[i] < 0.0)  // symbols clipping
-                                    {
-                                        corr_value -= d_preamble_samples[i];
-                                    }
-                                else
-                                    {
-                                        corr_value += d_preamble_samples[i];
-                                    }
-                            }
+                        corr_value = d_preamble_detector.correlation();
                     }
                 if (abs(corr_value) >= d_samples_per_preamble)
                     {
@@ -24,7 +24,8 @@
 #include "gnss_satellite.h"
 #include "gnss_synchro.h"
 #include "gps_navigation_message.h"
-#include <boost/circular_buffer.hpp>
+#include "preamble_detector.h"
+#include "symbol_ring.h"
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>             // for array
@@ -73,18 +74,18 @@ private:
 
     gps_l1_ca_telemetry_decoder_gs(const Gnss_Satellite &satellite, bool dump);
 
-    bool gps_word_parityCheck(uint32_t gpsword);
     bool decode_subframe();
 
     Gps_Navigation_Message d_nav;
     Gnss_Satellite d_satellite;
 
     std::array<int32_t, GPS_CA_PREAMBLE_LENGTH_BITS> d_preamble_samples{};
+    Preamble_Detector d_preamble_detector;
 
     std::string d_dump_filename;
     std::ofstream d_dump_file;
 
-    boost::circular_buffer<float> d_symbol_history;
+    Symbol_Ring<float> d_symbol_history;
 
     uint64_t d_sample_counter;
     uint64_t d_preamble_index;
@@ -18,6 +18,7 @@
  */
 
 #include "sbas_l1_telemetry_decoder_gs.h"
+#include "gnss_crc.h"
 #include "gnss_synchro.h"
 #include "viterbi_decoder.h"
 #include <glog/logging.h>
@@ -179,11 +180,12 @@ sbas_l1_telemetry_decoder_gs::Symbol_Aligner_And_Decoder::Symbol_Aligner_And_Dec
 {
     // convolutional code properties
     d_KK = 7;
-    const int32_t nn = 2;
-    std::array<int32_t, nn> g_encoder{121, 91};
+    const std::array<int32_t, 2> g_encoder{{121, 91}};
+    // trellis history: traceback depth plus one block of decoded bits
+    const int32_t max_bits = 5 * d_KK + D_BLOCK_SIZE_IN_BITS;
 
-    d_vd1 = std::make_shared<Viterbi_Decoder>(g_encoder.data(), d_KK, nn);
-    d_vd2 = std::make_shared<Viterbi_Decoder>(g_encoder.data(), d_KK, nn);
+    d_vd1 = std::make_shared<Viterbi_Decoder>(g_encoder, max_bits);
+    d_vd2 = std::make_shared<Viterbi_Decoder>(g_encoder, max_bits);
     d_past_symbol = 0;
 }
 
@@ -233,9 +235,34 @@ bool sbas_l1_telemetry_decoder_gs::Symbol_Aligner_And_Decoder::get_bits(const st
 
 
 // ### helper class for detecting the preamble and collect the corresponding message candidates ###
+sbas_l1_telemetry_decoder_gs::Frame_Detector::Frame_Detector()
+{
+    const std::array<std::array<int32_t, 8>, 3> preambles{{{{-1, 1, -1, 1, -1, -1, 1, 1}},
+        {{1, -1, -1, 1, 1, -1, 1, -1}},
+        {{1, 1, -1, -1, -1, 1, 1, -1}}}};
+    for (size_t i = 0; i < preambles.size(); i++)
+        {
+            d_preambles[i] = Preamble_Detector(preambles[i].data(), static_cast<int32_t>(preambles[i].size()));
+        }
+}
+
+
 void sbas_l1_telemetry_decoder_gs::Frame_Detector::reset()
 {
     d_buffer.clear();
+    for (auto &preamble : d_preambles)
+        {
+            preamble.reset();
+        }
+}
+
+
+void sbas_l1_telemetry_decoder_gs::Frame_Detector::push_window_bit(int32_t bit)
+{
+    for (auto &preamble : d_preambles)
+        {
+            preamble.push(bit == 1 ? 1.0F : -1.0F);
+        }
 }
 
 
@@ -243,9 +270,6 @@ void sbas_l1_telemetry_decoder_gs::Frame_Detector::get_frame_candidates(const st
 {
     std::stringstream ss;
     uint32_t sbas_msg_length = 250;
-    std::vector<std::vector<int32_t>> preambles = {{0, 1, 0, 1, 0, 0, 1, 1},
-        {1, 0, 0, 1, 1, 0, 1, 0},
-        {1, 1, 0, 0, 0, 1, 1, 0}};
     VLOG(FLOW) << "get_frame_candidates(): "
                << "d_buffer.size()=" << d_buffer.size() << "\tbits.size()=" << bits.size();
     ss << "copy bits ";
@@ -254,6 +278,10 @@ void sbas_l1_telemetry_decoder_gs::Frame_Detector::get_frame_candidates(const st
     for (auto bit_it = bits.cbegin(); bit_it < bits.cend(); ++bit_it)
         {
             d_buffer.push_back(*bit_it);
+            if (d_buffer.size() <= static_cast<size_t>(d_preambles[0].length()))
+                {
+                    push_window_bit(*bit_it);
+                }
             ss << *bit_it;
             count++;
         }
@@ -262,16 +290,12 @@ void sbas_l1_telemetry_decoder_gs::Frame_Detector::get_frame_candidates(const st
     while (d_buffer.size() >= sbas_msg_length)
         {
             // compare with all preambles
-            for (auto preample_it = preambles.begin(); preample_it < preambles.end(); ++preample_it)
+            for (auto preample_it = d_preambles.cbegin(); preample_it < d_preambles.cend(); ++preample_it)
                 {
-                    bool preamble_detected = true;
-                    bool inv_preamble_detected = true;
-                    // compare the buffer bits with the preamble bits
-                    for (auto preample_bit_it = preample_it->begin(); preample_bit_it < preample_it->end(); ++preample_bit_it)
-                        {
-                            preamble_detected = *preample_bit_it == d_buffer[preample_bit_it - preample_it->begin()] ? preamble_detected : false;
-                            inv_preamble_detected = *preample_bit_it != d_buffer[preample_bit_it - preample_it->begin()] ? inv_preamble_detected : false;
-                        }
+                    // the buffer bits match the preamble bits (or their inverse) if the correlation is maximum
+                    const int32_t corr_value = preample_it->correlation();
+                    const bool preamble_detected = corr_value == preample_it->length();
+                    const bool inv_preamble_detected = corr_value == -preample_it->length();
                     if (preamble_detected || inv_preamble_detected)
                         {
                             // copy candidate
@@ -287,7 +311,7 @@ void sbas_l1_telemetry_decoder_gs::Frame_Detector::get_frame_candidates(const st
                                 }
                             msg_candidates.emplace_back(relative_preamble_start, candidate);
                             ss.str("");
-                            ss << "preamble " << preample_it - preambles.begin() << (inv_preamble_detected ? " inverted" : " normal") << " detected! candidate=";
+                            ss << "preamble " << preample_it - d_preambles.cbegin() << (inv_preamble_detected ? " inverted" : " normal") << " detected! candidate=";
                             for (auto bit_it = candidate.begin(); bit_it < candidate.end(); ++bit_it)
                                 {
                                     ss << *bit_it;
@@ -298,6 +322,7 @@ void sbas_l1_telemetry_decoder_gs::Frame_Detector::get_frame_candidates(const st
             relative_preamble_start++;
             // remove bit in front
             d_buffer.pop_front();
+            push_window_bit(d_buffer[d_preambles[0].length() - 1]);
         }
 }
 
@@ -320,9 +345,7 @@ void sbas_l1_telemetry_decoder_gs::Crc_Verifier::get_valid_frames(const std::vec
             std::vector<uint8_t> candidate_bytes;
             zerropad_back_and_convert_to_bytes(candidate_it->second, candidate_bytes);
             // verify CRC
-            d_checksum_agent.reset(0);
-            d_checksum_agent.process_bytes(candidate_bytes.data(), candidate_bytes.size());
-            uint32_t crc = d_checksum_agent.checksum();
+            const uint32_t crc = compute_crc24q(candidate_bytes.data(), candidate_bytes.size());
             VLOG(SAMP_SYNC) << "candidate " << candidate_it - msg_candidates.begin()
                             << ": final crc remainder= " << std::hex << crc
                             << std::setfill(' ') << std::resetiosflags(std::ios::hex);
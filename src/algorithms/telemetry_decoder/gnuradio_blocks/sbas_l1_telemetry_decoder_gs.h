@@ -21,10 +21,11 @@
 #define GNSS_SDR_SBAS_L1_TELEMETRY_DECODER_GS_H
 
 #include "gnss_satellite.h"
-#include <boost/crc.hpp>  // for crc_optimal
+#include "preamble_detector.h"
 #include <gnuradio/block.h>
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
-#include <cstddef>           // for size_t
+#include <array>
+#include <cstddef>  // for size_t
 #include <cstdint>
 #include <deque>
 #include <fstream>
@@ -143,11 +144,14 @@ private:
     class Frame_Detector
     {
     public:
+        Frame_Detector();
         void reset();
         void get_frame_candidates(const std::vector<int32_t> &bits, std::vector<std::pair<int32_t, std::vector<int32_t>>> &msg_candidates);
 
     private:
+        void push_window_bit(int32_t bit);
         std::deque<int32_t> d_buffer;
+        std::array<Preamble_Detector, 3> d_preambles;  // correlators of the first bits of d_buffer with the three SBAS preambles
     } d_frame_detector;
 
 
@@ -159,8 +163,6 @@ private:
         void get_valid_frames(const std::vector<msg_candiate_int_t> &msg_candidates, std::vector<msg_candiate_char_t> &valid_msgs);
 
     private:
-        typedef boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc_24_q_type;
-        crc_24_q_type d_checksum_agent;
         void zerropad_front_and_convert_to_bytes(const std::vector<int32_t> &msg_candidate, std::vector<uint8_t> &bytes);
         void zerropad_back_and_convert_to_bytes(const std::vector<int32_t> &msg_candidate, std::vector<uint8_t> &bytes);
     } d_crc_verifier;
@@ -1,6 +1,7 @@
 /*!
  * \file convolutional.h
  * \brief General functions used to implement convolutional encoding.
+ * Decoding is done by the Viterbi_Decoder class (see viterbi_decoder.h).
  * \author Matthew C. Valenti, 2006-2008.
  * \author C. Fernandez-Prades, 2019.
  *
@@ -38,13 +39,6 @@
 #ifndef GNSS_SDR_CONVOLUTIONAL_H
 #define GNSS_SDR_CONVOLUTIONAL_H
 
-#include <volk_gnsssdr/volk_gnsssdr.h>
-#include <vector>
-
-/* define constants used throughout the library */
-const float MAXLOG = 1e7; /* Define infinity */
-
-
 /*!
  * \brief Determines if a symbol has odd (1) or even (0) parity
  *    Output parameters:
@@ -162,111 +156,4 @@ inline float Gamma(const float rec_array[],
 }
 
 
-/*!
- * \brief Uses the Viterbi algorithm to perform hard-decision decoding of a convolutional code.
- * \param[in] out0[]    The output bits for each state if input is a 0.
- * \param[in] state0[]  The next state if input is a 0.
- * \param[in] out1[]    The output bits for each state if input is a 1.
- * \param[in] state1[]  The next state if input is a 1.
- * \param[in] r[]       The received signal in LLR-form. For BPSK, must be in form r = 2*a*y/(sigma^2).
- * \param[in] KK        The constraint length of the convolutional code.
- * \param[in] LL        The number of data bits.
- * \param[out] output_u_int[]    Hard decisions on the data bits
- *
- */
-inline void Viterbi(int output_u_int[],
-    const int out0[],
-    const int state0[],
-    const int out1[],
-    const int state1[],
-    const float input_c[],
-    int KK,
-    int nn,
-    int LL)
-{
-    int i, t, state, mm, states;
-    int number_symbols;
-    uint32_t max_index;
-    float metric;
-    float max_val;
-
-    /* some derived constants */
-    mm = KK - 1;
-    states = 1 << mm;         /* 2^mm */
-    number_symbols = 1 << nn; /* 2^nn */
-
-    std::vector<float> prev_section(states, -MAXLOG);
-    std::vector<float> next_section(states, -MAXLOG);
-    std::vector<int> prev_bit(states * (LL + mm), 0);
-    std::vector<int> prev_state(states * (LL + mm), 0);
-    std::vector<float> rec_array(nn);
-    std::vector<float> metric_c(number_symbols);
-
-    prev_section[0] = 0.0; /* start in all-zeros state */
-
-    /* go through trellis */
-    for (t = 0; t < LL + mm; t++)
-        {
-            rec_array.assign(input_c + nn * t, input_c + nn * t + (nn - 1));
-
-            /* precompute all possible branch metrics */
-            for (i = 0; i < number_symbols; i++)
-                {
-                    metric_c[i] = Gamma(rec_array.data(), i, nn);
-                }
-
-            /* step through all states */
-            for (state = 0; state < states; state++)
-                {
-                    /* hypothesis: info bit is a zero */
-                    metric = prev_section[state] + metric_c[out0[state]];
-
-                    /* store new metric if more than metric in storage */
-                    if (metric > next_section[state0[state]])
-                        {
-                            next_section[state0[state]] = metric;
-                            prev_state[t * states + state0[state]] = state;
-                            prev_bit[t * states + state0[state]] = 0;
-                        }
-
-                    /* hypothesis: info bit is a one */
-                    metric = prev_section[state] + metric_c[out1[state]];
-
-                    /* store new metric if more than metric in storage */
-                    if (metric > next_section[state1[state]])
-                        {
-                            next_section[state1[state]] = metric;
-                            prev_state[t * states + state1[state]] = state;
-                            prev_bit[t * states + state1[state]] = 1;
-                        }
-                }
-
-            /* normalize */
-            volk_gnsssdr_32f_index_max_32u(&max_index, next_section.data(), states);
-            max_val = next_section[max_index];
-
-            for (state = 0; state < states; state++)
-                {
-                    prev_section[state] = next_section[state] - max_val;
-                    next_section[state] = -MAXLOG;
-                }
-        }
-
-    /* trace-back operation */
-    state = 0;
-
-    /* tail, no need to output */
-    for (t = LL + mm - 1; t >= LL; t--)
-        {
-            state = prev_state[t * states + state];
-        }
-
-    for (t = LL - 1; t >= 0; t--)
-        {
-            output_u_int[t] = prev_bit[t * states + state];
-            state = prev_state[t * states + state];
-        }
-}
-
-
 #endif
@@ -1,7 +1,8 @@
 /*!
  * \file viterbi27.c
  * \author Phil Karn, KA9Q
- * \brief K=7 r=1/2 Viterbi decoder in portable C
+ * \brief K=7 r=1/2 Viterbi decoder in portable C, with SSE2, AVX2 and NEON
+ * implementations of the add-compare-select step
  *
  * -------------------------------------------------------------------------
  * This file was originally borrowed from libswiftnav
@@ -23,6 +24,18 @@
 
 #include "fec.h"
 #include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define V27_ACS_AVX2 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define V27_ACS_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define V27_ACS_NEON 1
+#endif
 
 static inline unsigned int parity(unsigned int x)
 {
@@ -103,6 +116,171 @@ void v27_init(v27_t *v, v27_decision_t *decisions, unsigned int decisions_count,
         d->w[(i) / 16] |= decision << ((2U * (i) + 1U) & 31U);      \
     }
 
+
+/* Add-compare-select for the 32 butterflies of one trellis section.
+ * The vectorized versions compute the same 32-bit path metrics and decision
+ * bits as the C-language butterfly, several butterflies at a time: the new
+ * metrics of states 2i and 2i+1 (and their decision bits) are interleaved
+ * before being stored.
+ */
+#if V27_ACS_AVX2
+static inline void v27_acs(v27_t *v, v27_decision_t *d, unsigned char sym0, unsigned char sym1)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i s0 = _mm256_set1_epi32(sym0);
+    const __m256i s1 = _mm256_set1_epi32(sym1);
+    const __m256i k510 = _mm256_set1_epi32(510);
+    unsigned int i;
+
+    for (i = 0; i < 32; i += 8)
+        {
+            const __m256i c0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)&v->poly->c0[i]));
+            const __m256i c1 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)&v->poly->c1[i]));
+            const __m256i metric = _mm256_add_epi32(_mm256_xor_si256(c0, s0), _mm256_xor_si256(c1, s1));
+            const __m256i metric_inv = _mm256_sub_epi32(k510, metric);
+            const __m256i old_lo = _mm256_loadu_si256((const __m256i *)&v->old_metrics[i]);
+            const __m256i old_hi = _mm256_loadu_si256((const __m256i *)&v->old_metrics[i + 32]);
+            const __m256i m0 = _mm256_add_epi32(old_lo, metric);
+            const __m256i m1 = _mm256_add_epi32(old_hi, metric_inv);
+            const __m256i m2 = _mm256_add_epi32(old_lo, metric_inv);
+            const __m256i m3 = _mm256_add_epi32(old_hi, metric);
+            const __m256i d0 = _mm256_cmpgt_epi32(_mm256_sub_epi32(m0, m1), zero);
+            const __m256i d1 = _mm256_cmpgt_epi32(_mm256_sub_epi32(m2, m3), zero);
+            const __m256i n0 = _mm256_blendv_epi8(m0, m1, d0);
+            const __m256i n1 = _mm256_blendv_epi8(m2, m3, d1);
+            /* unpack works on 128-bit lanes, so a lane permutation is needed to restore the state order */
+            const __m256i n_lo = _mm256_unpacklo_epi32(n0, n1);
+            const __m256i n_hi = _mm256_unpackhi_epi32(n0, n1);
+            const __m256i d_lo = _mm256_unpacklo_epi32(d0, d1);
+            const __m256i d_hi = _mm256_unpackhi_epi32(d0, d1);
+            unsigned int decisions;
+            _mm256_storeu_si256((__m256i *)&v->new_metrics[2 * i], _mm256_permute2x128_si256(n_lo, n_hi, 0x20));
+            _mm256_storeu_si256((__m256i *)&v->new_metrics[2 * i + 8], _mm256_permute2x128_si256(n_lo, n_hi, 0x31));
+            decisions = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_permute2x128_si256(d_lo, d_hi, 0x20)));
+            decisions |= (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_permute2x128_si256(d_lo, d_hi, 0x31))) << 8U;
+            d->w[i / 16] |= decisions << ((2U * i) & 31U);
+        }
+}
+#elif V27_ACS_SSE2
+static inline __m128i v27_load_poly_sse2(const unsigned char *c)
+{
+    int packed;
+    memcpy(&packed, c, sizeof(packed));
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), _mm_setzero_si128()), _mm_setzero_si128());
+}
+
+
+static inline void v27_acs(v27_t *v, v27_decision_t *d, unsigned char sym0, unsigned char sym1)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i s0 = _mm_set1_epi32(sym0);
+    const __m128i s1 = _mm_set1_epi32(sym1);
+    const __m128i k510 = _mm_set1_epi32(510);
+    unsigned int i;
+
+    for (i = 0; i < 32; i += 4)
+        {
+            const __m128i metric = _mm_add_epi32(_mm_xor_si128(v27_load_poly_sse2(&v->poly->c0[i]), s0),
+                _mm_xor_si128(v27_load_poly_sse2(&v->poly->c1[i]), s1));
+            const __m128i metric_inv = _mm_sub_epi32(k510, metric);
+            const __m128i old_lo = _mm_loadu_si128((const __m128i *)&v->old_metrics[i]);
+            const __m128i old_hi = _mm_loadu_si128((const __m128i *)&v->old_metrics[i + 32]);
+            const __m128i m0 = _mm_add_epi32(old_lo, metric);
+            const __m128i m1 = _mm_add_epi32(old_hi, metric_inv);
+            const __m128i m2 = _mm_add_epi32(old_lo, metric_inv);
+            const __m128i m3 = _mm_add_epi32(old_hi, metric);
+            const __m128i d0 = _mm_cmpgt_epi32(_mm_sub_epi32(m0, m1), zero);
+            const __m128i d1 = _mm_cmpgt_epi32(_mm_sub_epi32(m2, m3), zero);
+            const __m128i n0 = _mm_or_si128(_mm_and_si128(d0, m1), _mm_andnot_si128(d0, m0));
+            const __m128i n1 = _mm_or_si128(_mm_and_si128(d1, m3), _mm_andnot_si128(d1, m2));
+            unsigned int decisions;
+            _mm_storeu_si128((__m128i *)&v->new_metrics[2 * i], _mm_unpacklo_epi32(n0, n1));
+            _mm_storeu_si128((__m128i *)&v->new_metrics[2 * i + 4], _mm_unpackhi_epi32(n0, n1));
+            decisions = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_unpacklo_epi32(d0, d1)));
+            decisions |= (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_unpackhi_epi32(d0, d1))) << 4U;
+            d->w[i / 16] |= decisions << ((2U * i) & 31U);
+        }
+}
+#elif V27_ACS_NEON
+static inline void v27_acs(v27_t *v, v27_decision_t *d, unsigned char sym0, unsigned char sym1)
+{
+    static const uint32_t bit_weights[4] = {1U, 2U, 4U, 8U};
+    const uint32x4_t weights = vld1q_u32(bit_weights);
+    const int32x4_t zero = vdupq_n_s32(0);
+    const uint32x4_t s0 = vdupq_n_u32(sym0);
+    const uint32x4_t s1 = vdupq_n_u32(sym1);
+    const uint32x4_t k510 = vdupq_n_u32(510);
+    unsigned int i;
+    unsigned int h;
+
+    for (i = 0; i < 32; i += 8)
+        {
+            const uint16x8_t c0_8 = vmovl_u8(vld1_u8(&v->poly->c0[i]));
+            const uint16x8_t c1_8 = vmovl_u8(vld1_u8(&v->poly->c1[i]));
+            for (h = 0; h < 2; h++)
+                {
+                    const unsigned int j = i + 4 * h;
+                    const uint32x4_t c0 = vmovl_u16(h == 0 ? vget_low_u16(c0_8) : vget_high_u16(c0_8));
+                    const uint32x4_t c1 = vmovl_u16(h == 0 ? vget_low_u16(c1_8) : vget_high_u16(c1_8));
+                    const uint32x4_t metric = vaddq_u32(veorq_u32(c0, s0), veorq_u32(c1, s1));
+                    const uint32x4_t metric_inv = vsubq_u32(k510, metric);
+                    const uint32x4_t old_lo = vld1q_u32(&v->old_metrics[j]);
+                    const uint32x4_t old_hi = vld1q_u32(&v->old_metrics[j + 32]);
+                    const uint32x4_t m0 = vaddq_u32(old_lo, metric);
+                    const uint32x4_t m1 = vaddq_u32(old_hi, metric_inv);
+                    const uint32x4_t m2 = vaddq_u32(old_lo, metric_inv);
+                    const uint32x4_t m3 = vaddq_u32(old_hi, metric);
+                    const uint32x4_t d0 = vcgtq_s32(vreinterpretq_s32_u32(vsubq_u32(m0, m1)), zero);
+                    const uint32x4_t d1 = vcgtq_s32(vreinterpretq_s32_u32(vsubq_u32(m2, m3)), zero);
+                    const uint32x4x2_t n = vzipq_u32(vbslq_u32(d0, m1, m0), vbslq_u32(d1, m3, m2));
+                    const uint32x4x2_t dz = vzipq_u32(d0, d1);
+                    unsigned int decisions;
+                    vst1q_u32(&v->new_metrics[2 * j], n.val[0]);
+                    vst1q_u32(&v->new_metrics[2 * j + 4], n.val[1]);
+                    decisions = vaddvq_u32(vandq_u32(dz.val[0], weights));
+                    decisions |= vaddvq_u32(vandq_u32(dz.val[1], weights)) << 4U;
+                    d->w[j / 16] |= decisions << ((2U * j) & 31U);
+                }
+        }
+}
+#else
+static inline void v27_acs(v27_t *v, v27_decision_t *d, unsigned char sym0, unsigned char sym1)
+{
+    BFLY(0U);
+    BFLY(1U);
+    BFLY(2U);
+    BFLY(3U);
+    BFLY(4U);
+    BFLY(5U);
+    BFLY(6U);
+    BFLY(7U);
+    BFLY(8U);
+    BFLY(9U);
+    BFLY(10U);
+    BFLY(11U);
+    BFLY(12U);
+    BFLY(13U);
+    BFLY(14U);
+    BFLY(15U);
+    BFLY(16U);
+    BFLY(17U);
+    BFLY(18U);
+    BFLY(19U);
+    BFLY(20U);
+    BFLY(21U);
+    BFLY(22U);
+    BFLY(23U);
+    BFLY(24U);
+    BFLY(25U);
+    BFLY(26U);
+    BFLY(27U);
+    BFLY(28U);
+    BFLY(29U);
+    BFLY(30U);
+    BFLY(31U);
+}
+#endif
+
 /** Update a v27_t decoder with a block of symbols.
  *
  * \param v Structure to update.
@@ -125,38 +303,7 @@ void v27_update(v27_t *v, const unsigned char *syms, int nbits)
             sym0 = *syms++;
             sym1 = *syms++;
 
-            BFLY(0U);
-            BFLY(1U);
-            BFLY(2U);
-            BFLY(3U);
-            BFLY(4U);
-            BFLY(5U);
-            BFLY(6U);
-            BFLY(7U);
-            BFLY(8U);
-            BFLY(9U);
-            BFLY(10U);
-            BFLY(11U);
-            BFLY(12U);
-            BFLY(13U);
-            BFLY(14U);
-            BFLY(15U);
-            BFLY(16U);
-            BFLY(17U);
-            BFLY(18U);
-            BFLY(19U);
-            BFLY(20U);
-            BFLY(21U);
-            BFLY(22U);
-            BFLY(23U);
-            BFLY(24U);
-            BFLY(25U);
-            BFLY(26U);
-            BFLY(27U);
-            BFLY(28U);
-            BFLY(29U);
-            BFLY(30U);
-            BFLY(31U);
+            v27_acs(v, d, sym0, sym1);
 
             /* Normalize metrics if they are nearing overflow */
             if (v->new_metrics[0] > (1U << 30U))
@@ -236,16 +383,17 @@ void v27_chainback_fixed(v27_t *v, unsigned char *data, unsigned int nbits,
  */
 void v27_chainback_likely(v27_t *v, unsigned char *data, unsigned int nbits)
 {
-    /* Determine state with minimum metric */
+    /* Determine state with minimum metric. Metric buffers are swapped after
+     * every update, so the latest path metrics are in old_metrics */
 
     int i;
     unsigned int best_metric = 0xffffffff;
     unsigned char best_state = 0;
     for (i = 0; i < 64; i++)
         {
-            if (v->new_metrics[i] < best_metric)
+            if (v->old_metrics[i] < best_metric)
                 {
-                    best_metric = v->new_metrics[i];
+                    best_metric = v->old_metrics[i];
                     best_state = i;
                 }
         }
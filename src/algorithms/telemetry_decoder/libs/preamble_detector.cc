@@ -0,0 +1,118 @@
+/*!
+ * \file preamble_detector.cc
+ * \brief Implementation of a sliding preamble correlator shared by the
+ * telemetry decoders.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "preamble_detector.h"
+#include <volk/volk.h>
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+
+
+Preamble_Detector::Preamble_Detector(const int32_t* preamble_symbols, int32_t length) : d_length(length > 0 ? length : 0)
+{
+    const auto n_words = static_cast<size_t>((d_length + 63) / 64);
+    d_hard_register = std::vector<uint64_t>(n_words, 0ULL);
+    d_preamble_bits = std::vector<uint64_t>(n_words, 0ULL);
+    d_soft_ring = std::vector<float>(2 * d_length, 0.0F);
+    d_preamble_float = std::vector<float>(d_length, 0.0F);
+    if (d_length % 64 == 0)
+        {
+            d_top_word_mask = ~0ULL;
+        }
+    else
+        {
+            d_top_word_mask = (1ULL << static_cast<uint32_t>(d_length % 64)) - 1ULL;
+        }
+
+    for (int32_t i = 0; i < d_length; i++)
+        {
+            // the first preamble symbol is the oldest one in the window
+            const int32_t bit = d_length - 1 - i;
+            if (preamble_symbols[i] < 0)
+                {
+                    d_preamble_bits[bit / 64] |= (1ULL << static_cast<uint32_t>(bit % 64));
+                    d_preamble_float[i] = -1.0F;
+                }
+            else
+                {
+                    d_preamble_float[i] = 1.0F;
+                }
+        }
+}
+
+
+void Preamble_Detector::reset()
+{
+    std::fill(d_hard_register.begin(), d_hard_register.end(), 0ULL);
+    std::fill(d_soft_ring.begin(), d_soft_ring.end(), 0.0F);
+    d_fill = 0;
+    d_soft_index = 0;
+}
+
+
+void Preamble_Detector::push(float symbol)
+{
+    if (d_length == 0)
+        {
+            return;
+        }
+    // shift the multi-word register by one position, from the most significant word
+    for (size_t w = d_hard_register.size() - 1; w > 0; w--)
+        {
+            d_hard_register[w] = (d_hard_register[w] << 1U) | (d_hard_register[w - 1] >> 63U);
+        }
+    d_hard_register[0] = (d_hard_register[0] << 1U) | (symbol < 0.0F ? 1ULL : 0ULL);
+    d_hard_register.back() &= d_top_word_mask;
+
+    // the oldest symbol is overwritten in both halves of the ring
+    d_soft_ring[d_soft_index] = symbol;
+    d_soft_ring[d_soft_index + d_length] = symbol;
+    d_soft_index++;
+    if (d_soft_index == d_length)
+        {
+            d_soft_index = 0;
+        }
+
+    if (d_fill < d_length)
+        {
+            d_fill++;
+        }
+}
+
+
+int32_t Preamble_Detector::correlation() const
+{
+    int32_t mismatches = 0;
+    for (size_t w = 0; w < d_hard_register.size(); w++)
+        {
+            mismatches += static_cast<int32_t>(std::bitset<64>(d_hard_register[w] ^ d_preamble_bits[w]).count());
+        }
+    return d_length - 2 * mismatches;
+}
+
+
+float Preamble_Detector::soft_correlation() const
+{
+    float result = 0.0F;
+    if (d_length > 0)
+        {
+            volk_32f_x2_dot_prod_32f(&result, &d_soft_ring[d_soft_index], d_preamble_float.data(), static_cast<unsigned int>(d_length));
+        }
+    return result;
+}
@@ -0,0 +1,98 @@
+/*!
+ * \file preamble_detector.h
+ * \brief Interface of a sliding preamble correlator shared by the telemetry
+ * decoders.
+ *
+ * Hard decisions on the incoming symbols are kept in a bit-packed shift
+ * register, so the correlation of the sliding window against the preamble
+ * is computed with XOR and population count operations on 64-bit words
+ * instead of a branch per symbol. A soft-decision correlation over a
+ * mirrored float ring (always contiguous) is also provided, computed by a
+ * VOLK dot product kernel.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PREAMBLE_DETECTOR_H
+#define GNSS_SDR_PREAMBLE_DETECTOR_H
+
+#include <cstdint>
+#include <vector>
+
+/*!
+ * \brief Sliding correlator of the last N received symbols against a
+ * preamble of N symbols.
+ *
+ * The preamble is given in bipolar form (+1 / -1). The window holds the last
+ * N symbols pushed, the oldest one being aligned with the first preamble
+ * symbol. A symbol x is decided as -1 if x < 0, and as +1 otherwise, so
+ * correlation() returns exactly the value of the former per-symbol
+ * sign-test loops of the telemetry decoders.
+ */
+class Preamble_Detector
+{
+public:
+    Preamble_Detector() = default;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] preamble_symbols  Preamble in bipolar form (+1 / -1).
+     * \param[in] length            Number of symbols of the preamble.
+     */
+    Preamble_Detector(const int32_t* preamble_symbols, int32_t length);
+
+    ~Preamble_Detector() = default;
+
+    //! Empties the correlation window
+    void reset();
+
+    //! Shifts a new symbol into the correlation window
+    void push(float symbol);
+
+    /*!
+     * \brief Hard-decision correlation of the window against the preamble,
+     * in the range [-N, N]. Until the window is full, the received symbols
+     * are aligned with the end of the preamble and the missing ones count as
+     * +1.
+     */
+    int32_t correlation() const;
+
+    /*!
+     * \brief Soft-decision correlation (dot product of the received symbols
+     * with the bipolar preamble). Until the window is full, the missing
+     * symbols count as 0.
+     */
+    float soft_correlation() const;
+
+    //! Number of symbols received since the last reset, saturated at the preamble length
+    inline int32_t fill() const { return d_fill; }
+
+    //! True if the correlation window is full
+    inline bool ready() const { return d_fill == d_length; }
+
+    inline int32_t length() const { return d_length; }
+
+private:
+    std::vector<uint64_t> d_hard_register;  // bit k of the register is the hard decision on the symbol received k symbols ago
+    std::vector<uint64_t> d_preamble_bits;  // preamble packed with the same layout, 1 means -1
+    std::vector<float> d_soft_ring;         // mirrored ring, d_soft_ring[i] == d_soft_ring[i + N]
+    std::vector<float> d_preamble_float;
+    uint64_t d_top_word_mask{0ULL};
+    int32_t d_length{0};
+    int32_t d_fill{0};
+    int32_t d_soft_index{0};  // position of the oldest symbol in the ring
+};
+
+#endif  // GNSS_SDR_PREAMBLE_DETECTOR_H
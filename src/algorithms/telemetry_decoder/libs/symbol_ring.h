@@ -0,0 +1,137 @@
+/*!
+ * \file symbol_ring.h
+ * \brief Fixed-capacity history of the last received symbols, stored in a
+ * mirrored ring so that any window of consecutive symbols is contiguous in
+ * memory.
+ *
+ * Each element is written twice, at positions i and i + capacity of a buffer
+ * of twice the capacity. The capacity elements starting at the position of
+ * the oldest one are therefore always the whole history in order, and frame
+ * decoders get a span over them with no copy and no wrap-around handling.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_SYMBOL_RING_H
+#define GNSS_SDR_SYMBOL_RING_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#if HAS_STD_SPAN
+#include <span>
+namespace own = std;
+#else
+#include <gsl/gsl>
+namespace own = gsl;
+#endif
+
+/*!
+ * \brief History of the last capacity() symbols with the interface of the
+ * boost::circular_buffer subset used by the telemetry decoders: element 0 is
+ * the oldest one, and push_back() overwrites it when the history is full.
+ */
+template <typename T>
+class Symbol_Ring
+{
+public:
+    Symbol_Ring() = default;
+
+    explicit Symbol_Ring(size_t capacity)
+    {
+        set_capacity(capacity);
+    }
+
+    /*!
+     * \brief Changes the capacity. As in boost::circular_buffer, the oldest
+     * elements are kept if the history does not fit in the new capacity.
+     */
+    void set_capacity(size_t capacity)
+    {
+        if (capacity == d_capacity)
+            {
+                return;
+            }
+        const size_t kept = std::min(d_size, capacity);
+        std::vector<T> buffer(2 * capacity);
+        for (size_t i = 0; i < kept; i++)
+            {
+                buffer[i] = d_buffer[d_head + i];
+                buffer[i + capacity] = buffer[i];
+            }
+        d_buffer.swap(buffer);
+        d_capacity = capacity;
+        d_size = kept;
+        d_head = 0;
+    }
+
+    //! Appends a symbol, discarding the oldest one if the history is full
+    inline void push_back(const T& symbol)
+    {
+        if (d_capacity == 0)
+            {
+                return;
+            }
+        if (d_size < d_capacity)
+            {
+                write((d_head + d_size) % d_capacity, symbol);
+                d_size++;
+            }
+        else
+            {
+                write(d_head, symbol);
+                d_head = (d_head + 1 == d_capacity) ? 0 : d_head + 1;
+            }
+    }
+
+    inline void clear()
+    {
+        d_size = 0;
+        d_head = 0;
+    }
+
+    //! Element i of the history, 0 being the oldest one
+    inline const T& operator[](size_t i) const { return d_buffer[d_head + i]; }
+
+    inline const T& front() const { return d_buffer[d_head]; }
+    inline const T& back() const { return d_buffer[d_head + d_size - 1]; }
+
+    //! Contiguous view of length symbols starting at element first of the history
+    inline own::span<const T> span(size_t first, size_t length) const
+    {
+        return own::span<const T>(d_buffer.data() + d_head + first, length);
+    }
+
+    inline const T* begin() const { return d_buffer.data() + d_head; }
+    inline const T* end() const { return d_buffer.data() + d_head + d_size; }
+
+    inline size_t size() const { return d_size; }
+    inline size_t capacity() const { return d_capacity; }
+    inline bool empty() const { return d_size == 0; }
+    inline bool full() const { return d_size == d_capacity; }
+
+private:
+    inline void write(size_t position, const T& symbol)
+    {
+        d_buffer[position] = symbol;
+        d_buffer[position + d_capacity] = symbol;
+    }
+
+    std::vector<T> d_buffer;  // mirrored storage, d_buffer[i] == d_buffer[i + d_capacity]
+    size_t d_capacity{0};
+    size_t d_size{0};
+    size_t d_head{0};  // position of the oldest element
+};
+
+#endif  // GNSS_SDR_SYMBOL_RING_H
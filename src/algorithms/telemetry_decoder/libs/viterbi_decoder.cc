@@ -1,12 +1,11 @@
 /*!
  * \file viterbi_decoder.cc
- * \brief Implementation of a Viterbi decoder class based on the Iterative Solutions
- * Coded Modulation Library by Matthew C. Valenti
- * \author Daniel Fehr 2013. daniel.co(at)bluewin.ch
+ * \brief Implementation of a Viterbi decoder class for the K=7, r=1/2
+ * convolutional code used by Galileo I/NAV and F/NAV, GPS CNAV and SBAS.
  *
  * -------------------------------------------------------------------------
  *
- * Copyright (C) 2010-2019  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
  *
  * GNSS-SDR is a software defined Global Navigation
  *          Satellite Systems receiver
@@ -20,562 +19,225 @@
 
 #include "viterbi_decoder.h"
 #include <glog/logging.h>
-#include <algorithm>  // for fill_n
-#include <ostream>    // for operator<<, basic_ostream, char_traits, endl
+#include <algorithm>  // for min, max
+#include <cmath>      // for fabs, lround
 
 // logging
-#define EVENT 2   // logs important events which don't occur every block
-#define FLOW 3    // logs the function calls of block processing functions
-#define BLOCK 4   // once per block
-#define SAMPLE 5  // about one log entry per sample
-#define LMORE 6   // many entries per sample / very specific stuff
+#define FLOW 3   // logs the function calls of block processing functions
+#define BLOCK 4  // once per block
 
-
-const float MAXLOG = 1e7; /* Define infinity */
-
-Viterbi_Decoder::Viterbi_Decoder(const int g_encoder[], const int KK, const int nn)
+namespace
 {
-    d_nn = nn;  // Coding rate 1/n
-    d_KK = KK;  // Constraint Length
-
-    // derived code properties
-    d_mm = d_KK - 1;
-    d_states = 1U << d_mm;         /* 2^mm */
-    d_number_symbols = 1U << d_nn; /* 2^nn */
+const int32_t VITERBI_KK = 7;                       // Constraint length
+const int32_t VITERBI_MM = VITERBI_KK - 1;          // Encoder memory (tail bits)
+const int32_t N_BRANCHES_FOR_INDICATOR_METRIC = 500;
+const float SOFT_SYMBOL_AMPLITUDE = 64.0;  // mean symbol amplitude after quantization
 
-    /* create appropriate transition matrices (trellis) */
-    d_out0.reserve(d_states);
-    d_out1.reserve(d_states);
-    d_state0.reserve(d_states);
-    d_state1.reserve(d_states);
-
-    nsc_transit(d_out0.data(), d_state0.data(), 0, g_encoder, d_KK, d_nn);
-    nsc_transit(d_out1.data(), d_state1.data(), 1, g_encoder, d_KK, d_nn);
-
-    // initialise trellis state
-    d_trellis_state_is_initialised = false;
-    Viterbi_Decoder::init_trellis_state();
-}
-
-
-void Viterbi_Decoder::reset()
+// The viterbi27.c engine shifts the encoder register in the opposite
+// direction, so the generators have to be bit-reversed
+signed char reverse_generator(int32_t g)
 {
-    init_trellis_state();
+    int32_t r = 0;
+    for (int32_t i = 0; i < VITERBI_KK; i++)
+        {
+            r = (r << 1) | ((g >> i) & 1);
+        }
+    return static_cast<signed char>(r);
 }
 
 
-/* Function decode_block()
- Description: Uses the Viterbi algorithm to perform hard-decision decoding of a convolutional code.
- Input parameters:
- r[]    The received signal in LLR-form. For BPSK, must be in form r = 2*a*y/(sigma^2).
- LL    The number of data bits to be decoded (doesn't include the mm zero-tail-bits)
- Output parameters:
- output_u_int[]    Hard decisions on the data bits (without the mm zero-tail-bits)
- */
-float Viterbi_Decoder::decode_block(const double input_c[], int output_u_int[], const int LL)
+int32_t parity(int32_t x)
 {
-    int state;
-    int decoding_length_mismatch;
-
-    VLOG(FLOW) << "decode_block(): LL=" << LL;
-
-    // init
-    init_trellis_state();
-    // do add compare select
-    do_acs(input_c, LL + d_mm);
-    // tail, no need to output -> traceback, but don't decode
-    state = do_traceback(d_mm);
-    // traceback and decode
-    decoding_length_mismatch = do_tb_and_decode(d_mm, LL, state, output_u_int, d_indicator_metric);
-
-    VLOG(FLOW) << "decoding length mismatch: " << decoding_length_mismatch;
-
-    return d_indicator_metric;
+    int32_t p = 0;
+    while (x)
+        {
+            p ^= 1;
+            x &= x - 1;
+        }
+    return p;
 }
+}  // namespace
 
 
-float Viterbi_Decoder::decode_continuous(const double sym[],
-    const int traceback_depth,
-    int bits[],
-    const int nbits_requested,
-    int& nbits_decoded)
+Viterbi_Decoder::Viterbi_Decoder(const std::array<int32_t, 2>& g_encoder, int32_t max_bits)
+    : d_g_encoder(g_encoder),
+      d_mean_amplitude(0.0),
+      d_max_bits(0),
+      d_pending_bits(0),
+      d_history_head(0),
+      d_encoder_state(0)
 {
-    int state;
-    int decoding_length_mismatch;
-
-    VLOG(FLOW) << "decode_continuous(): nbits_requested=" << nbits_requested;
-
-    // do add compare select
-    do_acs(sym, nbits_requested);
-    // the ML sequence in the newest part of the trellis can not be decoded
-    // since it depends on the future values -> traceback, but don't decode
-    state = do_traceback(traceback_depth);
-    // traceback and decode
-    decoding_length_mismatch = do_tb_and_decode(traceback_depth, nbits_requested, state, bits, d_indicator_metric);
-    nbits_decoded = nbits_requested + decoding_length_mismatch;
-
-    VLOG(FLOW) << "decoding length mismatch (continuous decoding): " << decoding_length_mismatch;
-
-    return d_indicator_metric;
+    const std::array<signed char, 2> poly{{reverse_generator(g_encoder[0]), reverse_generator(g_encoder[1])}};
+    v27_poly_init(&d_poly, poly.data());
+    resize_history(std::max(max_bits, VITERBI_KK));
 }
 
 
-void Viterbi_Decoder::init_trellis_state()
+void Viterbi_Decoder::resize_history(int32_t nbits)
 {
-    int state;
-    // if trellis state has been initialised, free old state memory
-    if (d_trellis_state_is_initialised)
-        {
-            // init trellis state
-            d_pm_t.clear();
-            d_rec_array.clear();
-            d_metric_c.clear();
-        }
-
-    // reserve new trellis state memory
-    d_pm_t.reserve(d_states);
-    d_trellis_paths = std::deque<Prev>();
-    d_rec_array.reserve(d_nn);
-    d_metric_c.reserve(d_number_symbols);
-    d_trellis_state_is_initialised = true;
-
-    /* initialize trellis */
-    for (state = 0; state < d_states; state++)
-        {
-            d_pm_t[state] = -MAXLOG;
-            // d_pm_t_next[state] = -MAXLOG;
-        }
-    d_pm_t[0] = 0; /* start in all-zeros state */
-
-    d_indicator_metric = 0;
+    d_max_bits = nbits;
+    d_decisions.resize(d_max_bits);
+    d_soft_symbols.resize(2 * d_max_bits);
+    d_decoded_bytes.resize(d_max_bits / 8 + 1);
+    d_symbol_history.resize(2 * d_max_bits);
+    reset();
 }
 
 
-int Viterbi_Decoder::do_acs(const double sym[], int nbits)
+void Viterbi_Decoder::reset()
 {
-    int t;
-    int i;
-    int state_at_t;
-    float metric;
-    float max_val;
-    std::vector<float> pm_t_next(d_states);
-
-    /* t:
-     *    - state: state at t
-     *    - d_prev_section[state_at_t]: path metric at t for state state_at_t
-     *    - d_out0[state_at_t]: sent symbols for a data bit 0 if state is state_at_t at time t
-     *
-     */
-
-    for (state_at_t = 0; state_at_t < d_states; state_at_t++)
-        {
-            pm_t_next[state_at_t] = -MAXLOG;
-        }
-
-    /* go through trellis */
-    for (t = 0; t < nbits; t++)
-        {
-            /* Temporarily store the received symbols current decoding step */
-            for (i = 0; i < d_nn; i++)
-                {
-                    d_rec_array[i] = static_cast<float>(sym[d_nn * t + i]);
-                }
-
-            /* precompute all possible branch metrics */
-            for (i = 0; i < d_number_symbols; i++)
-                {
-                    d_metric_c[i] = gamma(d_rec_array.data(), i, d_nn);
-                    VLOG(LMORE) << "metric for (tx_sym=" << i << "|ry_sym=(" << d_rec_array[0] << ", " << d_rec_array[1] << ") = " << d_metric_c[i];
-                }
-
-            // find the survivor branches leading the trellis states at t+1
-            Prev next_trellis_states(d_states, t + 1);
-            /* step through all states */
-            for (state_at_t = 0; state_at_t < d_states; state_at_t++)
-                {
-                    int next_state_if_0 = d_state0[state_at_t];
-                    int next_state_if_1 = d_state1[state_at_t];
-
-                    /* hypothesis: info bit is a zero */
-                    int bm_0 = d_metric_c[d_out0[state_at_t]];
-                    metric = d_pm_t[state_at_t] + bm_0;  // path metric + zerobranch metric
-
-                    /* store new metric if more than metric in storage */
-                    if (metric > pm_t_next[next_state_if_0])
-                        {
-                            pm_t_next[next_state_if_0] = metric;
-                            next_trellis_states.set_current_state_as_ancestor_of_next_state(next_state_if_0, state_at_t);
-                            next_trellis_states.set_decoded_bit_for_next_state(next_state_if_0, 0);
-                            next_trellis_states.set_survivor_branch_metric_of_next_state(next_state_if_0, bm_0);
-                        }
-
-                    /* hypothesis: info bit is a one */
-                    int bm_1 = d_metric_c[d_out1[state_at_t]];
-                    metric = d_pm_t[state_at_t] + bm_1;  // path metric + onebranch metric
-
-                    /* store new metric if more than metric in storage */
-                    if (metric > pm_t_next[next_state_if_1])
-                        {
-                            pm_t_next[next_state_if_1] = metric;
-                            next_trellis_states.set_current_state_as_ancestor_of_next_state(next_state_if_1, state_at_t);
-                            next_trellis_states.set_decoded_bit_for_next_state(next_state_if_1, 1);
-                            next_trellis_states.set_survivor_branch_metric_of_next_state(next_state_if_1, bm_1);
-                        }
-                }
-
-            d_trellis_paths.push_front(next_trellis_states);
-
-            /* normalize -> afterwards, the largest metric value is always 0 */
-            // max_val = 0;
-            max_val = -MAXLOG;
-            for (state_at_t = 0; state_at_t < d_states; state_at_t++)
-                {
-                    if (pm_t_next[state_at_t] > max_val)
-                        {
-                            max_val = pm_t_next[state_at_t];
-                        }
-                }
-            VLOG(LMORE) << "max_val at t=" << t << ": " << max_val;
-            for (state_at_t = 0; state_at_t < d_states; state_at_t++)
-                {
-                    d_pm_t[state_at_t] = pm_t_next[state_at_t] - max_val;
-                    pm_t_next[state_at_t] = -MAXLOG;
-                }
-        }
-
-    return t;
+    v27_init(&d_v27, d_decisions.data(), d_max_bits, &d_poly, 0);
+    d_mean_amplitude = 0.0;
+    d_pending_bits = 0;
+    d_history_head = 0;
+    d_encoder_state = 0;
 }
 
 
-int Viterbi_Decoder::do_traceback(size_t traceback_length)
+template <typename T>
+void Viterbi_Decoder::quantize_symbols(const T sym[], int32_t nbits, float scale)
 {
-    // traceback_length is in bits
-    int state;
-    std::deque<Prev>::iterator it;
-
-    VLOG(FLOW) << "do_traceback(): traceback_length=" << traceback_length << std::endl;
-
-    if (d_trellis_paths.size() < traceback_length)
+    // offset binary soft symbols, 0x00 = strong 0, 0xff = strong 1
+    for (int32_t i = 0; i < 2 * nbits; i++)
         {
-            traceback_length = d_trellis_paths.size();
+            const auto q = std::lround(static_cast<float>(sym[i]) * scale) + 128;
+            d_soft_symbols[i] = static_cast<unsigned char>(std::min<decltype(q)>(std::max<decltype(q)>(q, 0), 255));
         }
-
-    state = 0;  // maybe start not at state 0, but at state with best metric
-    for (it = d_trellis_paths.begin(); it < d_trellis_paths.begin() + traceback_length; ++it)
-        {
-            state = it->get_anchestor_state_of_current_state(state);
-        }
-    return state;
 }
 
 
-int Viterbi_Decoder::do_tb_and_decode(int traceback_length, int requested_decoding_length, int state, int output_u_int[], float& indicator_metric)
+float Viterbi_Decoder::branch_metric(const float rec[], int32_t bit)
 {
-    int n_of_branches_for_indicator_metric = 500;
-    int t_out;
-    std::deque<Prev>::iterator it;
-    int decoding_length_mismatch;
-    int overstep_length;
-    int n_im = 0;
-
-    VLOG(FLOW) << "do_tb_and_decode(): requested_decoding_length=" << requested_decoding_length;
-    // decode only decode_length bits -> overstep newer bits which are too much
-    decoding_length_mismatch = d_trellis_paths.size() - (traceback_length + requested_decoding_length);
-    VLOG(BLOCK) << "decoding_length_mismatch=" << decoding_length_mismatch;
-    overstep_length = decoding_length_mismatch >= 0 ? decoding_length_mismatch : 0;
-    VLOG(BLOCK) << "overstep_length=" << overstep_length;
-
-    for (it = d_trellis_paths.begin() + traceback_length;
-         it < d_trellis_paths.begin() + traceback_length + overstep_length; ++it)
+    // same convention as nsc_enc_bit(): the new bit enters at the MSB of the register
+    const int32_t reg = (bit << VITERBI_MM) ^ d_encoder_state;
+    d_encoder_state = reg >> 1;
+    float metric = 0.0;
+    for (int32_t j = 0; j < 2; j++)
         {
-            state = it->get_anchestor_state_of_current_state(state);
-        }
-    t_out = d_trellis_paths.end() - (d_trellis_paths.begin() + traceback_length + overstep_length) - 1;  // requested_decoding_length-1;
-    indicator_metric = 0;
-    for (it = d_trellis_paths.begin() + traceback_length + overstep_length; it < d_trellis_paths.end(); ++it)
-        {
-            if (it - (d_trellis_paths.begin() + traceback_length + overstep_length) < n_of_branches_for_indicator_metric)
+            if (parity(reg & d_g_encoder[j]))
                 {
-                    n_im++;
-                    indicator_metric += it->get_metric_of_current_state(state);
-                    VLOG(SAMPLE) << "@t=" << it->get_t() << " b=" << it->get_bit_of_current_state(state) << " sm=" << indicator_metric << " d=" << it->get_metric_of_current_state(state);
+                    metric += rec[j];
                 }
-            output_u_int[t_out] = it->get_bit_of_current_state(state);
-            state = it->get_anchestor_state_of_current_state(state);
-            t_out--;
-        }
-    if (n_im > 0)
-        {
-            indicator_metric /= n_im;
         }
-
-    VLOG(BLOCK) << "indicator metric: " << indicator_metric;
-    // remove old states
-    if (d_trellis_paths.begin() + traceback_length + overstep_length <= d_trellis_paths.end())
-        {
-            d_trellis_paths.erase(d_trellis_paths.begin() + traceback_length + overstep_length, d_trellis_paths.end());
-        }
-    return decoding_length_mismatch;
+    return metric;
 }
 
 
-/* function Gamma()
-
- Description: Computes the branch metric used for decoding.
-
- Output parameters:
- (returned float)     The metric between the hypothetical symbol and the recevieved vector
-
- Input parameters:
- rec_array            The received vector, of length nn
- symbol                The hypothetical symbol
- nn                    The length of the received vector
-
- This function is used by siso()  */
-float Viterbi_Decoder::gamma(const float rec_array[], int symbol, int nn)
+int32_t Viterbi_Decoder::decoded_bit(int32_t index) const
 {
-    float rm = 0;
-    int i;
-    unsigned int mask = 1U;
-    float txsym;
-
-    for (i = 0; i < nn; i++)
-        {
-            // if (symbol & mask) rm += rec_array[nn - i - 1];
-            txsym = symbol & mask ? 1 : -1;
-            rm += txsym * rec_array[nn - i - 1];
-            mask = mask << 1U;
-        }
-    // rm = rm > 50 ? rm : -1000;
-
-    return (rm);
+    // v27_chainback_*() output is delayed by the encoder memory: the decision
+    // taken at a given trellis section is the bit that entered the shift
+    // register VITERBI_MM sections before
+    const int32_t i = index + VITERBI_MM;
+    return (d_decoded_bytes[i >> 3] >> (7 - (i & 7))) & 1;
 }
 
 
-/* function that creates the transit and output vectors */
-void Viterbi_Decoder::nsc_transit(int output_p[], int trans_p[], int input, const int g[],
-    int KK, int nn)
+float Viterbi_Decoder::decode_block(const float input_c[], int32_t output_u_int[], int32_t LL)
 {
-    int nextstate[1];
-    int state;
-    int states;
-    states = (1U << (KK - 1)); /* The number of states: 2^mm */
-
-    /* Determine the output and next state for each possible starting state */
-    for (state = 0; state < states; state++)
+    const int32_t nbits = LL + VITERBI_MM;
+    VLOG(FLOW) << "decode_block(): LL=" << LL;
+    if (nbits > d_max_bits)
         {
-            output_p[state] = nsc_enc_bit(nextstate, input, state, g, KK, nn);
-            trans_p[state] = nextstate[0];
+            resize_history(nbits);
         }
-}
-
-
-/* Function nsc_enc_bit()
-
- Description: Convolutionally encodes a single bit using a rate 1/n encoder.
- Takes in one input bit at a time, and produces a n-bit output.
-
- Input parameters:
- input        The input data bit (i.e. a 0 or 1).
- state_in    The starting state of the encoder (an int from 0 to 2^m-1).
- g[]            An n-element vector containing the code generators in binary form.
- KK            The constraint length of the convolutional code.
- nn            number of symbols bits per input bits (rate 1/nn)
-
- Output parameters:
- output_p[]        An n-element vector containing the encoded bits.
- state_out_p[]    An integer containing the final state of the encoder
- (i.e. the state after encoding this bit)
+    reset();
 
- This function is used by rsc_encode(), nsc_transit(), rsc_transit(), and nsc_transit() */
-int Viterbi_Decoder::nsc_enc_bit(int state_out_p[], int input, int state_in,
-    const int g[], int KK, int nn)
-{
-    /* declare variables */
-    int state;
-    int i;
-    int out = 0;
-
-    /* create a word made up of state and new input */
-    state = (input << (KK - 1)) ^ state_in;
-
-    /* AND the word with the generators */
-    for (i = 0; i < nn; i++)
+    float amplitude = 0.0;
+    for (int32_t i = 0; i < 2 * nbits; i++)
         {
-            /* update output symbol */
-            out = (out << 1) + parity_counter(state & g[i], KK);
+            amplitude += std::fabs(input_c[i]);
         }
+    amplitude /= static_cast<float>(2 * nbits);
+    quantize_symbols(input_c, nbits, amplitude > 0.0 ? SOFT_SYMBOL_AMPLITUDE / amplitude : 0.0F);
 
-    /* shift the state to make the new state */
-    state_out_p[0] = state >> 1;
-    return (out);
-}
-
-/* function parity_counter()
+    // add compare select, and traceback from the all-zeros state forced by the tail bits
+    v27_update(&d_v27, d_soft_symbols.data(), nbits);
+    v27_chainback_fixed(&d_v27, d_decoded_bytes.data(), nbits, 0);
 
- Description: Determines if a symbol has odd (1) or even (0) parity
-
- Output parameters:
- (returned int): The symbol's parity = 1 for odd and 0 for even
-
- Input parameters:
- symbol:  The integer-valued symbol
- length:  The highest bit position in the symbol
-
- This function is used by nsc_enc_bit(), rsc_enc_bit(), and rsc_tail()  */
-int Viterbi_Decoder::parity_counter(int symbol, int length)
-{
-    int counter;
-    unsigned int temp_parity = 0;
-    for (counter = 0; counter < length; counter++)
+    float indicator_metric = 0.0;
+    const int32_t n_im = std::min(LL, N_BRANCHES_FOR_INDICATOR_METRIC);
+    for (int32_t t = 0; t < LL; t++)
         {
-            temp_parity = temp_parity ^ (symbol & 1U);
-            symbol = symbol >> 1U;
+            output_u_int[t] = decoded_bit(t);
+            if (t < n_im)
+                {
+                    indicator_metric += branch_metric(&input_c[2 * t], output_u_int[t]);
+                }
         }
-    return (temp_parity);
-}
-
-
-// prev helper class
-Viterbi_Decoder::Prev::Prev(int states, int t)
-{
-    this->t = t;
-    num_states = states;
-    state.reserve(num_states);
-    v_bit.reserve(num_states);
-    v_metric.reserve(num_states);
-    refcount = 1;
-    std::fill_n(state.begin(), num_states, 0);
-    std::fill_n(v_bit.begin(), num_states, 0);
-    std::fill_n(v_metric.begin(), num_states, 0.0F);
-}
-
-
-// copy constructor
-Viterbi_Decoder::Prev::Prev(const Prev& prev)
-{
-    refcount = prev.refcount;
-    refcount++;
-    t = prev.t;
-    state = prev.state;
-    num_states = prev.num_states;
-    v_bit = prev.v_bit;
-    v_metric = prev.v_metric;
-    VLOG(LMORE) << "Prev("
-                << "?"
-                << ", " << t << ")"
-                << " copy, new refcount = " << refcount;
-}
-
-
-// assignment constructor
-Viterbi_Decoder::Prev& Viterbi_Decoder::Prev::operator=(const Prev& other)
-{
-    // check for self-assignment
-    if (&other == this)
+    if (n_im > 0)
         {
-            return *this;
-        }
-
-    // handle old resources
-    if (refcount != 1)
-        {  // this object is not anymore using them
-            refcount--;
+            indicator_metric /= static_cast<float>(n_im);
         }
-
-    // increase ref counter for this resource set
-    refcount = other.refcount;
-    refcount++;
-
-    // take over resources
-    t = other.t;
-    state = other.state;
-    v_bit = other.v_bit;
-    v_metric = other.v_metric;
-
-    VLOG(LMORE) << "Prev("
-                << "?"
-                << ", " << t << ")"
-                << " assignment, new refcount = " << refcount;
-    return *this;
+    return indicator_metric;
 }
 
 
-Viterbi_Decoder::Prev::~Prev()
+float Viterbi_Decoder::decode_continuous(const double sym[],
+    int32_t traceback_depth,
+    int32_t bits[],
+    int32_t nbits_requested,
+    int32_t& nbits_decoded)
 {
-    if (refcount != 1)
-        {
-            refcount--;
-            VLOG(LMORE) << "~Prev("
-                        << "?"
-                        << ", " << t << ")"
-                        << " destructor after copy, new refcount = " << refcount;
-        }
-}
-
+    VLOG(FLOW) << "decode_continuous(): nbits_requested=" << nbits_requested;
+    const int32_t nbits = std::min(nbits_requested, d_max_bits);
 
-int Viterbi_Decoder::Prev::get_anchestor_state_of_current_state(int current_state)
-{
-    // std::cout << "get prev state: for state " << current_state << " at time " << t << ", the prev state at time " << t-1 << " is " << state[current_state] << std::endl;
-    if (num_states > current_state)
+    // the quantization step follows the (smoothed) amplitude of the input symbols
+    float amplitude = 0.0;
+    for (int32_t i = 0; i < 2 * nbits; i++)
         {
-            return state[current_state];
+            amplitude += static_cast<float>(std::fabs(sym[i]));
         }
-    // std::cout<<"alarm "<<"num_states="<<num_states<<" current_state="<<current_state<<std::endl;
-    // return state[current_state];
-    return 0;
-}
-
-
-int Viterbi_Decoder::Prev::get_bit_of_current_state(int current_state)
-{
-    // std::cout << "get prev bit  : for state " << current_state << " at time " << t << ", the send bit is " << bit[current_state] << std::endl;
-    if (num_states > current_state)
+    if (nbits > 0)
         {
-            return v_bit[current_state];
+            amplitude /= static_cast<float>(2 * nbits);
+            d_mean_amplitude = d_mean_amplitude > 0.0 ? 0.9F * d_mean_amplitude + 0.1F * amplitude : amplitude;
         }
-    return 0;
-}
-
+    quantize_symbols(sym, nbits, d_mean_amplitude > 0.0 ? SOFT_SYMBOL_AMPLITUDE / d_mean_amplitude : 0.0F);
 
-float Viterbi_Decoder::Prev::get_metric_of_current_state(int current_state)
-{
-    if (num_states > current_state)
+    // do add compare select
+    v27_update(&d_v27, d_soft_symbols.data(), nbits);
+    for (int32_t t = 0; t < nbits; t++)
         {
-            return v_metric[current_state];
+            d_symbol_history[2 * d_history_head] = static_cast<float>(sym[2 * t]);
+            d_symbol_history[2 * d_history_head + 1] = static_cast<float>(sym[2 * t + 1]);
+            d_history_head = (d_history_head + 1) % d_max_bits;
         }
-    return 0;
-}
-
-
-int Viterbi_Decoder::Prev::get_t()
-{
-    return t;
-}
-
-
-void Viterbi_Decoder::Prev::set_current_state_as_ancestor_of_next_state(int next_state, int current_state)
-{
-    if (num_states > next_state)
+    d_pending_bits += nbits;
+    if (d_pending_bits > d_max_bits)
         {
-            state[next_state] = current_state;
+            // the oldest sections have been overwritten in the decisions ring buffer
+            d_pending_bits = d_max_bits;
         }
-}
 
+    // the ML sequence in the newest part of the trellis can not be decoded
+    // since it depends on the future values -> traceback, but don't decode
+    const int32_t traceback_length = std::min(std::max(traceback_depth, VITERBI_MM), d_pending_bits);
+    const int32_t decoding_length_mismatch = d_pending_bits - (traceback_length + nbits_requested);
+    const int32_t overstep_length = std::max(decoding_length_mismatch, 0);
+    const int32_t n_decode = d_pending_bits - traceback_length - overstep_length;
+    nbits_decoded = nbits_requested + decoding_length_mismatch;
+    VLOG(BLOCK) << "decoding_length_mismatch=" << decoding_length_mismatch;
 
-void Viterbi_Decoder::Prev::set_decoded_bit_for_next_state(int next_state, int bit)
-{
-    if (num_states > next_state)
+    float indicator_metric = 0.0;
+    if (n_decode > 0)
         {
-            this->v_bit[next_state] = bit;
+            v27_chainback_likely(&d_v27, d_decoded_bytes.data(), d_pending_bits);
+            const int32_t oldest = (d_history_head - d_pending_bits + d_max_bits) % d_max_bits;
+            const int32_t n_im = std::min(n_decode, N_BRANCHES_FOR_INDICATOR_METRIC);
+            for (int32_t t = 0; t < n_decode; t++)
+                {
+                    bits[t] = decoded_bit(t);
+                    const float metric = branch_metric(&d_symbol_history[2 * ((oldest + t) % d_max_bits)], bits[t]);
+                    if (t < n_im)
+                        {
+                            indicator_metric += metric;
+                        }
+                }
+            indicator_metric /= static_cast<float>(n_im);
+            d_pending_bits -= n_decode;
         }
-}
 
-
-void Viterbi_Decoder::Prev::set_survivor_branch_metric_of_next_state(int next_state, float metric)
-{
-    if (num_states > next_state)
-        {
-            this->v_metric[next_state] = metric;
-        }
+    VLOG(BLOCK) << "indicator metric: " << indicator_metric;
+    return indicator_metric;
 }
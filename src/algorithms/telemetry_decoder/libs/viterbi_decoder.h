@@ -1,12 +1,16 @@
 /*!
  * \file viterbi_decoder.h
- * \brief Interface of a Viterbi decoder class based on the Iterative Solutions
- * Coded Modulation Library by Matthew C. Valenti
- * \author Daniel Fehr 2013. daniel.co(at)bluewin.ch
+ * \brief Interface of a Viterbi decoder class for the K=7, r=1/2
+ * convolutional code used by Galileo I/NAV and F/NAV, GPS CNAV and SBAS.
+ *
+ * The add-compare-select recursion is performed by the bit-packed K=7 engine
+ * of viterbi27.c (with SSE2, AVX2 and NEON implementations), so all the
+ * telemetry decoders share the same trellis code. All the trellis memory is
+ * allocated at construction time.
  *
  * -------------------------------------------------------------------------
  *
- * Copyright (C) 2010-2019  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
  *
  * GNSS-SDR is a software defined Global Navigation
  *          Satellite Systems receiver
@@ -21,97 +25,89 @@
 #ifndef GNSS_SDR_VITERBI_DECODER_H
 #define GNSS_SDR_VITERBI_DECODER_H
 
-#include <cstddef>  // for size_t
-#include <deque>
+extern "C"
+{
+#include "fec.h"
+}
+#include <array>
+#include <cstdint>
 #include <vector>
 
 /*!
- * \brief Class that implements a Viterbi decoder
+ * \brief Class that implements a Viterbi decoder for K=7, r=1/2
+ * convolutional codes
  */
 class Viterbi_Decoder
 {
 public:
-    Viterbi_Decoder(const int g_encoder[], const int KK, const int nn);
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] g_encoder  The two code generators, in the same form used by
+     * nsc_enc_bit() (e.g. {121, 91} for the 171 / 133 octal generators).
+     * \param[in] max_bits   Number of trellis sections to be preallocated
+     * (maximum block length plus tail bits, or maximum number of bits kept in
+     * the trellis in continuous decoding mode).
+     */
+    Viterbi_Decoder(const std::array<int32_t, 2>& g_encoder, int32_t max_bits);
     ~Viterbi_Decoder() = default;
+
+    // the decoder state holds pointers to its own path metric buffers
+    Viterbi_Decoder(const Viterbi_Decoder&) = delete;
+    Viterbi_Decoder& operator=(const Viterbi_Decoder&) = delete;
+
     void reset();
 
     /*!
-     * \brief Uses the Viterbi algorithm to perform hard-decision decoding of a convolutional code.
+     * \brief Uses the Viterbi algorithm to perform hard-decision decoding of a
+     * zero-terminated block.
      *
-     * \param[in]  input_c[]    The received signal in LLR-form. For BPSK, must be in form r = 2*a*y/(sigma^2).
-     * \param[in]  LL           The number of data bits to be decoded (does not include the mm zero-tail-bits)
+     * \param[in]  input_c[]  The received signal in LLR-form, 2 * (LL + 6)
+     * values. For BPSK, must be in form r = 2*a*y/(sigma^2).
+     * \param[in]  LL         The number of data bits to be decoded (does not
+     * include the 6 zero-tail-bits)
+     * \param[out] output_u_int[] Hard decisions on the data bits (without the
+     * zero-tail-bits)
      *
-     * \return  output_u_int[] Hard decisions on the data bits (without the mm zero-tail-bits)
+     * \return The mean branch metric along the decoded path.
      */
-    float decode_block(const double input_c[], int* output_u_int, const int LL);
+    float decode_block(const float input_c[], int32_t output_u_int[], int32_t LL);
 
-    float decode_continuous(const double sym[], const int traceback_depth, int bits[],
-        const int nbits_requested, int& nbits_decoded);
+    /*!
+     * \brief Decodes a continuous stream of symbols. The newest
+     * traceback_depth bits are kept in the trellis and decoded in subsequent
+     * calls.
+     *
+     * \return The mean branch metric along the decoded path, which can be
+     * used to compare different symbol alignments.
+     */
+    float decode_continuous(const double sym[], int32_t traceback_depth, int32_t bits[],
+        int32_t nbits_requested, int32_t& nbits_decoded);
 
 private:
-    class Prev
-    {
-    public:
-        int num_states;
-        Prev(int states, int t);
-        Prev(const Prev& prev);
-        Prev& operator=(const Prev& other);
-        ~Prev();
-
-        int get_anchestor_state_of_current_state(int current_state);
-        int get_bit_of_current_state(int current_state);
-        float get_metric_of_current_state(int current_state);
-        int get_t();
-        void set_current_state_as_ancestor_of_next_state(int next_state, int current_state);
-        void set_decoded_bit_for_next_state(int next_state, int bit);
-        void set_survivor_branch_metric_of_next_state(int next_state, float metric);
-
-    private:
-        std::vector<float> v_metric;
-        std::vector<int> state;
-        std::vector<int> v_bit;
-        int t;
-        int refcount;
-    };
-
-    // operations on the trellis (change decoder state)
-    void init_trellis_state();
-    int do_acs(const double sym[], int nbits);
-    int do_traceback(std::size_t traceback_length);
-    int do_tb_and_decode(int traceback_length, int requested_decoding_length, int state, int output_u_int[], float& indicator_metric);
-
-    // branch metric function
-    float gamma(const float rec_array[], int symbol, int nn);
+    template <typename T>
+    void quantize_symbols(const T sym[], int32_t nbits, float scale);
 
-    // trellis generation
-    void nsc_transit(int output_p[], int trans_p[], int input, const int g[], int KK, int nn);
-    int nsc_enc_bit(int state_out_p[], int input, int state_in, const int g[], int KK, int nn);
-    int parity_counter(int symbol, int length);
+    float branch_metric(const float rec[], int32_t bit);
+    void resize_history(int32_t nbits);
+    int32_t decoded_bit(int32_t index) const;
 
-    // trellis state
-    std::deque<Prev> d_trellis_paths;
-    std::vector<float> d_pm_t;
-    std::vector<float> d_metric_c;  /* Set of all possible branch metrics */
-    std::vector<float> d_rec_array; /* Received values for one trellis section */
+    v27_poly_t d_poly;
+    v27_t d_v27;
 
-    // trellis definition
-    std::vector<int> d_out0;
-    std::vector<int> d_state0;
-    std::vector<int> d_out1;
-    std::vector<int> d_state1;
+    std::vector<v27_decision_t> d_decisions;  // bit-packed decisions, one per trellis section
+    std::vector<unsigned char> d_soft_symbols;
+    std::vector<unsigned char> d_decoded_bytes;
+    std::vector<float> d_symbol_history;  // received symbols of the sections still in the trellis
 
-    // measures
-    float d_indicator_metric;
+    std::array<int32_t, 2> d_g_encoder;
 
-    // code properties
-    int d_KK;
-    int d_nn;
+    float d_mean_amplitude;
 
-    // derived code properties
-    int d_mm;
-    int d_states;
-    int d_number_symbols;
-    bool d_trellis_state_is_initialised;
+    int32_t d_max_bits;
+    int32_t d_pending_bits;    // sections in the trellis not decoded yet
+    int32_t d_history_head;    // position in d_symbol_history of the next section
+    int32_t d_encoder_state;  // encoder state before the oldest pending section
 };
 
 #endif  // GNSS_SDR_VITERBI_DECODER_H
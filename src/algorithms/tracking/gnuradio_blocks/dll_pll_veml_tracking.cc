@@ -32,17 +32,11 @@
 #include "Galileo_E1.h"
 #include "Galileo_E5a.h"
 #include "MATH_CONSTANTS.h"
-#include "beidou_b1i_signal_processing.h"
-#include "beidou_b3i_signal_processing.h"
-#include "galileo_e1_signal_processing.h"
-#include "galileo_e5_signal_processing.h"
 #include "gnss_satellite.h"
 #include "gnss_sdr_create_directory.h"
 #include "gnss_synchro.h"
-#include "gps_l2c_signal.h"
-#include "gps_l5_signal.h"
-#include "gps_sdr_signal_processing.h"
 #include "lock_detectors.h"
+#include "tracking_code_registry.h"
 #include "tracking_discriminators.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>   // for io_signature
@@ -374,9 +368,8 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::bl
     d_code_loop_filter = Tracking_loop_filter(d_code_period, d_trk_parameters.dll_bw_hz, d_trk_parameters.dll_filter_order, false);
     d_carrier_loop_filter.set_params(d_trk_parameters.fll_bw_hz, d_trk_parameters.pll_bw_hz, d_trk_parameters.pll_filter_order);
 
-    // Initialization of local code replica
-    // Get space for a vector with the sinboc(1,1) replica sampled 2x/chip
-    d_tracking_code.resize(2 * d_code_length_chips, 0.0);
+    // Local code replicas are shared among channels, see Tracking_Code_Registry
+    d_local_codes = nullptr;
     // correlator outputs (scalar)
     if (d_veml)
         {
@@ -437,12 +430,14 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::bl
             // Extra correlator for the data component
             d_correlator_data_cpu.init(2 * d_trk_parameters.vector_length, 1);
             d_correlator_data_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
-            d_data_code.resize(2 * d_code_length_chips, 0.0);
+            d_correlator_data_cpu.set_split_epoch_threads(d_trk_parameters.split_epoch_threads);
         }
 
     // --- Initializations ---
     d_Prompt_circular_buffer.set_capacity(d_secondary_code_length);
     d_multicorrelator_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+    // Split each correlation interval among several threads (useful at very high sample rates)
+    d_multicorrelator_cpu.set_split_epoch_threads(d_trk_parameters.split_epoch_threads);
     // Initial code frequency basis of NCO
     d_code_freq_chips = d_code_chip_rate;
     // Residual code phase (in chips)
@@ -458,8 +453,7 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::bl
     d_current_correlation_time_s = 0.0;
 
     // CN0 estimation and lock detector buffers
-    d_cn0_estimation_counter = 0;
-    d_Prompt_buffer.reserve(d_trk_parameters.cn0_samples);
+    d_lock_detector.set_window_length(d_trk_parameters.cn0_samples);
     d_carrier_lock_test = 1.0;
     d_CN0_SNV_dB_Hz = 0.0;
     d_carrier_lock_fail_counter = 0;
@@ -593,75 +587,36 @@ void dll_pll_veml_tracking::start_tracking()
     d_carrier_phase_rate_step_rad = 0.0;
     d_carr_ph_history.clear();
     d_code_ph_history.clear();
-    std::array<char, 3> Signal_{};
-    Signal_[0] = d_acquisition_gnss_synchro->Signal[0];
-    Signal_[1] = d_acquisition_gnss_synchro->Signal[1];
-    Signal_[2] = d_acquisition_gnss_synchro->Signal[2];
+    // Get the (shared, immutable) local code replicas for this satellite
+    d_local_codes = &Tracking_Code_Registry::get(d_systemName, d_signal_type, d_acquisition_gnss_synchro->PRN, d_code_length_chips, d_trk_parameters.track_pilot);
 
-    if (d_systemName == "GPS" and d_signal_type == "1C")
-        {
-            gps_l1_ca_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN, 0);
-        }
-    else if (d_systemName == "GPS" and d_signal_type == "2S")
-        {
-            gps_l2c_m_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
-        }
-    else if (d_systemName == "GPS" and d_signal_type == "L5")
+    if (d_systemName == "GPS" and d_signal_type == "L5")
         {
             if (d_trk_parameters.track_pilot)
                 {
-                    gps_l5q_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
-                    gps_l5i_code_gen_float(d_data_code, d_acquisition_gnss_synchro->PRN);
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
-                }
-            else
-                {
-                    gps_l5i_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_local_codes->data_code.data(), d_prompt_data_shift);
                 }
         }
     else if (d_systemName == "Galileo" and d_signal_type == "1B")
         {
             if (d_trk_parameters.track_pilot)
                 {
-                    std::array<char, 3> pilot_signal = {{'1', 'C', '\0'}};
-                    galileo_e1_code_gen_sinboc11_float(d_tracking_code, pilot_signal, d_acquisition_gnss_synchro->PRN);
-                    galileo_e1_code_gen_sinboc11_float(d_data_code, Signal_, d_acquisition_gnss_synchro->PRN);
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
-                }
-            else
-                {
-                    galileo_e1_code_gen_sinboc11_float(d_tracking_code, Signal_, d_acquisition_gnss_synchro->PRN);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_local_codes->data_code.data(), d_prompt_data_shift);
                 }
         }
     else if (d_systemName == "Galileo" and d_signal_type == "5X")
         {
-            volk_gnsssdr::vector<gr_complex> aux_code(d_code_length_chips);
-            std::array<char, 3> signal_type_ = {{'5', 'X', '\0'}};
-            galileo_e5_a_code_gen_complex_primary(aux_code, d_acquisition_gnss_synchro->PRN, signal_type_);
             if (d_trk_parameters.track_pilot)
                 {
                     d_secondary_code_string = GALILEO_E5A_Q_SECONDARY_CODE[d_acquisition_gnss_synchro->PRN - 1];
-                    for (uint32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].imag();
-                            d_data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5aI + E5aQ)
-                        }
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
-                }
-            else
-                {
-                    for (uint32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].real();
-                        }
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_local_codes->data_code.data(), d_prompt_data_shift);
                 }
         }
     else if (d_systemName == "Beidou" and d_signal_type == "B1")
         {
-            beidou_b1i_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN, 0);
             // GEO Satellites use different secondary code
             if (d_acquisition_gnss_synchro->PRN > 0 and d_acquisition_gnss_synchro->PRN < 6)
                 {
@@ -694,7 +649,6 @@ void dll_pll_veml_tracking::start_tracking()
 
     else if (d_systemName == "Beidou" and d_signal_type == "B3")
         {
-            beidou_b3i_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN, 0);
             // Update secondary code settings for geo satellites
             if (d_acquisition_gnss_synchro->PRN > 0 and d_acquisition_gnss_synchro->PRN < 6)
                 {
@@ -725,7 +679,7 @@ void dll_pll_veml_tracking::start_tracking()
                 }
         }
 
-    d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code.data(), d_local_code_shift_chips.data());
+    d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_local_codes->tracking_code.data(), d_local_code_shift_chips.data());
     std::fill_n(d_correlator_outs.begin(), d_n_correlator_taps, gr_complex(0.0, 0.0));
 
     d_carrier_lock_fail_counter = 0;
@@ -734,7 +688,7 @@ void dll_pll_veml_tracking::start_tracking()
     d_rem_carr_phase_rad = 0.0;
     d_rem_code_phase_chips = 0.0;
     d_acc_carrier_phase_rad = 0.0;
-    d_cn0_estimation_counter = 0;
+    d_lock_detector.reset();
     d_carrier_lock_test = 1.0;
     d_CN0_SNV_dB_Hz = 0.0;
 
@@ -856,21 +810,17 @@ bool dll_pll_veml_tracking::acquire_secondary()
 bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_time_s)
 {
     // ####### CN0 ESTIMATION AND LOCK DETECTORS ######
-    if (d_cn0_estimation_counter < d_trk_parameters.cn0_samples)
+    // running moments of the prompt correlator outputs over the last cn0_samples
+    d_lock_detector.update(d_P_accu);
+    if (!d_lock_detector.ready())
         {
-            // fill buffer with prompt correlator output values
-            d_Prompt_buffer[d_cn0_estimation_counter] = d_P_accu;
-            d_cn0_estimation_counter++;
             return true;
         }
-
-    d_Prompt_buffer[d_cn0_estimation_counter % d_trk_parameters.cn0_samples] = d_P_accu;
-    d_cn0_estimation_counter++;
     // Code lock indicator
-    float d_CN0_SNV_dB_Hz_raw = cn0_m2m4_estimator(d_Prompt_buffer.data(), d_trk_parameters.cn0_samples, static_cast<float>(coh_integration_time_s));
+    float d_CN0_SNV_dB_Hz_raw = d_lock_detector.cn0_m2m4(static_cast<float>(coh_integration_time_s));
     d_CN0_SNV_dB_Hz = d_cn0_smoother.smooth(d_CN0_SNV_dB_Hz_raw);
     // Carrier lock indicator
-    d_carrier_lock_test = d_carrier_lock_test_smoother.smooth(carrier_lock_detector(d_Prompt_buffer.data(), 1));
+    d_carrier_lock_test = d_carrier_lock_test_smoother.smooth(carrier_lock_detector(&d_P_accu, 1));
     // Loss of lock detection
     if (!d_pull_in_transitory)
         {
@@ -24,6 +24,7 @@
 #include "cpu_multicorrelator_real_codes.h"
 #include "dll_pll_conf.h"
 #include "exponential_smoother.h"
+#include "lock_detectors.h"
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
 #include "tracking_loop_filter.h"     // for DLL filter
 #include <boost/circular_buffer.hpp>
@@ -43,6 +44,7 @@
 #endif
 
 class Gnss_Synchro;
+class Tracking_Codes;
 class dll_pll_veml_tracking;
 
 #if GNURADIO_USES_STD_POINTERS
@@ -93,6 +95,7 @@ private:
 
     Dll_Pll_Conf d_trk_parameters;
 
+    Streaming_Lock_Detector<float> d_lock_detector;
     Exponential_Smoother d_cn0_smoother;
     Exponential_Smoother d_carrier_lock_test_smoother;
 
@@ -100,13 +103,11 @@ private:
     Tracking_FLL_PLL_filter d_carrier_loop_filter;
 
     Gnss_Synchro *d_acquisition_gnss_synchro;
+    const Tracking_Codes *d_local_codes;  // owned by Tracking_Code_Registry
 
-    volk_gnsssdr::vector<float> d_tracking_code;
-    volk_gnsssdr::vector<float> d_data_code;
     volk_gnsssdr::vector<float> d_local_code_shift_chips;
     volk_gnsssdr::vector<gr_complex> d_correlator_outs;
     volk_gnsssdr::vector<gr_complex> d_Prompt_Data;
-    volk_gnsssdr::vector<gr_complex> d_Prompt_buffer;
 
     boost::circular_buffer<float> d_dll_filt_history;
     boost::circular_buffer<std::pair<double, double>> d_code_ph_history;
@@ -179,7 +180,6 @@ private:
     int32_t d_extend_correlation_symbols_count;
     int32_t d_current_symbol;
     int32_t d_current_data_symbol;
-    int32_t d_cn0_estimation_counter;
     int32_t d_carrier_lock_fail_counter;
     int32_t d_code_lock_fail_counter;
 
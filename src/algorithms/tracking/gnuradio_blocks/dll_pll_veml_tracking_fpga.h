@@ -23,6 +23,7 @@
 
 #include "dll_pll_conf_fpga.h"
 #include "exponential_smoother.h"
+#include "lock_detectors.h"
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
 #include "tracking_loop_filter.h"     // for DLL filter
 #include <boost/circular_buffer.hpp>
@@ -119,6 +120,7 @@ private:
 
     Dll_Pll_Conf_Fpga d_trk_parameters;
 
+    Streaming_Lock_Detector<float> d_lock_detector;
     Exponential_Smoother d_cn0_smoother;
     Exponential_Smoother d_carrier_lock_test_smoother;
 
@@ -131,7 +133,6 @@ private:
     volk_gnsssdr::vector<float> d_local_code_shift_chips;
     volk_gnsssdr::vector<gr_complex> d_correlator_outs;
     volk_gnsssdr::vector<gr_complex> d_Prompt_Data;
-    volk_gnsssdr::vector<gr_complex> d_Prompt_buffer;
 
     boost::circular_buffer<float> d_dll_filt_history;
     boost::circular_buffer<std::pair<double, double>> d_code_ph_history;
@@ -209,7 +210,6 @@ private:
     int32_t d_current_symbol;
     int32_t d_current_data_symbol;
     int32_t d_current_integration_length_samples;
-    int32_t d_cn0_estimation_counter;
     int32_t d_carrier_lock_fail_counter;
     int32_t d_code_lock_fail_counter;
     int32_t d_correlation_length_ms;
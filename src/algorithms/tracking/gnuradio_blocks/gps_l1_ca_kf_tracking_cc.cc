@@ -189,54 +189,15 @@ Gps_L1_Ca_Kf_Tracking_cc::Gps_L1_Ca_Kf_Tracking_cc(
     double sigma2_doppler = 450;
     double sigma2_doppler_rate = pow(4.0 * GPS_TWO_PI, 2) / 12.0;
 
-    kf_P_x_ini = arma::zeros(2, 2);
-    kf_P_x_ini(0, 0) = sigma2_carrier_phase;
-    kf_P_x_ini(1, 1) = sigma2_doppler;
-
-    kf_R = arma::zeros(1, 1);
-    kf_R(0, 0) = sigma2_phase_detector_cycles2;
-
-    kf_Q = arma::zeros(2, 2);
-    kf_Q(0, 0) = pow(GPS_L1_CA_CODE_PERIOD_S, 4);
-    kf_Q(1, 1) = GPS_L1_CA_CODE_PERIOD_S;
-
-    kf_F = arma::zeros(2, 2);
-    kf_F(0, 0) = 1.0;
-    kf_F(0, 1) = GPS_TWO_PI * GPS_L1_CA_CODE_PERIOD_S;
-    kf_F(1, 0) = 0.0;
-    kf_F(1, 1) = 1.0;
-
-    kf_H = arma::zeros(1, 2);
-    kf_H(0, 0) = 1.0;
-
-    kf_x = arma::zeros(2, 1);
-    kf_y = arma::zeros(1, 1);
-    kf_P_y = arma::zeros(1, 1);
+    kf_2nd_order.set_model(GPS_L1_CA_CODE_PERIOD_S, {pow(GPS_L1_CA_CODE_PERIOD_S, 4), GPS_L1_CA_CODE_PERIOD_S});
+    kf_2nd_order.set_initial_covariance({sigma2_carrier_phase, sigma2_doppler});
 
     // order three
-    if (d_order == 3)
-        {
-            kf_P_x_ini = arma::resize(kf_P_x_ini, 3, 3);
-            kf_P_x_ini(2, 2) = sigma2_doppler_rate;
-
-            kf_Q = arma::zeros(3, 3);
-            kf_Q(0, 0) = pow(GPS_L1_CA_CODE_PERIOD_S, 4);
-            kf_Q(1, 1) = GPS_L1_CA_CODE_PERIOD_S;
-            kf_Q(2, 2) = GPS_L1_CA_CODE_PERIOD_S;
-
-            kf_F = arma::resize(kf_F, 3, 3);
-            kf_F(0, 2) = 0.5 * GPS_TWO_PI * pow(GPS_L1_CA_CODE_PERIOD_S, 2);
-            kf_F(1, 2) = GPS_L1_CA_CODE_PERIOD_S;
-            kf_F(2, 0) = 0.0;
-            kf_F(2, 1) = 0.0;
-            kf_F(2, 2) = 1.0;
-
-            kf_H = arma::resize(kf_H, 1, 3);
-            kf_H(0, 2) = 0.0;
-
-            kf_x = arma::resize(kf_x, 3, 1);
-            kf_x(2, 0) = 0.0;
-        }
+    kf_3rd_order.set_model(GPS_L1_CA_CODE_PERIOD_S, {pow(GPS_L1_CA_CODE_PERIOD_S, 4), GPS_L1_CA_CODE_PERIOD_S, GPS_L1_CA_CODE_PERIOD_S});
+    kf_3rd_order.set_initial_covariance({sigma2_carrier_phase, sigma2_doppler, sigma2_doppler_rate});
+
+    kf_R = sigma2_phase_detector_cycles2;
+    kf_P_y = 0.0;
 
     // Bayesian covariance estimator initialization
     kf_iter = 0;
@@ -248,7 +209,55 @@ Gps_L1_Ca_Kf_Tracking_cc::Gps_L1_Ca_Kf_Tracking_cc(
     bayes_nu = bce_nu;
     kf_R_est = kf_R;
 
-    bayes_estimator.init(arma::zeros(1, 1), bayes_kappa, bayes_nu, (kf_H * kf_P_x_ini * kf_H.t() + kf_R) * (bayes_nu + 2));
+    if (d_order == 3)
+        {
+            kf_init_bayes_estimator(kf_3rd_order);
+        }
+    else
+        {
+            kf_init_bayes_estimator(kf_2nd_order);
+        }
+}
+
+
+template <uint32_t N>
+void Gps_L1_Ca_Kf_Tracking_cc::kf_init_bayes_estimator(const Kalman_Carrier_Filter<N>& kf)
+{
+    const arma::mat Psi_prior = arma::ones(1, 1) * ((kf.initial_measurement_variance() + kf_R) * (bayes_nu + 2));
+    bayes_estimator.init(arma::zeros(1, 1), bayes_kappa, bayes_nu, Psi_prior);
+}
+
+
+template <uint32_t N>
+void Gps_L1_Ca_Kf_Tracking_cc::kf_carrier_update(Kalman_Carrier_Filter<N>& kf)
+{
+    // Kalman state prediction (time update)
+    kf.predict();
+
+    // Kalman estimation (measurement update)
+    if (bayes_run && (kf_iter >= bayes_ptrans))
+        {
+            bayes_estimator.update_sequential(d_carr_phase_error_rad);
+        }
+    if (bayes_run && (kf_iter >= (bayes_ptrans + bayes_strans)))
+        {
+            kf_P_y = bayes_estimator.get_Psi_est()(0, 0);
+            kf_R_est = kf_P_y - kf.predicted_measurement_variance();
+        }
+    else
+        {
+            kf_P_y = kf.predicted_measurement_variance() + kf_R;  // innovation covariance
+            kf_R_est = kf_R;
+        }
+
+    // Kalman filter update step
+    kf.update(d_carr_phase_error_rad, kf_P_y);
+
+    // Store Kalman filter results
+    d_rem_carr_phase_rad = kf.state(0);  // set a new carrier Phase estimation to the NCO
+    d_carrier_doppler_hz = kf.state(1);  // set a new carrier Doppler estimation to the NCO
+    d_carrier_dopplerrate_hz2 = N > 2 ? kf.state(2) : 0.0;
+    d_carr_phase_sigma2 = kf_R_est;
 }
 
 
@@ -265,8 +274,16 @@ void Gps_L1_Ca_Kf_Tracking_cc::start_tracking()
     // Correct Kalman filter covariance according to acq doppler step size (3 sigma)
     if (d_acquisition_gnss_synchro->Acq_doppler_step > 0)
         {
-            kf_P_x_ini(1, 1) = pow(d_acq_carrier_doppler_step_hz / 3.0, 2);
-            bayes_estimator.init(arma::zeros(1, 1), bayes_kappa, bayes_nu, (kf_H * kf_P_x_ini * kf_H.t() + kf_R) * (bayes_nu + 2));
+            kf_2nd_order.set_initial_covariance(1, pow(d_acq_carrier_doppler_step_hz / 3.0, 2));
+            kf_3rd_order.set_initial_covariance(1, pow(d_acq_carrier_doppler_step_hz / 3.0, 2));
+            if (d_order == 3)
+                {
+                    kf_init_bayes_estimator(kf_3rd_order);
+                }
+            else
+                {
+                    kf_init_bayes_estimator(kf_2nd_order);
+                }
         }
 
     int64_t acq_trk_diff_samples;
@@ -655,18 +672,19 @@ int Gps_L1_Ca_Kf_Tracking_cc::general_work(int noutput_items __attribute__((unus
                     current_synchro_data.correlation_length_ms = 1;
                     *out[0] = current_synchro_data;
                     // Kalman filter initialization reset
-                    kf_P_x = kf_P_x_ini;
                     // Update Kalman states based on acquisition information
-                    kf_x(0) = d_carrier_phase_step_rad * samples_offset;
-                    kf_x(1) = d_carrier_doppler_hz;
-                    if (kf_x.n_elem > 2)
-                        {
-                            kf_x(2) = d_carrier_dopplerrate_hz2;
-                        }
-
                     // Covariance estimation initialization reset
                     kf_iter = 0;
-                    bayes_estimator.init(arma::zeros(1, 1), bayes_kappa, bayes_nu, (kf_H * kf_P_x_ini * kf_H.t() + kf_R) * (bayes_nu + 2));
+                    if (d_order == 3)
+                        {
+                            kf_3rd_order.reset({d_carrier_phase_step_rad * samples_offset, d_carrier_doppler_hz, d_carrier_dopplerrate_hz2});
+                            kf_init_bayes_estimator(kf_3rd_order);
+                        }
+                    else
+                        {
+                            kf_2nd_order.reset({d_carrier_phase_step_rad * samples_offset, d_carrier_doppler_hz});
+                            kf_init_bayes_estimator(kf_2nd_order);
+                        }
 
                     consume_each(samples_offset);  // shift input to perform alignment with local replica
                     return 1;
@@ -684,54 +702,21 @@ int Gps_L1_Ca_Kf_Tracking_cc::general_work(int noutput_items __attribute__((unus
 
             // ################## Kalman Carrier Tracking ######################################
 
-            // Kalman state prediction (time update)
-            kf_x_pre = kf_F * kf_x;                        // state prediction
-            kf_P_x_pre = kf_F * kf_P_x * kf_F.t() + kf_Q;  // state error covariance prediction
-
             // Update discriminator [rads/Ti]
             d_carr_phase_error_rad = pll_cloop_two_quadrant_atan(d_correlator_outs[1]);  // prompt output
 
-            // Kalman estimation (measurement update)
-            double sigma2_phase_detector_cycles2;
+            // Measurement noise variance from the current C/N0 estimation
             double CN_lin = pow(10, d_CN0_SNV_dB_Hz / 10.0);
-            sigma2_phase_detector_cycles2 = (1.0 / (2.0 * CN_lin * GPS_L1_CA_CODE_PERIOD_S)) * (1.0 + 1.0 / (2.0 * CN_lin * GPS_L1_CA_CODE_PERIOD_S));
-
-            kf_y(0) = d_carr_phase_error_rad;  // measurement vector
-            kf_R(0, 0) = sigma2_phase_detector_cycles2;
-
-            if (bayes_run && (kf_iter >= bayes_ptrans))
-                {
-                    bayes_estimator.update_sequential(kf_y);
-                }
-            if (bayes_run && (kf_iter >= (bayes_ptrans + bayes_strans)))
-                {
-                    // TODO: Resolve segmentation fault
-                    kf_P_y = bayes_estimator.get_Psi_est();
-                    kf_R_est = kf_P_y - kf_H * kf_P_x_pre * kf_H.t();
-                }
-            else
-                {
-                    kf_P_y = kf_H * kf_P_x_pre * kf_H.t() + kf_R;  // innovation covariance matrix
-                    kf_R_est = kf_R;
-                }
-
-            // Kalman filter update step
-            kf_K = (kf_P_x_pre * kf_H.t()) * arma::inv(kf_P_y);                 // Kalman gain
-            kf_x = kf_x_pre + kf_K * kf_y;                                      // updated state estimation
-            kf_P_x = (arma::eye(size(kf_P_x_pre)) - kf_K * kf_H) * kf_P_x_pre;  // update state estimation error covariance matrix
+            kf_R = (1.0 / (2.0 * CN_lin * GPS_L1_CA_CODE_PERIOD_S)) * (1.0 + 1.0 / (2.0 * CN_lin * GPS_L1_CA_CODE_PERIOD_S));
 
-            // Store Kalman filter results
-            d_rem_carr_phase_rad = kf_x(0);  // set a new carrier Phase estimation to the NCO
-            d_carrier_doppler_hz = kf_x(1);  // set a new carrier Doppler estimation to the NCO
-            if (kf_x.n_elem > 2)
+            if (d_order == 3)
                 {
-                    d_carrier_dopplerrate_hz2 = kf_x(2);
+                    kf_carrier_update(kf_3rd_order);
                 }
             else
                 {
-                    d_carrier_dopplerrate_hz2 = 0;
+                    kf_carrier_update(kf_2nd_order);
                 }
-            d_carr_phase_sigma2 = kf_R_est(0, 0);
 
             // ################## DLL ##########################################################
             // New code Doppler frequency estimation based on carrier frequency estimation
@@ -36,6 +36,7 @@
 #include "bayesian_estimation.h"
 #include "cpu_multicorrelator_real_codes.h"
 #include "gnss_synchro.h"
+#include "kalman_carrier_filter.h"
 #include "tracking_2nd_DLL_filter.h"
 #include "tracking_2nd_PLL_filter.h"
 #include <armadillo>
@@ -137,24 +138,19 @@ private:
     double d_rem_carr_phase_rad;
 
     // Kalman filter variables
-    arma::mat kf_P_x_ini;  // initial state error covariance matrix
-    arma::mat kf_P_x;      // state error covariance matrix
-    arma::mat kf_P_x_pre;  // Predicted state error covariance matrix
-    arma::mat kf_P_y;      // innovation covariance matrix
+    template <uint32_t N>
+    void kf_carrier_update(Kalman_Carrier_Filter<N>& kf);
+    template <uint32_t N>
+    void kf_init_bayes_estimator(const Kalman_Carrier_Filter<N>& kf);
 
-    arma::mat kf_F;  // state transition matrix
-    arma::mat kf_H;  // system matrix
-    arma::mat kf_R;  // measurement error covariance matrix
-    arma::mat kf_Q;  // system error covariance matrix
-
-    arma::colvec kf_x;      // state vector
-    arma::colvec kf_x_pre;  // predicted state vector
-    arma::colvec kf_y;      // measurement vector
-    arma::mat kf_K;         // Kalman gain matrix
+    Kalman_Carrier_Filter<2> kf_2nd_order;  // phase and Doppler states
+    Kalman_Carrier_Filter<3> kf_3rd_order;  // phase, Doppler and Doppler rate states
+    double kf_R;                            // measurement error covariance
+    double kf_P_y;                          // innovation covariance
 
     // Bayesian estimator
     Bayesian_estimator bayes_estimator;
-    arma::mat kf_R_est;  // measurement error covariance
+    double kf_R_est;  // estimated measurement error covariance
     uint32_t bayes_ptrans;
     uint32_t bayes_strans;
     int32_t bayes_nu;
@@ -171,6 +171,51 @@ void Bayesian_estimator::update_sequential(const arma::vec& data, const arma::ve
 }
 
 
+/*
+ * Perform Bayesian noise estimation of a scalar process from a single new
+ * sample using the priors stored in the class structure. This is equivalent
+ * to update_sequential(const arma::vec&) for ny = 1 and K = 1, but it
+ * operates in place without building temporary matrices.
+ */
+void Bayesian_estimator::update_sequential(double data)
+{
+    if (mu_prior.is_empty())
+        {
+            mu_prior = arma::zeros(1, 1);
+        }
+
+    if (Psi_prior.is_empty())
+        {
+            Psi_prior = arma::zeros(1, 1);
+        }
+
+    const double mu_prior_0 = mu_prior(0);
+    const double innovation = data - mu_prior_0;
+
+    const double mu_posterior = (kappa_prior * mu_prior_0 + data) / (kappa_prior + 1);
+    const int kappa_posterior = kappa_prior + 1;
+    const int nu_posterior = nu_prior + 1;
+    const double Psi_posterior = Psi_prior(0, 0) + (kappa_prior * 1.0F) / (kappa_prior + 1.0F) * innovation * innovation;
+
+    mu_est.set_size(1);
+    Psi_est.set_size(1, 1);
+    mu_est(0) = mu_posterior;
+    if ((nu_posterior - 2) > 0)
+        {
+            Psi_est(0, 0) = Psi_posterior / (nu_posterior - 2);
+        }
+    else
+        {
+            Psi_est(0, 0) = Psi_posterior / (nu_posterior + 2);
+        }
+
+    mu_prior(0) = mu_posterior;
+    kappa_prior = kappa_posterior;
+    nu_prior = nu_posterior;
+    Psi_prior(0, 0) = Psi_posterior;
+}
+
+
 arma::mat Bayesian_estimator::get_mu_est() const
 {
     return mu_est;
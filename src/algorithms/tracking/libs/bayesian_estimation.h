@@ -66,6 +66,7 @@ public:
 
     void update_sequential(const arma::vec& data);
     void update_sequential(const arma::vec& data, const arma::vec& mu_prior_0, int kappa_prior_0, int nu_prior_0, const arma::mat& Psi_prior_0);
+    void update_sequential(double data);  //!< Fast path for a single sample of a scalar process
 
     arma::mat get_mu_est() const;
     arma::mat get_Psi_est() const;
@@ -8,6 +8,9 @@
  *
  * Class that implements a highly optimized vector multiTAP correlator class for CPUs
  *
+ * For very high sample rates, the correlation interval can be split into
+ * segments processed in parallel by a set of worker threads.
+ *
  * -------------------------------------------------------------------------
  *
  * Copyright (C) 2010-2019  (see AUTHORS file for a list of contributors)
@@ -24,8 +27,17 @@
 
 #include "cpu_multicorrelator_real_codes.h"
 #include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
 #include <cmath>
 
+namespace
+{
+// Segment boundaries are multiples of this number of samples, so the
+// pointers passed to the VOLK kernels keep the buffer alignment
+constexpr int SPLIT_EPOCH_GRANULARITY_SAMPLES = 64;
+}  // namespace
+
+
 Cpu_Multicorrelator_Real_Codes::Cpu_Multicorrelator_Real_Codes()
 {
     d_sig_in = nullptr;
@@ -36,11 +48,16 @@ Cpu_Multicorrelator_Real_Codes::Cpu_Multicorrelator_Real_Codes()
     d_code_length_chips = 0;
     d_n_correlators = 0;
     d_use_high_dynamics_resampler = true;
+    d_split_generation = 0;
+    d_split_pending = 0;
+    d_n_segments = 1;
+    d_split_stop = false;
 }
 
 
 Cpu_Multicorrelator_Real_Codes::~Cpu_Multicorrelator_Real_Codes()
 {
+    stop_split_epoch_workers();
     if (d_local_codes_resampled != nullptr)
         {
             Cpu_Multicorrelator_Real_Codes::free();
@@ -61,6 +78,8 @@ bool Cpu_Multicorrelator_Real_Codes::init(
             d_local_codes_resampled[n] = static_cast<float*>(volk_gnsssdr_malloc(size, volk_gnsssdr_get_alignment()));
         }
     d_n_correlators = n_correlators;
+    d_split_partial_corr.assign(d_n_segments * d_n_correlators, std::complex<float>(0.0, 0.0));
+    d_split_code_ptrs.assign(d_n_segments * d_n_correlators, nullptr);
     return true;
 }
 
@@ -124,6 +143,13 @@ bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
     float code_phase_rate_step_chips,
     int signal_length_samples)
 {
+    if (d_n_segments > 1)
+        {
+            split_epoch_correlation({rem_carrier_phase_in_rad, phase_step_rad, phase_rate_step_rad,
+                rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips,
+                signal_length_samples, d_use_high_dynamics_resampler});
+            return true;
+        }
     update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
     // Regenerate phase at each call in order to avoid numerical issues
     lv_32fc_t phase_offset_as_complex[1];
@@ -149,6 +175,13 @@ bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
     float code_phase_rate_step_chips,
     int signal_length_samples)
 {
+    if (d_n_segments > 1)
+        {
+            split_epoch_correlation({rem_carrier_phase_in_rad, phase_step_rad, 0.0,
+                rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips,
+                signal_length_samples, false});
+            return true;
+        }
     update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
     // Regenerate phase at each call in order to avoid numerical issues
     lv_32fc_t phase_offset_as_complex[1];
@@ -180,3 +213,162 @@ void Cpu_Multicorrelator_Real_Codes::set_high_dynamics_resampler(
 {
     d_use_high_dynamics_resampler = use_high_dynamics_resampler;
 }
+
+
+void Cpu_Multicorrelator_Real_Codes::set_split_epoch_threads(int n_threads)
+{
+    stop_split_epoch_workers();
+    d_n_segments = std::max(n_threads, 1);
+    d_split_partial_corr.assign(d_n_segments * d_n_correlators, std::complex<float>(0.0, 0.0));
+    d_split_code_ptrs.assign(d_n_segments * d_n_correlators, nullptr);
+    d_split_stop = false;
+    d_split_pending = 0;
+    // Segment 0 is always processed by the calling thread
+    for (int segment = 1; segment < d_n_segments; segment++)
+        {
+            d_split_workers.emplace_back(&Cpu_Multicorrelator_Real_Codes::split_epoch_worker, this, segment, d_split_generation);
+        }
+}
+
+
+void Cpu_Multicorrelator_Real_Codes::stop_split_epoch_workers()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_split_mutex);
+        d_split_stop = true;
+    }
+    d_split_start_cv.notify_all();
+    for (auto& worker : d_split_workers)
+        {
+            if (worker.joinable())
+                {
+                    worker.join();
+                }
+        }
+    d_split_workers.clear();
+}
+
+
+void Cpu_Multicorrelator_Real_Codes::split_epoch_worker(int segment, uint64_t last_generation)
+{
+    while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(d_split_mutex);
+                d_split_start_cv.wait(lock, [&] { return d_split_stop || d_split_generation != last_generation; });
+                if (d_split_stop)
+                    {
+                        return;
+                    }
+                last_generation = d_split_generation;
+            }
+            correlate_segment(segment);
+            {
+                std::lock_guard<std::mutex> lock(d_split_mutex);
+                d_split_pending--;
+            }
+            d_split_done_cv.notify_one();
+        }
+}
+
+
+void Cpu_Multicorrelator_Real_Codes::split_epoch_correlation(const Split_Epoch_Job& job)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_split_mutex);
+        d_split_job = job;
+        d_split_pending = d_n_segments - 1;
+        d_split_generation++;
+    }
+    d_split_start_cv.notify_all();
+
+    correlate_segment(0);
+
+    {
+        std::unique_lock<std::mutex> lock(d_split_mutex);
+        d_split_done_cv.wait(lock, [&] { return d_split_pending == 0; });
+    }
+
+    // Reduce the partial correlator outputs
+    for (int n = 0; n < d_n_correlators; n++)
+        {
+            std::complex<float> acc(0.0, 0.0);
+            for (int segment = 0; segment < d_n_segments; segment++)
+                {
+                    acc += d_split_partial_corr[segment * d_n_correlators + n];
+                }
+            d_corr_out[n] = acc;
+        }
+}
+
+
+void Cpu_Multicorrelator_Real_Codes::correlate_segment(int segment)
+{
+    const Split_Epoch_Job& job = d_split_job;
+    const int segment_length = (job.signal_length_samples / d_n_segments / SPLIT_EPOCH_GRANULARITY_SAMPLES) * SPLIT_EPOCH_GRANULARITY_SAMPLES;
+    const int first_sample = segment * segment_length;
+    const int n_samples = (segment == d_n_segments - 1) ? job.signal_length_samples - first_sample : segment_length;
+    std::complex<float>* partial_corr = &d_split_partial_corr[segment * d_n_correlators];
+    if (n_samples <= 0)
+        {
+            std::fill(partial_corr, partial_corr + d_n_correlators, std::complex<float>(0.0, 0.0));
+            return;
+        }
+
+    // Carrier and code phases at the first sample of the segment:
+    // phase(k0 + n) = phase(k0) + (step + 2 * rate * k0) * n + rate * n^2
+    const auto k0 = static_cast<double>(first_sample);
+    const double code_rate = d_use_high_dynamics_resampler ? job.code_phase_rate_step_chips : 0.0;
+    const double phase_rate = job.high_dynamics_rotator ? job.phase_rate_step_rad : 0.0;
+    const auto rem_code_phase_chips = static_cast<float>(job.rem_code_phase_chips - job.code_phase_step_chips * k0 - code_rate * k0 * k0);
+    const auto code_phase_step_chips = static_cast<float>(job.code_phase_step_chips + 2.0 * code_rate * k0);
+    const double rem_carrier_phase_rad = job.rem_carrier_phase_rad + job.phase_step_rad * k0 + phase_rate * k0 * k0;
+    const auto phase_step_rad = static_cast<float>(job.phase_step_rad + 2.0 * phase_rate * k0);
+
+    float** local_codes = &d_split_code_ptrs[segment * d_n_correlators];
+    for (int n = 0; n < d_n_correlators; n++)
+        {
+            local_codes[n] = d_local_codes_resampled[n] + first_sample;
+        }
+
+    if (d_use_high_dynamics_resampler)
+        {
+            // Each tap is resampled on its own: the multi-tap kernel derives the
+            // adjacent taps by rotating the first one, which is only valid over
+            // a whole code period
+            for (int n = 0; n < d_n_correlators; n++)
+                {
+                    volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn(&local_codes[n],
+                        d_local_code_in,
+                        rem_code_phase_chips,
+                        code_phase_step_chips,
+                        static_cast<float>(code_rate),
+                        &d_shifts_chips[n],
+                        d_code_length_chips,
+                        1,
+                        n_samples);
+                }
+        }
+    else
+        {
+            volk_gnsssdr_32f_xn_resampler_32f_xn(local_codes,
+                d_local_code_in,
+                rem_code_phase_chips,
+                code_phase_step_chips,
+                d_shifts_chips,
+                d_code_length_chips,
+                d_n_correlators,
+                n_samples);
+        }
+
+    lv_32fc_t phase_offset_as_complex[1];
+    phase_offset_as_complex[0] = lv_cmake(static_cast<float>(std::cos(rem_carrier_phase_rad)), static_cast<float>(-std::sin(rem_carrier_phase_rad)));
+    if (job.high_dynamics_rotator)
+        {
+            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn(partial_corr, d_sig_in + first_sample, std::exp(lv_32fc_t(0.0, -phase_step_rad)), std::exp(lv_32fc_t(0.0, -static_cast<float>(phase_rate))), phase_offset_as_complex, const_cast<const float**>(local_codes), d_n_correlators, n_samples);
+        }
+    else
+        {
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(partial_corr, d_sig_in + first_sample, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(local_codes), d_n_correlators, n_samples);
+        }
+}
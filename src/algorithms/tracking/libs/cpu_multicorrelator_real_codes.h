@@ -8,6 +8,13 @@
  *
  * Class that implements a highly optimized vector multiTAP correlator class for CPUs
  *
+ * For very high sample rates, the correlation interval can be split into
+ * consecutive segments that are processed in parallel by a set of worker
+ * threads (see set_split_epoch_threads()). The carrier and code phases at the
+ * beginning of each segment are obtained analytically from the values at the
+ * beginning of the correlation interval, so phase continuity is kept across
+ * segments, and the partial correlator outputs are reduced at the end.
+ *
  * -------------------------------------------------------------------------
  *
  * Copyright (C) 2010-2019  (see AUTHORS file for a list of contributors)
@@ -27,6 +34,11 @@
 
 
 #include <complex>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 /*!
  * \brief Class that implements carrier wipe-off and correlators.
@@ -45,7 +57,31 @@ public:
     bool Carrier_wipeoff_multicorrelator_resampler(float rem_carrier_phase_in_rad, float phase_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
     bool free();
 
+    /*!
+     * \brief Sets the number of threads (including the caller's) among which
+     * the correlation interval is split. A value of 1 (default) disables the
+     * split-epoch mode.
+     */
+    void set_split_epoch_threads(int n_threads);
+
 private:
+    struct Split_Epoch_Job
+    {
+        double rem_carrier_phase_rad;
+        double phase_step_rad;
+        double phase_rate_step_rad;
+        double rem_code_phase_chips;
+        double code_phase_step_chips;
+        double code_phase_rate_step_chips;
+        int signal_length_samples;
+        bool high_dynamics_rotator;
+    };
+
+    void split_epoch_correlation(const Split_Epoch_Job &job);
+    void correlate_segment(int segment);
+    void split_epoch_worker(int segment, uint64_t last_generation);
+    void stop_split_epoch_workers();
+
     // Allocate the device input vectors
     const std::complex<float> *d_sig_in;
     const float *d_local_code_in;
@@ -55,6 +91,19 @@ private:
     int d_code_length_chips;
     int d_n_correlators;
     bool d_use_high_dynamics_resampler;
+
+    // split-epoch parallel correlation
+    Split_Epoch_Job d_split_job{};
+    std::vector<std::thread> d_split_workers;
+    std::vector<std::complex<float>> d_split_partial_corr;  // n_segments x n_correlators
+    std::vector<float *> d_split_code_ptrs;                 // n_segments x n_correlators
+    std::mutex d_split_mutex;
+    std::condition_variable d_split_start_cv;
+    std::condition_variable d_split_done_cv;
+    uint64_t d_split_generation;
+    int d_split_pending;
+    int d_n_segments;
+    bool d_split_stop;
 };
 
 
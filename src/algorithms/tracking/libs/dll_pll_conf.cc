@@ -57,6 +57,7 @@ Dll_Pll_Conf::Dll_Pll_Conf()
     y_intercept = 1.0;
     carrier_aiding = true;
     extend_correlation_symbols = 1;
+    split_epoch_threads = 1;
     cn0_samples = FLAGS_cn0_samples;
     cn0_smoother_samples = 200;
     cn0_smoother_alpha = 0.002;
@@ -148,6 +149,12 @@ void Dll_Pll_Conf::SetFromConfiguration(const ConfigurationInterface *configurat
     very_early_late_space_narrow_chips = configuration->property(role + ".very_early_late_space_narrow_chips", very_early_late_space_narrow_chips);
     extend_correlation_symbols = configuration->property(role + ".extend_correlation_symbols", extend_correlation_symbols);
     track_pilot = configuration->property(role + ".track_pilot", track_pilot);
+    split_epoch_threads = configuration->property(role + ".split_epoch_threads", split_epoch_threads);
+    if (split_epoch_threads < 1)
+        {
+            split_epoch_threads = 1;
+            LOG(WARNING) << "split_epoch_threads must be bigger than 0. It has been set to 1";
+        }
     cn0_samples = configuration->property(role + ".cn0_samples", cn0_samples);
     cn0_min = configuration->property(role + ".cn0_min", cn0_min);
     max_code_lock_fail = configuration->property(role + ".max_lock_fail", max_code_lock_fail);
@@ -61,6 +61,7 @@ public:
     int32_t pll_filter_order;
     int32_t dll_filter_order;
     int32_t extend_correlation_symbols;
+    int32_t split_epoch_threads;
     int32_t cn0_samples;
     int32_t cn0_smoother_samples;
     int32_t carrier_lock_test_smoother_samples;
@@ -0,0 +1,181 @@
+/*!
+ * \file kalman_carrier_filter.h
+ * \brief Linear Kalman filter for carrier tracking, with compile-time
+ * sized state, covariance and gain matrices.
+ *
+ * The order of the carrier dynamic model (phase, Doppler and, optionally,
+ * Doppler rate and higher-order derivatives) is a template parameter, so all
+ * the matrices involved in the filter are Armadillo fixed-size objects. This
+ * avoids generic dispatch on the 2x2 / 3x3 linear algebra performed at every
+ * integration period.
+ *
+ * Reference:
+ * J. Vila-Valls, P. Closas, M. Navarro and C. Fernandez-Prades,
+ * "Are PLLs Dead? A Tutorial on Kalman Filter-based Techniques for Digital
+ * Carrier Synchronization", IEEE Aerospace and Electronic Systems Magazine,
+ * Vol. 32, No. 7, pp. 28–45, July 2017. DOI: 10.1109/MAES.2017.150260
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_KALMAN_CARRIER_FILTER_H
+#define GNSS_SDR_KALMAN_CARRIER_FILTER_H
+
+#if ARMA_NO_BOUND_CHECKING
+#define ARMA_NO_DEBUG 1
+#endif
+
+#include <armadillo>
+#include <cmath>
+#include <cstdint>
+
+/*!
+ * \brief Kalman filter for carrier phase tracking with a scalar phase
+ * discriminator measurement and a polynomial dynamic model of order N.
+ *
+ * State vector: x = [phase (rad), Doppler (Hz), Doppler rate (Hz/s), ...]^T
+ *
+ * The state transition matrix is built as the discretized Taylor expansion
+ * of the carrier phase, so any N >= 2 can be selected without runtime cost.
+ */
+template <uint32_t N>
+class Kalman_Carrier_Filter
+{
+    static_assert(N >= 2, "The carrier dynamic model needs at least phase and Doppler states");
+
+public:
+    using state_vec = arma::vec::fixed<N>;
+    using state_mat = arma::mat::fixed<N, N>;
+    using meas_mat = arma::rowvec::fixed<N>;
+
+    Kalman_Carrier_Filter()
+    {
+        x_.zeros();
+        x_pre_.zeros();
+        K_.zeros();
+        P_x_ini_.zeros();
+        P_x_.zeros();
+        P_x_pre_.zeros();
+        Q_.zeros();
+        F_.eye();
+        H_.zeros();
+        H_(0) = 1.0;
+        I_.eye();
+    }
+
+    ~Kalman_Carrier_Filter() = default;
+
+    /*!
+     * \brief Builds the state transition matrix and the (diagonal) process
+     * noise covariance matrix for an integration time T [s].
+     */
+    void set_model(double T, const state_vec& q_diag)
+    {
+        F_.eye();
+        for (uint32_t col = 1; col < N; col++)
+            {
+                // Doppler is expressed in Hz, so the phase row is scaled by 2*pi
+                double factorial = 1.0;
+                for (uint32_t k = 2; k <= col; k++)
+                    {
+                        factorial *= static_cast<double>(k);
+                    }
+                F_(0, col) = 2.0 * arma::datum::pi * std::pow(T, col) / factorial;
+                for (uint32_t row = 1; row < col; row++)
+                    {
+                        double f = 1.0;
+                        for (uint32_t k = 2; k <= col - row; k++)
+                            {
+                                f *= static_cast<double>(k);
+                            }
+                        F_(row, col) = std::pow(T, col - row) / f;
+                    }
+            }
+        Q_.zeros();
+        Q_.diag() = q_diag;
+    }
+
+    void set_initial_covariance(const state_vec& p_diag)
+    {
+        P_x_ini_.zeros();
+        P_x_ini_.diag() = p_diag;
+    }
+
+    void set_initial_covariance(uint32_t index, double value)
+    {
+        P_x_ini_(index, index) = value;
+    }
+
+    /*!
+     * \brief Resets the state error covariance matrix to its initial value
+     * and sets a new state
+     */
+    void reset(const state_vec& x0)
+    {
+        P_x_ = P_x_ini_;
+        x_ = x0;
+    }
+
+    //! Kalman state prediction (time update)
+    inline void predict()
+    {
+        x_pre_ = F_ * x_;
+        P_x_pre_ = F_ * P_x_ * F_.t() + Q_;
+    }
+
+    //! Predicted measurement variance, H * P_x_pre * H^T
+    inline double predicted_measurement_variance() const
+    {
+        return arma::as_scalar(H_ * P_x_pre_ * H_.t());
+    }
+
+    //! Initial measurement variance, H * P_x_ini * H^T
+    inline double initial_measurement_variance() const
+    {
+        return arma::as_scalar(H_ * P_x_ini_ * H_.t());
+    }
+
+    /*!
+     * \brief Kalman estimation (measurement update) for a scalar measurement
+     * y with innovation variance P_y. The inversion of the innovation
+     * covariance matrix reduces to a division.
+     */
+    inline void update(double y, double P_y)
+    {
+        K_ = (P_x_pre_ * H_.t()) / P_y;
+        x_ = x_pre_ + K_ * y;
+        P_x_ = (I_ - K_ * H_) * P_x_pre_;
+    }
+
+    inline const state_vec& state() const { return x_; }
+    inline double state(uint32_t index) const { return x_(index); }
+    inline const state_mat& covariance() const { return P_x_; }
+    inline const state_mat& transition_matrix() const { return F_; }
+
+private:
+    state_vec x_;      // state vector
+    state_vec x_pre_;  // predicted state vector
+    state_vec K_;      // Kalman gain (single measurement)
+
+    state_mat P_x_ini_;  // initial state error covariance matrix
+    state_mat P_x_;      // state error covariance matrix
+    state_mat P_x_pre_;  // predicted state error covariance matrix
+
+    state_mat F_;  // state transition matrix
+    state_mat Q_;  // system error covariance matrix
+    state_mat I_;  // identity
+    meas_mat H_;   // system matrix
+};
+
+#endif  // GNSS_SDR_KALMAN_CARRIER_FILTER_H
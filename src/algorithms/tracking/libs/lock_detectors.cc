@@ -36,6 +36,8 @@
  */
 
 #include "lock_detectors.h"
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 /*
@@ -149,3 +151,244 @@ float carrier_lock_detector(gr_complex* Prompt_buffer, int length)
     NBD = tmp_sum_I * tmp_sum_I - tmp_sum_Q * tmp_sum_Q;
     return NBD / NBP;
 }
+
+
+namespace
+{
+// Number of independent accumulators used in the batch estimators
+constexpr int LOCK_DETECTOR_LANES = 8;
+
+template <typename T>
+struct Prompt_Sums
+{
+    T abs_i;
+    T i;
+    T q;
+    T m2;
+    T m4;
+};
+
+
+template <typename T>
+Prompt_Sums<T> accumulate_prompt_sums(const T* prompt_i, const T* prompt_q, int length)
+{
+    std::array<T, LOCK_DETECTOR_LANES> abs_i{};
+    std::array<T, LOCK_DETECTOR_LANES> sum_i{};
+    std::array<T, LOCK_DETECTOR_LANES> sum_q{};
+    std::array<T, LOCK_DETECTOR_LANES> m2{};
+    std::array<T, LOCK_DETECTOR_LANES> m4{};
+    const int n_blocks = length / LOCK_DETECTOR_LANES;
+    for (int b = 0; b < n_blocks; b++)
+        {
+            const T* pi = prompt_i + b * LOCK_DETECTOR_LANES;
+            const T* pq = prompt_q + b * LOCK_DETECTOR_LANES;
+            for (int l = 0; l < LOCK_DETECTOR_LANES; l++)
+                {
+                    const T aux = pi[l] * pi[l] + pq[l] * pq[l];
+                    abs_i[l] += std::abs(pi[l]);
+                    sum_i[l] += pi[l];
+                    sum_q[l] += pq[l];
+                    m2[l] += aux;
+                    m4[l] += aux * aux;
+                }
+        }
+    for (int i = n_blocks * LOCK_DETECTOR_LANES; i < length; i++)
+        {
+            const T aux = prompt_i[i] * prompt_i[i] + prompt_q[i] * prompt_q[i];
+            abs_i[0] += std::abs(prompt_i[i]);
+            sum_i[0] += prompt_i[i];
+            sum_q[0] += prompt_q[i];
+            m2[0] += aux;
+            m4[0] += aux * aux;
+        }
+    Prompt_Sums<T> sums{T(0), T(0), T(0), T(0), T(0)};
+    for (int l = 0; l < LOCK_DETECTOR_LANES; l++)
+        {
+            sums.abs_i += abs_i[l];
+            sums.i += sum_i[l];
+            sums.q += sum_q[l];
+            sums.m2 += m2[l];
+            sums.m4 += m4[l];
+        }
+    return sums;
+}
+
+
+template <typename T>
+T cn0_m2m4_from_sums(T sum_abs_i, T sum_m2, T sum_m4, int length, T coh_integration_time_s)
+{
+    const auto n = static_cast<T>(length);
+    T Psig = sum_abs_i / n;
+    Psig = Psig * Psig;
+    const T m_2 = sum_m2 / n;
+    const T m_4 = sum_m4 / n;
+    const T aux = std::sqrt(T(2.0) * m_2 * m_2 - m_4);
+    T SNR_aux;
+    if (std::isnan(aux))
+        {
+            SNR_aux = Psig / (m_2 - Psig);
+        }
+    else
+        {
+            SNR_aux = aux / (m_2 - aux);
+        }
+    return T(10.0) * std::log10(SNR_aux) - T(10.0) * std::log10(coh_integration_time_s);
+}
+
+
+template <typename T>
+T cn0_svn_from_sums(T sum_abs_i, T sum_m2, int length, T coh_integration_time_s)
+{
+    const auto n = static_cast<T>(length);
+    T Psig = sum_abs_i / n;
+    Psig = Psig * Psig;
+    const T Ptot = sum_m2 / n;
+    const T SNR = Psig / (Ptot - Psig);
+    return T(10.0) * std::log10(SNR) - T(10.0) * std::log10(coh_integration_time_s);
+}
+
+
+template <typename T>
+T carrier_lock_from_sums(T sum_i, T sum_q)
+{
+    const T NBP = sum_i * sum_i + sum_q * sum_q;
+    const T NBD = sum_i * sum_i - sum_q * sum_q;
+    return NBD / NBP;
+}
+}  // namespace
+
+
+template <typename T>
+T cn0_m2m4_estimator(const T* prompt_i, const T* prompt_q, int length, T coh_integration_time_s)
+{
+    const Prompt_Sums<T> sums = accumulate_prompt_sums(prompt_i, prompt_q, length);
+    return cn0_m2m4_from_sums(sums.abs_i, sums.m2, sums.m4, length, coh_integration_time_s);
+}
+
+
+template <typename T>
+T cn0_svn_estimator(const T* prompt_i, const T* prompt_q, int length, T coh_integration_time_s)
+{
+    const Prompt_Sums<T> sums = accumulate_prompt_sums(prompt_i, prompt_q, length);
+    return cn0_svn_from_sums(sums.abs_i, sums.m2, length, coh_integration_time_s);
+}
+
+
+template <typename T>
+T carrier_lock_detector(const T* prompt_i, const T* prompt_q, int length)
+{
+    const Prompt_Sums<T> sums = accumulate_prompt_sums(prompt_i, prompt_q, length);
+    return carrier_lock_from_sums(sums.i, sums.q);
+}
+
+
+template <typename T>
+Streaming_Lock_Detector<T>::Streaming_Lock_Detector() : Streaming_Lock_Detector(1)
+{
+}
+
+
+template <typename T>
+Streaming_Lock_Detector<T>::Streaming_Lock_Detector(int window_length)
+{
+    set_window_length(window_length);
+}
+
+
+template <typename T>
+void Streaming_Lock_Detector<T>::set_window_length(int window_length)
+{
+    window_length_ = window_length > 0 ? window_length : 1;
+    prompt_i_.assign(window_length_, T(0));
+    prompt_q_.assign(window_length_, T(0));
+    reset();
+}
+
+
+template <typename T>
+void Streaming_Lock_Detector<T>::reset()
+{
+    std::fill(prompt_i_.begin(), prompt_i_.end(), T(0));
+    std::fill(prompt_q_.begin(), prompt_q_.end(), T(0));
+    sum_abs_i_ = T(0);
+    sum_i_ = T(0);
+    sum_q_ = T(0);
+    sum_m2_ = T(0);
+    sum_m4_ = T(0);
+    n_samples_ = 0;
+    index_ = 0;
+}
+
+
+template <typename T>
+void Streaming_Lock_Detector<T>::update(const std::complex<T>& prompt)
+{
+    const T new_i = prompt.real();
+    const T new_q = prompt.imag();
+    const T new_m2 = new_i * new_i + new_q * new_q;
+    const T old_i = prompt_i_[index_];
+    const T old_q = prompt_q_[index_];
+    const T old_m2 = old_i * old_i + old_q * old_q;
+
+    sum_abs_i_ += std::abs(new_i) - std::abs(old_i);
+    sum_i_ += new_i - old_i;
+    sum_q_ += new_q - old_q;
+    sum_m2_ += new_m2 - old_m2;
+    sum_m4_ += new_m2 * new_m2 - old_m2 * old_m2;
+
+    prompt_i_[index_] = new_i;
+    prompt_q_[index_] = new_q;
+    if (n_samples_ < window_length_)
+        {
+            n_samples_++;
+        }
+    index_++;
+    if (index_ == window_length_)
+        {
+            index_ = 0;
+            resync();
+        }
+}
+
+
+template <typename T>
+void Streaming_Lock_Detector<T>::resync()
+{
+    const Prompt_Sums<T> sums = accumulate_prompt_sums(prompt_i_.data(), prompt_q_.data(), window_length_);
+    sum_abs_i_ = sums.abs_i;
+    sum_i_ = sums.i;
+    sum_q_ = sums.q;
+    sum_m2_ = sums.m2;
+    sum_m4_ = sums.m4;
+}
+
+
+template <typename T>
+T Streaming_Lock_Detector<T>::cn0_m2m4(T coh_integration_time_s) const
+{
+    return cn0_m2m4_from_sums(sum_abs_i_, sum_m2_, sum_m4_, window_length_, coh_integration_time_s);
+}
+
+
+template <typename T>
+T Streaming_Lock_Detector<T>::cn0_svn(T coh_integration_time_s) const
+{
+    return cn0_svn_from_sums(sum_abs_i_, sum_m2_, window_length_, coh_integration_time_s);
+}
+
+
+template <typename T>
+T Streaming_Lock_Detector<T>::carrier_lock() const
+{
+    return carrier_lock_from_sums(sum_i_, sum_q_);
+}
+
+
+template float cn0_m2m4_estimator<float>(const float* prompt_i, const float* prompt_q, int length, float coh_integration_time_s);
+template double cn0_m2m4_estimator<double>(const double* prompt_i, const double* prompt_q, int length, double coh_integration_time_s);
+template float cn0_svn_estimator<float>(const float* prompt_i, const float* prompt_q, int length, float coh_integration_time_s);
+template double cn0_svn_estimator<double>(const double* prompt_i, const double* prompt_q, int length, double coh_integration_time_s);
+template float carrier_lock_detector<float>(const float* prompt_i, const float* prompt_q, int length);
+template double carrier_lock_detector<double>(const double* prompt_i, const double* prompt_q, int length);
+template class Streaming_Lock_Detector<float>;
+template class Streaming_Lock_Detector<double>;
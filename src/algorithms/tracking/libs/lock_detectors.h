@@ -38,6 +38,8 @@
 #define GNSS_SDR_LOCK_DETECTORS_H
 
 #include <gnuradio/gr_complex.h>
+#include <complex>
+#include <vector>
 
 
 /*! \brief cn0_svn_estimator is a Carrier-to-Noise (CN0) estimator
@@ -105,4 +107,81 @@ float cn0_m2m4_estimator(const gr_complex* Prompt_buffer, int length, float coh_
  */
 float carrier_lock_detector(gr_complex* Prompt_buffer, int length);
 
+
+/*! \brief Batch form of cn0_m2m4_estimator working on structure-of-arrays
+ * prompt correlator outputs (separate in-phase and quadrature arrays).
+ *
+ * The sums are accumulated in independent lanes with branch-free loops, so
+ * the compiler can vectorize them without reordering floating-point
+ * operations. This is the form to be used when the prompt correlators of a
+ * whole estimation window, or of several channels, are stored contiguously.
+ */
+template <typename T>
+T cn0_m2m4_estimator(const T* prompt_i, const T* prompt_q, int length, T coh_integration_time_s);
+
+
+/*! \brief Batch form of cn0_svn_estimator working on structure-of-arrays
+ * prompt correlator outputs.
+ */
+template <typename T>
+T cn0_svn_estimator(const T* prompt_i, const T* prompt_q, int length, T coh_integration_time_s);
+
+
+/*! \brief Batch form of carrier_lock_detector working on structure-of-arrays
+ * prompt correlator outputs.
+ */
+template <typename T>
+T carrier_lock_detector(const T* prompt_i, const T* prompt_q, int length);
+
+
+/*! \brief Streaming C/N0 estimator and carrier lock detector over a sliding
+ * window of prompt correlator outputs.
+ *
+ * Keeps the running sums of \f$ |Re(Pc(i))| \f$, \f$ |Pc(i)|^2 \f$,
+ * \f$ |Pc(i)|^4 \f$, \f$ Re(Pc(i)) \f$ and \f$ Im(Pc(i)) \f$ over the last
+ * window_length samples, so adding a new prompt sample and evaluating the
+ * M2M4 / SNV estimators or the carrier lock detector costs O(1) per epoch
+ * instead of O(window_length). In order to avoid the accumulation of
+ * rounding errors, the sums are recomputed from the window contents with the
+ * batch estimators each time the window wraps around, which keeps the
+ * amortized cost O(1).
+ *
+ * The window is stored as structure-of-arrays, and it is available in float
+ * and double precision.
+ */
+template <typename T>
+class Streaming_Lock_Detector
+{
+public:
+    Streaming_Lock_Detector();
+    explicit Streaming_Lock_Detector(int window_length);
+    ~Streaming_Lock_Detector() = default;
+
+    void set_window_length(int window_length);  //!< Sets the window length and resets the estimator
+    void reset();                               //!< Empties the window
+
+    void update(const std::complex<T>& prompt);  //!< Adds a new prompt correlator output
+
+    inline bool ready() const { return n_samples_ >= window_length_; }  //!< True if the window is full
+    inline int window_length() const { return window_length_; }
+
+    T cn0_m2m4(T coh_integration_time_s) const;  //!< M2M4 C/N0 estimation [dB-Hz] over the window
+    T cn0_svn(T coh_integration_time_s) const;   //!< SNV C/N0 estimation [dB-Hz] over the window
+    T carrier_lock() const;                      //!< Carrier lock test over the window
+
+private:
+    void resync();
+
+    std::vector<T> prompt_i_;
+    std::vector<T> prompt_q_;
+    T sum_abs_i_;
+    T sum_i_;
+    T sum_q_;
+    T sum_m2_;
+    T sum_m4_;
+    int window_length_;
+    int n_samples_;
+    int index_;
+};
+
 #endif
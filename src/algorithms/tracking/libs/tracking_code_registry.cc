@@ -0,0 +1,157 @@
+/*!
+ * \file tracking_code_registry.cc
+ * \brief Process-wide registry of local code replicas used by the tracking
+ * loops.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "tracking_code_registry.h"
+#include "beidou_b1i_signal_processing.h"
+#include "beidou_b3i_signal_processing.h"
+#include "galileo_e1_signal_processing.h"
+#include "galileo_e5_signal_processing.h"
+#include "gnss_sdr_make_unique.h"
+#include "gps_l2c_signal.h"
+#include "gps_l5_signal.h"
+#include "gps_sdr_signal_processing.h"
+#include <glog/logging.h>
+#include <array>
+#include <complex>
+#include <utility>
+
+
+const Tracking_Codes& Tracking_Code_Registry::get(const std::string& system_name,
+    const std::string& signal_type,
+    uint32_t prn,
+    uint32_t code_length_chips,
+    bool track_pilot)
+{
+    const Key key(system_name, signal_type, prn, track_pilot);
+    std::lock_guard<std::mutex> lock(table_mutex());
+    auto& codes_table = table();
+    auto it = codes_table.find(key);
+    if (it == codes_table.end())
+        {
+            DLOG(INFO) << "Generating tracking codes for " << system_name << " " << signal_type << " PRN " << prn;
+            it = codes_table.emplace(key, generate(system_name, signal_type, prn, code_length_chips, track_pilot)).first;
+        }
+    return *(it->second);
+}
+
+
+size_t Tracking_Code_Registry::size()
+{
+    std::lock_guard<std::mutex> lock(table_mutex());
+    return table().size();
+}
+
+
+std::map<Tracking_Code_Registry::Key, std::unique_ptr<const Tracking_Codes>>& Tracking_Code_Registry::table()
+{
+    static std::map<Key, std::unique_ptr<const Tracking_Codes>> codes_table;
+    return codes_table;
+}
+
+
+std::mutex& Tracking_Code_Registry::table_mutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+
+std::unique_ptr<Tracking_Codes> Tracking_Code_Registry::generate(const std::string& system_name,
+    const std::string& signal_type,
+    uint32_t prn,
+    uint32_t code_length_chips,
+    bool track_pilot)
+{
+    auto codes = std::make_unique<Tracking_Codes>();
+    codes->tracking_code.resize(2 * code_length_chips, 0.0);
+    if (track_pilot)
+        {
+            codes->data_code.resize(2 * code_length_chips, 0.0);
+        }
+
+    if (system_name == "GPS" and signal_type == "1C")
+        {
+            gps_l1_ca_code_gen_float(codes->tracking_code, prn, 0);
+        }
+    else if (system_name == "GPS" and signal_type == "2S")
+        {
+            gps_l2c_m_code_gen_float(codes->tracking_code, prn);
+        }
+    else if (system_name == "GPS" and signal_type == "L5")
+        {
+            if (track_pilot)
+                {
+                    gps_l5q_code_gen_float(codes->tracking_code, prn);
+                    gps_l5i_code_gen_float(codes->data_code, prn);
+                }
+            else
+                {
+                    gps_l5i_code_gen_float(codes->tracking_code, prn);
+                }
+        }
+    else if (system_name == "Galileo" and signal_type == "1B")
+        {
+            const std::array<char, 3> data_signal = {{'1', 'B', '\0'}};
+            if (track_pilot)
+                {
+                    const std::array<char, 3> pilot_signal = {{'1', 'C', '\0'}};
+                    galileo_e1_code_gen_sinboc11_float(codes->tracking_code, pilot_signal, prn);
+                    galileo_e1_code_gen_sinboc11_float(codes->data_code, data_signal, prn);
+                }
+            else
+                {
+                    galileo_e1_code_gen_sinboc11_float(codes->tracking_code, data_signal, prn);
+                }
+        }
+    else if (system_name == "Galileo" and signal_type == "5X")
+        {
+            volk_gnsssdr::vector<std::complex<float>> aux_code(code_length_chips);
+            const std::array<char, 3> signal_type_ = {{'5', 'X', '\0'}};
+            galileo_e5_a_code_gen_complex_primary(aux_code, prn, signal_type_);
+            if (track_pilot)
+                {
+                    for (uint32_t i = 0; i < code_length_chips; i++)
+                        {
+                            codes->tracking_code[i] = aux_code[i].imag();
+                            codes->data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5aI + E5aQ)
+                        }
+                }
+            else
+                {
+                    for (uint32_t i = 0; i < code_length_chips; i++)
+                        {
+                            codes->tracking_code[i] = aux_code[i].real();
+                        }
+                }
+        }
+    else if (system_name == "Beidou" and signal_type == "B1")
+        {
+            beidou_b1i_code_gen_float(codes->tracking_code, prn, 0);
+        }
+    else if (system_name == "Beidou" and signal_type == "B3")
+        {
+            beidou_b3i_code_gen_float(codes->tracking_code, prn, 0);
+        }
+    else
+        {
+            LOG(WARNING) << "No tracking codes available for " << system_name << " " << signal_type;
+        }
+
+    return codes;
+}
@@ -0,0 +1,98 @@
+/*!
+ * \file tracking_code_registry.h
+ * \brief Process-wide registry of local code replicas used by the tracking
+ * loops.
+ *
+ * The primary (and, when tracking pilot signals, data) codes used by the
+ * tracking correlators only depend on the signal and on the PRN. Instead of
+ * regenerating them every time a channel switches to tracking, they are
+ * generated once per signal and PRN and kept in an immutable table shared by
+ * all the channels.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TRACKING_CODE_REGISTRY_H
+#define GNSS_SDR_TRACKING_CODE_REGISTRY_H
+
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+/*!
+ * \brief Local codes of a given signal and PRN, as required by the tracking
+ * correlators. Objects of this class are never modified after being
+ * registered.
+ */
+class Tracking_Codes
+{
+public:
+    Tracking_Codes() = default;
+    Tracking_Codes(const Tracking_Codes&) = delete;
+    Tracking_Codes& operator=(const Tracking_Codes&) = delete;
+
+    volk_gnsssdr::vector<float> tracking_code;  // code tracked by the DLL/PLL (pilot component, if any)
+    volk_gnsssdr::vector<float> data_code;      // data component, only if a pilot component is tracked
+};
+
+
+/*!
+ * \brief Thread-safe registry of Tracking_Codes.
+ *
+ * Codes are generated the first time they are requested, and the returned
+ * references remain valid for the whole life of the process.
+ */
+class Tracking_Code_Registry
+{
+public:
+    /*!
+     * \brief Returns the local codes for the signal identified by its
+     * system name ("GPS", "Galileo", "Beidou"), signal type ("1C", "2S",
+     * "L5", "1B", "5X", "B1", "B3") and PRN.
+     *
+     * \param code_length_chips Code length of the signal, in chips. The
+     * tables are allocated with twice this length, as done by the tracking
+     * blocks.
+     * \param track_pilot If true, the pilot component is returned as the
+     * tracking code and the data component as the data code.
+     */
+    static const Tracking_Codes& get(const std::string& system_name,
+        const std::string& signal_type,
+        uint32_t prn,
+        uint32_t code_length_chips,
+        bool track_pilot);
+
+    /*!
+     * \brief Returns the number of code tables currently registered.
+     */
+    static size_t size();
+
+private:
+    using Key = std::tuple<std::string, std::string, uint32_t, bool>;
+
+    static std::unique_ptr<Tracking_Codes> generate(const std::string& system_name,
+        const std::string& signal_type,
+        uint32_t prn,
+        uint32_t code_length_chips,
+        bool track_pilot);
+
+    static std::map<Key, std::unique_ptr<const Tracking_Codes>>& table();
+    static std::mutex& table_mutex();
+};
+
+#endif  // GNSS_SDR_TRACKING_CODE_REGISTRY_H
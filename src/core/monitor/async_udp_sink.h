@@ -0,0 +1,203 @@
+/*!
+ * \file async_udp_sink.h
+ * \brief Queue of monitoring records that are serialized and sent over UDP
+ * by their own thread
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ASYNC_UDP_SINK_H
+#define GNSS_SDR_ASYNC_UDP_SINK_H
+
+#include "udp_datagram_sender.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Sends records of type T over UDP from an I/O thread.
+ *
+ * write() copies the records into a ring allocated at construction and
+ * returns at once; when the ring has no room for them, the records are
+ * dropped and counted. The I/O thread takes the records waiting in the ring,
+ * up to max_batch of them, serializes them into one datagram and sends it to
+ * all the endpoints. At low rates each datagram carries the records of a
+ * single write(); when the records arrive faster than they are sent, several
+ * writes are coalesced into one datagram. A datagram longer than the maximum
+ * UDP payload is split.
+ *
+ * stop(), also called by the destructor, sends the records still queued
+ * before joining the thread.
+ */
+template <typename T>
+class Async_Udp_Sink
+{
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "The records of an Async_Udp_Sink must be trivially copyable");
+
+    using Serializer = std::function<std::string(const std::vector<T>&)>;
+
+    /*!
+     * \brief capacity = maximum number of records waiting to be sent;
+     * max_batch = maximum number of records in a datagram; serializer =
+     * function that builds the datagram of a batch of records
+     */
+    Async_Udp_Sink(const std::vector<std::string>& addresses, uint16_t port, size_t capacity, size_t max_batch, Serializer serializer)
+        : d_sender(addresses, port),
+          d_serializer(std::move(serializer)),
+          d_capacity(std::max(capacity, static_cast<size_t>(1))),
+          d_max_batch(std::min(std::max(max_batch, static_cast<size_t>(1)), d_capacity))
+    {
+        d_ring.resize(d_capacity);
+        d_batch.reserve(d_max_batch);
+        d_thread = std::thread([this] { run(); });
+    }
+
+    ~Async_Udp_Sink() { stop(); }
+
+    Async_Udp_Sink(const Async_Udp_Sink&) = delete;
+    Async_Udp_Sink& operator=(const Async_Udp_Sink&) = delete;
+
+    /*!
+     * \brief Sends the records still queued and stops the I/O thread. Later
+     * writes are dropped.
+     */
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_stop = true;
+        }
+        d_not_empty.notify_one();
+        if (d_thread.joinable())
+            {
+                d_thread.join();
+            }
+    }
+
+    /*!
+     * \brief Queues n records, to be sent in the same datagram if they fit.
+     * Returns false if there was no room for them and they were dropped.
+     */
+    bool write(const T* records, size_t n)
+    {
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            if (d_size + n > d_capacity or d_stop)
+                {
+                    d_dropped += n;
+                    return false;
+                }
+            for (size_t i = 0; i < n; i++)
+                {
+                    d_ring[(d_head + d_size + i) % d_capacity] = records[i];
+                }
+            d_size += n;
+        }
+        d_not_empty.notify_one();
+        d_written += n;
+        return true;
+    }
+
+    inline size_t endpoints() const { return d_sender.endpoints(); }  //!< Number of valid endpoints
+    inline uint64_t written() const { return d_written.load(); }      //!< Records accepted by write()
+    inline uint64_t dropped() const { return d_dropped.load(); }      //!< Records dropped because the ring was full
+    inline uint64_t datagrams() const { return d_datagrams.load(); }  //!< Datagrams sent
+    inline uint64_t failed() const { return d_failed.load(); }        //!< Datagrams that could not be built or sent
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        while (true)
+            {
+                d_not_empty.wait(lock, [this] { return d_size > 0 or d_stop; });
+                if (d_size == 0)
+                    {
+                        // stop requested and nothing left to send
+                        break;
+                    }
+                // everything waiting, up to a full datagram, goes together
+                const size_t n = std::min(d_size, d_max_batch);
+                d_batch.clear();
+                for (size_t i = 0; i < n; i++)
+                    {
+                        d_batch.push_back(d_ring[(d_head + i) % d_capacity]);
+                    }
+                d_head = (d_head + n) % d_capacity;
+                d_size -= n;
+                lock.unlock();
+                send(d_batch);
+                lock.lock();
+            }
+    }
+
+    void send(const std::vector<T>& batch)
+    {
+        std::string datagram;
+        try
+            {
+                datagram = d_serializer(batch);
+            }
+        catch (const std::exception&)
+            {
+                d_failed++;
+                return;
+            }
+        if (datagram.size() > Udp_Datagram_Sender::MAX_DATAGRAM_LENGTH and batch.size() > 1)
+            {
+                const auto middle = batch.begin() + batch.size() / 2;
+                send(std::vector<T>(batch.begin(), middle));
+                send(std::vector<T>(middle, batch.end()));
+                return;
+            }
+        if (d_sender.send(datagram))
+            {
+                d_datagrams++;
+            }
+        else
+            {
+                d_failed++;
+            }
+    }
+
+    Udp_Datagram_Sender d_sender;  // only used by the I/O thread
+    Serializer d_serializer;
+    std::vector<T> d_ring;   // circular buffer of capacity records
+    std::vector<T> d_batch;  // records of the datagram being sent
+    size_t d_capacity;
+    size_t d_max_batch;
+    size_t d_head{0};  // position of the oldest record
+    size_t d_size{0};
+    bool d_stop{false};
+    std::mutex d_mutex;
+    std::condition_variable d_not_empty;
+    std::atomic<uint64_t> d_written{0};
+    std::atomic<uint64_t> d_dropped{0};
+    std::atomic<uint64_t> d_datagrams{0};
+    std::atomic<uint64_t> d_failed{0};
+    std::thread d_thread;
+};
+
+#endif  // GNSS_SDR_ASYNC_UDP_SINK_H
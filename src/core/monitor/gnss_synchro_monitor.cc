@@ -53,7 +53,8 @@ gnss_synchro_monitor::gnss_synchro_monitor(unsigned int n_channels,
     d_decimation_factor = decimation_factor;
     d_nchannels = n_channels;
 
-    udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_port, enable_protobuf);
+    udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_port, enable_protobuf, n_channels);
+    d_stocks.reserve(n_channels);
 
     count = 0;
 }
@@ -68,12 +69,13 @@ int gnss_synchro_monitor::work(int noutput_items, gr_vector_const_void_star& inp
             count++;
             if (count >= d_decimation_factor)
                 {
+                    // the channels of an epoch are sent together, without waiting for the I/O thread
+                    d_stocks.clear();
                     for (unsigned int i = 0; i < d_nchannels; i++)
                         {
-                            std::vector<Gnss_Synchro> stocks;
-                            stocks.push_back(in[i][epoch]);
-                            udp_sink_ptr->write_gnss_synchro(stocks);
+                            d_stocks.push_back(in[i][epoch]);
                         }
+                    udp_sink_ptr->write_gnss_synchro(d_stocks);
                     count = 0;
                 }
         }
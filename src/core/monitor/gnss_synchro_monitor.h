@@ -78,6 +78,7 @@ private:
     unsigned int d_nchannels;
     int d_decimation_factor;
     std::unique_ptr<Gnss_Synchro_Udp_Sink> udp_sink_ptr;
+    std::vector<Gnss_Synchro> d_stocks;  // objects of the epoch being sent
     int count;
 };
 
@@ -21,51 +21,47 @@
 #include "gnss_synchro_udp_sink.h"
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/vector.hpp>
-#include <iostream>
+#include <glog/logging.h>
 #include <sstream>
 
-Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf) : socket{io_context}
+Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf, size_t records_per_epoch)
+    : use_protobuf(enable_protobuf),
+      sink(addresses, port, QUEUE_EPOCHS * records_per_epoch, MAX_EPOCHS_PER_DATAGRAM * records_per_epoch,
+          [this](const std::vector<Gnss_Synchro>& stocks) { return serialize(stocks); })
 {
-    use_protobuf = enable_protobuf;
-    if (enable_protobuf)
+}
+
+
+Gnss_Synchro_Udp_Sink::~Gnss_Synchro_Udp_Sink()
+{
+    sink.stop();
+    if (sink.dropped() > 0)
         {
-            serdes = Serdes_Gnss_Synchro();
+            LOG(WARNING) << "Gnss_Synchro monitor dropped " << sink.dropped() << " of " << sink.written() + sink.dropped()
+                         << " objects, " << sink.datagrams() << " datagrams sent, " << sink.failed() << " failed";
         }
-    for (const auto& address : addresses)
+    else
         {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
+            LOG(INFO) << "Gnss_Synchro monitor sent " << sink.written() << " objects in " << sink.datagrams()
+                      << " datagrams, " << sink.failed() << " failed";
         }
 }
 
 
 bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
 {
-    std::string outbound_data;
+    return sink.write(stocks.data(), stocks.size());
+}
+
+
+std::string Gnss_Synchro_Udp_Sink::serialize(const std::vector<Gnss_Synchro>& stocks)
+{
     if (use_protobuf == false)
         {
             std::ostringstream archive_stream;
             boost::archive::binary_oarchive oa{archive_stream};
             oa << stocks;
-            outbound_data = archive_stream.str();
-        }
-    else
-        {
-            outbound_data = serdes.createProtobuffer(stocks);
-        }
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
-
-            try
-                {
-                    socket.send(boost::asio::buffer(outbound_data));
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    return false;
-                }
+            return archive_stream.str();
         }
-    return true;
+    return serdes.createProtobuffer(stocks);
 }
@@ -21,37 +21,46 @@
 #ifndef GNSS_SDR_GNSS_SYNCHRO_UDP_SINK_H
 #define GNSS_SDR_GNSS_SYNCHRO_UDP_SINK_H
 
+#include "async_udp_sink.h"
 #include "gnss_synchro.h"
 #include "serdes_gnss_synchro.h"
-#include <boost/asio.hpp>
-#include <boost/system/error_code.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 /*!
  * \brief This class sends serialized Gnss_Synchro objects
  * over UDP to one or multiple endpoints.
+ *
+ * The objects are serialized and sent by an I/O thread, so that writing them
+ * does not block the caller. The objects of several writes are coalesced in
+ * one datagram when they arrive faster than they are sent.
  */
 class Gnss_Synchro_Udp_Sink
 {
 public:
-    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf);
+    static const size_t QUEUE_EPOCHS = 64;             //!< Writes of records_per_epoch objects that can wait to be sent
+    static const size_t MAX_EPOCHS_PER_DATAGRAM = 10;  //!< Writes of records_per_epoch objects that can be coalesced
+
+    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf, size_t records_per_epoch = 1);
+    ~Gnss_Synchro_Udp_Sink();
+
+    /*!
+     * \brief Queues the objects to be sent in the same datagram. Returns
+     * false if they were dropped because the queue was full.
+     */
     bool write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);
 
+    inline uint64_t written() const { return sink.written(); }  //!< Objects queued
+    inline uint64_t dropped() const { return sink.dropped(); }  //!< Objects dropped because the queue was full
+
 private:
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    boost::system::error_code error;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    std::string serialize(const std::vector<Gnss_Synchro>& stocks);  // in the I/O thread
+
     Serdes_Gnss_Synchro serdes;
     bool use_protobuf;
+    Async_Udp_Sink<Gnss_Synchro> sink;  // last, so that its thread stops before serdes is destroyed
 };
 
 
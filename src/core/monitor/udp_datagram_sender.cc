@@ -0,0 +1,133 @@
+/*!
+ * \file udp_datagram_sender.cc
+ * \brief Implementation of a class that sends each datagram to one or
+ * multiple UDP endpoints with a single system call
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "udp_datagram_sender.h"
+#include "gnss_sdr_make_unique.h"
+#include <glog/logging.h>
+#include <cerrno>   // for errno, EINTR
+#include <utility>  // for std::move
+
+
+Udp_Datagram_Sender::Udp_Datagram_Sender(const std::vector<std::string>& addresses, uint16_t port)
+{
+    for (const auto& address : addresses)
+        {
+            boost::system::error_code error;
+            const boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
+            if (error)
+                {
+                    LOG(WARNING) << "Invalid monitor address " << address << ": " << error.message();
+                    continue;
+                }
+            Destinations* destinations = nullptr;
+            for (auto& d : d_destinations)
+                {
+                    if (d->endpoints.front().protocol() == endpoint.protocol())
+                        {
+                            destinations = d.get();
+                        }
+                }
+            if (destinations == nullptr)
+                {
+                    auto new_destinations = std::make_unique<Destinations>(d_io_context);
+                    new_destinations->socket.open(endpoint.protocol(), error);
+                    if (error)
+                        {
+                            LOG(WARNING) << "Could not open a UDP socket for " << address << ": " << error.message();
+                            continue;
+                        }
+                    destinations = new_destinations.get();
+                    d_destinations.push_back(std::move(new_destinations));
+                }
+            destinations->endpoints.push_back(endpoint);
+            d_endpoints++;
+        }
+
+#if defined(__linux__)
+    // the endpoints no longer move, so the message headers can point to them
+    for (auto& destinations : d_destinations)
+        {
+            destinations->headers.resize(destinations->endpoints.size());
+            for (size_t i = 0; i < destinations->endpoints.size(); i++)
+                {
+                    mmsghdr& header = destinations->headers[i];
+                    header = mmsghdr{};
+                    header.msg_hdr.msg_name = destinations->endpoints[i].data();
+                    header.msg_hdr.msg_namelen = static_cast<socklen_t>(destinations->endpoints[i].size());
+                    header.msg_hdr.msg_iov = &destinations->iov;
+                    header.msg_hdr.msg_iovlen = 1;
+                }
+        }
+#endif
+}
+
+
+bool Udp_Datagram_Sender::send(const std::string& datagram)
+{
+    bool sent = false;
+    for (auto& destinations : d_destinations)
+        {
+            if (send(*destinations, datagram))
+                {
+                    sent = true;
+                }
+        }
+    return sent;
+}
+
+
+bool Udp_Datagram_Sender::send(Destinations& destinations, const std::string& datagram)
+{
+#if defined(__linux__)
+    destinations.iov.iov_base = const_cast<char*>(datagram.data());
+    destinations.iov.iov_len = datagram.size();
+    size_t first = 0;
+    size_t sent = 0;
+    while (first < destinations.headers.size())
+        {
+            const int ret = sendmmsg(destinations.socket.native_handle(), &destinations.headers[first],
+                static_cast<unsigned int>(destinations.headers.size() - first), 0);
+            if (ret <= 0)
+                {
+                    if (ret < 0 and errno == EINTR)
+                        {
+                            continue;
+                        }
+                    // skip the endpoint that failed, for instance with nobody listening on it
+                    first++;
+                    continue;
+                }
+            first += static_cast<size_t>(ret);
+            sent += static_cast<size_t>(ret);
+        }
+    return sent > 0;
+#else
+    bool sent = false;
+    for (const auto& endpoint : destinations.endpoints)
+        {
+            boost::system::error_code error;
+            destinations.socket.send_to(boost::asio::buffer(datagram), endpoint, 0, error);
+            if (!error)
+                {
+                    sent = true;
+                }
+        }
+    return sent;
+#endif
+}
@@ -0,0 +1,84 @@
+/*!
+ * \file udp_datagram_sender.h
+ * \brief Interface of a class that sends each datagram to one or multiple
+ * UDP endpoints with a single system call
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_UDP_DATAGRAM_SENDER_H
+#define GNSS_SDR_UDP_DATAGRAM_SENDER_H
+
+#include <boost/asio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#if defined(__linux__)
+#include <sys/socket.h>  // for mmsghdr
+#include <sys/uio.h>     // for iovec
+#endif
+
+#if USE_BOOST_ASIO_IO_CONTEXT
+using b_io_context = boost::asio::io_context;
+#else
+using b_io_context = boost::asio::io_service;
+#endif
+
+/*!
+ * \brief Sends datagrams to a fixed list of UDP endpoints.
+ *
+ * The sockets are opened once, one for each protocol of the endpoints. On
+ * Linux, the copies of a datagram for all the endpoints of a socket are sent
+ * with a single sendmmsg() call; elsewhere, with one send_to() per endpoint.
+ * Addresses that cannot be parsed are skipped.
+ */
+class Udp_Datagram_Sender
+{
+public:
+    static const std::size_t MAX_DATAGRAM_LENGTH = 65507;  //!< Maximum payload of a UDP datagram over IPv4
+
+    Udp_Datagram_Sender(const std::vector<std::string>& addresses, uint16_t port);
+
+    ~Udp_Datagram_Sender() = default;
+
+    /*!
+     * \brief Sends the datagram to all the endpoints. Returns false if it
+     * could not be sent to any of them.
+     */
+    bool send(const std::string& datagram);
+
+    inline std::size_t endpoints() const { return d_endpoints; }  //!< Number of valid endpoints
+
+private:
+    struct Destinations
+    {
+        explicit Destinations(b_io_context& io_context) : socket{io_context} {}
+        boost::asio::ip::udp::socket socket;
+        std::vector<boost::asio::ip::udp::endpoint> endpoints;
+#if defined(__linux__)
+        std::vector<mmsghdr> headers;  // one per endpoint, all pointing to iov
+        iovec iov{};
+#endif
+    };
+
+    bool send(Destinations& destinations, const std::string& datagram);
+
+    b_io_context d_io_context;
+    std::vector<std::unique_ptr<Destinations>> d_destinations;  // one per protocol
+    std::size_t d_endpoints{};
+};
+
+#endif  // GNSS_SDR_UDP_DATAGRAM_SENDER_H
@@ -26,6 +26,10 @@
 #endif
 
 #include "control_thread.h"
+#include "beidou_dnav_almanac.h"
+#include "beidou_dnav_ephemeris.h"
+#include "beidou_dnav_iono.h"
+#include "beidou_dnav_utc_model.h"
 #include "channel_event.h"
 #include "command_event.h"
 #include "concurrent_map.h"
@@ -38,12 +42,14 @@
 #include "geofunctions.h"
 #include "glonass_gnav_ephemeris.h"
 #include "glonass_gnav_utc_model.h"
+#include "gnss_assistance_store.h"
 #include "gnss_flowgraph.h"
 #include "gnss_satellite.h"
 #include "gnss_sdr_flags.h"
 #include "gps_acq_assist.h"        // for Gps_Acq_Assist
 #include "gps_almanac.h"           // for Gps_Almanac
 #include "gps_cnav_ephemeris.h"    // for Gps_CNAV_Ephemeris
+#include "gps_cnav_iono.h"         // for Gps_CNAV_Iono
 #include "gps_cnav_utc_model.h"    // for Gps_CNAV_Utc_Model
 #include "gps_ephemeris.h"         // for Gps_Ephemeris
 #include "gps_iono.h"              // for Gps_Iono
@@ -77,6 +83,36 @@ extern Concurrent_Map<Gps_Acq_Assist> global_gps_acq_assist_map;
 extern Concurrent_Queue<Gps_Acq_Assist> global_gps_acq_assist_queue;
 
 
+namespace
+{
+// sends the latest records of type T of the store to the PVT block, returns how many
+template <typename T>
+size_t send_assistance_records(const Gnss_Assistance_Store& store, GNSSFlowgraph& flowgraph)
+{
+    const std::map<int, T> records = store.get_all<T>();
+    for (const auto& record : records)
+        {
+            flowgraph.send_telemetry_msg(pmt::make_any(std::make_shared<T>(record.second)));
+        }
+    return records.size();
+}
+
+
+// sends the ionospheric or UTC model of type T of the store, if any, to the PVT block
+template <typename T>
+size_t send_assistance_model(const Gnss_Assistance_Store& store, GNSSFlowgraph& flowgraph)
+{
+    T model;
+    if (store.get(model))
+        {
+            flowgraph.send_telemetry_msg(pmt::make_any(std::make_shared<T>(model)));
+            return 1;
+        }
+    return 0;
+}
+}  // namespace
+
+
 ControlThread::ControlThread()
 {
     if (FLAGS_c == "-")
@@ -391,10 +427,59 @@ void ControlThread::set_control_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_
 }
 
 
+/*
+ * Returns true if the store had any record
+ */
+bool ControlThread::read_assistance_from_store(const std::string &filename)
+{
+    Gnss_Assistance_Store store(filename);
+    if (!store.load())
+        {
+            LOG(INFO) << "Could not read the GNSS assistance store " << filename;
+            return false;
+        }
+    size_t records = 0;
+    records += send_assistance_records<Gps_Ephemeris>(store, *flowgraph_);
+    records += send_assistance_records<Gps_CNAV_Ephemeris>(store, *flowgraph_);
+    records += send_assistance_records<Galileo_Ephemeris>(store, *flowgraph_);
+    records += send_assistance_records<Glonass_Gnav_Ephemeris>(store, *flowgraph_);
+    records += send_assistance_records<Beidou_Dnav_Ephemeris>(store, *flowgraph_);
+    records += send_assistance_records<Gps_Almanac>(store, *flowgraph_);
+    records += send_assistance_records<Galileo_Almanac>(store, *flowgraph_);
+    records += send_assistance_records<Beidou_Dnav_Almanac>(store, *flowgraph_);
+    records += send_assistance_model<Gps_Iono>(store, *flowgraph_);
+    records += send_assistance_model<Gps_CNAV_Iono>(store, *flowgraph_);
+    records += send_assistance_model<Galileo_Iono>(store, *flowgraph_);
+    records += send_assistance_model<Beidou_Dnav_Iono>(store, *flowgraph_);
+    records += send_assistance_model<Gps_Utc_Model>(store, *flowgraph_);
+    records += send_assistance_model<Gps_CNAV_Utc_Model>(store, *flowgraph_);
+    records += send_assistance_model<Galileo_Utc_Model>(store, *flowgraph_);
+    records += send_assistance_model<Glonass_Gnav_Utc_Model>(store, *flowgraph_);
+    records += send_assistance_model<Beidou_Dnav_Utc_Model>(store, *flowgraph_);
+    std::cout << "Read " << records << " ephemeris, almanac, ionospheric and UTC model records from " << filename << std::endl;
+    return records > 0;
+}
+
+
 /*
  * Returns true if reading was successful
  */
 bool ControlThread::read_assistance_from_XML()
+{
+    // the binary store written by the PVT block as the navigation data arrived, if configured, replaces the XML files
+    const std::string store_filename = configuration_->property("GNSS-SDR.AGNSS_store", std::string(""));
+    if (!store_filename.empty() and read_assistance_from_store(store_filename))
+        {
+            return true;
+        }
+    return read_assistance_from_XML_files();
+}
+
+
+/*
+ * Returns true if reading was successful
+ */
+bool ControlThread::read_assistance_from_XML_files()
 {
     // return variable (true == succeeded)
     bool ret = false;
@@ -821,6 +906,16 @@ void ControlThread::assist_GNSS()
                 }
         }
 
+    if ((enable_gps_supl_assistance == false) and (enable_agnss_xml == false))
+        {
+            // the binary store written by the PVT block can also be used on its own
+            const std::string store_filename = configuration_->property("GNSS-SDR.AGNSS_store", std::string(""));
+            if (!store_filename.empty() and read_assistance_from_store(store_filename))
+                {
+                    std::cout << "GNSS assistance data loaded from " << store_filename << std::endl;
+                }
+        }
+
     // If AGNSS is enabled, make use of it
     if ((agnss_ref_location_.valid == true) and ((enable_gps_supl_assistance == true) or (enable_agnss_xml == true)))
         {
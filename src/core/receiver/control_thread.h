@@ -124,9 +124,15 @@ private:
      */
     void event_dispatcher(bool &valid_event, pmt::pmt_t &msg);
 
-    // Read {ephemeris, iono, utc, ref loc, ref time} assistance from a local XML file previously recorded
+    // Read {ephemeris, iono, utc, ref loc, ref time} assistance from the binary store, if configured, or else from local XML files previously recorded
     bool read_assistance_from_XML();
 
+    // Read {ephemeris, iono, utc, ref loc, ref time} assistance from local XML files previously recorded
+    bool read_assistance_from_XML_files();
+
+    // Read {ephemeris, almanac, iono, utc} assistance from the binary store written by the PVT block
+    bool read_assistance_from_store(const std::string &filename);
+
     /*
      * Blocking function that reads the GPS assistance queue
      */
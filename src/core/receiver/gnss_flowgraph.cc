@@ -705,7 +705,7 @@ void GNSSFlowgraph::connect()
                 {
                     for (unsigned int i = 0; i < channels_count_; i++)
                         {
-                            top_block_->connect(observables_->get_right_block(), i, GnssSynchroMonitor_, i);
+                            top_block_->connect(observables_->get_right_block(), monitor_observables_port_ + i, GnssSynchroMonitor_, i);
                         }
                 }
             catch (const std::exception& e)
@@ -956,7 +956,7 @@ void GNSSFlowgraph::disconnect()
                     top_block_->disconnect(observables_->get_right_block(), i, pvt_->get_left_block(), i);
                     if (enable_monitor_)
                         {
-                            top_block_->disconnect(observables_->get_right_block(), i, GnssSynchroMonitor_, i);
+                            top_block_->disconnect(observables_->get_right_block(), monitor_observables_port_ + i, GnssSynchroMonitor_, i);
                         }
                     top_block_->msg_disconnect(channels_.at(i)->get_right_block(), pmt::mp("telemetry"), pvt_->get_left_block(), pmt::mp("telemetry"));
                 }
@@ -1603,6 +1603,12 @@ void GNSSFlowgraph::init()
     std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
     udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
+    // The monitor gets every observable epoch from the raw output ports of the
+    // Observables block when the epochs sent to PVT are decimated
+    const int observable_interval_ms = configuration_->property("GNSS-SDR.observable_interval_ms", 20);
+    const int pvt_observable_interval_ms = configuration_->property("GNSS-SDR.pvt_observable_interval_ms", observable_interval_ms);
+    monitor_observables_port_ = (pvt_observable_interval_ms > observable_interval_ms) ? channels_count_ : 0;
+
     if (enable_monitor_)
         {
             GnssSynchroMonitor_ = gnss_synchro_make_monitor(channels_count_,
@@ -234,6 +234,7 @@ private:
     unsigned int channels_count_;
     unsigned int acq_channels_count_;
     unsigned int max_acq_channels_;
+    unsigned int monitor_observables_port_;
 
     bool connected_;
     bool running_;
@@ -24,6 +24,7 @@
 
 #include "MATH_CONSTANTS.h"
 #include "gnss_frequencies.h"
+#include "nav_bit_field.h"
 #include <cstdint>
 #include <map>
 #include <utility>  // std::pair
@@ -249,69 +250,69 @@ const std::vector<int32_t> GLONASS_GNAV_CRC_Q_INDEX{9, 10, 11, 12, 13, 14, 15, 1
 
 // FRAME 1-4
 // COMMON FIELDS
-const std::vector<std::pair<int32_t, int32_t>> STRING_ID({{2, 4}});
-const std::vector<std::pair<int32_t, int32_t>> KX({{78, 8}});
+constexpr Nav_Bit_Field STRING_ID{{2, 4}};
+constexpr Nav_Bit_Field KX{{78, 8}};
 // STRING 1
-const std::vector<std::pair<int32_t, int32_t>> P1({{8, 2}});
-const std::vector<std::pair<int32_t, int32_t>> T_K_HR({{10, 5}});
-const std::vector<std::pair<int32_t, int32_t>> T_K_MIN({{15, 6}});
-const std::vector<std::pair<int32_t, int32_t>> T_K_SEC({{21, 1}});
-const std::vector<std::pair<int32_t, int32_t>> X_N_DOT({{22, 24}});
-const std::vector<std::pair<int32_t, int32_t>> X_N_DOT_DOT({{46, 5}});
-const std::vector<std::pair<int32_t, int32_t>> X_N({{51, 27}});
+constexpr Nav_Bit_Field P1{{8, 2}};
+constexpr Nav_Bit_Field T_K_HR{{10, 5}};
+constexpr Nav_Bit_Field T_K_MIN{{15, 6}};
+constexpr Nav_Bit_Field T_K_SEC{{21, 1}};
+constexpr Nav_Bit_Field X_N_DOT{{22, 24}};
+constexpr Nav_Bit_Field X_N_DOT_DOT{{46, 5}};
+constexpr Nav_Bit_Field X_N{{51, 27}};
 
 // STRING 2
-const std::vector<std::pair<int32_t, int32_t>> B_N({{6, 3}});
-const std::vector<std::pair<int32_t, int32_t>> P2({{9, 1}});
-const std::vector<std::pair<int32_t, int32_t>> T_B({{10, 7}});
-const std::vector<std::pair<int32_t, int32_t>> Y_N_DOT({{22, 24}});
-const std::vector<std::pair<int32_t, int32_t>> Y_N_DOT_DOT({{46, 5}});
-const std::vector<std::pair<int32_t, int32_t>> Y_N({{51, 27}});
+constexpr Nav_Bit_Field B_N{{6, 3}};
+constexpr Nav_Bit_Field P2{{9, 1}};
+constexpr Nav_Bit_Field T_B{{10, 7}};
+constexpr Nav_Bit_Field Y_N_DOT{{22, 24}};
+constexpr Nav_Bit_Field Y_N_DOT_DOT{{46, 5}};
+constexpr Nav_Bit_Field Y_N{{51, 27}};
 
 // STRING 3
-const std::vector<std::pair<int32_t, int32_t>> P3({{6, 1}});
-const std::vector<std::pair<int32_t, int32_t>> GAMMA_N({{7, 11}});
-const std::vector<std::pair<int32_t, int32_t>> P({{19, 2}});
-const std::vector<std::pair<int32_t, int32_t>> EPH_L_N({{21, 1}});
-const std::vector<std::pair<int32_t, int32_t>> Z_N_DOT({{22, 24}});
-const std::vector<std::pair<int32_t, int32_t>> Z_N_DOT_DOT({{46, 5}});
-const std::vector<std::pair<int32_t, int32_t>> Z_N({{51, 27}});
+constexpr Nav_Bit_Field P3{{6, 1}};
+constexpr Nav_Bit_Field GAMMA_N{{7, 11}};
+constexpr Nav_Bit_Field P{{19, 2}};
+constexpr Nav_Bit_Field EPH_L_N{{21, 1}};
+constexpr Nav_Bit_Field Z_N_DOT{{22, 24}};
+constexpr Nav_Bit_Field Z_N_DOT_DOT{{46, 5}};
+constexpr Nav_Bit_Field Z_N{{51, 27}};
 
 // STRING 4
-const std::vector<std::pair<int32_t, int32_t>> TAU_N({{6, 22}});
-const std::vector<std::pair<int32_t, int32_t>> DELTA_TAU_N({{28, 5}});
-const std::vector<std::pair<int32_t, int32_t>> E_N({{33, 5}});
-const std::vector<std::pair<int32_t, int32_t>> P4({{52, 1}});
-const std::vector<std::pair<int32_t, int32_t>> F_T({{53, 4}});
-const std::vector<std::pair<int32_t, int32_t>> N_T({{60, 11}});
-const std::vector<std::pair<int32_t, int32_t>> N({{71, 5}});
-const std::vector<std::pair<int32_t, int32_t>> M({{76, 2}});
+constexpr Nav_Bit_Field TAU_N{{6, 22}};
+constexpr Nav_Bit_Field DELTA_TAU_N{{28, 5}};
+constexpr Nav_Bit_Field E_N{{33, 5}};
+constexpr Nav_Bit_Field P4{{52, 1}};
+constexpr Nav_Bit_Field F_T{{53, 4}};
+constexpr Nav_Bit_Field N_T{{60, 11}};
+constexpr Nav_Bit_Field N{{71, 5}};
+constexpr Nav_Bit_Field M{{76, 2}};
 
 // STRING 5
-const std::vector<std::pair<int32_t, int32_t>> DAY_NUMBER_A({{6, 11}});
-const std::vector<std::pair<int32_t, int32_t>> TAU_C({{17, 32}});
-const std::vector<std::pair<int32_t, int32_t>> N_4({{50, 5}});
-const std::vector<std::pair<int32_t, int32_t>> TAU_GPS({{55, 22}});
-const std::vector<std::pair<int32_t, int32_t>> ALM_L_N({{77, 1}});
+constexpr Nav_Bit_Field DAY_NUMBER_A{{6, 11}};
+constexpr Nav_Bit_Field TAU_C{{17, 32}};
+constexpr Nav_Bit_Field N_4{{50, 5}};
+constexpr Nav_Bit_Field TAU_GPS{{55, 22}};
+constexpr Nav_Bit_Field ALM_L_N{{77, 1}};
 
 // STRING 6, 8, 10, 12, 14
-const std::vector<std::pair<int32_t, int32_t>> C_N({{6, 1}});
-const std::vector<std::pair<int32_t, int32_t>> M_N_A({{7, 2}});
-const std::vector<std::pair<int32_t, int32_t>> N_A({{9, 5}});
-const std::vector<std::pair<int32_t, int32_t>> TAU_N_A({{14, 10}});
-const std::vector<std::pair<int32_t, int32_t>> LAMBDA_N_A({{24, 21}});
-const std::vector<std::pair<int32_t, int32_t>> DELTA_I_N_A({{45, 18}});
-const std::vector<std::pair<int32_t, int32_t>> EPSILON_N_A({{63, 15}});
+constexpr Nav_Bit_Field C_N{{6, 1}};
+constexpr Nav_Bit_Field M_N_A{{7, 2}};
+constexpr Nav_Bit_Field N_A{{9, 5}};
+constexpr Nav_Bit_Field TAU_N_A{{14, 10}};
+constexpr Nav_Bit_Field LAMBDA_N_A{{24, 21}};
+constexpr Nav_Bit_Field DELTA_I_N_A{{45, 18}};
+constexpr Nav_Bit_Field EPSILON_N_A{{63, 15}};
 
 // STRING 7, 9, 11, 13, 15
-const std::vector<std::pair<int32_t, int32_t>> OMEGA_N_A({{6, 16}});
-const std::vector<std::pair<int32_t, int32_t>> T_LAMBDA_N_A({{22, 21}});
-const std::vector<std::pair<int32_t, int32_t>> DELTA_T_N_A({{43, 22}});
-const std::vector<std::pair<int32_t, int32_t>> DELTA_T_DOT_N_A({{65, 7}});
-const std::vector<std::pair<int32_t, int32_t>> H_N_A({{72, 5}});
+constexpr Nav_Bit_Field OMEGA_N_A{{6, 16}};
+constexpr Nav_Bit_Field T_LAMBDA_N_A{{22, 21}};
+constexpr Nav_Bit_Field DELTA_T_N_A{{43, 22}};
+constexpr Nav_Bit_Field DELTA_T_DOT_N_A{{65, 7}};
+constexpr Nav_Bit_Field H_N_A{{72, 5}};
 
 // STRING 14 FRAME 5
-const std::vector<std::pair<int32_t, int32_t>> B1({{6, 11}});
-const std::vector<std::pair<int32_t, int32_t>> B2({{17, 10}});
+constexpr Nav_Bit_Field B1{{6, 11}};
+constexpr Nav_Bit_Field B2{{17, 10}};
 
 #endif  // GNSS_SDR_GLONASS_L1_L2_CA_H
@@ -67,12 +67,12 @@ public:
     /*!
      * \brief Decodes the BDS D1 NAV message
      */
-    int32_t d1_subframe_decoder(std::string const& subframe);
+    int32_t d1_subframe_decoder(const Nav_Message_Bits<BEIDOU_DNAV_SUBFRAME_DATA_BITS>& subframe_bits);
 
     /*!
      * \brief Decodes the BDS D2 NAV message
      */
-    int32_t d2_subframe_decoder(std::string const& subframe);
+    int32_t d2_subframe_decoder(const Nav_Message_Bits<BEIDOU_DNAV_SUBFRAME_DATA_BITS>& subframe_bits);
 
     /*!
      * \brief Computes the position of the satellite
@@ -147,9 +147,6 @@ public:
     }
 
 private:
-    uint64_t read_navigation_unsigned(std::bitset<BEIDOU_DNAV_SUBFRAME_DATA_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    int64_t read_navigation_signed(std::bitset<BEIDOU_DNAV_SUBFRAME_DATA_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    bool read_navigation_bool(std::bitset<BEIDOU_DNAV_SUBFRAME_DATA_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
     void print_beidou_word_bytes(uint32_t BEIDOU_word) const;
 
     /*
@@ -24,27 +24,21 @@
  */
 
 #include "galileo_fnav_message.h"
-#include <boost/crc.hpp>  // for boost::crc_basic, boost::crc_optimal
-#include <boost/dynamic_bitset.hpp>
+#include "gnss_crc.h"
 #include <glog/logging.h>
-#include <algorithm>  // for reverse
-#include <iostream>   // for string, operator<<
-#include <iterator>   // for back_insert_iterator
+#include <iostream>  // for string, operator<<
 
-using CRC_Galileo_FNAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
 
-
-void Galileo_Fnav_Message::split_page(const std::string& page_string)
+void Galileo_Fnav_Message::split_page(const Nav_Message_Bits<GALILEO_FNAV_PAGE_BITS>& page)
 {
-    std::string message_word = page_string.substr(0, 214);
-    std::string CRC_data = page_string.substr(214, 24);
-    std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> Word_for_CRC_bits(message_word);
-    std::bitset<24> checksum(CRC_data);
-    if (_CRC_test(Word_for_CRC_bits, checksum.to_ulong()) == true)
+    const auto checksum = static_cast<uint32_t>(page.extract(GALILEO_FNAV_DATA_FRAME_BITS + 1, 24));
+    if (_CRC_test(page, checksum) == true)
         {
             flag_CRC_test = true;
             // CRC correct: Decode word
-            decode_page(message_word);
+            Nav_Message_Bits<GALILEO_FNAV_DATA_FRAME_BITS> data_bits;
+            data_bits.insert(1, page, 1, GALILEO_FNAV_DATA_FRAME_BITS);
+            decode_page(data_bits);
         }
     else
         {
@@ -53,229 +47,213 @@ void Galileo_Fnav_Message::split_page(const std::string& page_string)
 }
 
 
-bool Galileo_Fnav_Message::_CRC_test(std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> bits, uint32_t checksum) const
+void Galileo_Fnav_Message::split_page(const std::string& page_string)
 {
-    CRC_Galileo_FNAV_type CRC_Galileo;
-
-    uint32_t crc_computed;
-    // Galileo FNAV frame for CRC is not an integer multiple of bytes
-    // it needs to be filled with zeroes at the start of the frame.
-    // This operation is done in the transformation from bits to bytes
-    // using boost::dynamic_bitset.
-    // ToDo: Use boost::dynamic_bitset for all the bitset operations in this class
-
-    boost::dynamic_bitset<uint8_t> frame_bits(std::string(bits.to_string()));
-
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    CRC_Galileo.process_bytes(bytes.data(), GALILEO_FNAV_DATA_FRAME_BYTES);
+    split_page(Nav_Message_Bits<GALILEO_FNAV_PAGE_BITS>(page_string.substr(0, GALILEO_FNAV_PAGE_BITS)));
+}
 
-    crc_computed = CRC_Galileo.checksum();
-    if (checksum == crc_computed)
-        {
-            return true;
-        }
 
-    return false;
+bool Galileo_Fnav_Message::_CRC_test(const Nav_Message_Bits<GALILEO_FNAV_PAGE_BITS>& page, uint32_t checksum) const
+{
+    // Galileo FNAV frame for CRC is not an integer multiple of bytes: the
+    // CRC is computed as if it was padded with zeros at the start
+    return compute_crc24q_bits(page.data(), GALILEO_FNAV_DATA_FRAME_BITS) == checksum;
 }
 
 
-void Galileo_Fnav_Message::decode_page(const std::string& data)
+void Galileo_Fnav_Message::decode_page(const Nav_Message_Bits<GALILEO_FNAV_DATA_FRAME_BITS>& data_bits)
 {
-    std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> data_bits(data);
-    page_type = read_navigation_unsigned(data_bits, FNAV_PAGE_TYPE_BIT);
+    page_type = data_bits.read_unsigned(FNAV_PAGE_TYPE_BIT);
     switch (page_type)
         {
         case 1:  // SVID, Clock correction, SISA, Ionospheric correction, BGD, GST, Signal health and Data validity status
-            FNAV_SV_ID_PRN_1 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_SV_ID_PRN_1_BIT));
-            FNAV_IODnav_1 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_IO_DNAV_1_BIT));
-            FNAV_t0c_1 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_T0C_1_BIT));
+            FNAV_SV_ID_PRN_1 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_SV_ID_PRN_1_BIT));
+            FNAV_IODnav_1 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_IO_DNAV_1_BIT));
+            FNAV_t0c_1 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_T0C_1_BIT));
             FNAV_t0c_1 *= FNAV_T0C_1_LSB;
-            FNAV_af0_1 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AF0_1_BIT));
+            FNAV_af0_1 = static_cast<double>(data_bits.read_signed(FNAV_AF0_1_BIT));
             FNAV_af0_1 *= FNAV_AF0_1_LSB;
-            FNAV_af1_1 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AF1_1_BIT));
+            FNAV_af1_1 = static_cast<double>(data_bits.read_signed(FNAV_AF1_1_BIT));
             FNAV_af1_1 *= FNAV_AF1_1_LSB;
-            FNAV_af2_1 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AF2_1_BIT));
+            FNAV_af2_1 = static_cast<double>(data_bits.read_signed(FNAV_AF2_1_BIT));
             FNAV_af2_1 *= FNAV_AF2_1_LSB;
-            FNAV_SISA_1 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_SISA_1_BIT));
-            FNAV_ai0_1 = static_cast<double>(read_navigation_unsigned(data_bits, FNAV_AI0_1_BIT));
+            FNAV_SISA_1 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_SISA_1_BIT));
+            FNAV_ai0_1 = static_cast<double>(data_bits.read_unsigned(FNAV_AI0_1_BIT));
             FNAV_ai0_1 *= FNAV_AI0_1_LSB;
-            FNAV_ai1_1 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AI1_1_BIT));
+            FNAV_ai1_1 = static_cast<double>(data_bits.read_signed(FNAV_AI1_1_BIT));
             FNAV_ai1_1 *= FNAV_AI1_1_LSB;
-            FNAV_ai2_1 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AI2_1_BIT));
+            FNAV_ai2_1 = static_cast<double>(data_bits.read_signed(FNAV_AI2_1_BIT));
             FNAV_ai2_1 *= FNAV_AI2_1_LSB;
-            FNAV_region1_1 = static_cast<bool>(read_navigation_unsigned(data_bits, FNAV_REGION1_1_BIT));
-            FNAV_region2_1 = static_cast<bool>(read_navigation_unsigned(data_bits, FNAV_REGION2_1_BIT));
-            FNAV_region3_1 = static_cast<bool>(read_navigation_unsigned(data_bits, FNAV_REGION3_1_BIT));
-            FNAV_region4_1 = static_cast<bool>(read_navigation_unsigned(data_bits, FNAV_REGION4_1_BIT));
-            FNAV_region5_1 = static_cast<bool>(read_navigation_unsigned(data_bits, FNAV_REGION5_1_BIT));
-            FNAV_BGD_1 = static_cast<double>(read_navigation_signed(data_bits, FNAV_BGD_1_BIT));
+            FNAV_region1_1 = static_cast<bool>(data_bits.read_unsigned(FNAV_REGION1_1_BIT));
+            FNAV_region2_1 = static_cast<bool>(data_bits.read_unsigned(FNAV_REGION2_1_BIT));
+            FNAV_region3_1 = static_cast<bool>(data_bits.read_unsigned(FNAV_REGION3_1_BIT));
+            FNAV_region4_1 = static_cast<bool>(data_bits.read_unsigned(FNAV_REGION4_1_BIT));
+            FNAV_region5_1 = static_cast<bool>(data_bits.read_unsigned(FNAV_REGION5_1_BIT));
+            FNAV_BGD_1 = static_cast<double>(data_bits.read_signed(FNAV_BGD_1_BIT));
             FNAV_BGD_1 *= FNAV_BGD_1_LSB;
-            FNAV_E5ahs_1 = static_cast<uint32_t>(read_navigation_unsigned(data_bits, FNAV_E5AHS_1_BIT));
-            FNAV_WN_1 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_WN_1_BIT));
-            FNAV_TOW_1 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_TOW_1_BIT));
-            FNAV_E5advs_1 = static_cast<bool>(read_navigation_unsigned(data_bits, FNAV_E5ADVS_1_BIT));
+            FNAV_E5ahs_1 = static_cast<uint32_t>(data_bits.read_unsigned(FNAV_E5AHS_1_BIT));
+            FNAV_WN_1 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_WN_1_BIT));
+            FNAV_TOW_1 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_TOW_1_BIT));
+            FNAV_E5advs_1 = static_cast<bool>(data_bits.read_unsigned(FNAV_E5ADVS_1_BIT));
             flag_TOW_1 = true;
             flag_TOW_set = true;
             flag_iono_and_GST = true;  // set to false externally
             break;
         case 2:  // Ephemeris (1/3) and GST
-            FNAV_IODnav_2 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_IO_DNAV_2_BIT));
-            FNAV_M0_2 = static_cast<double>(read_navigation_signed(data_bits, FNAV_M0_2_BIT));
+            FNAV_IODnav_2 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_IO_DNAV_2_BIT));
+            FNAV_M0_2 = static_cast<double>(data_bits.read_signed(FNAV_M0_2_BIT));
             FNAV_M0_2 *= FNAV_M0_2_LSB;
-            FNAV_omegadot_2 = static_cast<double>(read_navigation_signed(data_bits, FNAV_OMEGADOT_2_BIT));
+            FNAV_omegadot_2 = static_cast<double>(data_bits.read_signed(FNAV_OMEGADOT_2_BIT));
             FNAV_omegadot_2 *= FNAV_OMEGADOT_2_LSB;
-            FNAV_e_2 = static_cast<double>(read_navigation_unsigned(data_bits, FNAV_E_2_BIT));
+            FNAV_e_2 = static_cast<double>(data_bits.read_unsigned(FNAV_E_2_BIT));
             FNAV_e_2 *= FNAV_E_2_LSB;
-            FNAV_a12_2 = static_cast<double>(read_navigation_unsigned(data_bits, FNAV_A12_2_BIT));
+            FNAV_a12_2 = static_cast<double>(data_bits.read_unsigned(FNAV_A12_2_BIT));
             FNAV_a12_2 *= FNAV_A12_2_LSB;
-            FNAV_omega0_2 = static_cast<double>(read_navigation_signed(data_bits, FNAV_OMEGA0_2_BIT));
+            FNAV_omega0_2 = static_cast<double>(data_bits.read_signed(FNAV_OMEGA0_2_BIT));
             FNAV_omega0_2 *= FNAV_OMEGA0_2_LSB;
-            FNAV_idot_2 = static_cast<double>(read_navigation_signed(data_bits, FNAV_IDOT_2_BIT));
+            FNAV_idot_2 = static_cast<double>(data_bits.read_signed(FNAV_IDOT_2_BIT));
             FNAV_idot_2 *= FNAV_IDOT_2_LSB;
-            FNAV_WN_2 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_WN_2_BIT));
-            FNAV_TOW_2 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_TOW_2_BIT));
+            FNAV_WN_2 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_WN_2_BIT));
+            FNAV_TOW_2 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_TOW_2_BIT));
             flag_TOW_2 = true;
             flag_TOW_set = true;
             flag_ephemeris_1 = true;
             break;
         case 3:  // Ephemeris (2/3) and GST
-            FNAV_IODnav_3 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_IO_DNAV_3_BIT));
-            FNAV_i0_3 = static_cast<double>(read_navigation_signed(data_bits, FNAV_I0_3_BIT));
+            FNAV_IODnav_3 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_IO_DNAV_3_BIT));
+            FNAV_i0_3 = static_cast<double>(data_bits.read_signed(FNAV_I0_3_BIT));
             FNAV_i0_3 *= FNAV_I0_3_LSB;
-            FNAV_w_3 = static_cast<double>(read_navigation_signed(data_bits, FNAV_W_3_BIT));
+            FNAV_w_3 = static_cast<double>(data_bits.read_signed(FNAV_W_3_BIT));
             FNAV_w_3 *= FNAV_W_3_LSB;
-            FNAV_deltan_3 = static_cast<double>(read_navigation_signed(data_bits, FNAV_DELTAN_3_BIT));
+            FNAV_deltan_3 = static_cast<double>(data_bits.read_signed(FNAV_DELTAN_3_BIT));
             FNAV_deltan_3 *= FNAV_DELTAN_3_LSB;
-            FNAV_Cuc_3 = static_cast<double>(read_navigation_signed(data_bits, FNAV_CUC_3_BIT));
+            FNAV_Cuc_3 = static_cast<double>(data_bits.read_signed(FNAV_CUC_3_BIT));
             FNAV_Cuc_3 *= FNAV_CUC_3_LSB;
-            FNAV_Cus_3 = static_cast<double>(read_navigation_signed(data_bits, FNAV_CUS_3_BIT));
+            FNAV_Cus_3 = static_cast<double>(data_bits.read_signed(FNAV_CUS_3_BIT));
             FNAV_Cus_3 *= FNAV_CUS_3_LSB;
-            FNAV_Crc_3 = static_cast<double>(read_navigation_signed(data_bits, FNAV_CRC_3_BIT));
+            FNAV_Crc_3 = static_cast<double>(data_bits.read_signed(FNAV_CRC_3_BIT));
             FNAV_Crc_3 *= FNAV_CRC_3_LSB;
-            FNAV_Crs_3 = static_cast<double>(read_navigation_signed(data_bits, FNAV_CRS_3_BIT));
+            FNAV_Crs_3 = static_cast<double>(data_bits.read_signed(FNAV_CRS_3_BIT));
             FNAV_Crs_3 *= FNAV_CRS_3_LSB;
-            FNAV_t0e_3 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_T0E_3_BIT));
+            FNAV_t0e_3 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_T0E_3_BIT));
             FNAV_t0e_3 *= FNAV_T0E_3_LSB;
-            FNAV_WN_3 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_WN_3_BIT));
-            FNAV_TOW_3 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_TOW_3_BIT));
+            FNAV_WN_3 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_WN_3_BIT));
+            FNAV_TOW_3 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_TOW_3_BIT));
             flag_TOW_3 = true;
             flag_TOW_set = true;
             flag_ephemeris_2 = true;
             break;
         case 4:  // Ephemeris (3/3),  GST-UTC conversion,  GST-GPS conversion and TOW
-            FNAV_IODnav_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_IO_DNAV_4_BIT));
-            FNAV_Cic_4 = static_cast<double>(read_navigation_signed(data_bits, FNAV_CIC_4_BIT));
+            FNAV_IODnav_4 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_IO_DNAV_4_BIT));
+            FNAV_Cic_4 = static_cast<double>(data_bits.read_signed(FNAV_CIC_4_BIT));
             FNAV_Cic_4 *= FNAV_CIC_4_LSB;
-            FNAV_Cis_4 = static_cast<double>(read_navigation_signed(data_bits, FNAV_CIS_4_BIT));
+            FNAV_Cis_4 = static_cast<double>(data_bits.read_signed(FNAV_CIS_4_BIT));
             FNAV_Cis_4 *= FNAV_CIS_4_LSB;
-            FNAV_A0_4 = static_cast<double>(read_navigation_signed(data_bits, FNAV_A0_4_BIT));
+            FNAV_A0_4 = static_cast<double>(data_bits.read_signed(FNAV_A0_4_BIT));
             FNAV_A0_4 *= FNAV_A0_4_LSB;
-            FNAV_A1_4 = static_cast<double>(read_navigation_signed(data_bits, FNAV_A1_4_BIT));
+            FNAV_A1_4 = static_cast<double>(data_bits.read_signed(FNAV_A1_4_BIT));
             FNAV_A1_4 *= FNAV_A1_4_LSB;
-            FNAV_deltatls_4 = static_cast<int32_t>(read_navigation_signed(data_bits, FNAV_DELTATLS_4_BIT));
-            FNAV_t0t_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_T0T_4_BIT));
+            FNAV_deltatls_4 = static_cast<int32_t>(data_bits.read_signed(FNAV_DELTATLS_4_BIT));
+            FNAV_t0t_4 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_T0T_4_BIT));
             FNAV_t0t_4 *= FNAV_T0T_4_LSB;
-            FNAV_WNot_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_W_NOT_4_BIT));
-            FNAV_WNlsf_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_W_NLSF_4_BIT));
-            FNAV_DN_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_DN_4_BIT));
-            FNAV_deltatlsf_4 = static_cast<int32_t>(read_navigation_signed(data_bits, FNAV_DELTATLSF_4_BIT));
-            FNAV_t0g_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_T0G_4_BIT));
+            FNAV_WNot_4 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_W_NOT_4_BIT));
+            FNAV_WNlsf_4 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_W_NLSF_4_BIT));
+            FNAV_DN_4 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_DN_4_BIT));
+            FNAV_deltatlsf_4 = static_cast<int32_t>(data_bits.read_signed(FNAV_DELTATLSF_4_BIT));
+            FNAV_t0g_4 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_T0G_4_BIT));
             FNAV_t0g_4 *= FNAV_T0G_4_LSB;
-            FNAV_A0g_4 = static_cast<double>(read_navigation_signed(data_bits, FNAV_A0G_4_BIT));
+            FNAV_A0g_4 = static_cast<double>(data_bits.read_signed(FNAV_A0G_4_BIT));
             FNAV_A0g_4 *= FNAV_A0G_4_LSB;
-            FNAV_A1g_4 = static_cast<double>(read_navigation_signed(data_bits, FNAV_A1G_4_BIT));
+            FNAV_A1g_4 = static_cast<double>(data_bits.read_signed(FNAV_A1G_4_BIT));
             FNAV_A1g_4 *= FNAV_A1G_4_LSB;
-            FNAV_WN0g_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_W_N0G_4_BIT));
-            FNAV_TOW_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_TOW_4_BIT));
+            FNAV_WN0g_4 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_W_N0G_4_BIT));
+            FNAV_TOW_4 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_TOW_4_BIT));
             flag_TOW_4 = true;
             flag_TOW_set = true;
             flag_ephemeris_3 = true;
             flag_utc_model = true;  // set to false externally
             break;
         case 5:  // Almanac (SVID1 and SVID2(1/2)), Week Number and almanac reference time
-            FNAV_IODa_5 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_IO_DA_5_BIT));
-            FNAV_WNa_5 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_W_NA_5_BIT));
-            FNAV_t0a_5 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_T0A_5_BIT));
+            FNAV_IODa_5 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_IO_DA_5_BIT));
+            FNAV_WNa_5 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_W_NA_5_BIT));
+            FNAV_t0a_5 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_T0A_5_BIT));
             FNAV_t0a_5 *= FNAV_T0A_5_LSB;
-            FNAV_SVID1_5 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_SVI_D1_5_BIT));
-            FNAV_Deltaa12_1_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_DELTAA12_1_5_BIT));
+            FNAV_SVID1_5 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_SVI_D1_5_BIT));
+            FNAV_Deltaa12_1_5 = static_cast<double>(data_bits.read_signed(FNAV_DELTAA12_1_5_BIT));
             FNAV_Deltaa12_1_5 *= FNAV_DELTAA12_5_LSB;
-            FNAV_e_1_5 = static_cast<double>(read_navigation_unsigned(data_bits, FNAV_E_1_5_BIT));
+            FNAV_e_1_5 = static_cast<double>(data_bits.read_unsigned(FNAV_E_1_5_BIT));
             FNAV_e_1_5 *= FNAV_E_5_LSB;
-            FNAV_w_1_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_W_1_5_BIT));
+            FNAV_w_1_5 = static_cast<double>(data_bits.read_signed(FNAV_W_1_5_BIT));
             FNAV_w_1_5 *= FNAV_W_5_LSB;
-            FNAV_deltai_1_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_DELTAI_1_5_BIT));
+            FNAV_deltai_1_5 = static_cast<double>(data_bits.read_signed(FNAV_DELTAI_1_5_BIT));
             FNAV_deltai_1_5 *= FNAV_DELTAI_5_LSB;
-            FNAV_Omega0_1_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_OMEGA0_1_5_BIT));
+            FNAV_Omega0_1_5 = static_cast<double>(data_bits.read_signed(FNAV_OMEGA0_1_5_BIT));
             FNAV_Omega0_1_5 *= FNAV_OMEGA0_5_LSB;
-            FNAV_Omegadot_1_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_OMEGADOT_1_5_BIT));
+            FNAV_Omegadot_1_5 = static_cast<double>(data_bits.read_signed(FNAV_OMEGADOT_1_5_BIT));
             FNAV_Omegadot_1_5 *= FNAV_OMEGADOT_5_LSB;
-            FNAV_M0_1_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_M0_1_5_BIT));
+            FNAV_M0_1_5 = static_cast<double>(data_bits.read_signed(FNAV_M0_1_5_BIT));
             FNAV_M0_1_5 *= FNAV_M0_5_LSB;
-            FNAV_af0_1_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AF0_1_5_BIT));
+            FNAV_af0_1_5 = static_cast<double>(data_bits.read_signed(FNAV_AF0_1_5_BIT));
             FNAV_af0_1_5 *= FNAV_AF0_5_LSB;
-            FNAV_af1_1_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AF1_1_5_BIT));
+            FNAV_af1_1_5 = static_cast<double>(data_bits.read_signed(FNAV_AF1_1_5_BIT));
             FNAV_af1_1_5 *= FNAV_AF1_5_LSB;
-            FNAV_E5ahs_1_5 = static_cast<uint32_t>(read_navigation_unsigned(data_bits, FNAV_E5AHS_1_5_BIT));
-            FNAV_SVID2_5 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_SVI_D2_5_BIT));
-            FNAV_Deltaa12_2_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_DELTAA12_2_5_BIT));
+            FNAV_E5ahs_1_5 = static_cast<uint32_t>(data_bits.read_unsigned(FNAV_E5AHS_1_5_BIT));
+            FNAV_SVID2_5 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_SVI_D2_5_BIT));
+            FNAV_Deltaa12_2_5 = static_cast<double>(data_bits.read_signed(FNAV_DELTAA12_2_5_BIT));
             FNAV_Deltaa12_2_5 *= FNAV_DELTAA12_5_LSB;
-            FNAV_e_2_5 = static_cast<double>(read_navigation_unsigned(data_bits, FNAV_E_2_5_BIT));
+            FNAV_e_2_5 = static_cast<double>(data_bits.read_unsigned(FNAV_E_2_5_BIT));
             FNAV_e_2_5 *= FNAV_E_5_LSB;
-            FNAV_w_2_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_W_2_5_BIT));
+            FNAV_w_2_5 = static_cast<double>(data_bits.read_signed(FNAV_W_2_5_BIT));
             FNAV_w_2_5 *= FNAV_W_5_LSB;
-            FNAV_deltai_2_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_DELTAI_2_5_BIT));
+            FNAV_deltai_2_5 = static_cast<double>(data_bits.read_signed(FNAV_DELTAI_2_5_BIT));
             FNAV_deltai_2_5 *= FNAV_DELTAI_5_LSB;
             // TODO check this
             // Omega0_2 must be decoded when the two pieces are joined
-            omega0_1 = data.substr(210, 4);
+            omega0_1 = data_bits.extract(211, 4);
             // omega_flag=true;
             //
-            // FNAV_Omega012_2_5=static_cast<double>(read_navigation_signed(data_bits, FNAV_Omega012_2_5_bit);
+            // FNAV_Omega012_2_5=static_cast<double>(data_bits.read_signed(FNAV_Omega012_2_5_bit);
             flag_almanac_1 = true;
             break;
         case 6:  // Almanac (SVID2(2/2) and SVID3)
-            FNAV_IODa_6 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_IO_DA_6_BIT));
+            FNAV_IODa_6 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_IO_DA_6_BIT));
             // Don't worry about omega pieces. If page 5 has not been received, all_ephemeris
             // flag will be set to false and the data won't be recorded.*/
-            std::string omega0_2 = data.substr(10, 12);
-            std::string Omega0 = omega0_1 + omega0_2;
-            std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> omega_bits(Omega0);
-            const std::vector<std::pair<int32_t, int32_t>> om_bit({{0, 12}});
-            FNAV_Omega0_2_6 = static_cast<double>(read_navigation_signed(omega_bits, om_bit));
+            Nav_Message_Bits<16> omega_bits;
+            omega_bits.insert(1, 4, omega0_1);
+            omega_bits.insert(5, data_bits, 11, 12);  // omega0_2
+            constexpr Nav_Bit_Field om_bit{{1, 16}};
+            FNAV_Omega0_2_6 = static_cast<double>(omega_bits.read_signed(om_bit));
             FNAV_Omega0_2_6 *= FNAV_OMEGA0_5_LSB;
-            FNAV_Omegadot_2_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_OMEGADOT_2_6_BIT));
+            FNAV_Omegadot_2_6 = static_cast<double>(data_bits.read_signed(FNAV_OMEGADOT_2_6_BIT));
             FNAV_Omegadot_2_6 *= FNAV_OMEGADOT_5_LSB;
-            FNAV_M0_2_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_M0_2_6_BIT));
+            FNAV_M0_2_6 = static_cast<double>(data_bits.read_signed(FNAV_M0_2_6_BIT));
             FNAV_M0_2_6 *= FNAV_M0_5_LSB;
-            FNAV_af0_2_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AF0_2_6_BIT));
+            FNAV_af0_2_6 = static_cast<double>(data_bits.read_signed(FNAV_AF0_2_6_BIT));
             FNAV_af0_2_6 *= FNAV_AF0_5_LSB;
-            FNAV_af1_2_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AF1_2_6_BIT));
+            FNAV_af1_2_6 = static_cast<double>(data_bits.read_signed(FNAV_AF1_2_6_BIT));
             FNAV_af1_2_6 *= FNAV_AF1_5_LSB;
-            FNAV_E5ahs_2_6 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_E5AHS_2_6_BIT));
-            FNAV_SVID3_6 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_SVI_D3_6_BIT));
-            FNAV_Deltaa12_3_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_DELTAA12_3_6_BIT));
+            FNAV_E5ahs_2_6 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_E5AHS_2_6_BIT));
+            FNAV_SVID3_6 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_SVI_D3_6_BIT));
+            FNAV_Deltaa12_3_6 = static_cast<double>(data_bits.read_signed(FNAV_DELTAA12_3_6_BIT));
             FNAV_Deltaa12_3_6 *= FNAV_DELTAA12_5_LSB;
-            FNAV_e_3_6 = static_cast<double>(read_navigation_unsigned(data_bits, FNAV_E_3_6_BIT));
+            FNAV_e_3_6 = static_cast<double>(data_bits.read_unsigned(FNAV_E_3_6_BIT));
             FNAV_e_3_6 *= FNAV_E_5_LSB;
-            FNAV_w_3_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_W_3_6_BIT));
+            FNAV_w_3_6 = static_cast<double>(data_bits.read_signed(FNAV_W_3_6_BIT));
             FNAV_w_3_6 *= FNAV_W_5_LSB;
-            FNAV_deltai_3_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_DELTAI_3_6_BIT));
+            FNAV_deltai_3_6 = static_cast<double>(data_bits.read_signed(FNAV_DELTAI_3_6_BIT));
             FNAV_deltai_3_6 *= FNAV_DELTAI_5_LSB;
-            FNAV_Omega0_3_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_OMEGA0_3_6_BIT));
+            FNAV_Omega0_3_6 = static_cast<double>(data_bits.read_signed(FNAV_OMEGA0_3_6_BIT));
             FNAV_Omega0_3_6 *= FNAV_OMEGA0_5_LSB;
-            FNAV_Omegadot_3_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_OMEGADOT_3_6_BIT));
+            FNAV_Omegadot_3_6 = static_cast<double>(data_bits.read_signed(FNAV_OMEGADOT_3_6_BIT));
             FNAV_Omegadot_3_6 *= FNAV_OMEGADOT_5_LSB;
-            FNAV_M0_3_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_M0_3_6_BIT));
+            FNAV_M0_3_6 = static_cast<double>(data_bits.read_signed(FNAV_M0_3_6_BIT));
             FNAV_M0_3_6 *= FNAV_M0_5_LSB;
-            FNAV_af0_3_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AF0_3_6_BIT));
+            FNAV_af0_3_6 = static_cast<double>(data_bits.read_signed(FNAV_AF0_3_6_BIT));
             FNAV_af0_3_6 *= FNAV_AF0_5_LSB;
-            FNAV_af1_3_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_AF1_3_6_BIT));
+            FNAV_af1_3_6 = static_cast<double>(data_bits.read_signed(FNAV_AF1_3_6_BIT));
             FNAV_af1_3_6 *= FNAV_AF1_5_LSB;
-            FNAV_E5ahs_3_6 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_E5AHS_3_6_BIT));
+            FNAV_E5ahs_3_6 = static_cast<int32_t>(data_bits.read_unsigned(FNAV_E5AHS_3_6_BIT));
 
             flag_almanac_2 = true;
             break;
@@ -283,56 +261,6 @@ void Galileo_Fnav_Message::decode_page(const std::string& data)
 }
 
 
-uint64_t Galileo_Fnav_Message::read_navigation_unsigned(std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    uint64_t value = 0ULL;
-    int num_of_slices = parameter.size();
-    for (int i = 0; i < num_of_slices; i++)
-        {
-            for (int j = 0; j < parameter[i].second; j++)
-                {
-                    value <<= 1U;  // shift left
-                    if (static_cast<int>(bits[GALILEO_FNAV_DATA_FRAME_BITS - parameter[i].first - j]) == 1)
-                        {
-                            value += 1;  // insert the bit
-                        }
-                }
-        }
-    return value;
-}
-
-
-int64_t Galileo_Fnav_Message::read_navigation_signed(std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    int64_t value = 0LL;
-    int num_of_slices = parameter.size();
-
-    // read the MSB and perform the sign extension
-    if (static_cast<int>(bits[GALILEO_FNAV_DATA_FRAME_BITS - parameter[0].first]) == 1)
-        {
-            value ^= 0x0FFFFFFFFFFFFFFF;  // 64 bits variable
-        }
-    else
-        {
-            value &= 0;
-        }
-
-    for (int i = 0; i < num_of_slices; i++)
-        {
-            for (int j = 0; j < parameter[i].second; j++)
-                {
-                    value <<= 1;                  // shift left
-                    value &= 0xFFFFFFFFFFFFFFFE;  // reset the corresponding bit (for the 64 bits variable)
-                    if (static_cast<int>(bits[GALILEO_FNAV_DATA_FRAME_BITS - parameter[i].first - j]) == 1)
-                        {
-                            value += 1;  // insert the bit
-                        }
-                }
-        }
-    return value;
-}
-
-
 bool Galileo_Fnav_Message::have_new_ephemeris()  // Check if we have a new ephemeris stored in the galileo navigation class
 {
     if ((flag_ephemeris_1 == true) and (flag_ephemeris_2 == true) and (flag_ephemeris_3 == true) and (flag_iono_and_GST == true))
@@ -48,7 +48,17 @@ class Galileo_Fnav_Message
 public:
     Galileo_Fnav_Message() = default;
 
+    /*
+     * \brief Checks the CRC of a decoded page (data, CRC and tail bits) and,
+     * if it is correct, decodes the data according to ICD 4.2.2
+     */
+    void split_page(const Nav_Message_Bits<GALILEO_FNAV_PAGE_BITS>& page);
+
+    /*
+     * \brief Same as above, with the page given as a string of '0' and '1' characters
+     */
     void split_page(const std::string& page_string);
+
     bool have_new_ephemeris();
     bool have_new_iono_and_GST();
     bool have_new_utc_model();
@@ -139,12 +149,10 @@ public:
     }
 
 private:
-    bool _CRC_test(std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> bits, uint32_t checksum) const;
-    void decode_page(const std::string& data);
-    uint64_t read_navigation_unsigned(std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    int64_t read_navigation_signed(std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
+    bool _CRC_test(const Nav_Message_Bits<GALILEO_FNAV_PAGE_BITS>& page, uint32_t checksum) const;
+    void decode_page(const Nav_Message_Bits<GALILEO_FNAV_DATA_FRAME_BITS>& data_bits);
 
-    std::string omega0_1{};
+    uint64_t omega0_1{};
     // std::string omega0_2{};
     // bool omega_flag{};
 
@@ -47,13 +47,23 @@ public:
     /*
      * \brief Takes in input a page (Odd or Even) of 120 bit, split it according ICD 4.3.2.3 and join Data_k with Data_j
      */
-    void split_page(std::string page_string, int32_t flag_even_word);
+    void split_page(const Nav_Message_Bits<GALILEO_INAV_PAGE_PART_BITS>& page_part, int32_t flag_even_word);
+
+    /*
+     * \brief Same as above, with the page given as a string of '0' and '1' characters
+     */
+    void split_page(const std::string& page_string, int32_t flag_even_word);
 
     /*
      * \brief Takes in input Data_jk (128 bit) and split it in ephemeris parameters according ICD 4.3.5
      *
      * Takes in input Data_jk (128 bit) and split it in ephemeris parameters according ICD 4.3.5
      */
+    int32_t page_jk_decoder(const Nav_Message_Bits<GALILEO_DATA_JK_BITS>& data_jk_bits);
+
+    /*
+     * \brief Same as above, with Data_jk given as a string of '0' and '1' characters
+     */
     int32_t page_jk_decoder(const char* data_jk);
 
     /*
@@ -177,13 +187,9 @@ public:
     }
 
 private:
-    bool CRC_test(std::bitset<GALILEO_DATA_FRAME_BITS> bits, uint32_t checksum) const;
-    bool read_navigation_bool(std::bitset<GALILEO_DATA_JK_BITS> bits, const std::vector<std::pair<int32_t, int32_t> >& parameter) const;
-    uint64_t read_navigation_unsigned(std::bitset<GALILEO_DATA_JK_BITS> bits, const std::vector<std::pair<int32_t, int32_t> >& parameter) const;
-    uint64_t read_page_type_unsigned(std::bitset<GALILEO_PAGE_TYPE_BITS> bits, const std::vector<std::pair<int32_t, int32_t> >& parameter) const;
-    int64_t read_navigation_signed(std::bitset<GALILEO_DATA_JK_BITS> bits, const std::vector<std::pair<int32_t, int32_t> >& parameter) const;
+    bool CRC_test(const Nav_Message_Bits<GALILEO_INAV_PAGE_BITS>& page, uint32_t checksum) const;
 
-    std::string page_Even{};
+    Nav_Message_Bits<GALILEO_INAV_PAGE_PART_BITS> page_Even{};
 
     int32_t Page_type_time_stamp{};
     int32_t IOD_ephemeris{};
@@ -21,9 +21,9 @@
 
 #include "glonass_gnav_navigation_message.h"
 #include "MATH_CONSTANTS.h"  // for TWO_N20, TWO_N30, TWO_N14, TWO_N15, TWO_N18
+#include "gnss_crc.h"
 #include "gnss_satellite.h"
 #include <glog/logging.h>
-#include <cstddef>  // for size_t
 #include <map>
 #include <ostream>  // for operator<<
 
@@ -42,171 +42,7 @@ Glonass_Gnav_Navigation_Message::Glonass_Gnav_Navigation_Message()
 
 bool Glonass_Gnav_Navigation_Message::CRC_test(std::bitset<GLONASS_GNAV_STRING_BITS> bits) const
 {
-    uint32_t sum_bits = 0;
-    int32_t sum_hamming = 0;
-    int32_t C1 = 0;
-    int32_t C2 = 0;
-    int32_t C3 = 0;
-    int32_t C4 = 0;
-    int32_t C5 = 0;
-    int32_t C6 = 0;
-    int32_t C7 = 0;
-    int32_t C_Sigma = 0;
-    std::vector<uint32_t> string_bits(GLONASS_GNAV_STRING_BITS);
-
-    // Populate data and hamming code vectors
-    for (size_t i = 0; i < string_bits.size(); i++)
-        {
-            string_bits[i] = static_cast<uint32_t>(bits[i]);
-        }
-
-    // Compute C1 term
-    sum_bits = 0;
-    for (int i : GLONASS_GNAV_CRC_I_INDEX)
-        {
-            sum_bits += string_bits[i - 1];
-        }
-    C1 = string_bits[0] ^ (sum_bits % 2);
-
-    // Compute C2 term
-    sum_bits = 0;
-    for (int j : GLONASS_GNAV_CRC_J_INDEX)
-        {
-            sum_bits += string_bits[j - 1];
-        }
-    C2 = (string_bits[1]) ^ (sum_bits % 2);
-
-    // Compute C3 term
-    sum_bits = 0;
-    for (int k : GLONASS_GNAV_CRC_K_INDEX)
-        {
-            sum_bits += string_bits[k - 1];
-        }
-    C3 = string_bits[2] ^ (sum_bits % 2);
-
-    // Compute C4 term
-    sum_bits = 0;
-    for (int l : GLONASS_GNAV_CRC_L_INDEX)
-        {
-            sum_bits += string_bits[l - 1];
-        }
-    C4 = string_bits[3] ^ (sum_bits % 2);
-
-    // Compute C5 term
-    sum_bits = 0;
-    for (int m : GLONASS_GNAV_CRC_M_INDEX)
-        {
-            sum_bits += string_bits[m - 1];
-        }
-    C5 = string_bits[4] ^ (sum_bits % 2);
-
-    // Compute C6 term
-    sum_bits = 0;
-    for (int n : GLONASS_GNAV_CRC_N_INDEX)
-        {
-            sum_bits += string_bits[n - 1];
-        }
-    C6 = string_bits[5] ^ (sum_bits % 2);
-
-    // Compute C7 term
-    sum_bits = 0;
-    for (int p : GLONASS_GNAV_CRC_P_INDEX)
-        {
-            sum_bits += string_bits[p - 1];
-        }
-    C7 = string_bits[6] ^ (sum_bits % 2);
-
-    // Compute C_Sigma term
-    sum_bits = 0;
-    sum_hamming = 0;
-    for (int q : GLONASS_GNAV_CRC_Q_INDEX)
-        {
-            sum_bits += string_bits[q - 1];
-        }
-    for (int32_t q = 0; q < 8; q++)
-        {
-            sum_hamming += string_bits[q];
-        }
-    C_Sigma = (sum_hamming % 2) ^ (sum_bits % 2);
-
-    // Verification of the data
-    // (a-i) All checksums (C1,...,C7 and C_Sigma) are equal to zero
-    if ((C1 + C2 + C3 + C4 + C5 + C6 + C7 + C_Sigma) == 0)
-        {
-            return true;
-        }
-    // (a-ii) Only one of the checksums (C1,...,C7) is equal to 1 and C_Sigma = 1
-    if (C_Sigma == 1 && C1 + C2 + C3 + C4 + C5 + C6 + C7 == 1)
-        {
-            return true;
-        }
-
-    // All other conditions are assumed errors. TODO: Add correction for case B
-    return false;
-}
-
-
-bool Glonass_Gnav_Navigation_Message::read_navigation_bool(std::bitset<GLONASS_GNAV_STRING_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    bool value;
-
-    if (bits[GLONASS_GNAV_STRING_BITS - parameter[0].first] == 1)
-        {
-            value = true;
-        }
-    else
-        {
-            value = false;
-        }
-    return value;
-}
-
-
-uint64_t Glonass_Gnav_Navigation_Message::read_navigation_unsigned(std::bitset<GLONASS_GNAV_STRING_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    uint64_t value = 0ULL;
-    int32_t num_of_slices = parameter.size();
-    for (int32_t i = 0; i < num_of_slices; i++)
-        {
-            for (int32_t j = 0; j < parameter[i].second; j++)
-                {
-                    value <<= 1ULL;  // shift left
-                    if (bits[GLONASS_GNAV_STRING_BITS - parameter[i].first - j] == 1)
-                        {
-                            value += 1ULL;  // insert the bit
-                        }
-                }
-        }
-    return value;
-}
-
-
-int64_t Glonass_Gnav_Navigation_Message::read_navigation_signed(std::bitset<GLONASS_GNAV_STRING_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    int64_t value = 0LL;
-    int64_t sign = 0LL;
-    int32_t num_of_slices = parameter.size();
-    // read the MSB and perform the sign extension
-    if (bits[GLONASS_GNAV_STRING_BITS - parameter[0].first] == 1)
-        {
-            sign = -1LL;
-        }
-    else
-        {
-            sign = 1LL;
-        }
-    for (int32_t i = 0; i < num_of_slices; i++)
-        {
-            for (int32_t j = 1; j < parameter[i].second; j++)
-                {
-                    value <<= 1;  // shift left
-                    if (bits[GLONASS_GNAV_STRING_BITS - parameter[i].first - j] == 1)
-                        {
-                            value += 1LL;  // insert the bit
-                        }
-                }
-        }
-    return (sign * value);
+    return glonass_gnav_hamming_check(Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>(bits));
 }
 
 
@@ -245,34 +81,37 @@ uint32_t Glonass_Gnav_Navigation_Message::get_frame_number(uint32_t satellite_sl
 
 
 int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame_string)
+{
+    return string_decoder(Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>(frame_string));
+}
+
+
+int32_t Glonass_Gnav_Navigation_Message::string_decoder(const Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>& string_bits)
 {
     int32_t J = 0;
     d_string_ID = 0U;
     d_frame_ID = 0U;
 
-    // Unpack bytes to bits
-    std::bitset<GLONASS_GNAV_STRING_BITS> string_bits(frame_string);
-
     // Perform data verification and exit code if error in bit sequence
-    flag_CRC_test = CRC_test(string_bits);
+    flag_CRC_test = glonass_gnav_hamming_check(string_bits);
     if (flag_CRC_test == false)
         {
             return 0;
         }
 
     // Decode all 15 string messages
-    d_string_ID = static_cast<uint32_t>(read_navigation_unsigned(string_bits, STRING_ID));
+    d_string_ID = static_cast<uint32_t>(string_bits.read_unsigned(STRING_ID));
     switch (d_string_ID)
         {
         case 1:
             // --- It is string 1 -----------------------------------------------
-            gnav_ephemeris.d_P_1 = (static_cast<double>(read_navigation_unsigned(string_bits, P1)) + 1) * 15;
-            gnav_ephemeris.d_t_k = static_cast<double>(read_navigation_unsigned(string_bits, T_K_HR)) * 3600 +
-                                   static_cast<double>(read_navigation_unsigned(string_bits, T_K_MIN)) * 60 +
-                                   static_cast<double>(read_navigation_unsigned(string_bits, T_K_SEC)) * 30;
-            gnav_ephemeris.d_VXn = static_cast<double>(read_navigation_signed(string_bits, X_N_DOT)) * TWO_N20;
-            gnav_ephemeris.d_AXn = static_cast<double>(read_navigation_signed(string_bits, X_N_DOT_DOT)) * TWO_N30;
-            gnav_ephemeris.d_Xn = static_cast<double>(read_navigation_signed(string_bits, X_N)) * TWO_N11;
+            gnav_ephemeris.d_P_1 = (static_cast<double>(string_bits.read_unsigned(P1)) + 1) * 15;
+            gnav_ephemeris.d_t_k = static_cast<double>(string_bits.read_unsigned(T_K_HR)) * 3600 +
+                                   static_cast<double>(string_bits.read_unsigned(T_K_MIN)) * 60 +
+                                   static_cast<double>(string_bits.read_unsigned(T_K_SEC)) * 30;
+            gnav_ephemeris.d_VXn = static_cast<double>(string_bits.read_sign_magnitude(X_N_DOT)) * TWO_N20;
+            gnav_ephemeris.d_AXn = static_cast<double>(string_bits.read_sign_magnitude(X_N_DOT_DOT)) * TWO_N30;
+            gnav_ephemeris.d_Xn = static_cast<double>(string_bits.read_sign_magnitude(X_N)) * TWO_N11;
 
             flag_ephemeris_str_1 = true;
 
@@ -282,14 +121,14 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 2 -----------------------------------------------
             if (flag_ephemeris_str_1 == true)
                 {
-                    gnav_ephemeris.d_B_n = static_cast<double>(read_navigation_unsigned(string_bits, B_N));
-                    gnav_ephemeris.d_P_2 = static_cast<bool>(read_navigation_bool(string_bits, P2));
-                    gnav_ephemeris.d_t_b = static_cast<double>(read_navigation_unsigned(string_bits, T_B)) * 15 * 60;
-                    gnav_ephemeris.d_VYn = static_cast<double>(read_navigation_signed(string_bits, Y_N_DOT)) * TWO_N20;
-                    gnav_ephemeris.d_AYn = static_cast<double>(read_navigation_signed(string_bits, Y_N_DOT_DOT)) * TWO_N30;
-                    gnav_ephemeris.d_Yn = static_cast<double>(read_navigation_signed(string_bits, Y_N)) * TWO_N11;
-
-                    gnav_ephemeris.d_iode = read_navigation_unsigned(string_bits, T_B);
+                    gnav_ephemeris.d_B_n = static_cast<double>(string_bits.read_unsigned(B_N));
+                    gnav_ephemeris.d_P_2 = static_cast<bool>(string_bits.read_bool(P2));
+                    gnav_ephemeris.d_t_b = static_cast<double>(string_bits.read_unsigned(T_B)) * 15 * 60;
+                    gnav_ephemeris.d_VYn = static_cast<double>(string_bits.read_sign_magnitude(Y_N_DOT)) * TWO_N20;
+                    gnav_ephemeris.d_AYn = static_cast<double>(string_bits.read_sign_magnitude(Y_N_DOT_DOT)) * TWO_N30;
+                    gnav_ephemeris.d_Yn = static_cast<double>(string_bits.read_sign_magnitude(Y_N)) * TWO_N11;
+
+                    gnav_ephemeris.d_iode = string_bits.read_unsigned(T_B);
                     flag_ephemeris_str_2 = true;
                 }
 
@@ -299,13 +138,13 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 3 ----------------------------------------------
             if (flag_ephemeris_str_2 == true)
                 {
-                    gnav_ephemeris.d_P_3 = static_cast<bool>(read_navigation_bool(string_bits, P3));
-                    gnav_ephemeris.d_gamma_n = static_cast<double>(read_navigation_signed(string_bits, GAMMA_N)) * TWO_N40;
-                    gnav_ephemeris.d_P = static_cast<double>(read_navigation_unsigned(string_bits, P));
-                    gnav_ephemeris.d_l3rd_n = static_cast<bool>(read_navigation_bool(string_bits, EPH_L_N));
-                    gnav_ephemeris.d_VZn = static_cast<double>(read_navigation_signed(string_bits, Z_N_DOT)) * TWO_N20;
-                    gnav_ephemeris.d_AZn = static_cast<double>(read_navigation_signed(string_bits, Z_N_DOT_DOT)) * TWO_N30;
-                    gnav_ephemeris.d_Zn = static_cast<double>(read_navigation_signed(string_bits, Z_N)) * TWO_N11;
+                    gnav_ephemeris.d_P_3 = static_cast<bool>(string_bits.read_bool(P3));
+                    gnav_ephemeris.d_gamma_n = static_cast<double>(string_bits.read_sign_magnitude(GAMMA_N)) * TWO_N40;
+                    gnav_ephemeris.d_P = static_cast<double>(string_bits.read_unsigned(P));
+                    gnav_ephemeris.d_l3rd_n = static_cast<bool>(string_bits.read_bool(EPH_L_N));
+                    gnav_ephemeris.d_VZn = static_cast<double>(string_bits.read_sign_magnitude(Z_N_DOT)) * TWO_N20;
+                    gnav_ephemeris.d_AZn = static_cast<double>(string_bits.read_sign_magnitude(Z_N_DOT_DOT)) * TWO_N30;
+                    gnav_ephemeris.d_Zn = static_cast<double>(string_bits.read_sign_magnitude(Z_N)) * TWO_N11;
 
                     flag_ephemeris_str_3 = true;
                 }
@@ -316,14 +155,14 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 4 ----------------------------------------------
             if (flag_ephemeris_str_3 == true)
                 {
-                    gnav_ephemeris.d_tau_n = static_cast<double>(read_navigation_signed(string_bits, TAU_N)) * TWO_N30;
-                    gnav_ephemeris.d_Delta_tau_n = static_cast<double>(read_navigation_signed(string_bits, DELTA_TAU_N)) * TWO_N30;
-                    gnav_ephemeris.d_E_n = static_cast<double>(read_navigation_unsigned(string_bits, E_N));
-                    gnav_ephemeris.d_P_4 = static_cast<bool>(read_navigation_bool(string_bits, P4));
-                    gnav_ephemeris.d_F_T = static_cast<double>(read_navigation_unsigned(string_bits, F_T));
-                    gnav_ephemeris.d_N_T = static_cast<double>(read_navigation_unsigned(string_bits, N_T));
-                    gnav_ephemeris.d_n = static_cast<double>(read_navigation_unsigned(string_bits, N));
-                    gnav_ephemeris.d_M = static_cast<double>(read_navigation_unsigned(string_bits, M));
+                    gnav_ephemeris.d_tau_n = static_cast<double>(string_bits.read_sign_magnitude(TAU_N)) * TWO_N30;
+                    gnav_ephemeris.d_Delta_tau_n = static_cast<double>(string_bits.read_sign_magnitude(DELTA_TAU_N)) * TWO_N30;
+                    gnav_ephemeris.d_E_n = static_cast<double>(string_bits.read_unsigned(E_N));
+                    gnav_ephemeris.d_P_4 = static_cast<bool>(string_bits.read_bool(P4));
+                    gnav_ephemeris.d_F_T = static_cast<double>(string_bits.read_unsigned(F_T));
+                    gnav_ephemeris.d_N_T = static_cast<double>(string_bits.read_unsigned(N_T));
+                    gnav_ephemeris.d_n = static_cast<double>(string_bits.read_unsigned(N));
+                    gnav_ephemeris.d_M = static_cast<double>(string_bits.read_unsigned(M));
 
                     // Fill in ephemeris deliverables in the code
                     flag_update_slot_number = true;
@@ -339,11 +178,11 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 5 ----------------------------------------------
             if (flag_ephemeris_str_4 == true)
                 {
-                    gnav_utc_model.d_N_A = static_cast<double>(read_navigation_unsigned(string_bits, DAY_NUMBER_A));
-                    gnav_utc_model.d_tau_c = static_cast<double>(read_navigation_signed(string_bits, TAU_C)) * TWO_N31;
-                    gnav_utc_model.d_N_4 = static_cast<double>(read_navigation_unsigned(string_bits, N_4));
-                    gnav_utc_model.d_tau_gps = static_cast<double>(read_navigation_signed(string_bits, TAU_GPS)) * TWO_N30;
-                    gnav_ephemeris.d_l5th_n = static_cast<bool>(read_navigation_bool(string_bits, ALM_L_N));
+                    gnav_utc_model.d_N_A = static_cast<double>(string_bits.read_unsigned(DAY_NUMBER_A));
+                    gnav_utc_model.d_tau_c = static_cast<double>(string_bits.read_sign_magnitude(TAU_C)) * TWO_N31;
+                    gnav_utc_model.d_N_4 = static_cast<double>(string_bits.read_unsigned(N_4));
+                    gnav_utc_model.d_tau_gps = static_cast<double>(string_bits.read_sign_magnitude(TAU_GPS)) * TWO_N30;
+                    gnav_ephemeris.d_l5th_n = static_cast<bool>(string_bits.read_bool(ALM_L_N));
 
                     flag_utc_model_str_5 = true;
 
@@ -385,7 +224,7 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
 
         case 6:
             // --- It is string 6 ----------------------------------------------
-            i_alm_satellite_slot_number = static_cast<uint32_t>(read_navigation_unsigned(string_bits, N_A));
+            i_alm_satellite_slot_number = static_cast<uint32_t>(string_bits.read_unsigned(N_A));
             d_frame_ID = get_frame_number(i_alm_satellite_slot_number);
             // Make sure a valid frame_ID or satellite slot number is returned
             if (d_frame_ID == 0)
@@ -393,13 +232,13 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
                     return 0;
                 }
 
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(read_navigation_bool(string_bits, C_N));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(read_navigation_unsigned(string_bits, M_N_A));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(read_navigation_unsigned(string_bits, N_A));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(read_navigation_unsigned(string_bits, TAU_N_A)) * TWO_N18;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(read_navigation_signed(string_bits, LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(read_navigation_unsigned(string_bits, EPSILON_N_A)) * TWO_N20;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(string_bits.read_bool(C_N));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(string_bits.read_unsigned(M_N_A));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(string_bits.read_unsigned(N_A));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(string_bits.read_unsigned(TAU_N_A)) * TWO_N18;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(string_bits.read_sign_magnitude(LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(string_bits.read_unsigned(EPSILON_N_A)) * TWO_N20;
 
             flag_almanac_str_6 = true;
 
@@ -409,12 +248,12 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 7 ----------------------------------------------
             if (flag_almanac_str_6 == true)
                 {
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(read_navigation_signed(string_bits, OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(read_navigation_unsigned(string_bits, T_LAMBDA_N_A)) * TWO_N5;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_N_A)) * TWO_N9;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_DOT_N_A)) * TWO_N14;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(read_navigation_unsigned(string_bits, H_N_A));
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(read_navigation_bool(string_bits, ALM_L_N));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(string_bits.read_sign_magnitude(OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(string_bits.read_unsigned(T_LAMBDA_N_A)) * TWO_N5;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_N_A)) * TWO_N9;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_DOT_N_A)) * TWO_N14;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(string_bits.read_unsigned(H_N_A));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(string_bits.read_bool(ALM_L_N));
 
                     // Set satellite information for redundancy purposes
                     if (gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A > 24)
@@ -435,7 +274,7 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
 
         case 8:
             // --- It is string 8 ----------------------------------------------
-            i_alm_satellite_slot_number = static_cast<uint32_t>(read_navigation_unsigned(string_bits, N_A));
+            i_alm_satellite_slot_number = static_cast<uint32_t>(string_bits.read_unsigned(N_A));
             d_frame_ID = get_frame_number(i_alm_satellite_slot_number);
             // Make sure a valid frame_ID or satellite slot number is returned
             if (d_frame_ID == 0)
@@ -443,13 +282,13 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
                     return 0;
                 }
 
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(read_navigation_bool(string_bits, C_N));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(read_navigation_unsigned(string_bits, M_N_A));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(read_navigation_unsigned(string_bits, N_A));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(read_navigation_unsigned(string_bits, TAU_N_A)) * TWO_N18;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(read_navigation_signed(string_bits, LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(read_navigation_unsigned(string_bits, EPSILON_N_A)) * TWO_N20;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(string_bits.read_bool(C_N));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(string_bits.read_unsigned(M_N_A));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(string_bits.read_unsigned(N_A));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(string_bits.read_unsigned(TAU_N_A)) * TWO_N18;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(string_bits.read_sign_magnitude(LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(string_bits.read_unsigned(EPSILON_N_A)) * TWO_N20;
 
             flag_almanac_str_8 = true;
 
@@ -459,12 +298,12 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 9 ----------------------------------------------
             if (flag_almanac_str_8 == true)
                 {
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(read_navigation_signed(string_bits, OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(read_navigation_unsigned(string_bits, T_LAMBDA_N_A)) * TWO_N5;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_N_A)) * TWO_N9;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_DOT_N_A)) * TWO_N14;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(read_navigation_unsigned(string_bits, H_N_A));
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(read_navigation_bool(string_bits, ALM_L_N));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(string_bits.read_sign_magnitude(OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(string_bits.read_unsigned(T_LAMBDA_N_A)) * TWO_N5;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_N_A)) * TWO_N9;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_DOT_N_A)) * TWO_N14;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(string_bits.read_unsigned(H_N_A));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(string_bits.read_bool(ALM_L_N));
 
                     // Set satellite information for redundancy purposes
                     if (gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A > 24)
@@ -480,7 +319,7 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
 
         case 10:
             // --- It is string 10 ---------------------------------------------
-            i_alm_satellite_slot_number = static_cast<uint32_t>(read_navigation_unsigned(string_bits, N_A));
+            i_alm_satellite_slot_number = static_cast<uint32_t>(string_bits.read_unsigned(N_A));
             d_frame_ID = get_frame_number(i_alm_satellite_slot_number);
             // Make sure a valid frame_ID or satellite slot number is returned
             if (d_frame_ID == 0)
@@ -488,13 +327,13 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
                     return 0;
                 }
 
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(read_navigation_bool(string_bits, C_N));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(read_navigation_unsigned(string_bits, M_N_A));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(read_navigation_unsigned(string_bits, N_A));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(read_navigation_unsigned(string_bits, TAU_N_A)) * TWO_N18;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(read_navigation_signed(string_bits, LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(read_navigation_unsigned(string_bits, EPSILON_N_A)) * TWO_N20;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(string_bits.read_bool(C_N));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(string_bits.read_unsigned(M_N_A));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(string_bits.read_unsigned(N_A));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(string_bits.read_unsigned(TAU_N_A)) * TWO_N18;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(string_bits.read_sign_magnitude(LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(string_bits.read_unsigned(EPSILON_N_A)) * TWO_N20;
 
             flag_almanac_str_10 = true;
 
@@ -504,12 +343,12 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 11 ---------------------------------------------
             if (flag_almanac_str_10 == true)
                 {
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(read_navigation_signed(string_bits, OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(read_navigation_unsigned(string_bits, T_LAMBDA_N_A)) * TWO_N5;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_N_A)) * TWO_N9;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_DOT_N_A)) * TWO_N14;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(read_navigation_unsigned(string_bits, H_N_A));
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(read_navigation_bool(string_bits, ALM_L_N));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(string_bits.read_sign_magnitude(OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(string_bits.read_unsigned(T_LAMBDA_N_A)) * TWO_N5;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_N_A)) * TWO_N9;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_DOT_N_A)) * TWO_N14;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(string_bits.read_unsigned(H_N_A));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(string_bits.read_bool(ALM_L_N));
 
                     // Set satellite information for redundancy purposes
                     if (gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A > 24)
@@ -525,20 +364,20 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
 
         case 12:
             // --- It is string 12 ---------------------------------------------
-            i_alm_satellite_slot_number = static_cast<uint32_t>(read_navigation_unsigned(string_bits, N_A));
+            i_alm_satellite_slot_number = static_cast<uint32_t>(string_bits.read_unsigned(N_A));
             d_frame_ID = get_frame_number(i_alm_satellite_slot_number);
             // Make sure a valid frame_ID or satellite slot number is returned
             if (d_frame_ID == 0)
                 {
                     return 0;
                 }
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(read_navigation_bool(string_bits, C_N));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(read_navigation_unsigned(string_bits, M_N_A));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(read_navigation_unsigned(string_bits, N_A));
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(read_navigation_unsigned(string_bits, TAU_N_A)) * TWO_N18;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(read_navigation_signed(string_bits, LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
-            gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(read_navigation_unsigned(string_bits, EPSILON_N_A)) * TWO_N20;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(string_bits.read_bool(C_N));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(string_bits.read_unsigned(M_N_A));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(string_bits.read_unsigned(N_A));
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(string_bits.read_unsigned(TAU_N_A)) * TWO_N18;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(string_bits.read_sign_magnitude(LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
+            gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(string_bits.read_unsigned(EPSILON_N_A)) * TWO_N20;
 
             flag_almanac_str_12 = true;
 
@@ -548,12 +387,12 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 13 ---------------------------------------------
             if (flag_almanac_str_12 == true)
                 {
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(read_navigation_signed(string_bits, OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(read_navigation_unsigned(string_bits, T_LAMBDA_N_A)) * TWO_N5;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_N_A)) * TWO_N9;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_DOT_N_A)) * TWO_N14;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(read_navigation_unsigned(string_bits, H_N_A));
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(read_navigation_bool(string_bits, ALM_L_N));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(string_bits.read_sign_magnitude(OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(string_bits.read_unsigned(T_LAMBDA_N_A)) * TWO_N5;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_N_A)) * TWO_N9;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_DOT_N_A)) * TWO_N14;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(string_bits.read_unsigned(H_N_A));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(string_bits.read_bool(ALM_L_N));
 
                     // Set satellite information for redundancy purposes
                     if (gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A > 24)
@@ -571,25 +410,25 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 14 ---------------------------------------------
             if (d_frame_ID == 5)
                 {
-                    gnav_utc_model.d_B1 = static_cast<double>(read_navigation_unsigned(string_bits, B1));
-                    gnav_utc_model.d_B2 = static_cast<double>(read_navigation_unsigned(string_bits, B2));
+                    gnav_utc_model.d_B1 = static_cast<double>(string_bits.read_unsigned(B1));
+                    gnav_utc_model.d_B2 = static_cast<double>(string_bits.read_unsigned(B2));
                 }
             else
                 {
-                    i_alm_satellite_slot_number = static_cast<uint32_t>(read_navigation_unsigned(string_bits, N_A));
+                    i_alm_satellite_slot_number = static_cast<uint32_t>(string_bits.read_unsigned(N_A));
                     d_frame_ID = get_frame_number(i_alm_satellite_slot_number);
                     // Make sure a valid frame_ID or satellite slot number is returned
                     if (d_frame_ID == 0)
                         {
                             return 0;
                         }
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(read_navigation_bool(string_bits, C_N));
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(read_navigation_unsigned(string_bits, M_N_A));
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(read_navigation_unsigned(string_bits, N_A));
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(read_navigation_unsigned(string_bits, TAU_N_A)) * TWO_N18;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(read_navigation_signed(string_bits, LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(read_navigation_unsigned(string_bits, EPSILON_N_A)) * TWO_N20;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_C_n = static_cast<bool>(string_bits.read_bool(C_N));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_M_n_A = static_cast<double>(string_bits.read_unsigned(M_N_A));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_n_A = static_cast<double>(string_bits.read_unsigned(N_A));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_tau_n_A = static_cast<double>(string_bits.read_unsigned(TAU_N_A)) * TWO_N18;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_lambda_n_A = static_cast<double>(string_bits.read_sign_magnitude(LAMBDA_N_A)) * TWO_N20 * GLONASS_PI;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_i_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_I_N_A)) * TWO_N20 * GLONASS_PI;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_epsilon_n_A = static_cast<double>(string_bits.read_unsigned(EPSILON_N_A)) * TWO_N20;
 
                     flag_almanac_str_14 = true;
                 }
@@ -599,12 +438,12 @@ int32_t Glonass_Gnav_Navigation_Message::string_decoder(const std::string& frame
             // --- It is string 15 ----------------------------------------------
             if (d_frame_ID != 5 and flag_almanac_str_14 == true)
                 {
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(read_navigation_signed(string_bits, OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(read_navigation_unsigned(string_bits, T_LAMBDA_N_A)) * TWO_N5;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_N_A)) * TWO_N9;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(read_navigation_signed(string_bits, DELTA_T_DOT_N_A)) * TWO_N14;
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(read_navigation_unsigned(string_bits, H_N_A));
-                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(read_navigation_bool(string_bits, ALM_L_N));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_omega_n_A = static_cast<double>(string_bits.read_sign_magnitude(OMEGA_N_A)) * TWO_N15 * GLONASS_PI;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_t_lambda_n_A = static_cast<double>(string_bits.read_unsigned(T_LAMBDA_N_A)) * TWO_N5;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_N_A)) * TWO_N9;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_Delta_T_n_A_dot = static_cast<double>(string_bits.read_sign_magnitude(DELTA_T_DOT_N_A)) * TWO_N14;
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A = static_cast<double>(string_bits.read_unsigned(H_N_A));
+                    gnav_almanac[i_alm_satellite_slot_number - 1].d_l_n = static_cast<bool>(string_bits.read_bool(ALM_L_N));
 
                     // Set satellite information for redundancy purposes
                     if (gnav_almanac[i_alm_satellite_slot_number - 1].d_H_n_A > 24)
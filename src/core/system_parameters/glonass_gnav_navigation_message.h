@@ -106,6 +106,13 @@ public:
      */
     int32_t string_decoder(const std::string& frame_string);
 
+    /*!
+     * \brief Decodes the GLONASS GNAV string
+     * \param string_bits [in] are the bits of the string message, packed MSB first
+     * \returns Returns the ID of the decoded string
+     */
+    int32_t string_decoder(const Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>& string_bits);
+
     inline bool get_flag_CRC_test() const
     {
         return flag_CRC_test;
@@ -167,9 +174,6 @@ public:
     }
 
 private:
-    uint64_t read_navigation_unsigned(std::bitset<GLONASS_GNAV_STRING_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    int64_t read_navigation_signed(std::bitset<GLONASS_GNAV_STRING_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    bool read_navigation_bool(std::bitset<GLONASS_GNAV_STRING_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
 
     Glonass_Gnav_Ephemeris gnav_ephemeris{};                   // Ephemeris information decoded
     Glonass_Gnav_Utc_Model gnav_utc_model{};                   // UTC model information
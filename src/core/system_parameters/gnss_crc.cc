@@ -0,0 +1,236 @@
+/*!
+ * \file gnss_crc.cc
+ * \brief Error detection codes of the GNSS navigation messages: CRC-24Q,
+ * GPS LNAV word parity and GLONASS GNAV string Hamming code.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_crc.h"
+#include <array>
+#include <bitset>
+#include <vector>
+
+
+namespace
+{
+constexpr uint32_t CRC24Q_POLY = 0x864CFBU;  // 0x1864CFB without the x^24 term
+constexpr uint32_t CRC24Q_MASK = 0xFFFFFFU;
+
+
+/*
+ * table[0][b] is the CRC of byte b, and table[k][b] is the CRC of byte b
+ * followed by k zero bytes, so that 8 bytes are processed with 8 independent
+ * lookups (slice-by-8).
+ */
+struct Crc24q_Tables
+{
+    Crc24q_Tables()
+    {
+        for (uint32_t b = 0; b < 256; b++)
+            {
+                uint32_t crc = b << 16U;
+                for (int32_t k = 0; k < 8; k++)
+                    {
+                        crc = (crc & 0x800000U) ? ((crc << 1U) ^ CRC24Q_POLY) : (crc << 1U);
+                    }
+                table[0][b] = crc & CRC24Q_MASK;
+            }
+        for (size_t t = 1; t < 8; t++)
+            {
+                for (size_t b = 0; b < 256; b++)
+                    {
+                        const uint32_t prev = table[t - 1][b];
+                        table[t][b] = ((prev << 8U) & CRC24Q_MASK) ^ table[0][prev >> 16U];
+                    }
+            }
+    }
+
+    std::array<std::array<uint32_t, 256>, 8> table{};
+};
+
+
+const Crc24q_Tables& crc24q_tables()
+{
+    static const Crc24q_Tables tables;
+    return tables;
+}
+
+
+inline uint32_t crc24q_byte(uint32_t crc, uint64_t byte, const Crc24q_Tables& t)
+{
+    return ((crc << 8U) & CRC24Q_MASK) ^ t.table[0][((crc >> 16U) ^ byte) & 0xFFU];
+}
+
+
+// processes the 8 bytes of v, most significant byte first
+inline uint32_t crc24q_word(uint32_t crc, uint64_t v, const Crc24q_Tables& t)
+{
+    return t.table[7][((v >> 56U) ^ (crc >> 16U)) & 0xFFU] ^
+           t.table[6][((v >> 48U) ^ (crc >> 8U)) & 0xFFU] ^
+           t.table[5][((v >> 40U) ^ crc) & 0xFFU] ^
+           t.table[4][(v >> 32U) & 0xFFU] ^
+           t.table[3][(v >> 24U) & 0xFFU] ^
+           t.table[2][(v >> 16U) & 0xFFU] ^
+           t.table[1][(v >> 8U) & 0xFFU] ^
+           t.table[0][v & 0xFFU];
+}
+
+
+inline uint32_t rotl(uint32_t x, uint32_t n)
+{
+    return (x << n) | (x >> (32U - n));
+}
+
+
+inline uint32_t parity(uint64_t x)
+{
+    return static_cast<uint32_t>(std::bitset<64>(x).count() & 1U);
+}
+
+
+/*
+ * Masks over the packed GLONASS string of the bits XORed in each checksum.
+ * The ICD numbers the bits of a string from 85 (first transmitted) down to 1,
+ * so ICD bit i is at position 86 - i of the packed message.
+ */
+struct Glonass_Hamming_Masks
+{
+    Glonass_Hamming_Masks()
+    {
+        const std::array<const std::vector<int32_t>*, 7> indexes{{&GLONASS_GNAV_CRC_I_INDEX, &GLONASS_GNAV_CRC_J_INDEX, &GLONASS_GNAV_CRC_K_INDEX, &GLONASS_GNAV_CRC_L_INDEX, &GLONASS_GNAV_CRC_M_INDEX, &GLONASS_GNAV_CRC_N_INDEX, &GLONASS_GNAV_CRC_P_INDEX}};
+        for (size_t c = 0; c < indexes.size(); c++)
+            {
+                // the check bit Ck is ICD bit k
+                set(check[c], static_cast<int32_t>(c) + 1);
+                for (const auto i : *indexes[c])
+                    {
+                        set(check[c], i);
+                    }
+            }
+        // C_Sigma covers the whole string
+        for (int32_t i = 1; i <= GLONASS_GNAV_STRING_BITS; i++)
+            {
+                set(sigma, i);
+            }
+    }
+
+    static void set(std::array<uint64_t, 2>& mask, int32_t icd_bit)
+    {
+        const auto p = static_cast<uint32_t>(GLONASS_GNAV_STRING_BITS - icd_bit);
+        mask[p / 64] |= (1ULL << (63U - p % 64));
+    }
+
+    std::array<std::array<uint64_t, 2>, 7> check{};
+    std::array<uint64_t, 2> sigma{};
+};
+}  // namespace
+
+
+uint32_t compute_crc24q(const uint8_t* bytes, size_t n_bytes, uint32_t crc)
+{
+    const Crc24q_Tables& t = crc24q_tables();
+    size_t i = 0;
+    for (; i + 8 <= n_bytes; i += 8)
+        {
+            uint64_t v = 0ULL;
+            for (size_t k = 0; k < 8; k++)
+                {
+                    v = (v << 8U) | bytes[i + k];
+                }
+            crc = crc24q_word(crc, v, t);
+        }
+    for (; i < n_bytes; i++)
+        {
+            crc = crc24q_byte(crc, bytes[i], t);
+        }
+    return crc;
+}
+
+
+uint32_t compute_crc24q_bits(const uint64_t* words, size_t n_bits, uint32_t crc)
+{
+    const Crc24q_Tables& t = crc24q_tables();
+    size_t pos = 0;
+    // leading bits, so that the rest of the message is a whole number of bytes
+    for (; pos < n_bits % 8; pos++)
+        {
+            const uint32_t bit = static_cast<uint32_t>(words[pos / 64] >> (63U - pos % 64)) & 1U;
+            const uint32_t top = ((crc >> 23U) ^ bit) & 1U;
+            crc = (crc << 1U) & CRC24Q_MASK;
+            if (top)
+                {
+                    crc ^= CRC24Q_POLY;
+                }
+        }
+    for (; pos + 64 <= n_bits; pos += 64)
+        {
+            const auto offset = static_cast<uint32_t>(pos % 64);
+            uint64_t v = words[pos / 64] << offset;
+            if (offset > 0)
+                {
+                    v |= words[pos / 64 + 1] >> (64U - offset);
+                }
+            crc = crc24q_word(crc, v, t);
+        }
+    for (; pos < n_bits; pos += 8)
+        {
+            const auto offset = static_cast<uint32_t>(pos % 64);
+            uint64_t v = words[pos / 64] << offset;
+            if (offset > 56)
+                {
+                    v |= words[pos / 64 + 1] >> (64U - offset);
+                }
+            crc = crc24q_byte(crc, v >> 56U, t);
+        }
+    return crc;
+}
+
+
+bool gps_lnav_word_parity_check(uint32_t word)
+{
+    // XOR as many bits in parallel as possible. The magic constants pick
+    // up bits which are to be XOR'ed together to implement the GPS parity
+    // check algorithm described in IS-GPS-200. This avoids lengthy shift-
+    // and-xor loops.
+    const uint32_t d1 = word & 0xFBFFBF00U;
+    const uint32_t d2 = rotl(word, 1U) & 0x07FFBF01U;
+    const uint32_t d3 = rotl(word, 2U) & 0xFC0F8100U;
+    const uint32_t d4 = rotl(word, 3U) & 0xF81FFE02U;
+    const uint32_t d5 = rotl(word, 4U) & 0xFC00000EU;
+    const uint32_t d6 = rotl(word, 5U) & 0x07F00001U;
+    const uint32_t d7 = rotl(word, 6U) & 0x00003000U;
+    const uint32_t t = d1 ^ d2 ^ d3 ^ d4 ^ d5 ^ d6 ^ d7;
+    // Now XOR the 5 6-bit fields together to produce the 6-bit final result.
+    const uint32_t parity_bits = (t ^ rotl(t, 6U) ^ rotl(t, 12U) ^ rotl(t, 18U) ^ rotl(t, 24U)) & 0x3FU;
+    return parity_bits == (word & 0x3FU);
+}
+
+
+bool glonass_gnav_hamming_check(const Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>& string_bits)
+{
+    static const Glonass_Hamming_Masks masks;
+    const uint64_t* words = string_bits.data();
+    uint32_t sum_checks = 0;
+    for (const auto& mask : masks.check)
+        {
+            sum_checks += parity((words[0] & mask[0]) ^ (words[1] & mask[1]));
+        }
+    const uint32_t c_sigma = parity((words[0] & masks.sigma[0]) ^ (words[1] & masks.sigma[1]));
+
+    // (a-i) All checksums (C1,...,C7 and C_Sigma) are equal to zero
+    // (a-ii) Only one of the checksums (C1,...,C7) is equal to 1 and C_Sigma = 1
+    // All other conditions are assumed errors (no correction for case b)
+    return (sum_checks == 0 and c_sigma == 0) or (sum_checks == 1 and c_sigma == 1);
+}
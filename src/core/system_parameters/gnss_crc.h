@@ -0,0 +1,76 @@
+/*!
+ * \file gnss_crc.h
+ * \brief Error detection codes of the GNSS navigation messages: CRC-24Q
+ * (Galileo I/NAV and F/NAV, GPS CNAV, SBAS), GPS LNAV word parity and
+ * GLONASS GNAV string Hamming code.
+ *
+ * The CRC-24Q is computed with a slice-by-8 table algorithm, which processes
+ * 64 message bits per step, either over bytes or directly over bits packed
+ * MSB first in 64-bit words (see nav_bit_field.h). The parity and Hamming
+ * checks XOR all the bits involved in each check bit at once, with masks
+ * over whole words.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_CRC_H
+#define GNSS_SDR_GNSS_CRC_H
+
+#include "GLONASS_L1_L2_CA.h"
+#include "nav_bit_field.h"
+#include <cstddef>
+#include <cstdint>
+
+/*!
+ * \brief CRC-24Q (polynomial 0x1864CFB, not reflected, no final XOR) of a
+ * sequence of bytes, starting from the value crc.
+ */
+uint32_t compute_crc24q(const uint8_t* bytes, size_t n_bytes, uint32_t crc = 0U);
+
+/*!
+ * \brief CRC-24Q of the first n_bits bits of a message packed MSB first in
+ * 64-bit words, starting from the value crc.
+ *
+ * The result is the same as with compute_crc24q() over the message padded
+ * with zeros at the start up to a whole number of bytes, which is how the
+ * Galileo and GPS CNAV CRCs are defined.
+ */
+uint32_t compute_crc24q_bits(const uint64_t* words, size_t n_bits, uint32_t crc = 0U);
+
+//! CRC-24Q of a whole packed navigation message
+template <size_t N_BITS>
+inline uint32_t compute_crc24q(const Nav_Message_Bits<N_BITS>& bits)
+{
+    return compute_crc24q_bits(bits.data(), N_BITS);
+}
+
+/*!
+ * \brief Parity check of a GPS LNAV word (IS-GPS-200, 20.3.5.2).
+ *
+ * Bits 29 to 0 of word are the 30 bits of the word, data bits already
+ * inverted according to D30* (bits D1 to D24 at positions 29 to 6 and parity
+ * bits D25 to D30 at positions 5 to 0). Bits 31 and 30 are the bits D29* and
+ * D30* of the previous word.
+ */
+bool gps_lnav_word_parity_check(uint32_t word);
+
+/*!
+ * \brief Hamming code verification of a GLONASS GNAV string (ICD GLONASS
+ * 5.1, 4.7). Returns true if all the checksums are zero, or if only one of
+ * C1,...,C7 is one and C_Sigma is one (single error, which is not
+ * corrected).
+ */
+bool glonass_gnav_hamming_check(const Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>& string_bits);
+
+#endif  // GNSS_SDR_GNSS_CRC_H
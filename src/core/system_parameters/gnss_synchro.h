@@ -24,11 +24,16 @@
 
 #include <boost/serialization/nvp.hpp>
 #include <cstdint>
-#include <utility>
+#include <type_traits>
 
 /*!
  * \brief This is the class that contains the information that is shared
  * by the processing blocks.
+ *
+ * It is trivially copyable, so that the GNU Radio buffers and the containers
+ * of the PVT block copy it as a block of memory. The members are laid out
+ * with no padding holes between them, and the ones read at every epoch by
+ * the Observables and PVT blocks come first.
  */
 class Gnss_Synchro
 {
@@ -37,11 +42,34 @@ public:
 
     ~Gnss_Synchro() = default;  //!< Default destructor
 
+    // Members read at every epoch
+    uint64_t Tracking_sample_counter{};   //!< Set by Tracking processing block
+    int64_t fs{};                         //!< Set by Tracking processing block
+    double Carrier_Doppler_hz{};          //!< Set by Tracking processing block
+    double Carrier_phase_rads{};          //!< Set by Tracking processing block
+    double Code_phase_samples{};          //!< Set by Tracking processing block
+    double Pseudorange_m{};               //!< Set by Observables processing block
+    double RX_time{};                     //!< Set by Observables processing block
+    uint32_t TOW_at_current_symbol_ms{};  //!< Set by Telemetry Decoder processing block
+    bool Flag_valid_acquisition{};        //!< Set by Acquisition processing block
+    bool Flag_valid_symbol_output{};      //!< Set by Tracking processing block
+    bool Flag_valid_word{};               //!< Set by Telemetry Decoder processing block
+    bool Flag_valid_pseudorange{};        //!< Set by Observables processing block
+
+    // Observables
+    double interp_TOW_ms{};  //!< Set by Observables processing block
+
+    // Tracking
+    double Prompt_I{};                //!< Set by Tracking processing block
+    double Prompt_Q{};                //!< Set by Tracking processing block
+    double CN0_dB_hz{};               //!< Set by Tracking processing block
+    int32_t correlation_length_ms{};  //!< Set by Tracking processing block
+
     // Satellite and signal info
-    char System{};         //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
-    char Signal[3]{};      //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
     uint32_t PRN{};        //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
     int32_t Channel_ID{};  //!< Set by Channel constructor
+    char System{};         //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
+    char Signal[3]{};      //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
 
     // Acquisition
     double Acq_delay_samples{};          //!< Set by Acquisition processing block
@@ -49,116 +77,6 @@ public:
     uint64_t Acq_samplestamp_samples{};  //!< Set by Acquisition processing block
     uint32_t Acq_doppler_step{};         //!< Set by Acquisition processing block
 
-    // Tracking
-    int64_t fs{};                        //!< Set by Tracking processing block
-    double Prompt_I{};                   //!< Set by Tracking processing block
-    double Prompt_Q{};                   //!< Set by Tracking processing block
-    double CN0_dB_hz{};                  //!< Set by Tracking processing block
-    double Carrier_Doppler_hz{};         //!< Set by Tracking processing block
-    double Carrier_phase_rads{};         //!< Set by Tracking processing block
-    double Code_phase_samples{};         //!< Set by Tracking processing block
-    uint64_t Tracking_sample_counter{};  //!< Set by Tracking processing block
-    int32_t correlation_length_ms{};     //!< Set by Tracking processing block
-
-    // Telemetry Decoder
-    uint32_t TOW_at_current_symbol_ms{};  //!< Set by Telemetry Decoder processing block
-
-    // Observables
-    double Pseudorange_m{};  //!< Set by Observables processing block
-    double RX_time{};        //!< Set by Observables processing block
-    double interp_TOW_ms{};  //!< Set by Observables processing block
-
-    // Flags
-    bool Flag_valid_acquisition{};    //!< Set by Acquisition processing block
-    bool Flag_valid_symbol_output{};  //!< Set by Tracking processing block
-    bool Flag_valid_word{};           //!< Set by Telemetry Decoder processing block
-    bool Flag_valid_pseudorange{};    //!< Set by Observables processing block
-
-    /// Copy constructor
-    Gnss_Synchro(const Gnss_Synchro& other) noexcept
-    {
-        *this = other;
-    };
-
-    /// Copy assignment operator
-    Gnss_Synchro& operator=(const Gnss_Synchro& rhs) noexcept
-    {
-        // Only do assignment if RHS is a different object from this.
-        if (this != &rhs)
-            {
-                this->System = rhs.System;
-                this->Signal[0] = rhs.Signal[0];
-                this->Signal[1] = rhs.Signal[1];
-                this->Signal[2] = rhs.Signal[2];
-                this->PRN = rhs.PRN;
-                this->Channel_ID = rhs.Channel_ID;
-                this->Acq_delay_samples = rhs.Acq_delay_samples;
-                this->Acq_doppler_hz = rhs.Acq_doppler_hz;
-                this->Acq_samplestamp_samples = rhs.Acq_samplestamp_samples;
-                this->Acq_doppler_step = rhs.Acq_doppler_step;
-                this->fs = rhs.fs;
-                this->Prompt_I = rhs.Prompt_I;
-                this->Prompt_Q = rhs.Prompt_Q;
-                this->CN0_dB_hz = rhs.CN0_dB_hz;
-                this->Carrier_Doppler_hz = rhs.Carrier_Doppler_hz;
-                this->Carrier_phase_rads = rhs.Carrier_phase_rads;
-                this->Code_phase_samples = rhs.Code_phase_samples;
-                this->Tracking_sample_counter = rhs.Tracking_sample_counter;
-                this->correlation_length_ms = rhs.correlation_length_ms;
-                this->TOW_at_current_symbol_ms = rhs.TOW_at_current_symbol_ms;
-                this->Pseudorange_m = rhs.Pseudorange_m;
-                this->RX_time = rhs.RX_time;
-                this->interp_TOW_ms = rhs.interp_TOW_ms;
-                this->Flag_valid_acquisition = rhs.Flag_valid_acquisition;
-                this->Flag_valid_symbol_output = rhs.Flag_valid_symbol_output;
-                this->Flag_valid_word = rhs.Flag_valid_word;
-                this->Flag_valid_pseudorange = rhs.Flag_valid_pseudorange;
-            }
-        return *this;
-    };
-
-    /// Move constructor
-    Gnss_Synchro(Gnss_Synchro&& other) noexcept
-    {
-        *this = std::move(other);
-    };
-
-    /// Move assignment operator
-    Gnss_Synchro& operator=(Gnss_Synchro&& other) noexcept
-    {
-        if (this != &other)
-            {
-                this->System = other.System;
-                this->Signal[0] = other.Signal[0];
-                this->Signal[1] = other.Signal[1];
-                this->Signal[2] = other.Signal[2];
-                this->PRN = other.PRN;
-                this->Channel_ID = other.Channel_ID;
-                this->Acq_delay_samples = other.Acq_delay_samples;
-                this->Acq_doppler_hz = other.Acq_doppler_hz;
-                this->Acq_samplestamp_samples = other.Acq_samplestamp_samples;
-                this->Acq_doppler_step = other.Acq_doppler_step;
-                this->fs = other.fs;
-                this->Prompt_I = other.Prompt_I;
-                this->Prompt_Q = other.Prompt_Q;
-                this->CN0_dB_hz = other.CN0_dB_hz;
-                this->Carrier_Doppler_hz = other.Carrier_Doppler_hz;
-                this->Carrier_phase_rads = other.Carrier_phase_rads;
-                this->Code_phase_samples = other.Code_phase_samples;
-                this->Tracking_sample_counter = other.Tracking_sample_counter;
-                this->correlation_length_ms = other.correlation_length_ms;
-                this->TOW_at_current_symbol_ms = other.TOW_at_current_symbol_ms;
-                this->Pseudorange_m = other.Pseudorange_m;
-                this->RX_time = other.RX_time;
-                this->interp_TOW_ms = other.interp_TOW_ms;
-                this->Flag_valid_acquisition = other.Flag_valid_acquisition;
-                this->Flag_valid_symbol_output = other.Flag_valid_symbol_output;
-                this->Flag_valid_word = other.Flag_valid_word;
-                this->Flag_valid_pseudorange = other.Flag_valid_pseudorange;
-            }
-        return *this;
-    };
-
     /*!
      * \brief This member function serializes and restores
      * Gnss_Synchro objects from a byte stream.
@@ -204,4 +122,27 @@ public:
     }
 };
 
+// The size is the sum of the sizes of the members, rounded up to the alignment
+// of the class (8 bytes on most ABIs, 4 bytes on i386), only if there are no
+// padding holes between them
+static_assert(sizeof(Gnss_Synchro) ==
+                  (sizeof(Gnss_Synchro::Tracking_sample_counter) + sizeof(Gnss_Synchro::fs) +
+                      sizeof(Gnss_Synchro::Carrier_Doppler_hz) + sizeof(Gnss_Synchro::Carrier_phase_rads) +
+                      sizeof(Gnss_Synchro::Code_phase_samples) + sizeof(Gnss_Synchro::Pseudorange_m) +
+                      sizeof(Gnss_Synchro::RX_time) + sizeof(Gnss_Synchro::TOW_at_current_symbol_ms) +
+                      sizeof(Gnss_Synchro::Flag_valid_acquisition) + sizeof(Gnss_Synchro::Flag_valid_symbol_output) +
+                      sizeof(Gnss_Synchro::Flag_valid_word) + sizeof(Gnss_Synchro::Flag_valid_pseudorange) +
+                      sizeof(Gnss_Synchro::interp_TOW_ms) + sizeof(Gnss_Synchro::Prompt_I) +
+                      sizeof(Gnss_Synchro::Prompt_Q) + sizeof(Gnss_Synchro::CN0_dB_hz) +
+                      sizeof(Gnss_Synchro::correlation_length_ms) + sizeof(Gnss_Synchro::PRN) +
+                      sizeof(Gnss_Synchro::Channel_ID) + sizeof(Gnss_Synchro::System) +
+                      sizeof(Gnss_Synchro::Signal) + sizeof(Gnss_Synchro::Acq_delay_samples) +
+                      sizeof(Gnss_Synchro::Acq_doppler_hz) + sizeof(Gnss_Synchro::Acq_samplestamp_samples) +
+                      sizeof(Gnss_Synchro::Acq_doppler_step) + alignof(Gnss_Synchro) - 1) /
+                      alignof(Gnss_Synchro) * alignof(Gnss_Synchro),
+    "Gnss_Synchro has padding holes");
+#if !defined(__GLIBCXX__) || (__GNUC__ >= 5)
+static_assert(std::is_trivially_copyable<Gnss_Synchro>::value, "Gnss_Synchro must be trivially copyable");
+#endif
+
 #endif
@@ -23,7 +23,6 @@
 #include "gps_navigation_message.h"
 #include "gnss_satellite.h"
 #include <cmath>     // for fmod, abs, floor
-#include <cstring>   // for memcpy
 #include <iostream>  // for operator<<, cout, endl
 #include <limits>    // for std::numeric_limits
 
@@ -51,91 +50,11 @@ void Gps_Navigation_Message::print_gps_word_bytes(uint32_t GPS_word) const
 }
 
 
-bool Gps_Navigation_Message::read_navigation_bool(std::bitset<GPS_SUBFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    bool value;
-
-    if (static_cast<int>(bits[GPS_SUBFRAME_BITS - parameter[0].first]) == 1)
-        {
-            value = true;
-        }
-    else
-        {
-            value = false;
-        }
-    return value;
-}
-
-
-uint64_t Gps_Navigation_Message::read_navigation_unsigned(std::bitset<GPS_SUBFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    uint64_t value = 0ULL;
-    int32_t num_of_slices = parameter.size();
-    for (int32_t i = 0; i < num_of_slices; i++)
-        {
-            for (int32_t j = 0; j < parameter[i].second; j++)
-                {
-                    value <<= 1;  // shift left
-                    if (static_cast<int>(bits[GPS_SUBFRAME_BITS - parameter[i].first - j]) == 1)
-                        {
-                            value += 1ULL;  // insert the bit
-                        }
-                }
-        }
-    return value;
-}
-
-
-int64_t Gps_Navigation_Message::read_navigation_signed(std::bitset<GPS_SUBFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
-{
-    int64_t value = 0LL;
-    int32_t num_of_slices = parameter.size();
-
-    // read the MSB and perform the sign extension
-    if (static_cast<int>(bits[GPS_SUBFRAME_BITS - parameter[0].first]) == 1)
-        {
-            value ^= 0xFFFFFFFFFFFFFFFFLL;  // 64 bits variable
-        }
-    else
-        {
-            value &= 0LL;
-        }
-
-    for (int32_t i = 0; i < num_of_slices; i++)
-        {
-            for (int32_t j = 0; j < parameter[i].second; j++)
-                {
-                    value *= 2;                     // shift left the signed integer
-                    value &= 0xFFFFFFFFFFFFFFFELL;  // reset the corresponding bit (for the 64 bits variable)
-                    if (static_cast<int>(bits[GPS_SUBFRAME_BITS - parameter[i].first - j]) == 1)
-                        {
-                            value += 1LL;  // insert the bit
-                        }
-                }
-        }
-    return value;
-}
-
-
-int32_t Gps_Navigation_Message::subframe_decoder(char* subframe)
+int32_t Gps_Navigation_Message::subframe_decoder(const Nav_Message_Bits<GPS_SUBFRAME_BITS>& subframe_bits)
 {
     int32_t subframe_ID = 0;
-    uint32_t gps_word;
-
-    // UNPACK BYTES TO BITS AND REMOVE THE CRC REDUNDANCE
-    std::bitset<GPS_SUBFRAME_BITS> subframe_bits;
-    std::bitset<GPS_WORD_BITS + 2> word_bits;
-    for (int32_t i = 0; i < 10; i++)
-        {
-            memcpy(&gps_word, &subframe[i * 4], sizeof(char) * 4);
-            word_bits = std::bitset<(GPS_WORD_BITS + 2)>(gps_word);
-            for (int32_t j = 0; j < GPS_WORD_BITS; j++)
-                {
-                    subframe_bits[GPS_WORD_BITS * (9 - i) + j] = word_bits[j];
-                }
-        }
 
-    subframe_ID = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, SUBFRAME_ID));
+    subframe_ID = static_cast<int32_t>(subframe_bits.read_unsigned(SUBFRAME_ID));
 
     // Decode all 5 sub-frames
     switch (subframe_ID)
@@ -148,97 +67,97 @@ int32_t Gps_Navigation_Message::subframe_decoder(char* subframe)
             // The transmitted TOW is actual TOW of the next subframe
             // (the variable subframe at this point contains bits of the last subframe).
             // TOW = bin2dec(subframe(31:47)) * 6;
-            d_TOW_SF1 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, TOW));
+            d_TOW_SF1 = static_cast<int32_t>(subframe_bits.read_unsigned(TOW));
             // we are in the first subframe (the transmitted TOW is the start time of the next subframe) !
             d_TOW_SF1 = d_TOW_SF1 * 6;
             d_TOW = d_TOW_SF1;  // Set transmission time
-            b_integrity_status_flag = read_navigation_bool(subframe_bits, INTEGRITY_STATUS_FLAG);
-            b_alert_flag = read_navigation_bool(subframe_bits, ALERT_FLAG);
-            b_antispoofing_flag = read_navigation_bool(subframe_bits, ANTI_SPOOFING_FLAG);
-            i_GPS_week = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, GPS_WEEK));
-            i_SV_accuracy = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, SV_ACCURACY));  // (20.3.3.3.1.3)
-            i_SV_health = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, SV_HEALTH));
-            b_L2_P_data_flag = read_navigation_bool(subframe_bits, L2_P_DATA_FLAG);  //
-            i_code_on_L2 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, CA_OR_P_ON_L2));
-            d_TGD = static_cast<double>(read_navigation_signed(subframe_bits, T_GD));
+            b_integrity_status_flag = subframe_bits.read_bool(INTEGRITY_STATUS_FLAG);
+            b_alert_flag = subframe_bits.read_bool(ALERT_FLAG);
+            b_antispoofing_flag = subframe_bits.read_bool(ANTI_SPOOFING_FLAG);
+            i_GPS_week = static_cast<int32_t>(subframe_bits.read_unsigned(GPS_WEEK));
+            i_SV_accuracy = static_cast<int32_t>(subframe_bits.read_unsigned(SV_ACCURACY));  // (20.3.3.3.1.3)
+            i_SV_health = static_cast<int32_t>(subframe_bits.read_unsigned(SV_HEALTH));
+            b_L2_P_data_flag = subframe_bits.read_bool(L2_P_DATA_FLAG);  //
+            i_code_on_L2 = static_cast<int32_t>(subframe_bits.read_unsigned(CA_OR_P_ON_L2));
+            d_TGD = static_cast<double>(subframe_bits.read_signed(T_GD));
             d_TGD = d_TGD * T_GD_LSB;
-            d_IODC = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IODC));
-            d_Toc = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, T_OC));
+            d_IODC = static_cast<int32_t>(subframe_bits.read_unsigned(IODC));
+            d_Toc = static_cast<int32_t>(subframe_bits.read_unsigned(T_OC));
             d_Toc = d_Toc * T_OC_LSB;
-            d_A_f0 = static_cast<double>(read_navigation_signed(subframe_bits, A_F0));
+            d_A_f0 = static_cast<double>(subframe_bits.read_signed(A_F0));
             d_A_f0 = d_A_f0 * A_F0_LSB;
-            d_A_f1 = static_cast<double>(read_navigation_signed(subframe_bits, A_F1));
+            d_A_f1 = static_cast<double>(subframe_bits.read_signed(A_F1));
             d_A_f1 = d_A_f1 * A_F1_LSB;
-            d_A_f2 = static_cast<double>(read_navigation_signed(subframe_bits, A_F2));
+            d_A_f2 = static_cast<double>(subframe_bits.read_signed(A_F2));
             d_A_f2 = d_A_f2 * A_F2_LSB;
             break;
 
         case 2:  // --- It is subframe 2 -------------------
-            d_TOW_SF2 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, TOW));
+            d_TOW_SF2 = static_cast<int32_t>(subframe_bits.read_unsigned(TOW));
             d_TOW_SF2 = d_TOW_SF2 * 6;
             d_TOW = d_TOW_SF2;  // Set transmission time
-            b_integrity_status_flag = read_navigation_bool(subframe_bits, INTEGRITY_STATUS_FLAG);
-            b_alert_flag = read_navigation_bool(subframe_bits, ALERT_FLAG);
-            b_antispoofing_flag = read_navigation_bool(subframe_bits, ANTI_SPOOFING_FLAG);
-            d_IODE_SF2 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IODE_SF2));
-            d_Crs = static_cast<double>(read_navigation_signed(subframe_bits, C_RS));
+            b_integrity_status_flag = subframe_bits.read_bool(INTEGRITY_STATUS_FLAG);
+            b_alert_flag = subframe_bits.read_bool(ALERT_FLAG);
+            b_antispoofing_flag = subframe_bits.read_bool(ANTI_SPOOFING_FLAG);
+            d_IODE_SF2 = static_cast<int32_t>(subframe_bits.read_unsigned(IODE_SF2));
+            d_Crs = static_cast<double>(subframe_bits.read_signed(C_RS));
             d_Crs = d_Crs * C_RS_LSB;
-            d_Delta_n = static_cast<double>(read_navigation_signed(subframe_bits, DELTA_N));
+            d_Delta_n = static_cast<double>(subframe_bits.read_signed(DELTA_N));
             d_Delta_n = d_Delta_n * DELTA_N_LSB;
-            d_M_0 = static_cast<double>(read_navigation_signed(subframe_bits, M_0));
+            d_M_0 = static_cast<double>(subframe_bits.read_signed(M_0));
             d_M_0 = d_M_0 * M_0_LSB;
-            d_Cuc = static_cast<double>(read_navigation_signed(subframe_bits, C_UC));
+            d_Cuc = static_cast<double>(subframe_bits.read_signed(C_UC));
             d_Cuc = d_Cuc * C_UC_LSB;
-            d_e_eccentricity = static_cast<double>(read_navigation_unsigned(subframe_bits, ECCENTRICITY));
+            d_e_eccentricity = static_cast<double>(subframe_bits.read_unsigned(ECCENTRICITY));
             d_e_eccentricity = d_e_eccentricity * ECCENTRICITY_LSB;
-            d_Cus = static_cast<double>(read_navigation_signed(subframe_bits, C_US));
+            d_Cus = static_cast<double>(subframe_bits.read_signed(C_US));
             d_Cus = d_Cus * C_US_LSB;
-            d_sqrt_A = static_cast<double>(read_navigation_unsigned(subframe_bits, SQRT_A));
+            d_sqrt_A = static_cast<double>(subframe_bits.read_unsigned(SQRT_A));
             d_sqrt_A = d_sqrt_A * SQRT_A_LSB;
-            d_Toe = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, T_OE));
+            d_Toe = static_cast<int32_t>(subframe_bits.read_unsigned(T_OE));
             d_Toe = d_Toe * T_OE_LSB;
-            b_fit_interval_flag = read_navigation_bool(subframe_bits, FIT_INTERVAL_FLAG);
-            i_AODO = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, AODO));
+            b_fit_interval_flag = subframe_bits.read_bool(FIT_INTERVAL_FLAG);
+            i_AODO = static_cast<int32_t>(subframe_bits.read_unsigned(AODO));
             i_AODO = i_AODO * AODO_LSB;
             break;
 
         case 3:  // --- It is subframe 3 -------------------------------------
-            d_TOW_SF3 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, TOW));
+            d_TOW_SF3 = static_cast<int32_t>(subframe_bits.read_unsigned(TOW));
             d_TOW_SF3 = d_TOW_SF3 * 6;
             d_TOW = d_TOW_SF3;  // Set transmission time
-            b_integrity_status_flag = read_navigation_bool(subframe_bits, INTEGRITY_STATUS_FLAG);
-            b_alert_flag = read_navigation_bool(subframe_bits, ALERT_FLAG);
-            b_antispoofing_flag = read_navigation_bool(subframe_bits, ANTI_SPOOFING_FLAG);
-            d_Cic = static_cast<double>(read_navigation_signed(subframe_bits, C_IC));
+            b_integrity_status_flag = subframe_bits.read_bool(INTEGRITY_STATUS_FLAG);
+            b_alert_flag = subframe_bits.read_bool(ALERT_FLAG);
+            b_antispoofing_flag = subframe_bits.read_bool(ANTI_SPOOFING_FLAG);
+            d_Cic = static_cast<double>(subframe_bits.read_signed(C_IC));
             d_Cic = d_Cic * C_IC_LSB;
-            d_OMEGA0 = static_cast<double>(read_navigation_signed(subframe_bits, OMEGA_0));
+            d_OMEGA0 = static_cast<double>(subframe_bits.read_signed(OMEGA_0));
             d_OMEGA0 = d_OMEGA0 * OMEGA_0_LSB;
-            d_Cis = static_cast<double>(read_navigation_signed(subframe_bits, C_IS));
+            d_Cis = static_cast<double>(subframe_bits.read_signed(C_IS));
             d_Cis = d_Cis * C_IS_LSB;
-            d_i_0 = static_cast<double>(read_navigation_signed(subframe_bits, I_0));
+            d_i_0 = static_cast<double>(subframe_bits.read_signed(I_0));
             d_i_0 = d_i_0 * I_0_LSB;
-            d_Crc = static_cast<double>(read_navigation_signed(subframe_bits, C_RC));
+            d_Crc = static_cast<double>(subframe_bits.read_signed(C_RC));
             d_Crc = d_Crc * C_RC_LSB;
-            d_OMEGA = static_cast<double>(read_navigation_signed(subframe_bits, OMEGA));
+            d_OMEGA = static_cast<double>(subframe_bits.read_signed(OMEGA));
             d_OMEGA = d_OMEGA * OMEGA_LSB;
-            d_OMEGA_DOT = static_cast<double>(read_navigation_signed(subframe_bits, OMEGA_DOT));
+            d_OMEGA_DOT = static_cast<double>(subframe_bits.read_signed(OMEGA_DOT));
             d_OMEGA_DOT = d_OMEGA_DOT * OMEGA_DOT_LSB;
-            d_IODE_SF3 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IODE_SF3));
-            d_IDOT = static_cast<double>(read_navigation_signed(subframe_bits, I_DOT));
+            d_IODE_SF3 = static_cast<int32_t>(subframe_bits.read_unsigned(IODE_SF3));
+            d_IDOT = static_cast<double>(subframe_bits.read_signed(I_DOT));
             d_IDOT = d_IDOT * I_DOT_LSB;
             break;
 
         case 4:  // --- It is subframe 4 ---------- Almanac, ionospheric model, UTC parameters, SV health (PRN: 25-32)
             int32_t SV_data_ID;
             int32_t SV_page;
-            d_TOW_SF4 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, TOW));
+            d_TOW_SF4 = static_cast<int32_t>(subframe_bits.read_unsigned(TOW));
             d_TOW_SF4 = d_TOW_SF4 * 6;
             d_TOW = d_TOW_SF4;  // Set transmission time
-            b_integrity_status_flag = read_navigation_bool(subframe_bits, INTEGRITY_STATUS_FLAG);
-            b_alert_flag = read_navigation_bool(subframe_bits, ALERT_FLAG);
-            b_antispoofing_flag = read_navigation_bool(subframe_bits, ANTI_SPOOFING_FLAG);
-            SV_data_ID = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, SV_DATA_ID));
-            SV_page = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, SV_PAGE));
+            b_integrity_status_flag = subframe_bits.read_bool(INTEGRITY_STATUS_FLAG);
+            b_alert_flag = subframe_bits.read_bool(ALERT_FLAG);
+            b_antispoofing_flag = subframe_bits.read_bool(ANTI_SPOOFING_FLAG);
+            SV_data_ID = static_cast<int32_t>(subframe_bits.read_unsigned(SV_DATA_ID));
+            SV_page = static_cast<int32_t>(subframe_bits.read_unsigned(SV_PAGE));
             if (SV_page > 24 && SV_page < 33)  // Page 4 (from Table 20-V. Data IDs and SV IDs in Subframes 4 and 5, IS-GPS-200K, page 110)
                 {
                     //! \TODO read almanac
@@ -255,33 +174,33 @@ int32_t Gps_Navigation_Message::subframe_decoder(char* subframe)
             if (SV_page == 56)  // Page 18 (from Table 20-V. Data IDs and SV IDs in Subframes 4 and 5, IS-GPS-200K, page 110)
                 {
                     // Page 18 - Ionospheric and UTC data
-                    d_alpha0 = static_cast<double>(read_navigation_signed(subframe_bits, ALPHA_0));
+                    d_alpha0 = static_cast<double>(subframe_bits.read_signed(ALPHA_0));
                     d_alpha0 = d_alpha0 * ALPHA_0_LSB;
-                    d_alpha1 = static_cast<double>(read_navigation_signed(subframe_bits, ALPHA_1));
+                    d_alpha1 = static_cast<double>(subframe_bits.read_signed(ALPHA_1));
                     d_alpha1 = d_alpha1 * ALPHA_1_LSB;
-                    d_alpha2 = static_cast<double>(read_navigation_signed(subframe_bits, ALPHA_2));
+                    d_alpha2 = static_cast<double>(subframe_bits.read_signed(ALPHA_2));
                     d_alpha2 = d_alpha2 * ALPHA_2_LSB;
-                    d_alpha3 = static_cast<double>(read_navigation_signed(subframe_bits, ALPHA_3));
+                    d_alpha3 = static_cast<double>(subframe_bits.read_signed(ALPHA_3));
                     d_alpha3 = d_alpha3 * ALPHA_3_LSB;
-                    d_beta0 = static_cast<double>(read_navigation_signed(subframe_bits, BETA_0));
+                    d_beta0 = static_cast<double>(subframe_bits.read_signed(BETA_0));
                     d_beta0 = d_beta0 * BETA_0_LSB;
-                    d_beta1 = static_cast<double>(read_navigation_signed(subframe_bits, BETA_1));
+                    d_beta1 = static_cast<double>(subframe_bits.read_signed(BETA_1));
                     d_beta1 = d_beta1 * BETA_1_LSB;
-                    d_beta2 = static_cast<double>(read_navigation_signed(subframe_bits, BETA_2));
+                    d_beta2 = static_cast<double>(subframe_bits.read_signed(BETA_2));
                     d_beta2 = d_beta2 * BETA_2_LSB;
-                    d_beta3 = static_cast<double>(read_navigation_signed(subframe_bits, BETA_3));
+                    d_beta3 = static_cast<double>(subframe_bits.read_signed(BETA_3));
                     d_beta3 = d_beta3 * BETA_3_LSB;
-                    d_A1 = static_cast<double>(read_navigation_signed(subframe_bits, A_1));
+                    d_A1 = static_cast<double>(subframe_bits.read_signed(A_1));
                     d_A1 = d_A1 * A_1_LSB;
-                    d_A0 = static_cast<double>(read_navigation_signed(subframe_bits, A_0));
+                    d_A0 = static_cast<double>(subframe_bits.read_signed(A_0));
                     d_A0 = d_A0 * A_0_LSB;
-                    d_t_OT = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, T_OT));
+                    d_t_OT = static_cast<int32_t>(subframe_bits.read_unsigned(T_OT));
                     d_t_OT = d_t_OT * T_OT_LSB;
-                    i_WN_T = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, WN_T));
-                    d_DeltaT_LS = static_cast<int32_t>(read_navigation_signed(subframe_bits, DELTAT_LS));
-                    i_WN_LSF = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, WN_LSF));
-                    i_DN = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, DN));  // Right-justified ?
-                    d_DeltaT_LSF = static_cast<int32_t>(read_navigation_signed(subframe_bits, DELTAT_LSF));
+                    i_WN_T = static_cast<int32_t>(subframe_bits.read_unsigned(WN_T));
+                    d_DeltaT_LS = static_cast<int32_t>(subframe_bits.read_signed(DELTAT_LS));
+                    i_WN_LSF = static_cast<int32_t>(subframe_bits.read_unsigned(WN_LSF));
+                    i_DN = static_cast<int32_t>(subframe_bits.read_unsigned(DN));  // Right-justified ?
+                    d_DeltaT_LSF = static_cast<int32_t>(subframe_bits.read_signed(DELTAT_LSF));
                     flag_iono_valid = true;
                     flag_utc_model_valid = true;
                 }
@@ -294,28 +213,28 @@ int32_t Gps_Navigation_Message::subframe_decoder(char* subframe)
                 {
                     // Page 25 Anti-Spoofing, SV config and almanac health (PRN: 25-32)
                     //! \TODO Read Anti-Spoofing, SV config
-                    almanacHealth[25] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV25));
-                    almanacHealth[26] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV26));
-                    almanacHealth[27] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV27));
-                    almanacHealth[28] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV28));
-                    almanacHealth[29] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV29));
-                    almanacHealth[30] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV30));
-                    almanacHealth[31] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV31));
-                    almanacHealth[32] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV32));
+                    almanacHealth[25] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV25));
+                    almanacHealth[26] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV26));
+                    almanacHealth[27] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV27));
+                    almanacHealth[28] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV28));
+                    almanacHealth[29] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV29));
+                    almanacHealth[30] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV30));
+                    almanacHealth[31] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV31));
+                    almanacHealth[32] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV32));
                 }
             break;
 
         case 5:  // -- It is subframe 5 -----------------almanac health (PRN: 1-24) and Almanac reference week number and time.
             int32_t SV_data_ID_5;
             int32_t SV_page_5;
-            d_TOW_SF5 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, TOW));
+            d_TOW_SF5 = static_cast<int32_t>(subframe_bits.read_unsigned(TOW));
             d_TOW_SF5 = d_TOW_SF5 * 6;
             d_TOW = d_TOW_SF5;  // Set transmission time
-            b_integrity_status_flag = read_navigation_bool(subframe_bits, INTEGRITY_STATUS_FLAG);
-            b_alert_flag = read_navigation_bool(subframe_bits, ALERT_FLAG);
-            b_antispoofing_flag = read_navigation_bool(subframe_bits, ANTI_SPOOFING_FLAG);
-            SV_data_ID_5 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, SV_DATA_ID));
-            SV_page_5 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, SV_PAGE));
+            b_integrity_status_flag = subframe_bits.read_bool(INTEGRITY_STATUS_FLAG);
+            b_alert_flag = subframe_bits.read_bool(ALERT_FLAG);
+            b_antispoofing_flag = subframe_bits.read_bool(ANTI_SPOOFING_FLAG);
+            SV_data_ID_5 = static_cast<int32_t>(subframe_bits.read_unsigned(SV_DATA_ID));
+            SV_page_5 = static_cast<int32_t>(subframe_bits.read_unsigned(SV_PAGE));
             if (SV_page_5 < 25)
                 {
                     //! \TODO read almanac
@@ -325,33 +244,33 @@ int32_t Gps_Navigation_Message::subframe_decoder(char* subframe)
                 }
             if (SV_page_5 == 51)  // Page 25 (from Table 20-V. Data IDs and SV IDs in Subframes 4 and 5, IS-GPS-200K, page 110)
                 {
-                    i_Toa = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, T_OA));
+                    i_Toa = static_cast<int32_t>(subframe_bits.read_unsigned(T_OA));
                     i_Toa = i_Toa * T_OA_LSB;
-                    i_WN_A = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, WN_A));
-                    almanacHealth[1] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV1));
-                    almanacHealth[2] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV2));
-                    almanacHealth[3] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV3));
-                    almanacHealth[4] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV4));
-                    almanacHealth[5] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV5));
-                    almanacHealth[6] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV6));
-                    almanacHealth[7] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV7));
-                    almanacHealth[8] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV8));
-                    almanacHealth[9] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV9));
-                    almanacHealth[10] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV10));
-                    almanacHealth[11] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV11));
-                    almanacHealth[12] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV12));
-                    almanacHealth[13] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV13));
-                    almanacHealth[14] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV14));
-                    almanacHealth[15] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV15));
-                    almanacHealth[16] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV16));
-                    almanacHealth[17] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV17));
-                    almanacHealth[18] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV18));
-                    almanacHealth[19] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV19));
-                    almanacHealth[20] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV20));
-                    almanacHealth[21] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV21));
-                    almanacHealth[22] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV22));
-                    almanacHealth[23] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV23));
-                    almanacHealth[24] = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, HEALTH_SV24));
+                    i_WN_A = static_cast<int32_t>(subframe_bits.read_unsigned(WN_A));
+                    almanacHealth[1] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV1));
+                    almanacHealth[2] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV2));
+                    almanacHealth[3] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV3));
+                    almanacHealth[4] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV4));
+                    almanacHealth[5] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV5));
+                    almanacHealth[6] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV6));
+                    almanacHealth[7] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV7));
+                    almanacHealth[8] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV8));
+                    almanacHealth[9] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV9));
+                    almanacHealth[10] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV10));
+                    almanacHealth[11] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV11));
+                    almanacHealth[12] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV12));
+                    almanacHealth[13] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV13));
+                    almanacHealth[14] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV14));
+                    almanacHealth[15] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV15));
+                    almanacHealth[16] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV16));
+                    almanacHealth[17] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV17));
+                    almanacHealth[18] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV18));
+                    almanacHealth[19] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV19));
+                    almanacHealth[20] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV20));
+                    almanacHealth[21] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV21));
+                    almanacHealth[22] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV22));
+                    almanacHealth[23] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV23));
+                    almanacHealth[24] = static_cast<int32_t>(subframe_bits.read_unsigned(HEALTH_SV24));
                 }
             break;
 
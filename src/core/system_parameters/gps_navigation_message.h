@@ -64,9 +64,10 @@ public:
     Gps_Utc_Model get_utc_model();
 
     /*!
-     * \brief Decodes the GPS NAV message
+     * \brief Decodes a subframe of the GPS NAV message, given as its ten
+     * 30-bit words (data bits already corrected with D30*)
      */
-    int32_t subframe_decoder(char* subframe);
+    int32_t subframe_decoder(const Nav_Message_Bits<GPS_SUBFRAME_BITS>& subframe_bits);
 
     /*!
      * \brief Computes the Coordinated Universal Time (UTC) and
@@ -133,9 +134,6 @@ public:
     bool satellite_validation();
 
 private:
-    uint64_t read_navigation_unsigned(std::bitset<GPS_SUBFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    int64_t read_navigation_signed(std::bitset<GPS_SUBFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    bool read_navigation_bool(std::bitset<GPS_SUBFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
     void print_gps_word_bytes(uint32_t GPS_word) const;
 
     std::map<int32_t, int32_t> almanacHealth;  //!< Map that stores the health information stored in the almanac
@@ -0,0 +1,240 @@
+/*!
+ * \file nav_bit_field.h
+ * \brief Compile-time descriptors of navigation message fields, and a
+ * container of navigation message bits packed in 64-bit words from which
+ * the fields are extracted with shifts and masks.
+ *
+ * Bit positions follow the convention of the Interface Control Documents:
+ * the first transmitted bit of a message is bit 1. A field is made of up to
+ * three slices of consecutive bits, which are concatenated in order, the
+ * first bit of the first slice being the most significant one.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NAV_BIT_FIELD_H
+#define GNSS_SDR_NAV_BIT_FIELD_H
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//! Slice of consecutive bits of a navigation message
+struct Nav_Bit_Slice
+{
+    int32_t first;   //!< position of the first bit (1-based)
+    int32_t length;  //!< number of bits
+};
+
+
+/*!
+ * \brief Descriptor of a navigation message field, usable in constant
+ * expressions, e.g. constexpr Nav_Bit_Field D1_SOW{{19, 8}, {31, 12}};
+ */
+class Nav_Bit_Field
+{
+public:
+    constexpr Nav_Bit_Field(Nav_Bit_Slice s0) : d_slices{s0, {0, 0}, {0, 0}}, d_num_slices(1) {}
+    constexpr Nav_Bit_Field(Nav_Bit_Slice s0, Nav_Bit_Slice s1) : d_slices{s0, s1, {0, 0}}, d_num_slices(2) {}
+    constexpr Nav_Bit_Field(Nav_Bit_Slice s0, Nav_Bit_Slice s1, Nav_Bit_Slice s2) : d_slices{s0, s1, s2}, d_num_slices(3) {}
+
+    constexpr int32_t num_slices() const { return d_num_slices; }
+    constexpr const Nav_Bit_Slice& slice(int32_t i) const { return d_slices[i]; }
+    constexpr int32_t first() const { return d_slices[0].first; }
+    constexpr int32_t length() const { return d_slices[0].length + d_slices[1].length + d_slices[2].length; }
+
+private:
+    Nav_Bit_Slice d_slices[3];
+    int32_t d_num_slices;
+};
+
+
+/*!
+ * \brief Bits of a navigation message of N_BITS bits, packed MSB first in
+ * 64-bit words (bit 1 of the message is the most significant bit of the
+ * first word).
+ */
+template <size_t N_BITS>
+class Nav_Message_Bits
+{
+public:
+    Nav_Message_Bits() = default;
+
+    /*!
+     * \brief Packs a std::bitset in which bit 1 of the message is
+     * bits[N_BITS - 1] (i.e., as built from a string of '0' and '1').
+     */
+    explicit Nav_Message_Bits(const std::bitset<N_BITS>& bits)
+    {
+        // 64 bits at a time, with shifts of the whole bitset
+        const std::bitset<N_BITS> low_word(~0ULL);
+        for (size_t w = 0; w < d_words.size(); w++)
+            {
+                const size_t remaining = N_BITS - 64 * w;
+                if (remaining >= 64)
+                    {
+                        d_words[w] = ((bits >> (remaining - 64)) & low_word).to_ullong();
+                    }
+                else
+                    {
+                        const std::bitset<N_BITS> low_bits((1ULL << remaining) - 1ULL);
+                        d_words[w] = (bits & low_bits).to_ullong() << (64U - remaining);
+                    }
+            }
+    }
+
+    /*!
+     * \brief Packs a string of '0' and '1' characters, with the same
+     * alignment as the std::bitset string constructor: the first N_BITS
+     * characters are used and, if the string is shorter, it is aligned to the
+     * end of the message (missing leading bits are zeros).
+     */
+    explicit Nav_Message_Bits(const std::string& bits)
+    {
+        const size_t n = bits.size() < N_BITS ? bits.size() : N_BITS;
+        const size_t offset = N_BITS - n;
+        for (size_t i = 0; i < n; i++)
+            {
+                if (bits[i] == '1')
+                    {
+                        const size_t p = offset + i;
+                        d_words[p / 64] |= (1ULL << (63U - p % 64));
+                    }
+            }
+    }
+
+    //! Writes the length (<= 64) least significant bits of value starting at bit position first
+    inline void insert(int32_t first, int32_t length, uint64_t value)
+    {
+        if (length <= 0)
+            {
+                return;
+            }
+        const auto start = static_cast<size_t>(first - 1);
+        const size_t word = start / 64;
+        const auto offset = static_cast<uint32_t>(start % 64);
+        const auto n = static_cast<uint32_t>(length);
+        const uint64_t mask = (n < 64 ? (1ULL << n) : 0ULL) - 1ULL;
+        const uint64_t bits = value & mask;
+        // the field, left aligned in the first word and possibly spilling over the next one
+        d_words[word] = (d_words[word] & ~((mask << (64U - n)) >> offset)) | ((bits << (64U - n)) >> offset);
+        if (offset + n > 64)
+            {
+                const uint32_t spill = offset + n - 64;
+                d_words[word + 1] = (d_words[word + 1] & ~(~0ULL << (64U - spill))) | (bits << (64U - spill));
+            }
+    }
+
+    //! Copies length bits of another message, starting at its bit src_first, to bit position first
+    template <size_t M_BITS>
+    inline void insert(int32_t first, const Nav_Message_Bits<M_BITS>& src, int32_t src_first, int32_t length)
+    {
+        for (int32_t done = 0; done < length; done += 64)
+            {
+                const int32_t chunk = (length - done) < 64 ? (length - done) : 64;
+                insert(first + done, chunk, src.extract(src_first + done, chunk));
+            }
+    }
+
+    inline void set(int32_t position, bool value = true)
+    {
+        const auto p = static_cast<size_t>(position - 1);
+        const uint64_t mask = 1ULL << (63U - p % 64);
+        d_words[p / 64] = value ? (d_words[p / 64] | mask) : (d_words[p / 64] & ~mask);
+    }
+
+    //! Returns the length (<= 64) bits starting at bit position first, right aligned
+    inline uint64_t extract(int32_t first, int32_t length) const
+    {
+        if (length <= 0)
+            {
+                return 0ULL;
+            }
+        const auto start = static_cast<size_t>(first - 1);
+        const size_t word = start / 64;
+        const auto offset = static_cast<uint32_t>(start % 64);
+        uint64_t value = d_words[word] << offset;
+        if (offset > 0 && offset + static_cast<uint32_t>(length) > 64 && word + 1 < d_words.size())
+            {
+                value |= d_words[word + 1] >> (64U - offset);
+            }
+        return value >> (64U - static_cast<uint32_t>(length));
+    }
+
+    inline bool test(int32_t position) const
+    {
+        const auto p = static_cast<size_t>(position - 1);
+        return (d_words[p / 64] >> (63U - p % 64)) & 1ULL;
+    }
+
+    inline uint64_t read_unsigned(const Nav_Bit_Field& field) const
+    {
+        uint64_t value = extract(field.slice(0).first, field.slice(0).length);
+        for (int32_t i = 1; i < field.num_slices(); i++)
+            {
+                const int32_t length = field.slice(i).length;
+                value = (length < 64 ? (value << static_cast<uint32_t>(length)) : 0ULL) | extract(field.slice(i).first, length);
+            }
+        return value;
+    }
+
+    //! Reads a two's complement field, sign-extended to 64 bits
+    inline int64_t read_signed(const Nav_Bit_Field& field) const
+    {
+        const uint64_t value = read_unsigned(field);
+        const int32_t length = field.length();
+        if (length < 64 && test(field.first()))
+            {
+                return static_cast<int64_t>(value | (~0ULL << static_cast<uint32_t>(length)));
+            }
+        return static_cast<int64_t>(value);
+    }
+
+    /*!
+     * \brief Reads a sign-magnitude field (GLONASS convention): the first
+     * bit of the field is the sign, and the following bits of each slice
+     * are the magnitude.
+     */
+    inline int64_t read_sign_magnitude(const Nav_Bit_Field& field) const
+    {
+        uint64_t magnitude = 0ULL;
+        for (int32_t i = 0; i < field.num_slices(); i++)
+            {
+                const int32_t length = field.slice(i).length - 1;
+                if (length > 0)
+                    {
+                        magnitude = (magnitude << static_cast<uint32_t>(length)) | extract(field.slice(i).first + 1, length);
+                    }
+            }
+        const auto value = static_cast<int64_t>(magnitude);
+        return test(field.first()) ? -value : value;
+    }
+
+    inline bool read_bool(const Nav_Bit_Field& field) const
+    {
+        return test(field.first());
+    }
+
+    //! Packed words, MSB first (the unused bits of the last word are zeros)
+    inline const uint64_t* data() const { return d_words.data(); }
+
+    static constexpr size_t num_words() { return (N_BITS + 63) / 64; }
+
+private:
+    std::array<uint64_t, (N_BITS + 63) / 64> d_words{};
+};
+
+#endif  // GNSS_SDR_NAV_BIT_FIELD_H
@@ -0,0 +1,209 @@
+/*!
+ * \file benchmark_crc.cc
+ * \brief Benchmark for the error detection codes of the navigation messages:
+ * CRC-24Q with boost::crc_optimal, libswiftcnav and slice-by-8 tables, and
+ * GLONASS Hamming code verification bit by bit and with word masks
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "GLONASS_L1_L2_CA.h"
+#include "GPS_CNAV.h"
+#include "Galileo_E1.h"
+#include "gnss_crc.h"
+#include <benchmark/benchmark.h>
+#include <boost/crc.hpp>
+#include <boost/dynamic_bitset.hpp>
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+#include "edc.h"
+}
+
+namespace
+{
+std::string random_bit_string(size_t n_bits)
+{
+    std::default_random_engine e(1234);
+    std::uniform_int_distribution<int> bit_dist(0, 1);
+    std::string bits(n_bits, '0');
+    for (auto& c : bits)
+        {
+            c = bit_dist(e) ? '1' : '0';
+        }
+    return bits;
+}
+
+
+// Packs a string of bits MSB first in bytes, padded with zeros at the end
+std::vector<uint8_t> left_aligned_bytes(const std::string& bits)
+{
+    std::vector<uint8_t> bytes((bits.size() + 7) / 8, 0);
+    for (size_t i = 0; i < bits.size(); i++)
+        {
+            if (bits[i] == '1')
+                {
+                    bytes[i / 8] |= static_cast<uint8_t>(0x80U >> (i % 8));
+                }
+        }
+    return bytes;
+}
+
+
+// Hamming code verification formerly done in Glonass_Gnav_Navigation_Message::CRC_test
+bool glonass_hamming_bitwise(const std::bitset<GLONASS_GNAV_STRING_BITS>& bits)
+{
+    std::vector<uint32_t> string_bits(GLONASS_GNAV_STRING_BITS);
+    for (size_t i = 0; i < string_bits.size(); i++)
+        {
+            string_bits[i] = static_cast<uint32_t>(bits[i]);
+        }
+    const std::vector<const std::vector<int32_t>*> indexes{&GLONASS_GNAV_CRC_I_INDEX, &GLONASS_GNAV_CRC_J_INDEX, &GLONASS_GNAV_CRC_K_INDEX, &GLONASS_GNAV_CRC_L_INDEX, &GLONASS_GNAV_CRC_M_INDEX, &GLONASS_GNAV_CRC_N_INDEX, &GLONASS_GNAV_CRC_P_INDEX};
+    int32_t sum_checks = 0;
+    for (size_t k = 0; k < indexes.size(); k++)
+        {
+            uint32_t sum_bits = 0;
+            for (const auto i : *indexes[k])
+                {
+                    sum_bits += string_bits[i - 1];
+                }
+            sum_checks += static_cast<int32_t>(string_bits[k] ^ (sum_bits % 2));
+        }
+    uint32_t sum_bits = 0;
+    uint32_t sum_hamming = 0;
+    for (const auto q : GLONASS_GNAV_CRC_Q_INDEX)
+        {
+            sum_bits += string_bits[q - 1];
+        }
+    for (int32_t q = 0; q < 8; q++)
+        {
+            sum_hamming += string_bits[q];
+        }
+    const uint32_t c_sigma = (sum_hamming % 2) ^ (sum_bits % 2);
+    return (sum_checks == 0 and c_sigma == 0) or (sum_checks == 1 and c_sigma == 1);
+}
+}  // namespace
+
+
+// Galileo I/NAV page: std::bitset converted to bytes and boost::crc_optimal
+void bm_inav_boost(benchmark::State& state)
+{
+    const std::bitset<GALILEO_DATA_FRAME_BITS> bits(random_bit_string(GALILEO_DATA_FRAME_BITS));
+    while (state.KeepRunning())
+        {
+            boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+            boost::dynamic_bitset<unsigned char> frame_bits(std::string(bits.to_string()));
+            std::vector<unsigned char> bytes;
+            boost::to_block_range(frame_bits, std::back_inserter(bytes));
+            std::reverse(bytes.begin(), bytes.end());
+            crc.process_bytes(bytes.data(), GALILEO_DATA_FRAME_BYTES);
+            benchmark::DoNotOptimize(crc.checksum());
+        }
+}
+
+
+// Galileo I/NAV page: packed words and slice-by-8 tables
+void bm_inav_packed(benchmark::State& state)
+{
+    const Nav_Message_Bits<GALILEO_DATA_FRAME_BITS> bits(random_bit_string(GALILEO_DATA_FRAME_BITS));
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(compute_crc24q(bits));
+        }
+}
+
+
+// GPS CNAV message: libswiftcnav, one byte per step
+void bm_cnav_libswiftcnav(benchmark::State& state)
+{
+    const std::vector<uint8_t> bytes = left_aligned_bytes(random_bit_string(GPS_CNAV_DATA_PAGE_BITS));
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(crc24q_bits(0, bytes.data(), GPS_CNAV_DATA_PAGE_BITS - 24, false));
+        }
+}
+
+
+// GPS CNAV message: packed words and slice-by-8 tables
+void bm_cnav_packed(benchmark::State& state)
+{
+    const Nav_Message_Bits<GPS_CNAV_DATA_PAGE_BITS> bits(random_bit_string(GPS_CNAV_DATA_PAGE_BITS));
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(compute_crc24q_bits(bits.data(), GPS_CNAV_DATA_PAGE_BITS - 24));
+        }
+}
+
+
+// SBAS message (250 bits in 32 bytes): boost::crc_optimal
+void bm_sbas_boost(benchmark::State& state)
+{
+    const std::vector<uint8_t> bytes = left_aligned_bytes(random_bit_string(250));
+    while (state.KeepRunning())
+        {
+            boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+            crc.process_bytes(bytes.data(), bytes.size());
+            benchmark::DoNotOptimize(crc.checksum());
+        }
+}
+
+
+// SBAS message (250 bits in 32 bytes): slice-by-8 tables
+void bm_sbas_slice8(benchmark::State& state)
+{
+    const std::vector<uint8_t> bytes = left_aligned_bytes(random_bit_string(250));
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(compute_crc24q(bytes.data(), bytes.size()));
+        }
+}
+
+
+void bm_glonass_hamming_bitwise(benchmark::State& state)
+{
+    const std::bitset<GLONASS_GNAV_STRING_BITS> bits(random_bit_string(GLONASS_GNAV_STRING_BITS));
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(glonass_hamming_bitwise(bits));
+        }
+}
+
+
+void bm_glonass_hamming_packed(benchmark::State& state)
+{
+    const Nav_Message_Bits<GLONASS_GNAV_STRING_BITS> bits(random_bit_string(GLONASS_GNAV_STRING_BITS));
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(glonass_gnav_hamming_check(bits));
+        }
+}
+
+
+BENCHMARK(bm_inav_boost);
+BENCHMARK(bm_inav_packed);
+BENCHMARK(bm_cnav_libswiftcnav);
+BENCHMARK(bm_cnav_packed);
+BENCHMARK(bm_sbas_boost);
+BENCHMARK(bm_sbas_slice8);
+BENCHMARK(bm_glonass_hamming_bitwise);
+BENCHMARK(bm_glonass_hamming_packed);
+BENCHMARK_MAIN();
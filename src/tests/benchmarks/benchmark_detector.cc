@@ -19,6 +19,7 @@
  */
 
 #include "GPS_L1_CA.h"
+#include "preamble_detector.h"
 #include <benchmark/benchmark.h>
 #include <algorithm>  // for std::generate
 #include <array>
@@ -59,6 +60,7 @@ void bm_forloop(benchmark::State& state)
                             corr_value += d_preamble_samples[i];
                         }
                 }
+            benchmark::DoNotOptimize(corr_value);
         }
 }
 
@@ -83,6 +85,7 @@ void bm_accumulate(benchmark::State& state)
                 d_symbol_history.end(),
                 0,
                 [&d_preamble_samples, n = 0](float a, float b) mutable { return (b > 0.0 ? a + d_preamble_samples[n++] : a - d_preamble_samples[n++]); });
+            benchmark::DoNotOptimize(corr_value);
         }
 }
 
@@ -113,6 +116,7 @@ void bm_inner_product(benchmark::State& state)
                 std::plus<int32_t>(),
 #endif
                 [](float a, int32_t b) { return (std::signbit(a) ? -b : b); });
+            benchmark::DoNotOptimize(corr_value);
         }
 }
 
@@ -140,6 +144,7 @@ void bm_transform_reduce(benchmark::State& state)
                 0,
                 std::plus<>(),
                 [](auto a, auto b) { return (std::signbit(a) ? -b : b); });
+            benchmark::DoNotOptimize(corr_value);
         }
 }
 #endif
@@ -170,14 +175,74 @@ void bm_transform_reduce_policy(benchmark::State& state)
                 0,
                 std::plus<>(),
                 [](auto a, auto b) { return (std::signbit(a) ? -b : b); });
+            benchmark::DoNotOptimize(corr_value);
         }
 }
 #endif
 
 
+void bm_packed_register(benchmark::State& state)
+{
+    std::vector<float> d_symbol_history(GPS_CA_PREAMBLE_LENGTH_SYMBOLS, 0.0);
+    std::array<int32_t, GPS_CA_PREAMBLE_LENGTH_SYMBOLS> d_preamble_samples{};
+
+    // fill the inputs
+    std::random_device rd;
+    std::default_random_engine e2(rd());
+    std::uniform_real_distribution<> dist(-1.0, 1.0);
+    std::generate(d_symbol_history.begin(), d_symbol_history.end(), [&dist, &e2]() { return dist(e2); });
+
+    std::generate(d_preamble_samples.begin(), d_preamble_samples.end(), [n = 0]() mutable { return (GPS_CA_PREAMBLE_SYMBOLS_STR[n++] == '1' ? 1 : -1); });
+
+    Preamble_Detector detector(d_preamble_samples.data(), GPS_CA_PREAMBLE_LENGTH_SYMBOLS);
+    for (auto symbol : d_symbol_history)
+        {
+            detector.push(symbol);
+        }
+    size_t n = 0;
+    while (state.KeepRunning())
+        {
+            // a new symbol slides into the window, then the whole window is correlated
+            detector.push(d_symbol_history[n++ % d_symbol_history.size()]);
+            int32_t corr_value = detector.correlation();
+            benchmark::DoNotOptimize(corr_value);
+        }
+}
+
+
+void bm_packed_soft(benchmark::State& state)
+{
+    std::vector<float> d_symbol_history(GPS_CA_PREAMBLE_LENGTH_SYMBOLS, 0.0);
+    std::array<int32_t, GPS_CA_PREAMBLE_LENGTH_SYMBOLS> d_preamble_samples{};
+
+    // fill the inputs
+    std::random_device rd;
+    std::default_random_engine e2(rd());
+    std::uniform_real_distribution<> dist(-1.0, 1.0);
+    std::generate(d_symbol_history.begin(), d_symbol_history.end(), [&dist, &e2]() { return dist(e2); });
+
+    std::generate(d_preamble_samples.begin(), d_preamble_samples.end(), [n = 0]() mutable { return (GPS_CA_PREAMBLE_SYMBOLS_STR[n++] == '1' ? 1 : -1); });
+
+    Preamble_Detector detector(d_preamble_samples.data(), GPS_CA_PREAMBLE_LENGTH_SYMBOLS);
+    for (auto symbol : d_symbol_history)
+        {
+            detector.push(symbol);
+        }
+    size_t n = 0;
+    while (state.KeepRunning())
+        {
+            detector.push(d_symbol_history[n++ % d_symbol_history.size()]);
+            float corr_value = detector.soft_correlation();
+            benchmark::DoNotOptimize(corr_value);
+        }
+}
+
+
 BENCHMARK(bm_forloop);
 BENCHMARK(bm_accumulate);
 BENCHMARK(bm_inner_product);
+BENCHMARK(bm_packed_register);
+BENCHMARK(bm_packed_soft);
 #if COMPILER_HAS_STD_TRANSFORM_REDUCE
 BENCHMARK(bm_transform_reduce);
 #endif
@@ -0,0 +1,203 @@
+/*!
+ * \file benchmark_gnss_synchro.cc
+ * \brief Benchmark for the per-epoch copies of Gnss_Synchro objects, with
+ * the trivially copyable class and with member-wise copy operators
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr int32_t N_CHANNELS = 60;
+
+// Former Gnss_Synchro class, with user-defined copy and move operators
+class Gnss_Synchro_Memberwise
+{
+public:
+    Gnss_Synchro_Memberwise() = default;
+    ~Gnss_Synchro_Memberwise() = default;
+
+    char System{};
+    char Signal[3]{};
+    uint32_t PRN{};
+    int32_t Channel_ID{};
+    double Acq_delay_samples{};
+    double Acq_doppler_hz{};
+    uint64_t Acq_samplestamp_samples{};
+    uint32_t Acq_doppler_step{};
+    int64_t fs{};
+    double Prompt_I{};
+    double Prompt_Q{};
+    double CN0_dB_hz{};
+    double Carrier_Doppler_hz{};
+    double Carrier_phase_rads{};
+    double Code_phase_samples{};
+    uint64_t Tracking_sample_counter{};
+    int32_t correlation_length_ms{};
+    uint32_t TOW_at_current_symbol_ms{};
+    double Pseudorange_m{};
+    double RX_time{};
+    double interp_TOW_ms{};
+    bool Flag_valid_acquisition{};
+    bool Flag_valid_symbol_output{};
+    bool Flag_valid_word{};
+    bool Flag_valid_pseudorange{};
+
+    Gnss_Synchro_Memberwise(const Gnss_Synchro_Memberwise& other) noexcept
+    {
+        *this = other;
+    };
+
+    Gnss_Synchro_Memberwise& operator=(const Gnss_Synchro_Memberwise& rhs) noexcept
+    {
+        if (this != &rhs)
+            {
+                this->System = rhs.System;
+                this->Signal[0] = rhs.Signal[0];
+                this->Signal[1] = rhs.Signal[1];
+                this->Signal[2] = rhs.Signal[2];
+                this->PRN = rhs.PRN;
+                this->Channel_ID = rhs.Channel_ID;
+                this->Acq_delay_samples = rhs.Acq_delay_samples;
+                this->Acq_doppler_hz = rhs.Acq_doppler_hz;
+                this->Acq_samplestamp_samples = rhs.Acq_samplestamp_samples;
+                this->Acq_doppler_step = rhs.Acq_doppler_step;
+                this->fs = rhs.fs;
+                this->Prompt_I = rhs.Prompt_I;
+                this->Prompt_Q = rhs.Prompt_Q;
+                this->CN0_dB_hz = rhs.CN0_dB_hz;
+                this->Carrier_Doppler_hz = rhs.Carrier_Doppler_hz;
+                this->Carrier_phase_rads = rhs.Carrier_phase_rads;
+                this->Code_phase_samples = rhs.Code_phase_samples;
+                this->Tracking_sample_counter = rhs.Tracking_sample_counter;
+                this->correlation_length_ms = rhs.correlation_length_ms;
+                this->TOW_at_current_symbol_ms = rhs.TOW_at_current_symbol_ms;
+                this->Pseudorange_m = rhs.Pseudorange_m;
+                this->RX_time = rhs.RX_time;
+                this->interp_TOW_ms = rhs.interp_TOW_ms;
+                this->Flag_valid_acquisition = rhs.Flag_valid_acquisition;
+                this->Flag_valid_symbol_output = rhs.Flag_valid_symbol_output;
+                this->Flag_valid_word = rhs.Flag_valid_word;
+                this->Flag_valid_pseudorange = rhs.Flag_valid_pseudorange;
+            }
+        return *this;
+    };
+
+    Gnss_Synchro_Memberwise(Gnss_Synchro_Memberwise&& other) noexcept
+    {
+        *this = std::move(other);
+    };
+
+    Gnss_Synchro_Memberwise& operator=(Gnss_Synchro_Memberwise&& other) noexcept
+    {
+        if (this != &other)
+            {
+                *this = static_cast<const Gnss_Synchro_Memberwise&>(other);
+            }
+        return *this;
+    };
+};
+
+
+template <typename T>
+std::vector<T> make_epoch()
+{
+    std::vector<T> epoch(N_CHANNELS);
+    for (int32_t ch = 0; ch < N_CHANNELS; ch++)
+        {
+            epoch[ch].Channel_ID = ch;
+            epoch[ch].PRN = static_cast<uint32_t>(ch % 32 + 1);
+            epoch[ch].Pseudorange_m = 2.0e7 + ch;
+            epoch[ch].Flag_valid_pseudorange = true;
+        }
+    return epoch;
+}
+
+
+// Observables to PVT: the epoch is read from the input buffers and copied to a vector
+template <typename T>
+void copy_from_buffers(benchmark::State& state)
+{
+    const std::vector<T> buffer = make_epoch<T>();
+    std::vector<T> epoch(N_CHANNELS);
+    while (state.KeepRunning())
+        {
+            for (int32_t ch = 0; ch < N_CHANNELS; ch++)
+                {
+                    epoch[ch] = buffer[ch];
+                }
+            benchmark::DoNotOptimize(epoch.data());
+            benchmark::ClobberMemory();
+        }
+}
+
+
+// PVT: the valid observables of the epoch are inserted in a map indexed by channel
+template <typename T>
+void insert_in_map(benchmark::State& state)
+{
+    const std::vector<T> epoch = make_epoch<T>();
+    while (state.KeepRunning())
+        {
+            std::map<int, T> observables_map;
+            for (int32_t ch = 0; ch < N_CHANNELS; ch++)
+                {
+                    if (epoch[ch].Flag_valid_pseudorange)
+                        {
+                            observables_map.insert(std::pair<int, T>(epoch[ch].Channel_ID, epoch[ch]));
+                        }
+                }
+            benchmark::DoNotOptimize(observables_map);
+        }
+}
+}  // namespace
+
+
+void bm_copy_from_buffers_memberwise(benchmark::State& state)
+{
+    copy_from_buffers<Gnss_Synchro_Memberwise>(state);
+}
+
+
+void bm_copy_from_buffers_trivial(benchmark::State& state)
+{
+    copy_from_buffers<Gnss_Synchro>(state);
+}
+
+
+void bm_insert_in_map_memberwise(benchmark::State& state)
+{
+    insert_in_map<Gnss_Synchro_Memberwise>(state);
+}
+
+
+void bm_insert_in_map_trivial(benchmark::State& state)
+{
+    insert_in_map<Gnss_Synchro>(state);
+}
+
+
+BENCHMARK(bm_copy_from_buffers_memberwise);
+BENCHMARK(bm_copy_from_buffers_trivial);
+BENCHMARK(bm_insert_in_map_memberwise);
+BENCHMARK(bm_insert_in_map_trivial);
+BENCHMARK_MAIN();
@@ -0,0 +1,132 @@
+/*!
+ * \file benchmark_kalman_filter.cc
+ * \brief Benchmark for the per-epoch cost of the Kalman carrier tracking
+ * filter, comparing dynamically sized and compile-time sized matrices
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "kalman_carrier_filter.h"
+#include <armadillo>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr int64_t n_epochs = 1000;
+
+std::vector<double> generate_phase_errors()
+{
+    std::vector<double> phase_errors(n_epochs);
+    std::random_device r;
+    std::default_random_engine e(r());
+    std::normal_distribution<double> normal_dist(0.0, 0.1);
+    for (auto& err : phase_errors)
+        {
+            err = normal_dist(e);
+        }
+    return phase_errors;
+}
+}  // namespace
+
+
+// Former implementation, with dynamically sized Armadillo matrices
+void bm_dynamic_matrices(benchmark::State& state)
+{
+    const auto order = static_cast<uint32_t>(state.range(0));
+    const double T = GPS_L1_CA_CODE_PERIOD_S;
+    const std::vector<double> phase_errors = generate_phase_errors();
+
+    arma::mat kf_P_x = arma::eye(order, order);
+    arma::mat kf_F = arma::eye(order, order);
+    kf_F(0, 1) = GPS_TWO_PI * T;
+    arma::mat kf_Q = arma::zeros(order, order);
+    kf_Q(0, 0) = std::pow(T, 4);
+    kf_Q(1, 1) = T;
+    if (order == 3)
+        {
+            kf_F(0, 2) = 0.5 * GPS_TWO_PI * T * T;
+            kf_F(1, 2) = T;
+            kf_Q(2, 2) = T;
+        }
+    arma::mat kf_H = arma::zeros(1, order);
+    kf_H(0, 0) = 1.0;
+    arma::mat kf_R = arma::ones(1, 1) * 0.01;
+    arma::colvec kf_x = arma::zeros(order, 1);
+    arma::colvec kf_y = arma::zeros(1, 1);
+    arma::colvec kf_x_pre;
+    arma::mat kf_P_x_pre;
+    arma::mat kf_P_y;
+    arma::mat kf_K;
+
+    while (state.KeepRunning())
+        {
+            for (int64_t i = 0; i < n_epochs; i++)
+                {
+                    kf_x_pre = kf_F * kf_x;
+                    kf_P_x_pre = kf_F * kf_P_x * kf_F.t() + kf_Q;
+                    kf_y(0) = phase_errors[i];
+                    kf_P_y = kf_H * kf_P_x_pre * kf_H.t() + kf_R;
+                    kf_K = (kf_P_x_pre * kf_H.t()) * arma::inv(kf_P_y);
+                    kf_x = kf_x_pre + kf_K * kf_y;
+                    kf_P_x = (arma::eye(size(kf_P_x_pre)) - kf_K * kf_H) * kf_P_x_pre;
+                }
+            benchmark::DoNotOptimize(kf_x);
+        }
+    state.SetItemsProcessed(state.iterations() * n_epochs);
+}
+
+
+// Current implementation, with compile-time sized Armadillo matrices
+template <uint32_t N>
+void bm_fixed_matrices(benchmark::State& state)
+{
+    const double T = GPS_L1_CA_CODE_PERIOD_S;
+    const std::vector<double> phase_errors = generate_phase_errors();
+
+    Kalman_Carrier_Filter<N> kf;
+    typename Kalman_Carrier_Filter<N>::state_vec q_diag;
+    q_diag.fill(T);
+    q_diag(0) = std::pow(T, 4);
+    kf.set_model(T, q_diag);
+    typename Kalman_Carrier_Filter<N>::state_vec p_diag;
+    p_diag.ones();
+    kf.set_initial_covariance(p_diag);
+    typename Kalman_Carrier_Filter<N>::state_vec x0;
+    x0.zeros();
+    kf.reset(x0);
+    const double kf_R = 0.01;
+
+    while (state.KeepRunning())
+        {
+            for (int64_t i = 0; i < n_epochs; i++)
+                {
+                    kf.predict();
+                    kf.update(phase_errors[i], kf.predicted_measurement_variance() + kf_R);
+                }
+            benchmark::DoNotOptimize(kf.state());
+        }
+    state.SetItemsProcessed(state.iterations() * n_epochs);
+}
+
+
+BENCHMARK(bm_dynamic_matrices)->Arg(2)->Arg(3);
+BENCHMARK_TEMPLATE(bm_fixed_matrices, 2);
+BENCHMARK_TEMPLATE(bm_fixed_matrices, 3);
+BENCHMARK_MAIN();
@@ -0,0 +1,137 @@
+/*!
+ * \file benchmark_nav_fields.cc
+ * \brief Benchmark for the extraction of navigation message fields, from a
+ * std::bitset read bit by bit and from bits packed in 64-bit words
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "Galileo_E1.h"
+#include "nav_bit_field.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <random>
+
+namespace
+{
+// GPS L1 C/A subframe 2 and 3 ephemeris fields
+const std::array<Nav_Bit_Field, 15> GPS_FIELDS{{C_RS, DELTA_N, M_0, C_UC, ECCENTRICITY, C_US, SQRT_A, T_OE, C_IC, OMEGA_0, C_IS, I_0, C_RC, OMEGA, OMEGA_DOT}};
+
+// Galileo I/NAV word type 1 to 3 fields
+const std::array<Nav_Bit_Field, 12> GALILEO_FIELDS{{IOD_NAV_1_BIT, T0_E_1_BIT, M0_1_BIT, E_1_BIT, A_1_BIT, OMEGA_0_2_BIT, I_0_2_BIT, OMEGA_2_BIT, I_DOT_2_BIT, OMEGA_DOT_3_BIT, DELTA_N_3_BIT, C_UC_3_BIT}};
+
+
+template <size_t N>
+std::bitset<N> random_bits()
+{
+    std::default_random_engine e(1234);
+    std::uniform_int_distribution<int> bit_dist(0, 1);
+    std::bitset<N> bits;
+    for (size_t i = 0; i < N; i++)
+        {
+            bits[i] = bit_dist(e);
+        }
+    return bits;
+}
+
+
+// Bit by bit loop formerly used by the navigation message parsers
+template <size_t N>
+int64_t read_bitset_signed(const std::bitset<N>& bits, const Nav_Bit_Field& field)
+{
+    int64_t value = bits[N - field.first()] ? -1LL : 0LL;
+    for (int32_t i = 0; i < field.num_slices(); i++)
+        {
+            for (int32_t j = 0; j < field.slice(i).length; j++)
+                {
+                    value *= 2;
+                    value &= 0xFFFFFFFFFFFFFFFE;
+                    if (bits[N - field.slice(i).first - j] == 1)
+                        {
+                            value += 1;
+                        }
+                }
+        }
+    return value;
+}
+
+
+template <size_t N, size_t M>
+void bm_bitset(benchmark::State& state, const std::array<Nav_Bit_Field, M>& fields)
+{
+    const std::bitset<N> bits = random_bits<N>();
+    while (state.KeepRunning())
+        {
+            int64_t sum = 0;
+            for (const auto& field : fields)
+                {
+                    sum += read_bitset_signed(bits, field);
+                }
+            benchmark::DoNotOptimize(sum);
+        }
+}
+
+
+template <size_t N, size_t M>
+void bm_packed(benchmark::State& state, const std::array<Nav_Bit_Field, M>& fields)
+{
+    const std::bitset<N> bits = random_bits<N>();
+    while (state.KeepRunning())
+        {
+            // packing is part of the decoding of each received page
+            const Nav_Message_Bits<N> packed(bits);
+            int64_t sum = 0;
+            for (const auto& field : fields)
+                {
+                    sum += packed.read_signed(field);
+                }
+            benchmark::DoNotOptimize(sum);
+        }
+}
+}  // namespace
+
+
+void bm_gps_bitset(benchmark::State& state)
+{
+    bm_bitset<GPS_SUBFRAME_BITS>(state, GPS_FIELDS);
+}
+
+
+void bm_gps_packed(benchmark::State& state)
+{
+    bm_packed<GPS_SUBFRAME_BITS>(state, GPS_FIELDS);
+}
+
+
+void bm_galileo_bitset(benchmark::State& state)
+{
+    bm_bitset<GALILEO_DATA_JK_BITS>(state, GALILEO_FIELDS);
+}
+
+
+void bm_galileo_packed(benchmark::State& state)
+{
+    bm_packed<GALILEO_DATA_JK_BITS>(state, GALILEO_FIELDS);
+}
+
+
+BENCHMARK(bm_gps_bitset);
+BENCHMARK(bm_gps_packed);
+BENCHMARK(bm_galileo_bitset);
+BENCHMARK(bm_galileo_packed);
+BENCHMARK_MAIN();
@@ -0,0 +1,290 @@
+/*!
+ * \file benchmark_rtklib_matrix.cc
+ * \brief Benchmark for the matrix operations of an epoch of the RTKLIB
+ * positioning modes, comparing the small matrix kernels with BLAS and LAPACK
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "rtklib_rtkcmn.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Matrix product and inverse used by lsq_impl() and filter_impl()
+struct Small_Kernels
+{
+    static void matmul(const char *tr, int n, int k, int m, double alpha, const double *A, const double *B, double beta, double *C)
+    {
+        ::matmul(tr, n, k, m, alpha, A, B, beta, C);
+    }
+    static int matinv(double *A, int n) { return ::matinv(A, n); }
+};
+
+
+// Former implementation, always calling BLAS and LAPACK
+struct Blas_Kernels
+{
+    static void matmul(const char *tr, int n, int k, int m, double alpha, const double *A, const double *B, double beta, double *C)
+    {
+        ::matmul_blas(tr, n, k, m, alpha, A, B, beta, C);
+    }
+    static int matinv(double *A, int n) { return ::matinv_lapack(A, n); }
+};
+
+
+std::vector<double> random_matrix(int n, int m)
+{
+    std::default_random_engine e(1234);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> A(n * m);
+    for (auto &a : A)
+        {
+            a = dist(e);
+        }
+    return A;
+}
+
+
+// symmetric positive definite n x n matrix
+std::vector<double> random_covariance(int n)
+{
+    const std::vector<double> H = random_matrix(n, n);
+    std::vector<double> P(n * n);
+    matmul_blas("NT", n, n, n, 1.0, H.data(), H.data(), 0.0, P.data());
+    for (int i = 0; i < n; i++)
+        {
+            P[i + i * n] += 1.0;
+        }
+    return P;
+}
+
+
+// same as lsq() of rtklib_rtkcmn.cc
+template <typename Kernels>
+int lsq_impl(const double *A, const double *y, int n, int m, double *x, double *Q, double *Ay)
+{
+    Kernels::matmul("NN", n, 1, m, 1.0, A, y, 0.0, Ay);
+    Kernels::matmul("NT", n, n, m, 1.0, A, A, 0.0, Q);
+    const int info = Kernels::matinv(Q, n);
+    if (!info)
+        {
+            Kernels::matmul("NN", n, 1, n, 1.0, Q, Ay, 0.0, x);
+        }
+    return info;
+}
+
+
+// same as filter_() of rtklib_rtkcmn.cc, with the buffers allocated by the caller
+template <typename Kernels>
+int filter_impl(const double *x, const double *P, const double *H, const double *v, const double *R, int n, int m,
+    double *xp, double *Pp, double *F, double *Q, double *K, double *I)
+{
+    matcpy(Q, R, m, m);
+    matcpy(xp, x, n, 1);
+    for (int i = 0; i < n * n; i++)
+        {
+            I[i] = 0.0;
+        }
+    for (int i = 0; i < n; i++)
+        {
+            I[i + i * n] = 1.0;
+        }
+    Kernels::matmul("NN", n, m, n, 1.0, P, H, 0.0, F);
+    Kernels::matmul("TN", m, m, n, 1.0, H, F, 1.0, Q);
+    const int info = Kernels::matinv(Q, m);
+    if (!info)
+        {
+            Kernels::matmul("NN", n, m, m, 1.0, F, Q, 0.0, K);
+            Kernels::matmul("NN", n, 1, m, 1.0, K, v, 1.0, xp);
+            Kernels::matmul("NT", n, n, m, -1.0, K, H, 1.0, I);
+            Kernels::matmul("NN", n, n, n, 1.0, I, P, 0.0, Pp);
+        }
+    return info;
+}
+
+
+/*
+ * Single point positioning epoch, as in rtklib_pntpos.cc: iterations of the
+ * position and clocks least squares (7 parameters: position and the clocks
+ * of the systems), the velocity least squares, the DOPs, and the conversion
+ * of each line of sight to local coordinates
+ */
+template <typename Kernels>
+void spp_epoch(int nsat, const std::vector<double> &H, const std::vector<double> &v, std::vector<double> &work)
+{
+    const int nv = nsat + 3;  // measurements plus constraints of the unused clocks
+    double dx[7];
+    double Q[49];
+    for (int iter = 0; iter < 5; iter++)
+        {
+            lsq_impl<Kernels>(H.data(), v.data(), 7, nv, dx, Q, work.data());
+        }
+    double dv[4];
+    double Qv[16];
+    lsq_impl<Kernels>(H.data(), v.data(), 4, nsat, dv, Qv, work.data());
+    double Qd[16];
+    Kernels::matmul("NT", 4, 4, nsat, 1.0, H.data(), H.data(), 0.0, Qd);
+    Kernels::matinv(Qd, 4);
+    const double E[9] = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9};
+    double enu[3];
+    for (int i = 0; i < nsat; i++)
+        {
+            Kernels::matmul("NN", 3, 1, 3, 1.0, E, H.data() + 3 * i, 0.0, enu);
+        }
+    benchmark::DoNotOptimize(dx);
+    benchmark::DoNotOptimize(dv);
+    benchmark::DoNotOptimize(Qd);
+    benchmark::DoNotOptimize(enu);
+}
+
+
+/*
+ * Measurement update of a Kalman filter with nx active states and nv
+ * measurements, as done at each epoch by the PPP (rtklib_ppp.cc) and RTK
+ * (rtklib_rtkpos.cc) modes
+ */
+class Filter_Epoch
+{
+public:
+    Filter_Epoch(int nx, int nv) : d_nx(nx),
+                                   d_nv(nv),
+                                   d_P(random_covariance(nx)),
+                                   d_R(random_covariance(nv)),
+                                   d_H(random_matrix(nx, nv)),
+                                   d_x(random_matrix(nx, 1)),
+                                   d_v(random_matrix(nv, 1)),
+                                   d_xp(nx),
+                                   d_Pp(nx * nx),
+                                   d_F(nx * nv),
+                                   d_Q(nv * nv),
+                                   d_K(nx * nv),
+                                   d_I(nx * nx)
+    {
+    }
+
+    template <typename Kernels>
+    void run()
+    {
+        filter_impl<Kernels>(d_x.data(), d_P.data(), d_H.data(), d_v.data(), d_R.data(), d_nx, d_nv,
+            d_xp.data(), d_Pp.data(), d_F.data(), d_Q.data(), d_K.data(), d_I.data());
+        benchmark::DoNotOptimize(d_xp.data());
+        benchmark::DoNotOptimize(d_Pp.data());
+    }
+
+private:
+    int d_nx;
+    int d_nv;
+    std::vector<double> d_P;
+    std::vector<double> d_R;
+    std::vector<double> d_H;
+    std::vector<double> d_x;
+    std::vector<double> d_v;
+    std::vector<double> d_xp;
+    std::vector<double> d_Pp;
+    std::vector<double> d_F;
+    std::vector<double> d_Q;
+    std::vector<double> d_K;
+    std::vector<double> d_I;
+};
+}  // namespace
+
+
+template <typename Kernels>
+void bm_single_point_epoch(benchmark::State &state)
+{
+    const auto nsat = static_cast<int>(state.range(0));
+    const std::vector<double> H = random_matrix(7, nsat + 3);
+    const std::vector<double> v = random_matrix(nsat + 3, 1);
+    std::vector<double> work(7);
+    while (state.KeepRunning())
+        {
+            spp_epoch<Kernels>(nsat, H, v, work);
+        }
+}
+
+
+// PPP with ambiguities and slant ionospheric delays of nsat satellites, and
+// code and phase measurements: 5 + 2 * nsat states, 2 * nsat measurements
+template <typename Kernels>
+void bm_ppp_epoch(benchmark::State &state)
+{
+    const auto nsat = static_cast<int>(state.range(0));
+    Filter_Epoch epoch(5 + 2 * nsat, 2 * nsat);
+    while (state.KeepRunning())
+        {
+            epoch.run<Kernels>();
+        }
+}
+
+
+// Single frequency RTK: position and nsat ambiguities, code and phase
+// double differences: 3 + nsat states, 2 * (nsat - 1) measurements
+template <typename Kernels>
+void bm_rtk_epoch(benchmark::State &state)
+{
+    const auto nsat = static_cast<int>(state.range(0));
+    Filter_Epoch epoch(3 + nsat, 2 * (nsat - 1));
+    while (state.KeepRunning())
+        {
+            epoch.run<Kernels>();
+        }
+}
+
+
+template <typename Kernels>
+void bm_matmul(benchmark::State &state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    const std::vector<double> A = random_matrix(n, n);
+    const std::vector<double> B = random_matrix(n, n);
+    std::vector<double> C(n * n);
+    while (state.KeepRunning())
+        {
+            Kernels::matmul("NT", n, n, n, 1.0, A.data(), B.data(), 0.0, C.data());
+            benchmark::DoNotOptimize(C.data());
+        }
+}
+
+
+template <typename Kernels>
+void bm_matinv(benchmark::State &state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    const std::vector<double> P = random_covariance(n);
+    std::vector<double> Q(n * n);
+    while (state.KeepRunning())
+        {
+            Q = P;
+            Kernels::matinv(Q.data(), n);
+            benchmark::DoNotOptimize(Q.data());
+        }
+}
+
+
+BENCHMARK_TEMPLATE(bm_single_point_epoch, Blas_Kernels)->Arg(6)->Arg(12)->Arg(24);
+BENCHMARK_TEMPLATE(bm_single_point_epoch, Small_Kernels)->Arg(6)->Arg(12)->Arg(24);
+BENCHMARK_TEMPLATE(bm_ppp_epoch, Blas_Kernels)->Arg(6)->Arg(10);
+BENCHMARK_TEMPLATE(bm_ppp_epoch, Small_Kernels)->Arg(6)->Arg(10);
+BENCHMARK_TEMPLATE(bm_rtk_epoch, Blas_Kernels)->Arg(6)->Arg(12);
+BENCHMARK_TEMPLATE(bm_rtk_epoch, Small_Kernels)->Arg(6)->Arg(12);
+BENCHMARK_TEMPLATE(bm_matmul, Blas_Kernels)->DenseRange(2, 8, 2);
+BENCHMARK_TEMPLATE(bm_matmul, Small_Kernels)->DenseRange(2, 8, 2);
+BENCHMARK_TEMPLATE(bm_matinv, Blas_Kernels)->DenseRange(4, 24, 4);
+BENCHMARK_TEMPLATE(bm_matinv, Small_Kernels)->DenseRange(4, 24, 4);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,171 @@
+/*!
+ * \file benchmark_viterbi.cc
+ * \brief Benchmark for the K=7, r=1/2 Viterbi decoder used by the Galileo,
+ * CNAV and SBAS telemetry decoders
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "convolutional.h"
+#include "viterbi_decoder.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr int32_t KK = 7;
+constexpr int32_t nn = 2;
+constexpr int32_t mm = KK - 1;
+constexpr int32_t states = 1 << mm;
+constexpr int32_t inav_data_bits = 114;  // Galileo I/NAV page part, without tail bits
+
+std::vector<float> generate_encoded_page(int32_t nbits)
+{
+    std::array<int, 2> g_encoder{{121, 91}};
+    std::random_device r;
+    std::default_random_engine e(r());
+    std::uniform_int_distribution<int> bit_dist(0, 1);
+    std::normal_distribution<float> noise(0.0, 0.5);
+    std::vector<float> symbols;
+    int encoder_state = 0;
+    for (int32_t i = 0; i < nbits + mm; i++)
+        {
+            const int bit = i < nbits ? bit_dist(e) : 0;
+            int next_state;
+            const int out = nsc_enc_bit(&next_state, bit, encoder_state, g_encoder.data(), KK, nn);
+            encoder_state = next_state;
+            symbols.push_back(((out >> 1) & 1 ? 1.0F : -1.0F) + noise(e));
+            symbols.push_back((out & 1 ? 1.0F : -1.0F) + noise(e));
+        }
+    return symbols;
+}
+}  // namespace
+
+
+// Former implementation: scalar float add-compare-select, with the state
+// arrays allocated for every page
+void bm_scalar_viterbi(benchmark::State& state)
+{
+    std::array<int, 2> g_encoder{{121, 91}};
+    std::vector<int> out0(states);
+    std::vector<int> out1(states);
+    std::vector<int> state0(states);
+    std::vector<int> state1(states);
+    nsc_transit(out0.data(), state0.data(), 0, g_encoder.data(), KK, nn);
+    nsc_transit(out1.data(), state1.data(), 1, g_encoder.data(), KK, nn);
+    const std::vector<float> page = generate_encoded_page(inav_data_bits);
+
+    while (state.KeepRunning())
+        {
+            const int32_t LL = inav_data_bits;
+            std::vector<float> prev_section(states, -1e7);
+            std::vector<float> next_section(states, -1e7);
+            std::vector<int> prev_bit(states * (LL + mm), 0);
+            std::vector<int> prev_state(states * (LL + mm), 0);
+            std::vector<float> metric_c(1 << nn);
+            std::vector<int> bits(LL);
+            prev_section[0] = 0.0;
+            for (int32_t t = 0; t < LL + mm; t++)
+                {
+                    for (int32_t i = 0; i < (1 << nn); i++)
+                        {
+                            metric_c[i] = Gamma(&page[nn * t], i, nn);
+                        }
+                    for (int32_t s = 0; s < states; s++)
+                        {
+                            float metric = prev_section[s] + metric_c[out0[s]];
+                            if (metric > next_section[state0[s]])
+                                {
+                                    next_section[state0[s]] = metric;
+                                    prev_state[t * states + state0[s]] = s;
+                                    prev_bit[t * states + state0[s]] = 0;
+                                }
+                            metric = prev_section[s] + metric_c[out1[s]];
+                            if (metric > next_section[state1[s]])
+                                {
+                                    next_section[state1[s]] = metric;
+                                    prev_state[t * states + state1[s]] = s;
+                                    prev_bit[t * states + state1[s]] = 1;
+                                }
+                        }
+                    float max_val = next_section[0];
+                    for (int32_t s = 1; s < states; s++)
+                        {
+                            max_val = next_section[s] > max_val ? next_section[s] : max_val;
+                        }
+                    for (int32_t s = 0; s < states; s++)
+                        {
+                            prev_section[s] = next_section[s] - max_val;
+                            next_section[s] = -1e7;
+                        }
+                }
+            int s = 0;
+            for (int32_t t = LL + mm - 1; t >= LL; t--)
+                {
+                    s = prev_state[t * states + s];
+                }
+            for (int32_t t = LL - 1; t >= 0; t--)
+                {
+                    bits[t] = prev_bit[t * states + s];
+                    s = prev_state[t * states + s];
+                }
+            benchmark::DoNotOptimize(bits.data());
+        }
+    state.SetItemsProcessed(state.iterations() * inav_data_bits);
+}
+
+
+// Current implementation: bit-packed SIMD engine with preallocated trellis
+void bm_viterbi_decoder_block(benchmark::State& state)
+{
+    Viterbi_Decoder decoder({{121, 91}}, inav_data_bits + mm);
+    const std::vector<float> page = generate_encoded_page(inav_data_bits);
+    std::vector<int32_t> bits(inav_data_bits);
+
+    while (state.KeepRunning())
+        {
+            decoder.decode_block(page.data(), bits.data(), inav_data_bits);
+            benchmark::DoNotOptimize(bits.data());
+        }
+    state.SetItemsProcessed(state.iterations() * inav_data_bits);
+}
+
+
+// Continuous decoding, as done by the SBAS telemetry decoder
+void bm_viterbi_decoder_continuous(benchmark::State& state)
+{
+    const int32_t block_bits = 30;
+    const int32_t traceback_depth = 5 * KK;
+    Viterbi_Decoder decoder({{121, 91}}, traceback_depth + block_bits);
+    const std::vector<float> page = generate_encoded_page(block_bits);
+    const std::vector<double> symbols(page.begin(), page.begin() + 2 * block_bits);
+    std::vector<int32_t> bits(block_bits);
+    int32_t nbits_decoded = 0;
+
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(decoder.decode_continuous(symbols.data(), traceback_depth, bits.data(), block_bits, nbits_decoded));
+        }
+    state.SetItemsProcessed(state.iterations() * block_bits);
+}
+
+
+BENCHMARK(bm_scalar_viterbi);
+BENCHMARK(bm_viterbi_decoder_block);
+BENCHMARK(bm_viterbi_decoder_continuous);
+BENCHMARK_MAIN();
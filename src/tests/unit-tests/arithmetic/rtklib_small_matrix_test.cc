@@ -0,0 +1,144 @@
+/*!
+ * \file rtklib_small_matrix_test.cc
+ * \brief Tests for the small matrix kernels of RTKLIB against BLAS and LAPACK
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "rtklib_rtkcmn.h"
+#include "rtklib_small_matrix.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+// calls the small matrix kernels whatever the size of the matrices
+void matmul_small_kernels(const char* tr, int n, int k, int m, double alpha, const double* A, const double* B, double beta, double* C)
+{
+    if (tr[0] == 'T')
+        {
+            if (tr[1] == 'T')
+                {
+                    matmul_small_dispatch<true, true>(n, k, m, alpha, A, B, beta, C);
+                }
+            else
+                {
+                    matmul_small_dispatch<true, false>(n, k, m, alpha, A, B, beta, C);
+                }
+        }
+    else
+        {
+            if (tr[1] == 'T')
+                {
+                    matmul_small_dispatch<false, true>(n, k, m, alpha, A, B, beta, C);
+                }
+            else
+                {
+                    matmul_small_dispatch<false, false>(n, k, m, alpha, A, B, beta, C);
+                }
+        }
+}
+}  // namespace
+
+
+TEST(RtklibSmallMatrixTest, MatmulMatchesBlas)
+{
+    std::default_random_engine e(1234);
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+    // fixed size kernels, and generic kernel with and without blocks of four dot products
+    const std::vector<std::vector<int>> sizes = {{3, 1, 3}, {3, 3, 3}, {4, 4, 4}, {2, 2, 2}, {4, 4, 12}, {7, 1, 15}, {7, 7, 15}, {21, 21, 21}};
+    for (const auto& size : sizes)
+        {
+            const int n = size[0];
+            const int k = size[1];
+            const int m = size[2];
+            for (const char* tr : {"NN", "NT", "TN", "TT"})
+                {
+                    std::vector<double> A(n * m);
+                    std::vector<double> B(m * k);
+                    std::vector<double> C(n * k);
+                    for (auto& a : A)
+                        {
+                            a = dist(e);
+                        }
+                    for (auto& b : B)
+                        {
+                            b = dist(e);
+                        }
+                    for (auto& c : C)
+                        {
+                            c = dist(e);
+                        }
+                    for (const double beta : {0.0, 1.0, -0.5})
+                        {
+                            std::vector<double> C_small = C;
+                            std::vector<double> C_matmul = C;
+                            std::vector<double> C_blas = C;
+                            matmul_small_kernels(tr, n, k, m, 1.5, A.data(), B.data(), beta, C_small.data());
+                            matmul(tr, n, k, m, 1.5, A.data(), B.data(), beta, C_matmul.data());
+                            matmul_blas(tr, n, k, m, 1.5, A.data(), B.data(), beta, C_blas.data());
+                            for (int i = 0; i < n * k; i++)
+                                {
+                                    ASSERT_NEAR(C_small[i], C_blas[i], 1e-9) << tr << " " << n << "x" << k << "x" << m << " beta " << beta;
+                                    ASSERT_NEAR(C_matmul[i], C_blas[i], 1e-9) << tr << " " << n << "x" << k << "x" << m << " beta " << beta;
+                                }
+                        }
+                }
+        }
+}
+
+
+TEST(RtklibSmallMatrixTest, MatinvMatchesLapack)
+{
+    std::default_random_engine e(1234);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (int n = 1; n <= SMALL_MATINV_MAX_N + 2; n++)
+        {
+            // symmetric positive definite, as the normal and innovation matrices
+            std::vector<double> H(n * n);
+            for (auto& h : H)
+                {
+                    h = dist(e);
+                }
+            std::vector<double> Q(n * n);
+            matmul_blas("NT", n, n, n, 1.0, H.data(), H.data(), 0.0, Q.data());
+            for (int i = 0; i < n; i++)
+                {
+                    Q[i + i * n] += 0.1;
+                }
+            std::vector<double> Q_small = Q;
+            std::vector<double> Q_lapack = Q;
+            ASSERT_EQ(n <= SMALL_MATINV_MAX_N ? matinv_small(Q_small.data(), n) : matinv(Q_small.data(), n), 0);
+            ASSERT_EQ(matinv_lapack(Q_lapack.data(), n), 0);
+            for (int i = 0; i < n * n; i++)
+                {
+                    ASSERT_NEAR(Q_small[i], Q_lapack[i], 1e-8 * (1.0 + std::abs(Q_lapack[i]))) << "n = " << n;
+                }
+        }
+
+    // a zero leading element needs a row exchange
+    double A[9] = {0.0, 2.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 4.0};
+    ASSERT_EQ(matinv(A, 3), 0);
+    const double expected[9] = {0.0, 1.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.0, 0.25};
+    for (int i = 0; i < 9; i++)
+        {
+            EXPECT_DOUBLE_EQ(A[i], expected[i]);
+        }
+
+    double singular[4] = {1.0, 2.0, 2.0, 4.0};
+    EXPECT_GT(matinv(singular, 2), 0);
+}
@@ -0,0 +1,160 @@
+/*!
+ * \file gnss_synchro_udp_sink_test.cc
+ * \brief Tests for the UDP monitor sinks and their I/O thread
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "async_udp_sink.h"
+#include "gnss_synchro_udp_sink.h"
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/asio.hpp>
+#include <boost/serialization/vector.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <future>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+// UDP socket on an ephemeral port of the loopback interface
+class Udp_Test_Receiver
+{
+public:
+    Udp_Test_Receiver() : socket{io_context, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0)}
+    {
+        socket.non_blocking(true);
+    }
+
+    uint16_t port() const { return socket.local_endpoint().port(); }
+
+    // datagrams received so far
+    std::vector<std::string> receive()
+    {
+        std::vector<std::string> datagrams;
+        boost::system::error_code error;
+        while (true)
+            {
+                const size_t length = socket.receive(boost::asio::buffer(buffer), 0, error);
+                if (error)
+                    {
+                        break;
+                    }
+                datagrams.emplace_back(buffer.data(), length);
+            }
+        return datagrams;
+    }
+
+private:
+    b_io_context io_context;
+    boost::asio::ip::udp::socket socket;
+    std::array<char, 65536> buffer{};
+};
+
+
+std::vector<int> decode_ints(const std::string& datagram)
+{
+    std::vector<int> values(datagram.size() / sizeof(int));
+    std::memcpy(values.data(), datagram.data(), values.size() * sizeof(int));
+    return values;
+}
+}  // namespace
+
+
+TEST(GnssSynchroUdpSinkTest, CoalescesPendingWrites)
+{
+    Udp_Test_Receiver receiver;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<bool> first{true};
+    {
+        Async_Udp_Sink<int> sink({"127.0.0.1"}, receiver.port(), 8, 4,
+            [&](const std::vector<int>& values) {
+                if (first)
+                    {
+                        // holds the I/O thread, so that the next writes pile up
+                        first = false;
+                        released.wait();
+                    }
+                return std::string(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(int));
+            });
+        EXPECT_EQ(sink.endpoints(), 1U);
+        const std::vector<int> values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+        ASSERT_TRUE(sink.write(&values[0], 1));
+        while (sink.written() == 0 or first)
+            {
+                std::this_thread::yield();
+            }
+        EXPECT_TRUE(sink.write(&values[1], 2));
+        EXPECT_TRUE(sink.write(&values[3], 3));
+        EXPECT_TRUE(sink.write(&values[6], 2));
+        EXPECT_FALSE(sink.write(&values[8], 4));  // no room left in the ring
+        release.set_value();
+        sink.stop();
+        EXPECT_FALSE(sink.write(&values[8], 1));
+        EXPECT_EQ(sink.written(), 8U);
+        EXPECT_EQ(sink.dropped(), 5U);
+        EXPECT_EQ(sink.datagrams(), 3U);
+        EXPECT_EQ(sink.failed(), 0U);
+    }
+
+    const std::vector<std::string> datagrams = receiver.receive();
+    ASSERT_EQ(datagrams.size(), 3U);
+    EXPECT_EQ(decode_ints(datagrams[0]), std::vector<int>({1}));
+    EXPECT_EQ(decode_ints(datagrams[1]), std::vector<int>({2, 3, 4, 5}));  // up to max_batch records
+    EXPECT_EQ(decode_ints(datagrams[2]), std::vector<int>({6, 7, 8}));
+}
+
+
+TEST(GnssSynchroUdpSinkTest, SendsToAllEndpoints)
+{
+    Udp_Test_Receiver receiver;
+    std::vector<Gnss_Synchro> stocks(3);
+    for (uint32_t i = 0; i < stocks.size(); i++)
+        {
+            stocks[i].Channel_ID = static_cast<int32_t>(i);
+            stocks[i].PRN = 10 + i;
+            stocks[i].Pseudorange_m = 2.0e7 + i;
+        }
+    {
+        // the same endpoint twice, and an address that is skipped
+        Gnss_Synchro_Udp_Sink sink({"127.0.0.1", "not an address", "127.0.0.1"}, receiver.port(), false, stocks.size());
+        EXPECT_TRUE(sink.write_gnss_synchro(stocks));
+        EXPECT_EQ(sink.written(), 3U);
+        EXPECT_EQ(sink.dropped(), 0U);
+    }
+
+    const std::vector<std::string> datagrams = receiver.receive();
+    ASSERT_EQ(datagrams.size(), 2U);
+    for (const auto& datagram : datagrams)
+        {
+            std::istringstream archive_stream(datagram);
+            boost::archive::binary_iarchive ia{archive_stream};
+            std::vector<Gnss_Synchro> received;
+            ia >> received;
+            ASSERT_EQ(received.size(), stocks.size());
+            for (size_t i = 0; i < stocks.size(); i++)
+                {
+                    EXPECT_EQ(received[i].Channel_ID, stocks[i].Channel_ID);
+                    EXPECT_EQ(received[i].PRN, stocks[i].PRN);
+                    EXPECT_DOUBLE_EQ(received[i].Pseudorange_m, stocks[i].Pseudorange_m);
+                }
+        }
+}
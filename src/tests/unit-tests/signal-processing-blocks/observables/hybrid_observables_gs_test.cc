@@ -0,0 +1,203 @@
+/*!
+ * \file hybrid_observables_gs_test.cc
+ * \brief Tests for the output ports of the Observables block when the PVT
+ * interval is longer than the observables interval
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro.h"
+#include "hybrid_observables_gs.h"
+#include "obs_conf.h"
+#include <gnuradio/block.h>
+#include <gnuradio/io_signature.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_b.h>
+#endif
+#if GNURADIO_USES_STD_POINTERS
+#else
+#include <boost/shared_ptr.hpp>
+#endif
+
+
+// ######## GNURADIO BLOCK SOURCE OF TRACKING OBSERVABLES #########
+namespace
+{
+constexpr uint32_t TEST_FS_HZ = 1000000;
+constexpr uint32_t TEST_TOW0_MS = 345600000;  // a multiple of the PVT interval
+}  // namespace
+
+class HybridObservablesGsTest_source;
+
+#if GNURADIO_USES_STD_POINTERS
+using HybridObservablesGsTest_source_sptr = std::shared_ptr<HybridObservablesGsTest_source>;
+#else
+using HybridObservablesGsTest_source_sptr = boost::shared_ptr<HybridObservablesGsTest_source>;
+#endif
+
+HybridObservablesGsTest_source_sptr HybridObservablesGsTest_source_make(uint32_t duration_ms, uint32_t clock_interval_ms);
+
+
+/*!
+ * \brief Outputs the tracking observables of one GPS L1 C/A channel every
+ * millisecond on port 0, and the receiver clock every clock_interval_ms on
+ * port 1. The clock is never ahead of the tracking observables, so the
+ * Observables block can interpolate every epoch.
+ */
+class HybridObservablesGsTest_source : public gr::block
+{
+public:
+    int general_work(int noutput_items, gr_vector_int& ninput_items,
+        gr_vector_const_void_star& input_items, gr_vector_void_star& output_items);
+
+private:
+    friend HybridObservablesGsTest_source_sptr HybridObservablesGsTest_source_make(uint32_t duration_ms, uint32_t clock_interval_ms);
+    HybridObservablesGsTest_source(uint32_t duration_ms, uint32_t clock_interval_ms);
+    uint32_t d_duration_ms;
+    uint32_t d_clock_interval_ms;
+    uint32_t d_ms;
+};
+
+
+HybridObservablesGsTest_source_sptr HybridObservablesGsTest_source_make(uint32_t duration_ms, uint32_t clock_interval_ms)
+{
+    return HybridObservablesGsTest_source_sptr(new HybridObservablesGsTest_source(duration_ms, clock_interval_ms));
+}
+
+
+HybridObservablesGsTest_source::HybridObservablesGsTest_source(uint32_t duration_ms, uint32_t clock_interval_ms) : gr::block("HybridObservablesGsTest_source", gr::io_signature::make(0, 0, 0), gr::io_signature::make(2, 2, sizeof(Gnss_Synchro))),
+                                                                                                                 d_duration_ms(duration_ms),
+                                                                                                                 d_clock_interval_ms(clock_interval_ms),
+                                                                                                                 d_ms(0)
+{
+}
+
+
+int HybridObservablesGsTest_source::general_work(int noutput_items __attribute__((unused)),
+    gr_vector_int& ninput_items __attribute__((unused)), gr_vector_const_void_star& input_items __attribute__((unused)),
+    gr_vector_void_star& output_items)
+{
+    if (d_ms >= d_duration_ms)
+        {
+            return WORK_DONE;
+        }
+    auto** out = reinterpret_cast<Gnss_Synchro**>(&output_items[0]);
+    Gnss_Synchro gnss_synchro = Gnss_Synchro();
+    gnss_synchro.Tracking_sample_counter = static_cast<uint64_t>(d_ms) * TEST_FS_HZ / 1000;
+    gnss_synchro.fs = TEST_FS_HZ;
+    gnss_synchro.TOW_at_current_symbol_ms = TEST_TOW0_MS + d_ms;
+    gnss_synchro.Flag_valid_acquisition = true;
+    gnss_synchro.Flag_valid_symbol_output = true;
+    gnss_synchro.Flag_valid_word = true;
+    gnss_synchro.PRN = 1;
+    gnss_synchro.Channel_ID = 0;
+    gnss_synchro.System = 'G';
+    std::memcpy(static_cast<void*>(gnss_synchro.Signal), "1C", 3);
+    out[0][0] = gnss_synchro;
+    produce(0, 1);
+    if (d_ms > 0 and d_ms % d_clock_interval_ms == 0)
+        {
+            out[1][0] = gnss_synchro;
+            produce(1, 1);
+        }
+    d_ms++;
+    return WORK_CALLED_PRODUCE;
+}
+
+
+// ###########################################################
+
+
+namespace
+{
+std::vector<Gnss_Synchro> to_gnss_synchro(const std::vector<unsigned char>& bytes)
+{
+    std::vector<Gnss_Synchro> gnss_synchros(bytes.size() / sizeof(Gnss_Synchro));
+    std::memcpy(static_cast<void*>(gnss_synchros.data()), bytes.data(), gnss_synchros.size() * sizeof(Gnss_Synchro));
+    return gnss_synchros;
+}
+
+
+uint32_t rx_tow_ms(const Gnss_Synchro& gnss_synchro)
+{
+    return static_cast<uint32_t>(std::round(gnss_synchro.RX_time * 1000.0));
+}
+}  // namespace
+
+
+TEST(HybridObservablesGsTest, PvtIntervalDecimatesOnlyPvtPorts)
+{
+    const uint32_t duration_ms = 3000;
+    Obs_Conf conf;
+    conf.nchannels_in = 2;  // one channel and the receiver clock
+    conf.nchannels_out = 1;
+    conf.observable_interval_ms = 20;
+    conf.pvt_interval_ms = 100;
+
+    auto source = HybridObservablesGsTest_source_make(duration_ms, conf.observable_interval_ms);
+    auto observables = hybrid_observables_gs_make(conf);
+    auto pvt_sink = gr::blocks::vector_sink_b::make(sizeof(Gnss_Synchro));
+    auto raw_sink = gr::blocks::vector_sink_b::make(sizeof(Gnss_Synchro));
+    auto top_block = gr::make_top_block("Hybrid observables PVT interval test");
+    top_block->connect(source, 0, observables, 0);
+    top_block->connect(source, 1, observables, 1);
+    top_block->connect(observables, 0, pvt_sink, 0);
+    top_block->connect(observables, 1, raw_sink, 0);
+    top_block->run();
+
+    const std::vector<Gnss_Synchro> pvt = to_gnss_synchro(pvt_sink->data());
+    const std::vector<Gnss_Synchro> raw = to_gnss_synchro(raw_sink->data());
+
+    // the raw ports output every epoch, once the receiver clock buffer is full
+    const uint32_t n_clock = (duration_ms - 1) / conf.observable_interval_ms;
+    ASSERT_GT(raw.size(), n_clock - 10);
+    for (size_t i = 0; i < raw.size(); i++)
+        {
+            EXPECT_TRUE(raw[i].Flag_valid_pseudorange) << "raw epoch " << i;
+            EXPECT_EQ(rx_tow_ms(raw[i]) % conf.observable_interval_ms, 0U) << "raw epoch " << i;
+            if (i > 0)
+                {
+                    EXPECT_EQ(rx_tow_ms(raw[i]) - rx_tow_ms(raw[i - 1]), conf.observable_interval_ms) << "raw epoch " << i;
+                }
+        }
+
+    // the PVT ports output the same epochs, only at the PVT interval
+    std::vector<Gnss_Synchro> expected_pvt;
+    for (const auto& gnss_synchro : raw)
+        {
+            if (rx_tow_ms(gnss_synchro) % conf.pvt_interval_ms == 0)
+                {
+                    expected_pvt.push_back(gnss_synchro);
+                }
+        }
+    ASSERT_FALSE(pvt.empty());
+    ASSERT_EQ(pvt.size(), expected_pvt.size());
+    EXPECT_LE(raw.size(), 5 * pvt.size() + 4);
+    EXPECT_GE(raw.size(), 5 * pvt.size() - 4);
+    for (size_t i = 0; i < pvt.size(); i++)
+        {
+            EXPECT_EQ(rx_tow_ms(pvt[i]), rx_tow_ms(expected_pvt[i])) << "PVT epoch " << i;
+            EXPECT_EQ(rx_tow_ms(pvt[i]) % conf.pvt_interval_ms, 0U) << "PVT epoch " << i;
+            EXPECT_DOUBLE_EQ(pvt[i].Pseudorange_m, expected_pvt[i].Pseudorange_m) << "PVT epoch " << i;
+            EXPECT_TRUE(pvt[i].Flag_valid_pseudorange) << "PVT epoch " << i;
+        }
+}
@@ -0,0 +1,324 @@
+/*!
+ * \file trk_obs_history_test.cc
+ * \brief Tests for the history of tracking observables of the Observables
+ * block, against a linear search and the interpolation over full
+ * Gnss_Synchro records
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_alloc_counter.h"
+#include "gnss_synchro.h"
+#include "trk_obs_history.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+// Search formerly done in hybrid_observables_gs::interp_trk_obs
+int32_t nearest_linear(const Trk_Obs_History& history, uint32_t ch, uint64_t rx_clock)
+{
+    int32_t nearest_element = -1;
+    int64_t old_abs_diff = std::numeric_limits<int64_t>::max();
+    for (uint32_t i = 0; i < history.size(ch); i++)
+        {
+            const int64_t abs_diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(history.get(ch, i).Tracking_sample_counter));
+            if (old_abs_diff > abs_diff)
+                {
+                    old_abs_diff = abs_diff;
+                    nearest_element = static_cast<int32_t>(i);
+                }
+        }
+    return nearest_element;
+}
+
+
+// Interpolation formerly done in hybrid_observables_gs::interp_trk_obs, over full records
+bool interp_reference(Gnss_Synchro& interpolated_obs, const std::vector<Gnss_Synchro>& history, uint64_t rx_clock)
+{
+    int32_t nearest_element = -1;
+    int64_t old_abs_diff = std::numeric_limits<int64_t>::max();
+    for (size_t i = 0; i < history.size(); i++)
+        {
+            const int64_t abs_diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(history[i].Tracking_sample_counter));
+            if (old_abs_diff > abs_diff)
+                {
+                    old_abs_diff = abs_diff;
+                    nearest_element = static_cast<int32_t>(i);
+                }
+        }
+    if (nearest_element == -1 or (static_cast<double>(old_abs_diff) / static_cast<double>(history[nearest_element].fs)) >= 0.02)
+        {
+            return false;
+        }
+    const int32_t neighbor_element = rx_clock > history[nearest_element].Tracking_sample_counter ? nearest_element + 1 : nearest_element - 1;
+    if (neighbor_element >= static_cast<int32_t>(history.size()) or neighbor_element < 0)
+        {
+            return false;
+        }
+    const Gnss_Synchro& t1 = history[std::min(nearest_element, neighbor_element)];
+    const Gnss_Synchro& t2 = history[std::max(nearest_element, neighbor_element)];
+    interpolated_obs = history[nearest_element];
+    const double T_rx_s = static_cast<double>(rx_clock) / static_cast<double>(interpolated_obs.fs);
+    const double time_factor = (T_rx_s - t1.RX_time) / (t2.RX_time - t1.RX_time);
+    interpolated_obs.Carrier_phase_rads = t1.Carrier_phase_rads + (t2.Carrier_phase_rads - t1.Carrier_phase_rads) * time_factor;
+    interpolated_obs.Carrier_Doppler_hz = t1.Carrier_Doppler_hz + (t2.Carrier_Doppler_hz - t1.Carrier_Doppler_hz) * time_factor;
+    if ((t2.TOW_at_current_symbol_ms - t1.TOW_at_current_symbol_ms) > 0)
+        {
+            interpolated_obs.interp_TOW_ms = static_cast<double>(t1.TOW_at_current_symbol_ms) + (static_cast<double>(t2.TOW_at_current_symbol_ms) - static_cast<double>(t1.TOW_at_current_symbol_ms)) * time_factor;
+        }
+    else
+        {
+            interpolated_obs.interp_TOW_ms = static_cast<double>(t1.TOW_at_current_symbol_ms) + (static_cast<double>(t2.TOW_at_current_symbol_ms + 604800000) - static_cast<double>(t1.TOW_at_current_symbol_ms)) * time_factor;
+        }
+    return true;
+}
+}  // namespace
+
+
+TEST(TrkObsHistoryTest, NearestMatchesLinearSearch)
+{
+    std::default_random_engine e(1234);
+    std::uniform_int_distribution<uint64_t> step_dist(1, 4000);  // up to 2 ms at 2 Msps
+    std::uniform_int_distribution<int> event_dist(0, 99);
+    const uint32_t nchann = 3;
+    Trk_Obs_History history(50, nchann);
+    EXPECT_EQ(history.nearest(0, 12345), -1);
+
+    std::vector<uint64_t> sample_counter(nchann, 0);
+    uint64_t rx_clock = 0;
+    for (int32_t epoch = 0; epoch < 5000; epoch++)
+        {
+            for (uint32_t ch = 0; ch < nchann; ch++)
+                {
+                    // a few observables per epoch, more than the capacity from time to time
+                    const int n_obs = event_dist(e) < 2 ? 150 : event_dist(e) % 4;
+                    for (int i = 0; i < n_obs; i++)
+                        {
+                            Gnss_Synchro obs{};
+                            obs.fs = 2000000;
+                            sample_counter[ch] += step_dist(e);
+                            obs.Tracking_sample_counter = sample_counter[ch];
+                            history.push_back(ch, obs, 0.0);
+                        }
+                    if (event_dist(e) == 0)
+                        {
+                            history.clear(ch);
+                        }
+                }
+            // the receiver clock lags behind the observables, and jumps back now and then
+            const int event = event_dist(e);
+            if (event < 3)
+                {
+                    rx_clock -= std::min(rx_clock, step_dist(e) * 10);
+                }
+            else
+                {
+                    rx_clock = std::max(rx_clock, sample_counter[0] - std::min(sample_counter[0], step_dist(e) * 2));
+                }
+            for (uint32_t ch = 0; ch < nchann; ch++)
+                {
+                    ASSERT_EQ(history.nearest(ch, rx_clock), nearest_linear(history, ch, rx_clock)) << "epoch " << epoch << ", channel " << ch;
+                    // exact match and ties between two observables
+                    if (history.size(ch) > 1)
+                        {
+                            const uint64_t exact = history.get(ch, 1).Tracking_sample_counter;
+                            ASSERT_EQ(history.nearest(ch, exact), 1);
+                            const uint64_t t0 = history.get(ch, 0).Tracking_sample_counter;
+                            const uint64_t tie = t0 + (exact - t0) / 2;
+                            ASSERT_EQ(history.nearest(ch, tie), nearest_linear(history, ch, tie));
+                        }
+                }
+        }
+}
+
+
+TEST(TrkObsHistoryTest, OlderObservableRestartsHistory)
+{
+    Trk_Obs_History history(10, 1);
+    Gnss_Synchro obs{};
+    obs.fs = 100000;
+    for (uint64_t counter : {100, 200, 300})
+        {
+            obs.Tracking_sample_counter = counter;
+            history.push_back(0, obs, 0.0);
+        }
+    EXPECT_EQ(history.lower_bound(0, 250), 2U);
+    obs.Tracking_sample_counter = 50;
+    history.push_back(0, obs, 0.0);
+    ASSERT_EQ(history.size(0), 1U);
+    EXPECT_EQ(history.get(0, 0).Tracking_sample_counter, 50U);
+    EXPECT_EQ(history.lower_bound(0, 250), 1U);
+    EXPECT_EQ(history.nearest(0, 250), 0);
+}
+
+
+TEST(TrkObsHistoryTest, DepthIsSetInTime)
+{
+    Trk_Obs_History history(100, 2);
+    Gnss_Synchro obs{};
+    obs.fs = 4000000;
+    // 1 ms integration in channel 0, 20 ms in channel 1
+    for (uint64_t ms = 1; ms <= 1000; ms++)
+        {
+            obs.Tracking_sample_counter = ms * 4000;
+            history.push_back(0, obs, 0.0);
+            if (ms % 20 == 0)
+                {
+                    history.push_back(1, obs, 0.0);
+                }
+        }
+    EXPECT_EQ(history.size(0), 101U);
+    EXPECT_EQ(history.size(1), 6U);
+    EXPECT_EQ(history.get(0, 0).Tracking_sample_counter, 900U * 4000U);
+    EXPECT_EQ(history.get(1, 0).Tracking_sample_counter, 900U * 4000U);
+}
+
+
+TEST(TrkObsHistoryTest, InterpolationMatchesFullRecords)
+{
+    std::default_random_engine e(4321);
+    std::uniform_int_distribution<uint64_t> step_dist(3000, 5000);  // about 1 ms at 4 Msps
+    std::uniform_real_distribution<double> value_dist(-1.0, 1.0);
+    std::default_random_engine e_fields(1234);  // apart, not to change the sample counters
+    const uint32_t nchann = 4;
+    const std::vector<uint32_t> integration_ms{1, 2, 4, 20};
+    const int64_t fs = 4000000;
+    Trk_Obs_History history(300, nchann);
+    std::vector<std::vector<Gnss_Synchro>> reference(nchann);
+
+    std::vector<uint64_t> sample_counter(nchann, 0);
+    for (int32_t epoch = 0; epoch < 2000; epoch++)
+        {
+            for (uint32_t ch = 0; ch < nchann; ch++)
+                {
+                    for (uint32_t i = 0; i < 20 / integration_ms[ch]; i++)
+                        {
+                            Gnss_Synchro obs{};
+                            obs.PRN = ch + 1;
+                            obs.Channel_ID = static_cast<int32_t>(ch);
+                            obs.fs = fs;
+                            // flags and prompt of each observable, not to be taken from the newest one
+                            obs.Flag_valid_word = value_dist(e_fields) > -0.5;
+                            obs.Flag_valid_symbol_output = value_dist(e_fields) > -0.5;
+                            obs.Prompt_I = value_dist(e_fields);
+                            obs.Prompt_Q = value_dist(e_fields);
+                            obs.correlation_length_ms = static_cast<int32_t>(integration_ms[ch]) * (value_dist(e_fields) > 0.0 ? 1 : 2);
+                            sample_counter[ch] += step_dist(e) * integration_ms[ch];
+                            obs.Tracking_sample_counter = sample_counter[ch];
+                            obs.Code_phase_samples = value_dist(e);
+                            obs.Carrier_phase_rads = 1000.0 * value_dist(e);
+                            obs.Carrier_Doppler_hz = 5000.0 * value_dist(e);
+                            obs.CN0_dB_hz = 45.0 + value_dist(e);
+                            obs.TOW_at_current_symbol_ms = static_cast<uint32_t>(sample_counter[ch] / 4000U);
+                            const double rx_time = (static_cast<double>(obs.Tracking_sample_counter) + obs.Code_phase_samples) / static_cast<double>(fs);
+                            history.push_back(ch, obs, rx_time);
+                            obs.RX_time = rx_time;
+                            reference[ch].push_back(obs);
+                        }
+                    if (reference[ch].size() > 1000)
+                        {
+                            reference[ch].erase(reference[ch].begin(), reference[ch].begin() + 500);
+                        }
+                }
+            // 200 ms behind the newest observables
+            const uint64_t rx_clock = sample_counter[0] > 800000 ? sample_counter[0] - 800000 : 0;
+            std::vector<Gnss_Synchro> epoch_data(nchann);
+            const int32_t n_valid = history.interpolate(rx_clock, epoch_data);
+            int32_t n_reference = 0;
+            for (uint32_t ch = 0; ch < nchann; ch++)
+                {
+                    Gnss_Synchro expected{};
+                    if (interp_reference(expected, reference[ch], rx_clock))
+                        {
+                            n_reference++;
+                            ASSERT_EQ(epoch_data[ch].Tracking_sample_counter, expected.Tracking_sample_counter) << "epoch " << epoch << ", channel " << ch;
+                            ASSERT_EQ(epoch_data[ch].PRN, expected.PRN);
+                            ASSERT_EQ(epoch_data[ch].fs, expected.fs);
+                            ASSERT_EQ(epoch_data[ch].Flag_valid_word, expected.Flag_valid_word);
+                            ASSERT_EQ(epoch_data[ch].Flag_valid_symbol_output, expected.Flag_valid_symbol_output);
+                            ASSERT_EQ(epoch_data[ch].Prompt_I, expected.Prompt_I);
+                            ASSERT_EQ(epoch_data[ch].Prompt_Q, expected.Prompt_Q);
+                            ASSERT_EQ(epoch_data[ch].correlation_length_ms, expected.correlation_length_ms);
+                            ASSERT_EQ(epoch_data[ch].CN0_dB_hz, expected.CN0_dB_hz);
+                            ASSERT_EQ(epoch_data[ch].Code_phase_samples, expected.Code_phase_samples);
+                            ASSERT_EQ(epoch_data[ch].RX_time, expected.RX_time);
+                            ASSERT_EQ(epoch_data[ch].TOW_at_current_symbol_ms, expected.TOW_at_current_symbol_ms);
+                            ASSERT_DOUBLE_EQ(epoch_data[ch].Carrier_phase_rads, expected.Carrier_phase_rads);
+                            ASSERT_DOUBLE_EQ(epoch_data[ch].Carrier_Doppler_hz, expected.Carrier_Doppler_hz);
+                            ASSERT_DOUBLE_EQ(epoch_data[ch].interp_TOW_ms, expected.interp_TOW_ms);
+                        }
+                    else
+                        {
+                            ASSERT_EQ(epoch_data[ch].fs, 0) << "epoch " << epoch << ", channel " << ch;
+                        }
+                }
+            ASSERT_EQ(n_valid, n_reference);
+            if (epoch > 20)
+                {
+                    ASSERT_EQ(n_valid, static_cast<int32_t>(nchann));
+                }
+        }
+}
+
+
+#if ENABLE_ALLOCATION_COUNTER
+TEST(TrkObsHistoryTest, NoAllocationInSteadyState)
+{
+    const uint64_t allocations_before_vector = gnss_sdr_thread_allocations();
+    std::vector<int> v(10);
+    EXPECT_EQ(gnss_sdr_thread_allocations(), allocations_before_vector + 1);
+
+    const uint32_t nchann = 8;
+    const int64_t fs = 4000000;
+    Trk_Obs_History history(500, nchann);
+    std::vector<Gnss_Synchro> epoch_data(nchann);
+    Gnss_Synchro obs{};
+    obs.fs = fs;
+    uint64_t sample_counter = 0;
+    uint64_t steady_state_allocations = 0;
+    for (int32_t epoch = 0; epoch < 500; epoch++)
+        {
+            const uint64_t allocations_at_start = gnss_sdr_thread_allocations();
+            for (int32_t ms = 0; ms < 20; ms++)
+                {
+                    sample_counter += 4000;
+                    obs.Tracking_sample_counter = sample_counter;
+                    obs.TOW_at_current_symbol_ms = static_cast<uint32_t>(sample_counter / 4000);
+                    for (uint32_t ch = 0; ch < nchann; ch++)
+                        {
+                            history.push_back(ch, obs, static_cast<double>(sample_counter) / static_cast<double>(fs));
+                        }
+                }
+            const int32_t n_valid = history.interpolate(sample_counter - 800000, epoch_data);
+            if (epoch > 10)
+                {
+                    ASSERT_EQ(n_valid, static_cast<int32_t>(nchann));
+                }
+            // the columns reach their final capacity after twice the depth of the history
+            if (epoch > 2 * 500 / 20 + 1)
+                {
+                    steady_state_allocations += gnss_sdr_thread_allocations() - allocations_at_start;
+                }
+        }
+    EXPECT_EQ(steady_state_allocations, 0U);
+}
+#endif
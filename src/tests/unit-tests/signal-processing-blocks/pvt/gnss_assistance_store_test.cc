@@ -0,0 +1,182 @@
+/*!
+ * \file gnss_assistance_store_test.cc
+ * \brief Tests for the binary store of GNSS assistance data
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "galileo_ephemeris.h"
+#include "gnss_assistance_store.h"
+#include "gps_ephemeris.h"
+#include "gps_iono.h"
+#include "gps_utc_model.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+
+
+namespace
+{
+std::streamoff file_length(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    return file.tellg();
+}
+
+
+Gps_Ephemeris test_gps_ephemeris(uint32_t prn, double toe)
+{
+    Gps_Ephemeris eph;
+    eph.i_satellite_PRN = prn;
+    eph.d_Toe = toe;
+    eph.d_sqrt_A = 5153.7;
+    eph.d_e_eccentricity = 0.01;
+    return eph;
+}
+}  // namespace
+
+
+TEST(GnssAssistanceStoreTest, SaveAndLoad)
+{
+    const std::string filename("gnss_assistance_store_test.dat");
+    {
+        Gnss_Assistance_Store store(filename);
+        ASSERT_TRUE(store.open());
+        EXPECT_TRUE(store.save(test_gps_ephemeris(3, 345600.0), 3));
+        EXPECT_TRUE(store.save(test_gps_ephemeris(7, 345600.0), 7));
+        EXPECT_TRUE(store.save(test_gps_ephemeris(3, 352800.0), 3));  // newer ephemeris of the same satellite
+        Galileo_Ephemeris gal_eph;
+        gal_eph.i_satellite_PRN = 11;
+        gal_eph.IOD_nav_1 = 77;
+        EXPECT_TRUE(store.save(gal_eph, 11));
+        Gps_Utc_Model utc_model;
+        utc_model.d_DeltaT_LS = 18;
+        utc_model.valid = true;
+        EXPECT_TRUE(store.save(utc_model));
+    }
+
+    Gnss_Assistance_Store store(filename);
+    ASSERT_TRUE(store.load());
+    EXPECT_EQ(store.size(), 4U);
+    const std::map<int, Gps_Ephemeris> gps_ephemeris_map = store.get_all<Gps_Ephemeris>();
+    ASSERT_EQ(gps_ephemeris_map.size(), 2U);
+    EXPECT_EQ(gps_ephemeris_map.at(3).i_satellite_PRN, 3U);
+    EXPECT_DOUBLE_EQ(gps_ephemeris_map.at(3).d_Toe, 352800.0);
+    EXPECT_DOUBLE_EQ(gps_ephemeris_map.at(7).d_Toe, 345600.0);
+    EXPECT_DOUBLE_EQ(gps_ephemeris_map.at(7).d_sqrt_A, 5153.7);
+    const std::map<int, Galileo_Ephemeris> galileo_ephemeris_map = store.get_all<Galileo_Ephemeris>();
+    ASSERT_EQ(galileo_ephemeris_map.size(), 1U);
+    EXPECT_EQ(galileo_ephemeris_map.at(11).IOD_nav_1, 77);
+    Gps_Utc_Model utc_model;
+    ASSERT_TRUE(store.get(utc_model));
+    EXPECT_EQ(utc_model.d_DeltaT_LS, 18);
+    EXPECT_TRUE(utc_model.valid);
+    Gps_Iono gps_iono;
+    EXPECT_FALSE(store.get(gps_iono));
+
+    std::remove(filename.c_str());
+}
+
+
+TEST(GnssAssistanceStoreTest, RepeatedRecordNotAppended)
+{
+    const std::string filename("gnss_assistance_store_test.dat");
+    Gnss_Assistance_Store store(filename);
+    ASSERT_TRUE(store.open());
+    EXPECT_TRUE(store.save(test_gps_ephemeris(3, 345600.0), 3));
+    const std::streamoff length = file_length(filename);
+    EXPECT_TRUE(store.save(test_gps_ephemeris(3, 345600.0), 3));
+    EXPECT_EQ(file_length(filename), length);
+    EXPECT_TRUE(store.save(test_gps_ephemeris(3, 352800.0), 3));
+    EXPECT_GT(file_length(filename), length);
+
+    std::remove(filename.c_str());
+}
+
+
+TEST(GnssAssistanceStoreTest, TruncatedRecordIgnored)
+{
+    const std::string filename("gnss_assistance_store_test.dat");
+    std::streamoff length;
+    {
+        Gnss_Assistance_Store store(filename);
+        ASSERT_TRUE(store.open());
+        EXPECT_TRUE(store.save(test_gps_ephemeris(3, 345600.0), 3));
+        length = file_length(filename);
+        EXPECT_TRUE(store.save(test_gps_ephemeris(7, 345600.0), 7));
+    }
+    // a crash in the middle of the second record
+    std::string content(static_cast<size_t>(file_length(filename)), '\0');
+    {
+        std::ifstream in(filename, std::ios::binary);
+        in.read(&content[0], content.size());
+    }
+    {
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        out.write(content.data(), length + 20);
+    }
+
+    Gnss_Assistance_Store store(filename);
+    ASSERT_TRUE(store.load());
+    const std::map<int, Gps_Ephemeris> gps_ephemeris_map = store.get_all<Gps_Ephemeris>();
+    ASSERT_EQ(gps_ephemeris_map.size(), 1U);
+    EXPECT_EQ(gps_ephemeris_map.count(3), 1U);
+
+    // the next run drops the torn record and appends after the valid ones
+    ASSERT_TRUE(store.open());
+    EXPECT_EQ(file_length(filename), length);
+    EXPECT_TRUE(store.save(test_gps_ephemeris(7, 345600.0), 7));
+    Gnss_Assistance_Store reloaded(filename);
+    ASSERT_TRUE(reloaded.load());
+    EXPECT_EQ(reloaded.get_all<Gps_Ephemeris>().size(), 2U);
+
+    std::remove(filename.c_str());
+}
+
+
+TEST(GnssAssistanceStoreTest, Compaction)
+{
+    const std::string filename("gnss_assistance_store_test.dat");
+    Gnss_Assistance_Store store(filename);
+    ASSERT_TRUE(store.open());
+    for (int i = 0; i < 2000; i++)
+        {
+            EXPECT_TRUE(store.save(test_gps_ephemeris(1 + i % 4, 345600.0 + 16.0 * i), 1 + i % 4));
+        }
+    EXPECT_LT(file_length(filename), 2 * 65536);
+
+    Gnss_Assistance_Store reloaded(filename);
+    ASSERT_TRUE(reloaded.load());
+    const std::map<int, Gps_Ephemeris> gps_ephemeris_map = reloaded.get_all<Gps_Ephemeris>();
+    ASSERT_EQ(gps_ephemeris_map.size(), 4U);
+    EXPECT_DOUBLE_EQ(gps_ephemeris_map.at(4).d_Toe, 345600.0 + 16.0 * 1999);
+
+    std::remove(filename.c_str());
+}
+
+
+TEST(GnssAssistanceStoreTest, NotAStore)
+{
+    const std::string filename("gnss_assistance_store_test.dat");
+    {
+        std::ofstream out(filename);
+        out << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>\n";
+    }
+    Gnss_Assistance_Store store(filename);
+    EXPECT_FALSE(store.load());
+    std::remove(filename.c_str());
+    EXPECT_FALSE(store.load());
+}
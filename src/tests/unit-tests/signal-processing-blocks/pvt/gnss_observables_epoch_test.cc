@@ -0,0 +1,108 @@
+/*!
+ * \file gnss_observables_epoch_test.cc
+ * \brief Tests for the channel-indexed observables of the PVT block, against
+ * the std::map formerly used
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_observables_epoch.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <map>
+#include <random>
+
+
+TEST(GnssObservablesEpochTest, MatchesMap)
+{
+    std::default_random_engine e(1234);
+    std::bernoulli_distribution valid_dist(0.3);
+    // channel counts below, at and above the size of a word of the bitmap
+    for (const uint32_t nchannels : {1, 12, 64, 65, 150})
+        {
+            Gnss_Observables_Epoch epoch(nchannels);
+            for (int n = 0; n < 20; n++)
+                {
+                    std::map<int, Gnss_Synchro> reference;
+                    epoch.clear();
+                    EXPECT_TRUE(epoch.empty());
+                    for (uint32_t ch = 0; ch < nchannels; ch++)
+                        {
+                            if (valid_dist(e))
+                                {
+                                    Gnss_Synchro obs{};
+                                    obs.Channel_ID = ch;
+                                    obs.PRN = n + 1;
+                                    obs.RX_time = 0.001 * (n * nchannels + ch);
+                                    epoch.set(ch, obs);
+                                    reference[ch] = obs;
+                                }
+                        }
+                    ASSERT_EQ(epoch.size(), reference.size());
+                    auto ref_iter = reference.cbegin();
+                    for (auto iter = epoch.cbegin(); iter != epoch.cend(); ++iter, ++ref_iter)
+                        {
+                            ASSERT_NE(ref_iter, reference.cend());
+                            EXPECT_EQ(iter.channel(), static_cast<uint32_t>(ref_iter->first));
+                            EXPECT_EQ(iter->RX_time, ref_iter->second.RX_time);
+                        }
+                    EXPECT_EQ(ref_iter, reference.cend());
+                    if (!reference.empty())
+                        {
+                            EXPECT_EQ(epoch.front().Channel_ID, reference.cbegin()->second.Channel_ID);
+                        }
+                    std::map<int, Gnss_Synchro> copy;
+                    epoch.to_map(copy);
+                    ASSERT_EQ(copy.size(), reference.size());
+                    for (const auto& obs : reference)
+                        {
+                            EXPECT_EQ(copy.at(obs.first).RX_time, obs.second.RX_time);
+                        }
+                }
+        }
+}
+
+
+TEST(GnssObservablesEpochTest, SetEraseAndFromMap)
+{
+    Gnss_Observables_Epoch epoch(10);
+    Gnss_Synchro obs{};
+    epoch.set(3, obs);
+    epoch.set(3, obs);
+    epoch.set(7, obs);
+    EXPECT_EQ(epoch.size(), 2U);
+    EXPECT_TRUE(epoch.valid(3));
+    epoch.erase(3);
+    epoch.erase(3);
+    EXPECT_FALSE(epoch.valid(3));
+    EXPECT_EQ(epoch.size(), 1U);
+    EXPECT_EQ(epoch.cbegin().channel(), 7U);
+
+    // modifying through the iterator changes the stored observable
+    for (Gnss_Synchro& observable : epoch)
+        {
+            observable.Pseudorange_m = 2.0e7;
+        }
+    EXPECT_EQ(epoch[7].Pseudorange_m, 2.0e7);
+
+    std::map<int, Gnss_Synchro> observables_map;
+    observables_map[2] = obs;
+    observables_map[12] = obs;
+    epoch.from_map(observables_map);
+    EXPECT_EQ(epoch.capacity(), 13U);
+    EXPECT_EQ(epoch.size(), 2U);
+    EXPECT_TRUE(epoch.valid(2));
+    EXPECT_TRUE(epoch.valid(12));
+    EXPECT_FALSE(epoch.valid(7));
+}
@@ -0,0 +1,142 @@
+/*!
+ * \file pvt_output_stage_test.cc
+ * \brief Tests for the worker threads that run the output tasks of the PVT
+ * block
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "pvt_output_stage.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+TEST(PvtOutputStageTest, TasksOfAWorkerRunInOrder)
+{
+    std::vector<std::vector<int>> outputs(3);
+    {
+        Pvt_Output_Stage stage(4, false, 2);
+        for (int n = 0; n < 1000; n++)
+            {
+                // printers 0 and 2 share the first worker
+                for (uint32_t printer = 0; printer < outputs.size(); printer++)
+                    {
+                        EXPECT_TRUE(stage.post(printer, [&outputs, printer, n]() { outputs[printer].push_back(n); }));
+                    }
+            }
+        stage.wait_idle();
+        EXPECT_EQ(stage.posted(), 3000U);
+        EXPECT_EQ(stage.dropped(), 0U);
+        EXPECT_EQ(stage.depth(), 0U);
+        EXPECT_LE(stage.max_depth(), 8U);
+    }
+    for (const auto& output : outputs)
+        {
+            ASSERT_EQ(output.size(), 1000U);
+            for (int n = 0; n < 1000; n++)
+                {
+                    EXPECT_EQ(output[n], n);
+                }
+        }
+}
+
+
+TEST(PvtOutputStageTest, DropPolicyNeverBlocks)
+{
+    std::mutex mutex;
+    std::condition_variable released_cv;
+    bool released = false;
+    int executed = 0;
+    {
+        Pvt_Output_Stage stage(2, true, 1);
+        // the first task keeps the worker busy until it is released
+        stage.post(0, [&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            released_cv.wait(lock, [&released] { return released; });
+            executed++;
+        });
+        int accepted = 0;
+        for (int n = 0; n < 10; n++)
+            {
+                if (stage.post(0, [&]() { std::lock_guard<std::mutex> lock(mutex); executed++; }))
+                    {
+                        accepted++;
+                    }
+            }
+        // the busy worker may or may not have taken the first task out of the queue yet
+        EXPECT_GE(accepted, 1);
+        EXPECT_LE(accepted, 2);
+        EXPECT_EQ(stage.dropped(), static_cast<uint64_t>(10 - accepted));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            released = true;
+        }
+        released_cv.notify_all();
+        stage.wait_idle();
+        EXPECT_EQ(executed, 1 + accepted);
+    }
+}
+
+
+TEST(PvtOutputStageTest, DestructorRunsPendingTasks)
+{
+    int executed = 0;
+    {
+        Pvt_Output_Stage stage(64, false, 1);
+        for (int n = 0; n < 200; n++)
+            {
+                stage.post(0, [&executed]() { executed++; });
+            }
+    }
+    EXPECT_EQ(executed, 200);
+}
+
+
+TEST(PvtOutputStageTest, BlockPolicyFreesSlotsOfARing)
+{
+    // with a single worker and the block policy, at most queue_depth + 1
+    // tasks are in flight, so a ring of queue_depth + 2 slots can hand data
+    // over to the worker, as the PVT block does with the user solver epochs
+    const size_t queue_depth = 4;
+    std::vector<std::atomic<int>> ring(queue_depth + 2);
+    int errors = 0;
+    int last = -1;
+    {
+        Pvt_Output_Stage stage(queue_depth, false, 1);
+        for (int n = 0; n < 2000; n++)
+            {
+                std::atomic<int>& slot = ring[n % ring.size()];
+                slot = n;
+                stage.post(0, [&slot, &errors, &last, n]() {
+                    if (n % 100 == 0)
+                        {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        }
+                    if (slot != n or last != n - 1)
+                        {
+                            errors++;
+                        }
+                    last = n;
+                });
+            }
+    }
+    EXPECT_EQ(errors, 0);
+    EXPECT_EQ(last, 1999);
+}
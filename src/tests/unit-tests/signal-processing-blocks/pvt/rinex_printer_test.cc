@@ -17,10 +17,38 @@
  * -------------------------------------------------------------------------
  */
 
+#include "gps_iono.h"
+#include "gps_utc_model.h"
 #include "rinex_printer.h"
+#include <fstream>
+#include <sstream>
 #include <string>
 
 
+namespace
+{
+std::string file_content(const std::string& filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+
+bool file_exists(const std::string& filename)
+{
+    return std::ifstream(filename).good();
+}
+
+
+std::string base_filename(const std::string& path)
+{
+    return path.substr(path.find_last_of("/\\") + 1);
+}
+}  // namespace
+
+
 TEST(RinexPrinterTest, GalileoObsHeader)
 {
     std::string line_aux;
@@ -743,3 +771,169 @@ TEST(RinexPrinterTest, MixedObsLogGpsGlo)
             LOG(INFO) << "Error deleting temporary file";
         }
 }
+
+
+TEST(RinexPrinterTest, GpsObsHeaderUpdate)
+{
+    const Gps_Ephemeris eph = Gps_Ephemeris();
+    Gps_Utc_Model utc_model = Gps_Utc_Model();
+    utc_model.d_DeltaT_LS = 18;
+
+    std::shared_ptr<Rinex_Printer> rp;
+    rp = std::make_shared<Rinex_Printer>();
+    rp->rinex_obs_header(rp->obsFile, eph, 0.0);
+
+    std::map<int, Gnss_Synchro> gnss_pseudoranges_map;
+    Gnss_Synchro gs = Gnss_Synchro();
+    gs.System = 'G';
+    std::memcpy(static_cast<void*>(gs.Signal), "1C", 3);
+    gs.PRN = 8;
+    gs.Pseudorange_m = 22000002.1;
+    gnss_pseudoranges_map.insert(std::pair<int, Gnss_Synchro>(1, gs));
+    rp->log_rinex_obs(rp->obsFile, eph, 0.0, gnss_pseudoranges_map);
+    rp->obsFile.flush();
+    const int64_t size = rp->obsFile.tellp();
+
+    // the header is patched in place, and the file stays open for the next epochs
+    rp->update_obs_header(rp->obsFile, utc_model);
+    EXPECT_EQ(size, rp->obsFile.tellp());
+    rp->log_rinex_obs(rp->obsFile, eph, 0.0, gnss_pseudoranges_map);
+    rp->obsFile.flush();
+
+    std::ifstream in(rp->obsfilename);
+    std::string line_str;
+    std::string line_previous;
+    std::string line_leap;
+    int data_lines = 0;
+    while (std::getline(in, line_str))
+        {
+            if (line_previous.find("TIME OF FIRST OBS", 59) != std::string::npos)
+                {
+                    line_leap = line_str;
+                }
+            if (line_str.find("G08", 0) == 0)
+                {
+                    data_lines++;
+                }
+            line_previous = line_str;
+        }
+
+    std::string expected_str("    18     0     0     0                                    LEAP SECONDS        ");
+    EXPECT_EQ(0, expected_str.compare(line_leap));
+    EXPECT_EQ(2, data_lines);
+
+    if (remove(rp->obsfilename.c_str()) != 0)
+        {
+            LOG(INFO) << "Error deleting temporary file";
+        }
+}
+
+
+TEST(RinexPrinterTest, GpsNavHeaderUpdateLengthChange)
+{
+    Gps_Ephemeris eph = Gps_Ephemeris();
+    eph.i_satellite_PRN = 3;
+    eph.i_GPS_week = 2100;
+    Gps_Iono iono = Gps_Iono();
+    Gps_Utc_Model utc_model = Gps_Utc_Model();
+
+    auto rp = std::make_shared<Rinex_Printer>(3);
+    rp->rinex_nav_header(rp->navFile, iono, utc_model, eph);
+    const std::map<int32_t, Gps_Ephemeris> eph_map{{3, eph}};
+    rp->log_rinex_nav(rp->navFile, eph_map);
+    rp->navFile.flush();
+
+    // a header with the trailing blanks of its lines trimmed, so that the
+    // updated header is longer and the data records have to be moved
+    std::string content = file_content(rp->navfilename);
+    const size_t header_end = content.find('\n', content.find("END OF HEADER")) + 1;
+    const std::string records = content.substr(header_end);
+    ASSERT_FALSE(records.empty());
+    std::string trimmed_header;
+    std::istringstream header(content.substr(0, header_end));
+    std::string line_str;
+    while (std::getline(header, line_str))
+        {
+            trimmed_header += line_str.substr(0, line_str.find_last_not_of(' ') + 1) + '\n';
+        }
+    ASSERT_LT(trimmed_header.size(), header_end);
+    {
+        std::ofstream out(rp->navfilename, std::ios::binary | std::ios::trunc);
+        out << trimmed_header << records;
+    }
+
+    iono.valid = true;
+    utc_model.valid = true;
+    utc_model.d_DeltaT_LS = 18;
+    rp->update_nav_header(rp->navFile, utc_model, iono, eph);
+    rp->navFile.flush();
+
+    content = file_content(rp->navfilename);
+    const size_t new_header_end = content.find('\n', content.find("END OF HEADER")) + 1;
+    EXPECT_GT(new_header_end, trimmed_header.size());
+    EXPECT_EQ(content.substr(new_header_end), records);  // the data records survive byte for byte
+    EXPECT_NE(content.find("    18     0     0     0"), std::string::npos);
+    EXPECT_FALSE(file_exists(rp->navfilename + ".tmp"));
+
+    // the file stays open for the next records
+    rp->log_rinex_nav(rp->navFile, eph_map);
+    rp->navFile.flush();
+    EXPECT_EQ(file_content(rp->navfilename).substr(new_header_end), records + records);
+
+    if (remove(rp->navfilename.c_str()) != 0)
+        {
+            LOG(INFO) << "Error deleting temporary file";
+        }
+}
+
+
+TEST(RinexPrinterTest, RotateFiles)
+{
+    const Gps_Ephemeris eph = Gps_Ephemeris();
+    auto rp = std::make_shared<Rinex_Printer>(3);
+    const std::string first_obsfilename = rp->obsfilename;
+    const std::string first_navfilename = rp->navfilename;
+    rp->rinex_obs_header(rp->obsFile, eph, 0.0);
+
+    // 5 January 2020, 13:00:00 UTC
+    const boost::posix_time::ptime utc_epoch(boost::gregorian::date(2020, 1, 5), boost::posix_time::hours(13));
+    rp->rotate_files(utc_epoch);
+
+    // the files are named after the epoch that started them
+    EXPECT_EQ(base_filename(rp->obsfilename), "GSDR005n0000.20O");
+    EXPECT_EQ(base_filename(rp->navfilename), "GSDR005n0000.20N");
+    // the closed files are kept only if something was written in them
+    EXPECT_TRUE(file_exists(first_obsfilename));
+    EXPECT_FALSE(file_exists(first_navfilename));
+
+    // the new file has its own header
+    rp->rinex_obs_header(rp->obsFile, eph, 0.0);
+    rp->obsFile.flush();
+    std::string line_str;
+    {
+        std::ifstream in(rp->obsfilename);
+        std::getline(in, line_str);
+    }
+    EXPECT_NE(line_str.find("RINEX VERSION / TYPE", 59), std::string::npos);
+    const std::string rotated_content = file_content(rp->obsfilename);
+    EXPECT_EQ(rotated_content.find("RINEX VERSION / TYPE"), rotated_content.rfind("RINEX VERSION / TYPE"));
+
+    // a file of the same epoch is overwritten, not appended to
+    const std::string rotated_obsfilename = rp->obsfilename;
+    rp->rotate_files(utc_epoch + boost::posix_time::hours(1));
+    const std::string next_obsfilename = rp->obsfilename;
+    EXPECT_EQ(base_filename(next_obsfilename), "GSDR005o0000.20O");
+    EXPECT_TRUE(file_exists(rotated_obsfilename));
+    rp->rotate_files(utc_epoch);
+    EXPECT_EQ(rp->obsfilename, rotated_obsfilename);
+    EXPECT_EQ(file_content(rotated_obsfilename), "");
+
+    const std::string last_obsfilename = rp->obsfilename;
+    rp.reset();
+    EXPECT_FALSE(file_exists(last_obsfilename));  // nothing written after the last rotation
+    EXPECT_FALSE(file_exists(next_obsfilename));
+    if (remove(first_obsfilename.c_str()) != 0)
+        {
+            LOG(INFO) << "Error deleting temporary file";
+        }
+}
@@ -0,0 +1,225 @@
+/*!
+ * \file rtcm_bit_writer_test.cc
+ * \brief Tests for the bit writer of the RTCM messages, and round trip of
+ * the messages printed by the Rtcm class through the RTKLIB decoder
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "rtcm.h"
+#include "rtcm_bit_writer.h"
+#include "rtklib_rtcm.h"
+#include "rtklib_rtkcmn.h"
+#include <gtest/gtest.h>
+#include <bitset>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+
+
+namespace
+{
+// feeds a message to the RTKLIB decoder, returns the status of the last byte
+int decode_rtcm3(rtcm_t* rtcm, const std::string& message)
+{
+    int status = 0;
+    for (char c : message)
+        {
+            status = input_rtcm3(rtcm, static_cast<unsigned char>(c));
+        }
+    return status;
+}
+
+
+Gnss_Synchro test_observable(char system, const char* signal, uint32_t prn, double pseudorange_m, double cn0_dB_hz)
+{
+    Gnss_Synchro gnss_synchro{};
+    gnss_synchro.System = system;
+    gnss_synchro.Signal[0] = signal[0];
+    gnss_synchro.Signal[1] = signal[1];
+    gnss_synchro.PRN = prn;
+    gnss_synchro.Pseudorange_m = pseudorange_m;
+    gnss_synchro.Carrier_phase_rads = 1.0e8;
+    gnss_synchro.Carrier_Doppler_hz = -1234.5;
+    gnss_synchro.CN0_dB_hz = cn0_dB_hz;
+    gnss_synchro.Flag_valid_pseudorange = true;
+    return gnss_synchro;
+}
+}  // namespace
+
+
+TEST(RtcmBitWriterTest, PutAcrossBytes)
+{
+    Rtcm_Bit_Writer writer;
+    writer.put(0x5, 3);                    // 101
+    writer.put(0x1ABCD, 17);               // 1 1010 1011 1100 1101
+    writer.put(std::bitset<15>(-2));       // 111 1111 1111 1110
+    writer.put(0xFFFFFFFFFFFFFFFFULL, 1);  // only the least significant bit
+    EXPECT_EQ(writer.size(), 36U);
+
+    const std::string frame = writer.frame();
+    ASSERT_EQ(frame.size(), 3U + 5U + 3U);
+    EXPECT_EQ(static_cast<uint8_t>(frame[0]), 0xD3);
+    EXPECT_EQ(static_cast<uint8_t>(frame[1]), 0x00);
+    EXPECT_EQ(static_cast<uint8_t>(frame[2]), 0x05);
+    // 1011 1010 | 1011 1100 | 1101 1111 | 1111 1111 | 1101 0000 (zero padded)
+    EXPECT_EQ(static_cast<uint8_t>(frame[3]), 0xBA);
+    EXPECT_EQ(static_cast<uint8_t>(frame[4]), 0xBC);
+    EXPECT_EQ(static_cast<uint8_t>(frame[5]), 0xDF);
+    EXPECT_EQ(static_cast<uint8_t>(frame[6]), 0xFF);
+    EXPECT_EQ(static_cast<uint8_t>(frame[7]), 0xD0);
+    const auto* bytes = reinterpret_cast<const unsigned char*>(frame.data());
+    EXPECT_EQ(rtk_crc24q(bytes, 8), getbitu(bytes, 64, 24));
+}
+
+
+TEST(RtcmBitWriterTest, ClearReusesBuffer)
+{
+    Rtcm_Bit_Writer writer;
+    for (int i = 0; i < 40; i++)
+        {
+            writer.put(0xFFFFFFFFU, 32);
+        }
+    writer.frame();
+    writer.clear();
+    EXPECT_EQ(writer.size(), 0U);
+
+    // the bytes of the longer message and its CRC do not leak into the next ones
+    Rtcm_Bit_Writer fresh;
+    for (int i = 0; i < 50; i++)
+        {
+            writer.put(0x12345U, 20);
+            fresh.put(0x12345U, 20);
+        }
+    EXPECT_EQ(writer.frame(), fresh.frame());
+}
+
+
+TEST(RtcmBitWriterTest, Overflow)
+{
+    Rtcm_Bit_Writer writer;
+    for (uint32_t i = 0; i < Rtcm_Bit_Writer::MAX_MESSAGE_LENGTH_BYTES; i++)
+        {
+            writer.put(0xAB, 8);
+        }
+    EXPECT_FALSE(writer.overflow());
+    EXPECT_EQ(writer.frame().size(), 3U + Rtcm_Bit_Writer::MAX_MESSAGE_LENGTH_BYTES + 3U);
+    writer.put(1, 1);
+    EXPECT_TRUE(writer.overflow());
+    EXPECT_TRUE(writer.frame().empty());
+    writer.clear();
+    EXPECT_FALSE(writer.overflow());
+}
+
+
+TEST(RtcmBitWriterTest, RtklibDecodesStationAndEphemeris)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    auto decoder = std::make_unique<rtcm_t>();
+    ASSERT_EQ(init_rtcm(decoder.get()), 1);
+
+    const double x = 1114104.5999;
+    const double y = -4850729.7108;
+    const double z = 3975521.4643;
+    EXPECT_EQ(decode_rtcm3(decoder.get(), rtcm->print_MT1005(2003, x, y, z, true, false, false, false, false, 0)), 5);
+    EXPECT_EQ(decoder->staid, 2003);
+    EXPECT_DOUBLE_EQ(decoder->sta.pos[0], x);
+    EXPECT_DOUBLE_EQ(decoder->sta.pos[1], y);
+    EXPECT_DOUBLE_EQ(decoder->sta.pos[2], z);
+
+    Gps_Ephemeris gps_eph;
+    gps_eph.i_satellite_PRN = 3;
+    gps_eph.i_GPS_week = 2100;
+    gps_eph.d_IODE_SF2 = 45;
+    gps_eph.d_IODC = 45;
+    gps_eph.d_Toe = 345600;
+    gps_eph.d_Toc = 345600;
+    gps_eph.d_sqrt_A = 5153.7;
+    gps_eph.d_e_eccentricity = 0.01;
+    gps_eph.d_Crs = -50.0;
+    gps_eph.d_A_f0 = 1.0e-4;
+    EXPECT_EQ(decode_rtcm3(decoder.get(), rtcm->print_MT1019(gps_eph)), 2);
+    const eph_t& eph = decoder->nav.eph[satno(SYS_GPS, 3) - 1];
+    EXPECT_EQ(eph.iode, 45);
+    EXPECT_EQ(eph.iodc, 45);
+    EXPECT_DOUBLE_EQ(eph.toes, 345600.0);
+    EXPECT_NEAR(std::sqrt(eph.A), 5153.7, TWO_N19);
+    EXPECT_NEAR(eph.e, 0.01, TWO_N33);
+    EXPECT_NEAR(eph.crs, -50.0, TWO_N5);
+    EXPECT_NEAR(eph.f0, 1.0e-4, TWO_N31);
+
+    Galileo_Ephemeris gal_eph;
+    gal_eph.i_satellite_PRN = 11;
+    gal_eph.WN_5 = 1100;
+    gal_eph.IOD_nav_1 = 77;
+    gal_eph.t0e_1 = 345600;
+    gal_eph.t0c_4 = 345600;
+    gal_eph.A_1 = 5440.6;
+    gal_eph.e_1 = 0.001;
+    EXPECT_EQ(decode_rtcm3(decoder.get(), rtcm->print_MT1045(gal_eph)), 2);
+    const eph_t& eph_gal = decoder->nav.eph[satno(SYS_GAL, 11) - 1];
+    EXPECT_EQ(eph_gal.iode, 77);
+    EXPECT_DOUBLE_EQ(eph_gal.toes, 345600.0);
+    EXPECT_NEAR(std::sqrt(eph_gal.A), 5440.6, TWO_N19);
+    EXPECT_NEAR(eph_gal.e, 0.001, TWO_N33);
+
+    free_rtcm(decoder.get());
+}
+
+
+TEST(RtcmBitWriterTest, RtklibDecodesMsm)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    auto decoder = std::make_unique<rtcm_t>();
+    ASSERT_EQ(init_rtcm(decoder.get()), 1);
+
+    std::map<int32_t, Gnss_Synchro> observables;
+    observables[0] = test_observable('G', "1C", 3, 21000000.123, 41.0);
+    observables[1] = test_observable('G', "1C", 7, 22500000.456, 38.0);
+    observables[2] = test_observable('G', "1C", 12, 23700000.789, 45.0);
+    observables[3] = test_observable('G', "2S", 3, 21000003.5, 35.0);
+
+    Gps_Ephemeris gps_eph;
+    gps_eph.i_satellite_PRN = 3;
+    Gps_CNAV_Ephemeris gps_cnav_eph;
+    gps_cnav_eph.i_satellite_PRN = 3;
+    const double obs_time = 345600.0;
+    for (int msm : {4, 7})
+        {
+            const std::string message = msm == 4 ? rtcm->print_MSM_4(gps_eph, gps_cnav_eph, {}, {}, obs_time, observables, 1234, 0, 0, 0, false, false)
+                                                 : rtcm->print_MSM_7(gps_eph, gps_cnav_eph, {}, {}, obs_time, observables, 1234, 0, 0, 0, false, false);
+            ASSERT_EQ(decode_rtcm3(decoder.get(), message), 1) << "MSM" << msm;
+            ASSERT_EQ(decoder->obs.n, 3) << "MSM" << msm;
+            for (const auto& observable : observables)
+                {
+                    const Gnss_Synchro& gnss_synchro = observable.second;
+                    const int sat = satno(SYS_GPS, gnss_synchro.PRN);
+                    const int frq = gnss_synchro.Signal[0] == '1' ? 0 : 1;
+                    const obsd_t* obs = nullptr;
+                    for (int i = 0; i < decoder->obs.n; i++)
+                        {
+                            if (decoder->obs.data[i].sat == sat)
+                                {
+                                    obs = &decoder->obs.data[i];
+                                }
+                        }
+                    ASSERT_NE(obs, nullptr) << "MSM" << msm << " PRN " << gnss_synchro.PRN;
+                    EXPECT_NEAR(obs->P[frq], gnss_synchro.Pseudorange_m, msm == 4 ? 0.02 : 0.001) << "MSM" << msm << " PRN " << gnss_synchro.PRN;
+                    EXPECT_NEAR(obs->SNR[frq] / 4.0, gnss_synchro.CN0_dB_hz, 1.0) << "MSM" << msm << " PRN " << gnss_synchro.PRN;
+                }
+        }
+
+    free_rtcm(decoder.get());
+}
@@ -20,8 +20,11 @@
 
 #include "Galileo_E1.h"
 #include "rtcm.h"
+#include <chrono>
 #include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 TEST(RtcmTest, HexToBin)
 {
@@ -630,3 +633,82 @@ TEST(RtcmTest, InstantiateServerWithoutClosing)
     std::string test3_bin = rtcm->hex_to_bin(test3);
     EXPECT_EQ(0, test3_bin.compare("11111111"));
 }
+
+
+TEST(RtcmTest, ServerFanOut)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    rtcm->run_server();
+    b_io_context io_context;
+    const boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::address_v4::loopback(), 2101);
+    const int num_clients = 256;
+    std::vector<boost::asio::ip::tcp::socket> clients;
+    clients.reserve(num_clients);
+    for (int i = 0; i < num_clients; i++)
+        {
+            clients.emplace_back(io_context);
+            clients.back().connect(endpoint);
+        }
+    // the sessions join the room when the server accepts the connections
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    std::string expected;
+    for (int i = 0; i < 100; i++)
+        {
+            const std::string msg(100 + i, static_cast<char>('a' + i % 26));
+            rtcm->send_message(msg);
+            expected += msg;
+        }
+    for (auto& client : clients)
+        {
+            std::string received(expected.size(), '\0');
+            boost::asio::read(client, boost::asio::buffer(&received[0], received.size()));
+            EXPECT_EQ(received, expected);
+        }
+    rtcm->stop_server();
+}
+
+
+TEST(RtcmTest, ServerEvictsSlowClient)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    rtcm->run_server();
+    b_io_context io_context;
+    const boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::address_v4::loopback(), 2101);
+    boost::asio::ip::tcp::socket client(io_context);
+    client.open(endpoint.protocol());
+    client.set_option(boost::asio::socket_base::receive_buffer_size(4096));
+    client.connect(endpoint);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    const std::string msg(1000, 'x');
+    const std::size_t num_msgs = 20000;
+    for (std::size_t i = 0; i < num_msgs; i++)
+        {
+            rtcm->send_message(msg);
+        }
+    // the client does not read while the messages are sent
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    // then it gets what was already sent, and the end of the stream
+    client.non_blocking(true);
+    std::vector<char> buffer(65536);
+    std::size_t received = 0;
+    boost::system::error_code ec;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::steady_clock::now() < deadline)
+        {
+            received += client.read_some(boost::asio::buffer(buffer), ec);
+            if (ec == boost::asio::error::would_block)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            else if (ec)
+                {
+                    break;
+                }
+        }
+    EXPECT_EQ(ec, boost::asio::error::eof);
+    EXPECT_LT(received, num_msgs * msg.size());
+    rtcm->stop_server();
+}
@@ -0,0 +1,177 @@
+/*!
+ * \file rtklib_orbit_cache_test.cc
+ * \brief Tests for the satellite orbit and clock cache of RTKLIB against the
+ * direct computation from the broadcast ephemeris
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+
+namespace
+{
+eph_t test_gps_ephemeris()
+{
+    eph_t eph{};
+    eph.sat = satno(SYS_GPS, 5);
+    eph.iode = 10;
+    eph.iodc = 10;
+    eph.week = 2100;
+    eph.toe = gpst2time(2100, 345600.0);
+    eph.toc = eph.toe;
+    eph.toes = 345600.0;
+    eph.A = 26560.0e3;
+    eph.e = 0.01;
+    eph.i0 = 0.96;
+    eph.OMG0 = 1.0;
+    eph.omg = 0.5;
+    eph.M0 = 0.3;
+    eph.deln = 4.5e-9;
+    eph.OMGd = -8.0e-9;
+    eph.idot = 1.0e-10;
+    eph.crc = 200.0;
+    eph.crs = -50.0;
+    eph.cuc = -2.0e-6;
+    eph.cus = 5.0e-6;
+    eph.cic = 1.0e-7;
+    eph.cis = -1.0e-7;
+    eph.f0 = 1.0e-4;
+    eph.f1 = 1.0e-11;
+    return eph;
+}
+
+
+geph_t test_glonass_ephemeris()
+{
+    geph_t geph{};
+    geph.sat = satno(SYS_GLO, 3);
+    geph.iode = 20;
+    geph.toe = gpst2time(2100, 345600.0);
+    geph.pos[0] = 25510.0e3;
+    geph.vel[1] = 2.5e3;
+    geph.vel[2] = 3.0e3;
+    geph.acc[0] = 1.0e-6;
+    geph.taun = 1.0e-5;
+    geph.gamn = 1.0e-12;
+    return geph;
+}
+
+
+// maximum differences between the positions, velocities and clocks computed
+// with and without the cache, every 10 ms from toe + t_start during 120 s
+void compare(nav_t* nav, int sat, double t_start, double* max_pos, double* max_vel, double* max_clk)
+{
+    const gtime_t toe = gpst2time(2100, 345600.0);
+    auto cache = std::make_unique<orbcache_t>();
+    orbcache_reset(cache.get());
+    *max_pos = *max_vel = *max_clk = 0.0;
+    for (int n = 0; n < 12000; n++)
+        {
+            const gtime_t time = timeadd(toe, t_start + 0.01 * n);
+            double rs[6];
+            double dts[2];
+            double var;
+            int svh;
+            double rs_cache[6];
+            double dts_cache[2];
+            double var_cache;
+            int svh_cache;
+            nav->orbcache = nullptr;
+            ASSERT_EQ(ephpos(time, time, sat, nav, -1, rs, dts, &var, &svh), 1);
+            nav->orbcache = cache.get();
+            ASSERT_EQ(ephpos(time, time, sat, nav, -1, rs_cache, dts_cache, &var_cache, &svh_cache), 1);
+            EXPECT_EQ(var, var_cache);
+            EXPECT_EQ(svh, svh_cache);
+            for (int i = 0; i < 3; i++)
+                {
+                    *max_pos = std::max(*max_pos, std::abs(rs[i] - rs_cache[i]));
+                    *max_vel = std::max(*max_vel, std::abs(rs[i + 3] - rs_cache[i + 3]));
+                }
+            *max_clk = std::max(*max_clk, std::abs(dts[0] - dts_cache[0]));
+        }
+}
+}  // namespace
+
+
+TEST(RtklibOrbitCacheTest, KeplerianOrbit)
+{
+    eph_t eph = test_gps_ephemeris();
+    auto nav = std::make_unique<nav_t>();
+    nav->eph = &eph;
+    nav->n = 1;
+    double max_pos;
+    double max_vel;
+    double max_clk;
+    compare(nav.get(), eph.sat, -600.0, &max_pos, &max_vel, &max_clk);
+    EXPECT_LT(max_pos, 1.0e-4);
+    // the direct velocity is a forward difference over 1 ms
+    EXPECT_LT(max_vel, 2.0e-4);
+    EXPECT_LT(max_clk, 1.0e-12);
+}
+
+
+TEST(RtklibOrbitCacheTest, GlonassOrbit)
+{
+    geph_t geph = test_glonass_ephemeris();
+    auto nav = std::make_unique<nav_t>();
+    nav->geph = &geph;
+    nav->ng = 1;
+    double max_pos;
+    double max_vel;
+    double max_clk;
+    // the cache integrates from the previous node instead of from toe
+    compare(nav.get(), geph.sat, 300.0, &max_pos, &max_vel, &max_clk);
+    EXPECT_LT(max_pos, 1.0e-4);
+    EXPECT_LT(max_vel, 2.0e-4);
+    EXPECT_LT(max_clk, 1.0e-12);
+}
+
+
+TEST(RtklibOrbitCacheTest, NewEphemerisResetsEntry)
+{
+    eph_t eph = test_gps_ephemeris();
+    auto nav = std::make_unique<nav_t>();
+    nav->eph = &eph;
+    nav->n = 1;
+    auto cache = std::make_unique<orbcache_t>();
+    orbcache_reset(cache.get());
+    nav->orbcache = cache.get();
+    const gtime_t time = timeadd(eph.toe, 1.5);
+    double rs[6];
+    double dts[2];
+    double var;
+    int svh;
+    ASSERT_EQ(ephpos(time, time, eph.sat, nav.get(), -1, rs, dts, &var, &svh), 1);
+
+    // same IODE, but another orbit
+    eph.M0 += 1.0e-3;
+    double rs_new[6];
+    double dts_new[2];
+    ASSERT_EQ(ephpos(time, time, eph.sat, nav.get(), -1, rs_new, dts_new, &var, &svh), 1);
+    nav->orbcache = nullptr;
+    double rs_direct[6];
+    double dts_direct[2];
+    ASSERT_EQ(ephpos(time, time, eph.sat, nav.get(), -1, rs_direct, dts_direct, &var, &svh), 1);
+    for (int i = 0; i < 3; i++)
+        {
+            EXPECT_GT(std::abs(rs_new[i] - rs[i]), 1.0);
+            EXPECT_NEAR(rs_new[i], rs_direct[i], 1.0e-4);
+        }
+}
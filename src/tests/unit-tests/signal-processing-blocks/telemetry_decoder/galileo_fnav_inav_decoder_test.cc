@@ -19,9 +19,9 @@
  * -------------------------------------------------------------------------
  */
 
-#include "convolutional.h"
 #include "galileo_fnav_message.h"
 #include "galileo_navigation_message.h"
+#include "viterbi_decoder.h"
 #include <armadillo>
 #include <gtest/gtest.h>
 #include <volk_gnsssdr/volk_gnsssdr.h>
@@ -37,16 +37,14 @@ public:
     Galileo_Navigation_Message INAV_decoder;
     Galileo_Fnav_Message FNAV_decoder;
     // vars for Viterbi decoder
-    int32_t *out0, *out1, *state0, *state1;
-    int32_t g_encoder[2];
     const int32_t nn = 2;  // Coding rate 1/n
     const int32_t KK = 7;  // Constraint Length
     int32_t mm = KK - 1;
+    Viterbi_Decoder viterbi{{{121, 91}}, 244};  // Polynomials G1 and G2, longest (F/NAV) page
     int32_t flag_even_word_arrived;
     void viterbi_decoder(float *page_part_symbols, int32_t *page_part_bits, int32_t _datalength)
     {
-        Viterbi(page_part_bits, out0, state0, out1, state1,
-            page_part_symbols, KK, nn, _datalength);
+        viterbi.decode_block(page_part_symbols, page_part_bits, _datalength);
     }
 
 
@@ -149,7 +147,7 @@ public:
 
         // 3. Call the Galileo page decoder
         std::string page_String;
-        for (int32_t i = 0; i < frame_length; i++)
+        for (int32_t i = 0; i < (frame_length / 2); i++)
             {
                 if (page_bits[i] > 0)
                     {
@@ -174,27 +172,10 @@ public:
 
     Galileo_FNAV_INAV_test()
     {
-        // vars for Viterbi decoder
-        int32_t max_states = 1 << mm;  // 2^mm
-        g_encoder[0] = 121;            // Polynomial G1
-        g_encoder[1] = 91;             // Polynomial G2
-        out0 = static_cast<int32_t *>(volk_gnsssdr_malloc(max_states * sizeof(int32_t), volk_gnsssdr_get_alignment()));
-        out1 = static_cast<int32_t *>(volk_gnsssdr_malloc(max_states * sizeof(int32_t), volk_gnsssdr_get_alignment()));
-        state0 = static_cast<int32_t *>(volk_gnsssdr_malloc(max_states * sizeof(int32_t), volk_gnsssdr_get_alignment()));
-        state1 = static_cast<int32_t *>(volk_gnsssdr_malloc(max_states * sizeof(int32_t), volk_gnsssdr_get_alignment()));
-        // create appropriate transition matrices
-        nsc_transit(out0, state0, 0, g_encoder, KK, nn);
-        nsc_transit(out1, state1, 1, g_encoder, KK, nn);
         flag_even_word_arrived = 0;
     }
 
-    ~Galileo_FNAV_INAV_test()
-    {
-        volk_gnsssdr_free(out0);
-        volk_gnsssdr_free(out1);
-        volk_gnsssdr_free(state0);
-        volk_gnsssdr_free(state1);
-    }
+    ~Galileo_FNAV_INAV_test() = default;
 };
 
 TEST_F(Galileo_FNAV_INAV_test, ValidationOfResults)
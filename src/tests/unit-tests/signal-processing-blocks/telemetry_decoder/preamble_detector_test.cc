@@ -0,0 +1,116 @@
+/*!
+ * \file preamble_detector_test.cc
+ * \brief Tests for the bit-packed sliding preamble correlator, against the
+ * per-symbol sign test formerly used by the telemetry decoders
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "preamble_detector.h"
+#include <boost/circular_buffer.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+std::vector<int32_t> random_preamble(int32_t length, std::default_random_engine& e)
+{
+    std::uniform_int_distribution<int32_t> bit_dist(0, 1);
+    std::vector<int32_t> preamble(length);
+    for (auto& symbol : preamble)
+        {
+            symbol = bit_dist(e) ? 1 : -1;
+        }
+    return preamble;
+}
+}  // namespace
+
+
+TEST(PreambleDetectorTest, SlidingWindowMatchesSignTest)
+{
+    std::default_random_engine e(1234);
+    std::uniform_real_distribution<float> symbol_dist(-1.0, 1.0);
+    // GPS L1 C/A, Galileo I/NAV, BeiDou D1, GLONASS (several words) and an exact multiple of 64
+    for (const int32_t length : {8, 10, 11, 128, 300})
+        {
+            const std::vector<int32_t> preamble = random_preamble(length, e);
+            Preamble_Detector detector(preamble.data(), length);
+            // the telemetry decoders correlate the oldest symbols of their history
+            boost::circular_buffer<float> history(3 * length);
+            for (int32_t n = 0; n < 10 * length; n++)
+                {
+                    const bool history_full = history.full();
+                    history.push_back(symbol_dist(e));
+                    if (history_full)
+                        {
+                            detector.push(history[length - 1]);
+                        }
+                    else if (static_cast<int32_t>(history.size()) <= length)
+                        {
+                            detector.push(history.back());
+                        }
+                    EXPECT_EQ(detector.ready(), static_cast<int32_t>(history.size()) >= length);
+                    if (detector.ready())
+                        {
+                            int32_t corr_value = 0;
+                            float soft_value = 0.0;
+                            for (int32_t i = 0; i < length; i++)
+                                {
+                                    if (history[i] < 0.0)
+                                        {
+                                            corr_value -= preamble[i];
+                                        }
+                                    else
+                                        {
+                                            corr_value += preamble[i];
+                                        }
+                                    soft_value += history[i] * static_cast<float>(preamble[i]);
+                                }
+                            ASSERT_EQ(detector.correlation(), corr_value) << "length " << length << ", symbol " << n;
+                            ASSERT_NEAR(detector.soft_correlation(), soft_value, 1e-3) << "length " << length << ", symbol " << n;
+                        }
+                }
+        }
+}
+
+
+TEST(PreambleDetectorTest, DetectsPreambleAndPolarity)
+{
+    std::default_random_engine e(4321);
+    const int32_t length = 11;
+    const std::vector<int32_t> preamble = random_preamble(length, e);
+    Preamble_Detector detector(preamble.data(), length);
+    for (const auto symbol : preamble)
+        {
+            detector.push(0.8F * static_cast<float>(symbol));
+        }
+    EXPECT_EQ(detector.correlation(), length);
+    EXPECT_NEAR(detector.soft_correlation(), 0.8 * length, 1e-4);
+
+    // a 180 degrees phase ambiguity flips the correlation sign
+    for (const auto symbol : preamble)
+        {
+            detector.push(-0.5F * static_cast<float>(symbol));
+        }
+    EXPECT_EQ(detector.correlation(), -length);
+    EXPECT_NEAR(detector.soft_correlation(), -0.5 * length, 1e-4);
+
+    detector.reset();
+    EXPECT_FALSE(detector.ready());
+    EXPECT_EQ(detector.fill(), 0);
+    EXPECT_FLOAT_EQ(detector.soft_correlation(), 0.0);
+}
@@ -0,0 +1,98 @@
+/*!
+ * \file symbol_ring_test.cc
+ * \brief Tests for the mirrored symbol history of the telemetry decoders,
+ * against the boost::circular_buffer formerly used
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "symbol_ring.h"
+#include <boost/circular_buffer.hpp>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <random>
+
+
+TEST(SymbolRingTest, MatchesCircularBuffer)
+{
+    std::default_random_engine e(1234);
+    std::uniform_real_distribution<float> symbol_dist(-1.0, 1.0);
+    // GPS L1 C/A subframe, Galileo I/NAV page part plus preamble, and small sizes
+    for (const size_t capacity : {1, 7, 310, 511})
+        {
+            Symbol_Ring<float> ring(capacity);
+            boost::circular_buffer<float> reference(capacity);
+            for (size_t n = 0; n < 4 * capacity + 3; n++)
+                {
+                    ASSERT_EQ(ring.full(), reference.full());
+                    const float symbol = symbol_dist(e);
+                    ring.push_back(symbol);
+                    reference.push_back(symbol);
+                    ASSERT_EQ(ring.size(), reference.size());
+                    ASSERT_EQ(ring.back(), reference.back());
+                    ASSERT_EQ(ring.front(), reference.front());
+                    // any window of the history is contiguous
+                    const size_t first = ring.size() / 3;
+                    const size_t length = ring.size() - first;
+                    const auto window = ring.span(first, length);
+                    for (size_t i = 0; i < length; i++)
+                        {
+                            ASSERT_EQ(window[i], reference[first + i]) << "capacity " << capacity << ", symbol " << n;
+                            ASSERT_EQ(&window[i], &ring[first + i]);
+                        }
+                }
+            size_t i = 0;
+            for (const float symbol : ring)
+                {
+                    EXPECT_EQ(symbol, reference[i++]);
+                }
+            EXPECT_EQ(i, capacity);
+            ring.clear();
+            EXPECT_TRUE(ring.empty());
+            EXPECT_FALSE(ring.full());
+        }
+}
+
+
+TEST(SymbolRingTest, SetCapacityKeepsOldest)
+{
+    Symbol_Ring<int> ring(5);
+    boost::circular_buffer<int> reference(5);
+    for (int n = 0; n < 8; n++)
+        {
+            ring.push_back(n);
+            reference.push_back(n);
+        }
+    ring.set_capacity(3);
+    reference.set_capacity(3);
+    ASSERT_EQ(ring.size(), reference.size());
+    for (size_t i = 0; i < ring.size(); i++)
+        {
+            EXPECT_EQ(ring[i], reference[i]);
+        }
+    ring.set_capacity(6);
+    reference.set_capacity(6);
+    for (int n = 8; n < 12; n++)
+        {
+            ring.push_back(n);
+            reference.push_back(n);
+        }
+    ASSERT_EQ(ring.size(), reference.size());
+    const auto window = ring.span(0, ring.size());
+    for (size_t i = 0; i < ring.size(); i++)
+        {
+            EXPECT_EQ(window[i], reference[i]);
+        }
+}
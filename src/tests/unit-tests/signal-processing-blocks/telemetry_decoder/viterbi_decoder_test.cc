@@ -0,0 +1,135 @@
+/*!
+ * \file viterbi_decoder_test.cc
+ * \brief Tests for the K=7, r=1/2 Viterbi decoder, in block and continuous
+ * decoding modes
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "convolutional.h"
+#include "viterbi_decoder.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Encodes bits (plus 6 zero tail bits if add_tail is true) and returns BPSK symbols with noise
+template <typename T>
+std::vector<T> encode_bits(const std::vector<int32_t>& bits, bool add_tail, T sigma, std::default_random_engine& e, int& encoder_state)
+{
+    std::array<int, 2> g_encoder{{121, 91}};
+    std::normal_distribution<T> noise(0.0, sigma);
+    std::vector<int32_t> all_bits(bits);
+    if (add_tail)
+        {
+            all_bits.insert(all_bits.end(), 6, 0);
+        }
+    std::vector<T> symbols;
+    for (const auto bit : all_bits)
+        {
+            int next_state;
+            const int out = nsc_enc_bit(&next_state, bit, encoder_state, g_encoder.data(), 7, 2);
+            encoder_state = next_state;
+            symbols.push_back(((out >> 1) & 1 ? 1.0 : -1.0) + noise(e));
+            symbols.push_back((out & 1 ? 1.0 : -1.0) + noise(e));
+        }
+    return symbols;
+}
+}  // namespace
+
+
+TEST(ViterbiDecoderTest, BlockDecoding)
+{
+    std::default_random_engine e(1234);
+    std::uniform_int_distribution<int32_t> bit_dist(0, 1);
+    const int32_t LL = 238;  // Galileo F/NAV page
+    Viterbi_Decoder decoder({{121, 91}}, LL + 6);
+    std::vector<int32_t> decoded(LL);
+    int32_t errors = 0;
+    for (int32_t page = 0; page < 100; page++)
+        {
+            std::vector<int32_t> bits(LL);
+            for (auto& b : bits)
+                {
+                    b = bit_dist(e);
+                }
+            int encoder_state = 0;
+            // Eb/N0 ~ 5 dB
+            const std::vector<float> symbols = encode_bits<float>(bits, true, 0.6, e, encoder_state);
+            decoder.decode_block(symbols.data(), decoded.data(), LL);
+            for (int32_t i = 0; i < LL; i++)
+                {
+                    errors += (decoded[i] != bits[i]);
+                }
+        }
+    EXPECT_EQ(errors, 0);
+}
+
+
+TEST(ViterbiDecoderTest, ContinuousDecoding)
+{
+    std::default_random_engine e(4321);
+    std::uniform_int_distribution<int32_t> bit_dist(0, 1);
+    const int32_t block_bits = 30;
+    const int32_t traceback_depth = 35;
+    Viterbi_Decoder aligned({{121, 91}}, block_bits + traceback_depth);
+    Viterbi_Decoder shifted({{121, 91}}, block_bits + traceback_depth);
+
+    std::vector<int32_t> sent_bits;
+    std::vector<int32_t> received_bits;
+    int encoder_state = 0;
+    double past_symbol = 0.0;
+    for (int32_t block = 0; block < 100; block++)
+        {
+            std::vector<int32_t> bits(block_bits);
+            for (auto& b : bits)
+                {
+                    b = bit_dist(e);
+                }
+            sent_bits.insert(sent_bits.end(), bits.begin(), bits.end());
+            const std::vector<double> symbols = encode_bits<double>(bits, false, 0.6, e, encoder_state);
+            std::vector<double> symbols_shifted(1, past_symbol);
+            symbols_shifted.insert(symbols_shifted.end(), symbols.begin(), symbols.end() - 1);
+            past_symbol = symbols.back();
+
+            std::vector<int32_t> decoded(block_bits);
+            std::vector<int32_t> decoded_shifted(block_bits);
+            int32_t nbits_decoded = 0;
+            int32_t nbits_decoded_shifted = 0;
+            const float metric = aligned.decode_continuous(symbols.data(), traceback_depth, decoded.data(), block_bits, nbits_decoded);
+            const float metric_shifted = shifted.decode_continuous(symbols_shifted.data(), traceback_depth, decoded_shifted.data(), block_bits, nbits_decoded_shifted);
+            if (nbits_decoded > 0)
+                {
+                    // the right symbol alignment must provide the best metric
+                    EXPECT_GT(metric, metric_shifted);
+                }
+            for (int32_t i = 0; i < nbits_decoded; i++)
+                {
+                    received_bits.push_back(decoded[i]);
+                }
+        }
+
+    // only the last traceback_depth bits are still in the trellis
+    ASSERT_EQ(received_bits.size(), sent_bits.size() - traceback_depth);
+    int32_t errors = 0;
+    for (size_t i = 0; i < received_bits.size(); i++)
+        {
+            errors += (received_bits[i] != sent_bits[i]);
+        }
+    EXPECT_EQ(errors, 0);
+}
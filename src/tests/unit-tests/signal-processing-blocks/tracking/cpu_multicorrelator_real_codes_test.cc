@@ -26,9 +26,11 @@
 #include <gtest/gtest.h>
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>
 #include <chrono>
+#include <cmath>
 #include <complex>
 #include <random>
 #include <thread>
+#include <vector>
 
 
 DEFINE_int32(cpu_multicorrelator_real_codes_iterations_test, 100, "Number of averaged iterations in CPU multicorrelator test timing test");
@@ -54,6 +56,53 @@ void run_correlator_cpu_real_codes(Cpu_Multicorrelator_Real_Codes* correlator,
 }
 
 
+namespace
+{
+// Correlator outputs for two consecutive epochs of the signal, split among n_threads
+std::vector<gr_complex> correlate_two_epochs(const volk_gnsssdr::vector<gr_complex>& signal,
+    volk_gnsssdr::vector<float>& code,
+    volk_gnsssdr::vector<float>& shifts_chips,
+    bool high_dynamics,
+    int n_threads,
+    int length,
+    float phase_step_rad,
+    float phase_rate_step_rad,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips)
+{
+    const int n_taps = static_cast<int>(shifts_chips.size());
+    std::vector<gr_complex> outputs;
+    volk_gnsssdr::vector<gr_complex> corr_out(n_taps, gr_complex(0.0, 0.0));
+    Cpu_Multicorrelator_Real_Codes correlator;
+    correlator.set_high_dynamics_resampler(high_dynamics);
+    correlator.init(length, n_taps);
+    correlator.set_split_epoch_threads(n_threads);
+    correlator.set_local_code_and_taps(static_cast<int>(code.size()), code.data(), shifts_chips.data());
+    for (int epoch = 0; epoch < 2; epoch++)
+        {
+            // phases at the first sample of the epoch
+            const double k0 = static_cast<double>(epoch) * length;
+            const auto rem_carrier_phase_rad = static_cast<float>(std::fmod(0.3 + phase_step_rad * k0 + phase_rate_step_rad * k0 * k0, PI_2));
+            const auto rem_code_phase_chips = static_cast<float>(-std::fmod(code_phase_step_chips * k0 + code_phase_rate_step_chips * k0 * k0, static_cast<double>(code.size())));
+            correlator.set_input_output_vectors(corr_out.data(), signal.data() + epoch * length);
+            if (high_dynamics)
+                {
+                    correlator.Carrier_wipeoff_multicorrelator_resampler(rem_carrier_phase_rad, phase_step_rad, phase_rate_step_rad,
+                        rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, length);
+                }
+            else
+                {
+                    correlator.Carrier_wipeoff_multicorrelator_resampler(rem_carrier_phase_rad, phase_step_rad,
+                        rem_code_phase_chips, code_phase_step_chips, 0.0, length);
+                }
+            outputs.insert(outputs.end(), corr_out.begin(), corr_out.end());
+        }
+    correlator.free();
+    return outputs;
+}
+}  // namespace
+
+
 TEST(CpuMulticorrelatorRealCodesTest, MeasureExecutionTime)
 {
     std::chrono::time_point<std::chrono::system_clock> start;
@@ -255,3 +304,59 @@ TEST(CpuMulticorrelatorRealCodesTest, MeasureExecutionTimeAlloc)
             correlator_pool[n]->free();
         }
 }
+
+
+TEST(CpuMulticorrelatorRealCodesTest, SplitEpochMatchesSingleThread)
+{
+    // lengths that are not multiples of the segments, the last one shorter
+    // than a segment for each thread
+    const std::vector<int> lengths = {4037, 2047, 150};
+    const int max_length = 4037;
+    const float sampling_freq_hz = 4.0e6;
+    const float code_phase_step_chips = GPS_L1_CA_CODE_RATE_CPS / sampling_freq_hz;
+    const float phase_step_rad = PI_2 * 1234.5 / sampling_freq_hz;
+
+    volk_gnsssdr::vector<float> code(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+    gps_l1_ca_code_gen_float(code, 7, 0);
+    volk_gnsssdr::vector<float> shifts_chips = {-0.5, 0.0, 0.5};  // Early, Prompt, and Late
+
+    for (const bool high_dynamics : {false, true})
+        {
+            const float phase_rate_step_rad = high_dynamics ? 2.0e-9 : 0.0;
+            const float code_phase_rate_step_chips = high_dynamics ? 1.0e-8 : 0.0;
+
+            // two epochs of the code on the carrier, plus noise
+            std::default_random_engine e1(1);
+            std::normal_distribution<float> noise(0.0, 0.5);
+            volk_gnsssdr::vector<gr_complex> signal(2 * max_length);
+            for (int n = 0; n < 2 * max_length; n++)
+                {
+                    const double chip = code_phase_step_chips * static_cast<double>(n) + code_phase_rate_step_chips * static_cast<double>(n) * n;
+                    const double phase = 0.3 + phase_step_rad * static_cast<double>(n) + phase_rate_step_rad * static_cast<double>(n) * n;
+                    const float code_value = code[static_cast<int>(std::floor(chip)) % code.size()];
+                    signal[n] = gr_complex(code_value * std::cos(phase) + noise(e1), code_value * std::sin(phase) + noise(e1));
+                }
+
+            for (const int length : lengths)
+                {
+                    const std::vector<gr_complex> reference = correlate_two_epochs(signal, code, shifts_chips, high_dynamics, 1,
+                        length, phase_step_rad, phase_rate_step_rad, code_phase_step_chips, code_phase_rate_step_chips);
+                    // the prompt correlator is aligned with the signal
+                    EXPECT_GT(std::abs(reference[1]), 0.5 * length);
+                    EXPECT_GT(std::abs(reference[4]), 0.5 * length);
+                    for (const int n_threads : {2, 3, 4})
+                        {
+                            const std::vector<gr_complex> split = correlate_two_epochs(signal, code, shifts_chips, high_dynamics, n_threads,
+                                length, phase_step_rad, phase_rate_step_rad, code_phase_step_chips, code_phase_rate_step_chips);
+                            ASSERT_EQ(split.size(), reference.size());
+                            for (size_t k = 0; k < reference.size(); k++)
+                                {
+                                    EXPECT_NEAR(split[k].real(), reference[k].real(), 1.0e-3 * length)
+                                        << "high dynamics: " << high_dynamics << ", length: " << length << ", threads: " << n_threads << ", output: " << k;
+                                    EXPECT_NEAR(split[k].imag(), reference[k].imag(), 1.0e-3 * length)
+                                        << "high dynamics: " << high_dynamics << ", length: " << length << ", threads: " << n_threads << ", output: " << k;
+                                }
+                        }
+                }
+        }
+}
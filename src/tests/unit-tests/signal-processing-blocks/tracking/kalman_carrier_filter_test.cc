@@ -0,0 +1,74 @@
+/*!
+ * \file kalman_carrier_filter_test.cc
+ * \brief Tests the compile-time sized Kalman carrier filter against the
+ * equivalent formulation with dynamically sized matrices.
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "kalman_carrier_filter.h"
+#include <armadillo>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+TEST(KalmanCarrierFilterTest, ThirdOrderMatchesDynamicMatrices)
+{
+    const double T = 0.001;
+    const double R = 0.05;
+
+    Kalman_Carrier_Filter<3> kf;
+    kf.set_model(T, {std::pow(T, 4), T, T});
+    kf.set_initial_covariance({1.5, 450.0, 30.0});
+    kf.reset({0.1, 1000.0, 2.0});
+
+    arma::mat F = arma::eye(3, 3);
+    F(0, 1) = 2.0 * arma::datum::pi * T;
+    F(0, 2) = 0.5 * 2.0 * arma::datum::pi * T * T;
+    F(1, 2) = T;
+    arma::mat Q = arma::zeros(3, 3);
+    Q(0, 0) = std::pow(T, 4);
+    Q(1, 1) = T;
+    Q(2, 2) = T;
+    arma::mat H = arma::zeros(1, 3);
+    H(0, 0) = 1.0;
+    arma::mat P = arma::diagmat(arma::vec({1.5, 450.0, 30.0}));
+    arma::vec x = {0.1, 1000.0, 2.0};
+
+    EXPECT_LT(arma::abs(F - kf.transition_matrix()).max(), 1e-15);
+
+    std::default_random_engine e(0);
+    std::normal_distribution<double> normal_dist(0.0, 0.2);
+    for (int i = 0; i < 1000; i++)
+        {
+            const double y = normal_dist(e);
+            arma::vec x_pre = F * x;
+            arma::mat P_pre = F * P * F.t() + Q;
+            arma::mat P_y = H * P_pre * H.t() + R;
+            arma::mat K = (P_pre * H.t()) * arma::inv(P_y);
+            x = x_pre + K * y;
+            P = (arma::eye(3, 3) - K * H) * P_pre;
+
+            kf.predict();
+            kf.update(y, kf.predicted_measurement_variance() + R);
+        }
+
+    for (unsigned int i = 0; i < 3; i++)
+        {
+            EXPECT_NEAR(x(i), kf.state(i), 1e-9 * std::max(1.0, std::abs(x(i))));
+        }
+    EXPECT_LT(arma::abs(P - kf.covariance()).max(), 1e-9);
+}
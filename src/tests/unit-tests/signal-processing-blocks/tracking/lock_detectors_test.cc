@@ -0,0 +1,54 @@
+/*!
+ * \file lock_detectors_test.cc
+ * \brief Tests the streaming C/N0 estimators and carrier lock detector
+ * against the estimators working on a whole window of prompt samples.
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "lock_detectors.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+TEST(LockDetectorsTest, StreamingMatchesWindowEstimators)
+{
+    const int window_length = 20;
+    const float coh_integration_time_s = 0.001;
+    std::vector<gr_complex> window(window_length);
+    Streaming_Lock_Detector<float> detector(window_length);
+    Streaming_Lock_Detector<double> detector_d(window_length);
+
+    std::default_random_engine e(0);
+    std::normal_distribution<float> normal_dist(0.0, 1.0);
+    for (int n = 0; n < 10000; n++)
+        {
+            gr_complex prompt(5.0F + normal_dist(e), normal_dist(e));
+            window[n % window_length] = prompt;
+            detector.update(prompt);
+            detector_d.update(std::complex<double>(prompt.real(), prompt.imag()));
+            ASSERT_EQ(detector.ready(), n >= window_length - 1);
+            if (detector.ready())
+                {
+                    float cn0_m2m4 = cn0_m2m4_estimator(window.data(), window_length, coh_integration_time_s);
+                    float cn0_svn = cn0_svn_estimator(window.data(), window_length, coh_integration_time_s);
+                    float lock = carrier_lock_detector(window.data(), window_length);
+                    ASSERT_NEAR(cn0_m2m4, detector.cn0_m2m4(coh_integration_time_s), 0.01);
+                    ASSERT_NEAR(cn0_svn, detector.cn0_svn(coh_integration_time_s), 0.01);
+                    ASSERT_NEAR(lock, detector.carrier_lock(), 1e-4);
+                    ASSERT_NEAR(cn0_m2m4, detector_d.cn0_m2m4(coh_integration_time_s), 0.01);
+                }
+        }
+}
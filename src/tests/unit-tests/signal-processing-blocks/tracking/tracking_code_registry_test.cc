@@ -0,0 +1,92 @@
+/*!
+ * \file tracking_code_registry_test.cc
+ * \brief Tests for the shared registry of tracking code replicas.
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "Galileo_E1.h"
+#include "galileo_e1_signal_processing.h"
+#include "gps_sdr_signal_processing.h"
+#include "tracking_code_registry.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST(TrackingCodeRegistryTest, GpsL1CaMatchesCodeGenerator)
+{
+    const auto code_length = static_cast<uint32_t>(GPS_L1_CA_CODE_LENGTH_CHIPS);
+    for (uint32_t prn = 1; prn <= 32; prn++)
+        {
+            const Tracking_Codes& codes = Tracking_Code_Registry::get("GPS", "1C", prn, code_length, false);
+            ASSERT_EQ(codes.tracking_code.size(), 2 * code_length);
+            EXPECT_TRUE(codes.data_code.empty());
+            std::vector<float> expected(2 * code_length, 0.0);
+            gps_l1_ca_code_gen_float(expected, prn, 0);
+            for (uint32_t i = 0; i < 2 * code_length; i++)
+                {
+                    ASSERT_EQ(codes.tracking_code[i], expected[i]);
+                }
+        }
+}
+
+
+TEST(TrackingCodeRegistryTest, GalileoE1PilotAndData)
+{
+    const auto code_length = static_cast<uint32_t>(GALILEO_E1_B_CODE_LENGTH_CHIPS);
+    const uint32_t prn = 11;
+    const Tracking_Codes& codes = Tracking_Code_Registry::get("Galileo", "1B", prn, code_length, true);
+    ASSERT_EQ(codes.tracking_code.size(), 2 * code_length);
+    ASSERT_EQ(codes.data_code.size(), 2 * code_length);
+
+    std::vector<float> pilot(2 * code_length, 0.0);
+    std::vector<float> data(2 * code_length, 0.0);
+    const std::array<char, 3> pilot_signal = {{'1', 'C', '\0'}};
+    const std::array<char, 3> data_signal = {{'1', 'B', '\0'}};
+    galileo_e1_code_gen_sinboc11_float(pilot, pilot_signal, prn);
+    galileo_e1_code_gen_sinboc11_float(data, data_signal, prn);
+    for (uint32_t i = 0; i < 2 * code_length; i++)
+        {
+            ASSERT_EQ(codes.tracking_code[i], pilot[i]);
+            ASSERT_EQ(codes.data_code[i], data[i]);
+        }
+}
+
+
+TEST(TrackingCodeRegistryTest, ConcurrentRequestsShareTables)
+{
+    const auto code_length = static_cast<uint32_t>(GPS_L1_CA_CODE_LENGTH_CHIPS);
+    const int n_threads = 8;
+    std::vector<const Tracking_Codes*> results(n_threads, nullptr);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; t++)
+        {
+            threads.emplace_back([&results, t, code_length]() { results[t] = &Tracking_Code_Registry::get("GPS", "1C", 7, code_length, false); });
+        }
+    for (auto& th : threads)
+        {
+            th.join();
+        }
+    for (int t = 1; t < n_threads; t++)
+        {
+            EXPECT_EQ(results[0], results[t]);
+        }
+    const size_t n_tables = Tracking_Code_Registry::size();
+    Tracking_Code_Registry::get("GPS", "1C", 7, code_length, false);
+    EXPECT_EQ(Tracking_Code_Registry::size(), n_tables);
+}
@@ -0,0 +1,229 @@
+/*!
+ * \file gnss_crc_test.cc
+ * \brief Tests for the CRC-24Q, GPS LNAV parity and GLONASS Hamming code
+ * checks of the navigation messages
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "GLONASS_L1_L2_CA.h"
+#include "Galileo_E1.h"
+#include "gnss_crc.h"
+#include <boost/crc.hpp>
+#include <gtest/gtest.h>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+using Boost_Crc24q_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
+
+
+uint32_t boost_crc24q(const std::vector<uint8_t>& bytes)
+{
+    Boost_Crc24q_type crc;
+    crc.process_bytes(bytes.data(), bytes.size());
+    return crc.checksum();
+}
+
+
+// GPS LNAV parity equations, IS-GPS-200 Table 20-XIV, one bit at a time
+bool gps_parity_bitwise(uint32_t word)
+{
+    const std::vector<std::vector<int32_t>> equations{
+        {1, 2, 3, 5, 6, 10, 11, 12, 13, 14, 17, 18, 20, 23},
+        {2, 3, 4, 6, 7, 11, 12, 13, 14, 15, 18, 19, 21, 24},
+        {1, 3, 4, 5, 7, 8, 12, 13, 14, 15, 16, 19, 20, 22},
+        {2, 4, 5, 6, 8, 9, 13, 14, 15, 16, 17, 20, 21, 23},
+        {1, 3, 5, 6, 7, 9, 10, 14, 15, 16, 17, 18, 21, 22, 24},
+        {3, 5, 6, 8, 9, 10, 11, 13, 15, 19, 22, 23, 24}};
+    const uint32_t d29_star = (word >> 31U) & 1U;
+    const uint32_t d30_star = (word >> 30U) & 1U;
+    for (size_t k = 0; k < equations.size(); k++)
+        {
+            // D25, D27 and D30 start from D29*; D26, D28 and D29 start from D30*
+            uint32_t p = (k == 0 or k == 2 or k == 5) ? d29_star : d30_star;
+            for (const auto i : equations[k])
+                {
+                    p ^= (word >> static_cast<uint32_t>(30 - i)) & 1U;
+                }
+            if (p != ((word >> static_cast<uint32_t>(5 - k)) & 1U))
+                {
+                    return false;
+                }
+        }
+    return true;
+}
+
+
+// GLONASS Hamming code verification, one checksum at a time over std::bitset
+bool glonass_hamming_bitwise(const std::bitset<GLONASS_GNAV_STRING_BITS>& bits)
+{
+    const std::vector<const std::vector<int32_t>*> indexes{&GLONASS_GNAV_CRC_I_INDEX, &GLONASS_GNAV_CRC_J_INDEX, &GLONASS_GNAV_CRC_K_INDEX, &GLONASS_GNAV_CRC_L_INDEX, &GLONASS_GNAV_CRC_M_INDEX, &GLONASS_GNAV_CRC_N_INDEX, &GLONASS_GNAV_CRC_P_INDEX};
+    int32_t sum_checks = 0;
+    for (size_t k = 0; k < indexes.size(); k++)
+        {
+            int32_t c = bits[k];
+            for (const auto i : *indexes[k])
+                {
+                    c ^= bits[i - 1];
+                }
+            sum_checks += c;
+        }
+    const auto c_sigma = static_cast<int32_t>(bits.count() % 2);
+    return (sum_checks == 0 and c_sigma == 0) or (sum_checks == 1 and c_sigma == 1);
+}
+}  // namespace
+
+
+TEST(GnssCrcTest, Crc24qBytesMatchesBoost)
+{
+    std::default_random_engine e(1234);
+    std::uniform_int_distribution<int> byte_dist(0, 255);
+    for (size_t n = 0; n < 70; n++)
+        {
+            std::vector<uint8_t> bytes(n);
+            for (auto& b : bytes)
+                {
+                    b = static_cast<uint8_t>(byte_dist(e));
+                }
+            EXPECT_EQ(compute_crc24q(bytes.data(), bytes.size()), boost_crc24q(bytes)) << n << " bytes";
+        }
+    // the remainder of a message followed by its CRC is zero
+    std::vector<uint8_t> message{0x53, 0x48, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    const uint32_t crc = compute_crc24q(message.data(), message.size());
+    message.push_back(static_cast<uint8_t>(crc >> 16U));
+    message.push_back(static_cast<uint8_t>(crc >> 8U));
+    message.push_back(static_cast<uint8_t>(crc));
+    EXPECT_EQ(compute_crc24q(message.data(), message.size()), 0U);
+}
+
+
+TEST(GnssCrcTest, Crc24qPackedBitsMatchesZeroPaddedBytes)
+{
+    std::default_random_engine e(4321);
+    std::uniform_int_distribution<int> bit_dist(0, 1);
+    for (size_t n_bits = 1; n_bits < 300; n_bits++)
+        {
+            std::string bits(n_bits, '0');
+            for (auto& c : bits)
+                {
+                    c = bit_dist(e) ? '1' : '0';
+                }
+            // bytes of the message padded with zeros at the start
+            const std::string padded = std::string((8 - n_bits % 8) % 8, '0') + bits;
+            std::vector<uint8_t> bytes;
+            for (size_t i = 0; i < padded.size(); i += 8)
+                {
+                    bytes.push_back(static_cast<uint8_t>(std::bitset<8>(padded.substr(i, 8)).to_ulong()));
+                }
+            std::vector<uint64_t> words((n_bits + 63) / 64, 0ULL);
+            for (size_t p = 0; p < n_bits; p++)
+                {
+                    if (bits[p] == '1')
+                        {
+                            words[p / 64] |= (1ULL << (63U - p % 64));
+                        }
+                }
+            ASSERT_EQ(compute_crc24q_bits(words.data(), n_bits), boost_crc24q(bytes)) << n_bits << " bits";
+        }
+}
+
+
+TEST(GnssCrcTest, GalileoInavPage)
+{
+    std::default_random_engine e(1111);
+    std::uniform_int_distribution<int> bit_dist(0, 1);
+    std::string page(GALILEO_DATA_FRAME_BITS, '0');
+    for (auto& c : page)
+        {
+            c = bit_dist(e) ? '1' : '0';
+        }
+    const Nav_Message_Bits<GALILEO_DATA_FRAME_BITS> bits(page);
+    const uint32_t crc = compute_crc24q(bits);
+
+    // appending the CRC to the page gives a zero remainder
+    const std::string page_and_crc = page + std::bitset<24>(crc).to_string();
+    const Nav_Message_Bits<GALILEO_DATA_FRAME_BITS + 24> bits_and_crc(page_and_crc);
+    EXPECT_EQ(compute_crc24q(bits_and_crc), 0U);
+
+    std::string corrupted = page;
+    corrupted[100] = corrupted[100] == '1' ? '0' : '1';
+    EXPECT_NE(compute_crc24q(Nav_Message_Bits<GALILEO_DATA_FRAME_BITS>(corrupted)), crc);
+}
+
+
+TEST(GnssCrcTest, GpsLnavParityMatchesEquations)
+{
+    std::default_random_engine e(2222);
+    std::uniform_int_distribution<uint32_t> word_dist;
+    int32_t n_valid = 0;
+    for (int32_t n = 0; n < 20000; n++)
+        {
+            uint32_t word = word_dist(e);
+            if (n % 2 == 0)
+                {
+                    // force valid parity bits from the equations
+                    for (uint32_t parity = 0; parity < 64; parity++)
+                        {
+                            word = (word & ~0x3FU) | parity;
+                            if (gps_parity_bitwise(word))
+                                {
+                                    break;
+                                }
+                        }
+                }
+            const bool expected = gps_parity_bitwise(word);
+            n_valid += expected ? 1 : 0;
+            ASSERT_EQ(gps_lnav_word_parity_check(word), expected) << std::hex << word;
+        }
+    EXPECT_GT(n_valid, 10000);
+}
+
+
+TEST(GnssCrcTest, GlonassHammingCode)
+{
+    // strings from GlonassCrcTest
+    EXPECT_TRUE(glonass_gnav_hamming_check(Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>(std::string("0000100000111001001001000011101010101100010101001000001001011101010101110011110110101"))));
+    EXPECT_TRUE(glonass_gnav_hamming_check(Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>(std::string("0000100000111001001011000011101010101100010101001000001001011101010101110011100001010"))));
+    EXPECT_FALSE(glonass_gnav_hamming_check(Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>(std::string("0000100000111001001001000011101010101100010101001000001001011101010101110011100001010"))));
+
+    std::default_random_engine e(3333);
+    std::uniform_int_distribution<int> bit_dist(0, 1);
+    for (int32_t n = 0; n < 10000; n++)
+        {
+            std::string string_bits(GLONASS_GNAV_STRING_BITS, '0');
+            for (auto& c : string_bits)
+                {
+                    c = bit_dist(e) ? '1' : '0';
+                }
+            ASSERT_EQ(glonass_gnav_hamming_check(Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>(string_bits)), glonass_hamming_bitwise(std::bitset<GLONASS_GNAV_STRING_BITS>(string_bits))) << string_bits;
+        }
+
+    // double errors in the data bits are rejected
+    const std::string valid("0000100000111001001001000011101010101100010101001000001001011101010101110011110110101");
+    for (size_t i = 0; i < GLONASS_GNAV_STRING_BITS - 8; i++)
+        {
+            std::string corrupted = valid;
+            corrupted[i] = corrupted[i] == '1' ? '0' : '1';
+            std::string double_error = corrupted;
+            const size_t j = (i + 13) % (GLONASS_GNAV_STRING_BITS - 8);
+            double_error[j] = double_error[j] == '1' ? '0' : '1';
+            EXPECT_FALSE(glonass_gnav_hamming_check(Nav_Message_Bits<GLONASS_GNAV_STRING_BITS>(double_error))) << "bits " << i << ", " << j;
+        }
+}
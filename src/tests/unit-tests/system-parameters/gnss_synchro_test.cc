@@ -0,0 +1,93 @@
+/*!
+ * \file gnss_synchro_test.cc
+ * \brief Tests for the memory layout of the Gnss_Synchro class
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro.h"
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+
+TEST(GnssSynchroTest, TriviallyCopyable)
+{
+    EXPECT_TRUE(std::is_trivially_copyable<Gnss_Synchro>::value);
+    EXPECT_TRUE(std::is_standard_layout<Gnss_Synchro>::value);
+
+    Gnss_Synchro gnss_synchro;
+    gnss_synchro.Tracking_sample_counter = 123456789012ULL;
+    gnss_synchro.Pseudorange_m = 21000000.123;
+    gnss_synchro.Flag_valid_pseudorange = true;
+    gnss_synchro.PRN = 17;
+    gnss_synchro.System = 'E';
+    std::memcpy(gnss_synchro.Signal, "1B", 3);
+    gnss_synchro.Acq_doppler_step = 250;
+
+    // a copy as a block of memory keeps all the members
+    Gnss_Synchro copy;
+    std::memcpy(static_cast<void*>(&copy), &gnss_synchro, sizeof(Gnss_Synchro));
+    EXPECT_EQ(copy.Tracking_sample_counter, 123456789012ULL);
+    EXPECT_DOUBLE_EQ(copy.Pseudorange_m, 21000000.123);
+    EXPECT_TRUE(copy.Flag_valid_pseudorange);
+    EXPECT_EQ(copy.PRN, 17U);
+    EXPECT_EQ(copy.System, 'E');
+    EXPECT_STREQ(copy.Signal, "1B");
+    EXPECT_EQ(copy.Acq_doppler_step, 250U);
+}
+
+
+TEST(GnssSynchroTest, NoPaddingHoles)
+{
+    // each member starts where the previous one ends
+#define EXPECT_FOLLOWS(member, previous) \
+    EXPECT_EQ(offsetof(Gnss_Synchro, member), offsetof(Gnss_Synchro, previous) + sizeof(Gnss_Synchro::previous)) << #member
+
+    EXPECT_EQ(offsetof(Gnss_Synchro, Tracking_sample_counter), 0U);
+    EXPECT_FOLLOWS(fs, Tracking_sample_counter);
+    EXPECT_FOLLOWS(Carrier_Doppler_hz, fs);
+    EXPECT_FOLLOWS(Carrier_phase_rads, Carrier_Doppler_hz);
+    EXPECT_FOLLOWS(Code_phase_samples, Carrier_phase_rads);
+    EXPECT_FOLLOWS(Pseudorange_m, Code_phase_samples);
+    EXPECT_FOLLOWS(RX_time, Pseudorange_m);
+    EXPECT_FOLLOWS(TOW_at_current_symbol_ms, RX_time);
+    EXPECT_FOLLOWS(Flag_valid_acquisition, TOW_at_current_symbol_ms);
+    EXPECT_FOLLOWS(Flag_valid_symbol_output, Flag_valid_acquisition);
+    EXPECT_FOLLOWS(Flag_valid_word, Flag_valid_symbol_output);
+    EXPECT_FOLLOWS(Flag_valid_pseudorange, Flag_valid_word);
+    EXPECT_FOLLOWS(interp_TOW_ms, Flag_valid_pseudorange);
+    EXPECT_FOLLOWS(Prompt_I, interp_TOW_ms);
+    EXPECT_FOLLOWS(Prompt_Q, Prompt_I);
+    EXPECT_FOLLOWS(CN0_dB_hz, Prompt_Q);
+    EXPECT_FOLLOWS(correlation_length_ms, CN0_dB_hz);
+    EXPECT_FOLLOWS(PRN, correlation_length_ms);
+    EXPECT_FOLLOWS(Channel_ID, PRN);
+    EXPECT_FOLLOWS(System, Channel_ID);
+    EXPECT_FOLLOWS(Signal, System);
+    EXPECT_FOLLOWS(Acq_delay_samples, Signal);
+    EXPECT_FOLLOWS(Acq_doppler_hz, Acq_delay_samples);
+    EXPECT_FOLLOWS(Acq_samplestamp_samples, Acq_doppler_hz);
+    EXPECT_FOLLOWS(Acq_doppler_step, Acq_samplestamp_samples);
+#undef EXPECT_FOLLOWS
+
+    // only the padding at the end, up to the alignment of the class
+    const size_t end = offsetof(Gnss_Synchro, Acq_doppler_step) + sizeof(Gnss_Synchro::Acq_doppler_step);
+    EXPECT_GE(sizeof(Gnss_Synchro), end);
+    EXPECT_LT(sizeof(Gnss_Synchro), end + alignof(Gnss_Synchro));
+
+    // the members read at every epoch come first
+    EXPECT_LE(offsetof(Gnss_Synchro, Flag_valid_pseudorange) + sizeof(bool), 64U);
+}
@@ -0,0 +1,236 @@
+/*!
+ * \file nav_bit_field_test.cc
+ * \brief Tests for the extraction of navigation message fields from bits
+ * packed in 64-bit words, against the bit by bit reads of a std::bitset
+ * formerly done by the navigation message parsers
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "Beidou_DNAV.h"
+#include "GLONASS_L1_L2_CA.h"
+#include "GPS_L1_CA.h"
+#include "Galileo_E1.h"
+#include "nav_bit_field.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+template <size_t N>
+std::string random_bit_string(std::default_random_engine& e)
+{
+    std::uniform_int_distribution<int> bit_dist(0, 1);
+    std::string bits(N, '0');
+    for (auto& c : bits)
+        {
+            c = bit_dist(e) ? '1' : '0';
+        }
+    return bits;
+}
+
+
+template <size_t N>
+uint64_t bitset_unsigned(const std::bitset<N>& bits, const Nav_Bit_Field& field)
+{
+    uint64_t value = 0ULL;
+    for (int32_t i = 0; i < field.num_slices(); i++)
+        {
+            for (int32_t j = 0; j < field.slice(i).length; j++)
+                {
+                    value <<= 1U;
+                    if (bits[N - field.slice(i).first - j] == 1)
+                        {
+                            value += 1ULL;
+                        }
+                }
+        }
+    return value;
+}
+
+
+template <size_t N>
+int64_t bitset_signed(const std::bitset<N>& bits, const Nav_Bit_Field& field)
+{
+    int64_t value = bits[N - field.first()] == 1 ? -1LL : 0LL;
+    for (int32_t i = 0; i < field.num_slices(); i++)
+        {
+            for (int32_t j = 0; j < field.slice(i).length; j++)
+                {
+                    value *= 2;
+                    value &= 0xFFFFFFFFFFFFFFFE;
+                    if (bits[N - field.slice(i).first - j] == 1)
+                        {
+                            value += 1;
+                        }
+                }
+        }
+    return value;
+}
+
+
+template <size_t N>
+int64_t bitset_sign_magnitude(const std::bitset<N>& bits, const Nav_Bit_Field& field)
+{
+    int64_t value = 0LL;
+    const int64_t sign = bits[N - field.first()] == 1 ? -1LL : 1LL;
+    for (int32_t i = 0; i < field.num_slices(); i++)
+        {
+            for (int32_t j = 1; j < field.slice(i).length; j++)
+                {
+                    value <<= 1;
+                    if (bits[N - field.slice(i).first - j] == 1)
+                        {
+                            value += 1LL;
+                        }
+                }
+        }
+    return sign * value;
+}
+}  // namespace
+
+
+TEST(NavBitFieldTest, ConstantDescriptors)
+{
+    // BeiDou D1 seconds of week are split in two slices
+    static_assert(D1_SOW.num_slices() == 2, "D1_SOW has two slices");
+    static_assert(D1_SOW.first() == 19, "D1_SOW starts at bit 19");
+    static_assert(D1_SOW.length() == 20, "D1_SOW is 20 bits long");
+    EXPECT_EQ(D1_SOW.slice(1).first, 31);
+    EXPECT_EQ(D1_SOW.slice(1).length, 12);
+}
+
+
+TEST(NavBitFieldTest, ReadsMatchBitset)
+{
+    std::default_random_engine e(1234);
+    const std::vector<Nav_Bit_Field> gps_fields{TOW, GPS_WEEK, T_GD, IODC, A_F0, C_RS, DELTA_N, M_0, ECCENTRICITY, SQRT_A, OMEGA_0, I_0, OMEGA_DOT, I_DOT, ALPHA_1, A_0};
+    const std::vector<Nav_Bit_Field> galileo_fields{IOD_NAV_1_BIT, T0_E_1_BIT, M0_1_BIT, E_1_BIT, A_1_BIT, OMEGA_0_2_BIT, I_0_2_BIT, OMEGA_2_BIT, I_DOT_2_BIT, OMEGA_DOT_3_BIT, DELTA_N_3_BIT, C_UC_3_BIT};
+    const std::vector<Nav_Bit_Field> beidou_fields{D1_SOW, D1_TOC, D1_TGD1, D1_ALPHA2, D1_A0, D1_A1, D1_DELTA_N, D1_CUC, D1_M0, D1_E, D1_SQRT_A, D1_I0, D1_OMEGA_DOT};
+    const std::vector<Nav_Bit_Field> glonass_fields{X_N, X_N_DOT, X_N_DOT_DOT, Y_N, Z_N, GAMMA_N, TAU_N, DELTA_TAU_N, TAU_C, TAU_GPS, LAMBDA_N_A, DELTA_I_N_A, EPSILON_N_A};
+    for (int32_t n = 0; n < 100; n++)
+        {
+            const std::string gps_string = random_bit_string<GPS_SUBFRAME_BITS>(e);
+            const std::bitset<GPS_SUBFRAME_BITS> gps_bitset(gps_string);
+            const Nav_Message_Bits<GPS_SUBFRAME_BITS> gps_bits(gps_bitset);
+            const Nav_Message_Bits<GPS_SUBFRAME_BITS> gps_bits_from_string(gps_string);
+            for (const auto& field : gps_fields)
+                {
+                    ASSERT_EQ(gps_bits.read_unsigned(field), bitset_unsigned(gps_bitset, field));
+                    ASSERT_EQ(gps_bits.read_signed(field), bitset_signed(gps_bitset, field));
+                    ASSERT_EQ(gps_bits_from_string.read_signed(field), bitset_signed(gps_bitset, field));
+                    ASSERT_EQ(gps_bits.read_bool(field), gps_bitset[GPS_SUBFRAME_BITS - field.first()] == 1);
+                }
+
+            const std::bitset<GALILEO_DATA_JK_BITS> galileo_bitset(random_bit_string<GALILEO_DATA_JK_BITS>(e));
+            const Nav_Message_Bits<GALILEO_DATA_JK_BITS> galileo_bits(galileo_bitset);
+            for (const auto& field : galileo_fields)
+                {
+                    ASSERT_EQ(galileo_bits.read_unsigned(field), bitset_unsigned(galileo_bitset, field));
+                    ASSERT_EQ(galileo_bits.read_signed(field), bitset_signed(galileo_bitset, field));
+                }
+
+            const std::bitset<BEIDOU_DNAV_SUBFRAME_DATA_BITS> beidou_bitset(random_bit_string<BEIDOU_DNAV_SUBFRAME_DATA_BITS>(e));
+            const Nav_Message_Bits<BEIDOU_DNAV_SUBFRAME_DATA_BITS> beidou_bits(beidou_bitset);
+            for (const auto& field : beidou_fields)
+                {
+                    ASSERT_EQ(beidou_bits.read_unsigned(field), bitset_unsigned(beidou_bitset, field));
+                    ASSERT_EQ(beidou_bits.read_signed(field), bitset_signed(beidou_bitset, field));
+                }
+
+            const std::bitset<GLONASS_GNAV_STRING_BITS> glonass_bitset(random_bit_string<GLONASS_GNAV_STRING_BITS>(e));
+            const Nav_Message_Bits<GLONASS_GNAV_STRING_BITS> glonass_bits(glonass_bitset);
+            for (const auto& field : glonass_fields)
+                {
+                    ASSERT_EQ(glonass_bits.read_unsigned(field), bitset_unsigned(glonass_bitset, field));
+                    ASSERT_EQ(glonass_bits.read_sign_magnitude(field), bitset_sign_magnitude(glonass_bitset, field));
+                }
+        }
+}
+
+
+TEST(NavBitFieldTest, InsertWords)
+{
+    // GPS L1 C/A subframes are assembled from 30-bit words
+    Nav_Message_Bits<GPS_SUBFRAME_BITS> bits;
+    std::string expected;
+    for (int32_t i = 0; i < 10; i++)
+        {
+            const uint32_t word = 0x2A5A5A5AU ^ (static_cast<uint32_t>(i) * 0x01234567U);
+            bits.insert(GPS_WORD_BITS * i + 1, GPS_WORD_BITS, word & 0x3FFFFFFFU);
+            expected += std::bitset<GPS_WORD_BITS>(word).to_string();
+        }
+    const Nav_Message_Bits<GPS_SUBFRAME_BITS> from_string(expected);
+    for (int32_t p = 1; p <= GPS_SUBFRAME_BITS; p++)
+        {
+            ASSERT_EQ(bits.test(p), expected[p - 1] == '1') << "bit " << p;
+            ASSERT_EQ(from_string.test(p), expected[p - 1] == '1') << "bit " << p;
+        }
+
+    // shorter strings are aligned to the end, as with std::bitset
+    const std::bitset<GPS_SUBFRAME_BITS> short_bitset(std::string("1011"));
+    const Nav_Message_Bits<GPS_SUBFRAME_BITS> short_bits(std::string("1011"));
+    EXPECT_EQ(short_bits.extract(GPS_SUBFRAME_BITS - 3, 4), 11ULL);
+    EXPECT_EQ(short_bits.read_unsigned(Nav_Bit_Field{{GPS_SUBFRAME_BITS - 63, 64}}), bitset_unsigned(short_bitset, Nav_Bit_Field{{GPS_SUBFRAME_BITS - 63, 64}}));
+}
+
+
+TEST(NavBitFieldTest, OverwriteAndCopyBits)
+{
+    std::default_random_engine e(5678);
+    std::uniform_int_distribution<int32_t> first_dist(1, GPS_SUBFRAME_BITS);
+    std::uniform_int_distribution<int32_t> length_dist(1, 64);
+    std::uniform_int_distribution<uint64_t> value_dist;
+    std::string expected = random_bit_string<GPS_SUBFRAME_BITS>(e);
+    Nav_Message_Bits<GPS_SUBFRAME_BITS> bits(expected);
+    for (int32_t n = 0; n < 2000; n++)
+        {
+            const int32_t first = first_dist(e);
+            const int32_t length = std::min(length_dist(e), GPS_SUBFRAME_BITS - first + 1);
+            const uint64_t value = value_dist(e);
+            bits.insert(first, length, value);
+            for (int32_t j = 0; j < length; j++)
+                {
+                    expected[first - 1 + j] = ((value >> static_cast<uint32_t>(length - 1 - j)) & 1ULL) ? '1' : '0';
+                }
+            ASSERT_EQ(bits.extract(first, length), length < 64 ? (value & ((1ULL << static_cast<uint32_t>(length)) - 1ULL)) : value);
+        }
+    for (int32_t p = 1; p <= GPS_SUBFRAME_BITS; p++)
+        {
+            ASSERT_EQ(bits.test(p), expected[p - 1] == '1') << "bit " << p;
+        }
+
+    // Galileo I/NAV Data_k and Data_j joined as in the page parser
+    const std::string page = random_bit_string<GALILEO_INAV_PAGE_BITS>(e);
+    const Nav_Message_Bits<GALILEO_INAV_PAGE_BITS> page_bits(page);
+    Nav_Message_Bits<GALILEO_DATA_JK_BITS> data_jk_bits;
+    data_jk_bits.insert(1, page_bits, 3, 112);
+    data_jk_bits.insert(113, page_bits, 117, 16);
+    const std::string data_jk = page.substr(2, 112) + page.substr(116, 16);
+    for (int32_t p = 1; p <= GALILEO_DATA_JK_BITS; p++)
+        {
+            ASSERT_EQ(data_jk_bits.test(p), data_jk[p - 1] == '1') << "bit " << p;
+        }
+
+    data_jk_bits.set(1, false);
+    data_jk_bits.set(GALILEO_DATA_JK_BITS);
+    EXPECT_FALSE(data_jk_bits.test(1));
+    EXPECT_TRUE(data_jk_bits.test(GALILEO_DATA_JK_BITS));
+}